@@ -0,0 +1,40 @@
+#!/bin/bash
+
+# Compares the dust masking of bin/gt with the masking of a reference
+# version of gt (e.g. a build of an earlier revision) on a genome: the
+# running times of both are shown and the masked sequences must be
+# identical.
+
+set -e
+
+if test $# -lt 2
+then
+  echo "Usage: $0 <reference gt> <genome file> [dust options]"
+  echo "e.g. $0 /usr/local/bin/gt hg38.fa -dustlink 5"
+  exit 1
+fi
+
+REFGT=$1
+inputfile=$2
+shift
+shift
+
+TMPFILE1=`mktemp DUSTREF.XXXXXX` || exit 1
+TMPFILE2=`mktemp DUSTNEW.XXXXXX` || exit 1
+echo "# reference: ${REFGT}"
+time ${REFGT} encseq encode -dust -dustecho $* -indexname ${TMPFILE1}.idx \
+                            ${inputfile} > ${TMPFILE1}
+echo "# bin/gt"
+time bin/gt encseq encode -dust -dustecho $* -indexname ${TMPFILE2}.idx \
+                          ${inputfile} > ${TMPFILE2}
+if cmp -s ${TMPFILE1} ${TMPFILE2} && \
+   cmp -s ${TMPFILE1}.idx.esq ${TMPFILE2}.idx.esq
+then
+  echo "# masks are identical"
+  status=0
+else
+  echo "# masks differ"
+  status=1
+fi
+rm -f ${TMPFILE1} ${TMPFILE2} ${TMPFILE1}.idx.* ${TMPFILE2}.idx.*
+exit ${status}
@@ -65,6 +65,9 @@ display_options = [
   ["gfa2",        "output matches in gfa2 format"],
   ["custom",      "output matches in custom format, i.e. no columns are " +
                   "pre-defined; all columns have to be specified by the user"],
+  ["binary",      "output matches as fixed size binary records, including " +
+                  "the edit operations if cigar, cigarX, trace or dtrace is " +
+                  "requested; use gt dev show_seedext to convert them"],
   ["cigar",       "display cigar string representing alignment " +
                   "(no distinction between match and mismatch)"],
   ["cigarX",      "display cigar string representing alignment " +
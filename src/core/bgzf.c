@@ -0,0 +1,731 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "core/assert_api.h"
+#include "core/bgzf.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/ma_api.h"
+#include "core/multithread_api.h"
+#include "core/str_api.h"
+#include "core/xansi_api.h"
+
+/* maximal size of a compressed block (including header and footer) */
+#define GT_BGZF_MAX_BLOCK_SIZE    65536U
+/* amount of uncompressed data stored in a block by the writer, chosen such that
+   even incompressible data fits into a single block */
+#define GT_BGZF_BLOCK_DATA_SIZE   65280U
+#define GT_BGZF_HEADER_SIZE       18U
+#define GT_BGZF_FOOTER_SIZE       8U
+/* number of blocks processed in one parallel round per thread */
+#define GT_BGZF_BLOCKS_PER_JOB    4U
+
+static const unsigned char bgzf_header[GT_BGZF_HEADER_SIZE] = {
+  31, 139, 8, 4, 0, 0, 0, 0, 0, 255, 6, 0, 'B', 'C', 2, 0, 0, 0
+};
+
+static const unsigned char bgzf_eof_block[28] = {
+  31, 139, 8, 4, 0, 0, 0, 0, 0, 255, 6, 0, 'B', 'C', 2, 0, 27, 0, 3, 0, 0, 0,
+  0, 0, 0, 0, 0, 0
+};
+
+typedef struct {
+  unsigned char *cdata, /* compressed block including header and footer */
+                *udata; /* uncompressed data */
+  unsigned int clength,
+               ulength;
+} GtBGZFBlock;
+
+struct GtBGZF {
+  FILE *fp;
+  bool is_writer,
+       eof;
+  int level;
+  GtBGZFBlock *blocks;
+  unsigned int numofblocks,
+               loaded,   /* number of blocks filled in the current round */
+               current,  /* block currently read from */
+               position, /* position in uncompressed data of current block */
+               readahead; /* number of blocks to load in the next round */
+  /* block index: compressed and uncompressed start offsets of all blocks */
+  GtUint64 *coffsets,
+           *uoffsets;
+  GtUword indexsize;
+  /* shared state of the worker threads */
+  GtMutex *mutex;
+  unsigned int nextblock;
+  bool failed;
+};
+
+static unsigned int bgzf_get16(const unsigned char *buf)
+{
+  return (unsigned int) buf[0] | ((unsigned int) buf[1] << 8);
+}
+
+static GtUint64 bgzf_get32(const unsigned char *buf)
+{
+  return (GtUint64) bgzf_get16(buf) | ((GtUint64) bgzf_get16(buf + 2) << 16);
+}
+
+static void bgzf_put32(unsigned char *buf, GtUint64 value)
+{
+  buf[0] = (unsigned char) (value & 0xff);
+  buf[1] = (unsigned char) ((value >> 8) & 0xff);
+  buf[2] = (unsigned char) ((value >> 16) & 0xff);
+  buf[3] = (unsigned char) ((value >> 24) & 0xff);
+}
+
+/* returns the total size of the block whose header is stored in <header>, or 0
+   if <header> is not a valid BGZF header */
+static unsigned int bgzf_block_size(const unsigned char *header)
+{
+  if (header[0] != 31 || header[1] != 139 || header[2] != 8 ||
+      !(header[3] & 4) || bgzf_get16(header + 10) != 6 ||
+      header[12] != 'B' || header[13] != 'C' || bgzf_get16(header + 14) != 2) {
+    return 0;
+  }
+  return bgzf_get16(header + 16) + 1;
+}
+
+bool gt_bgzf_is_bgzf(FILE *fp)
+{
+  unsigned char header[GT_BGZF_HEADER_SIZE];
+  size_t len;
+  long pos;
+  gt_assert(fp);
+  pos = ftell(fp);
+  len = fread(header, 1, sizeof header, fp);
+  gt_xfseek(fp, pos, SEEK_SET);
+  return len == sizeof header && bgzf_block_size(header) > 0;
+}
+
+static GtBGZF* bgzf_new(FILE *fp, bool is_writer)
+{
+  GtBGZF *bgzf;
+  unsigned int i;
+  gt_assert(fp);
+  bgzf = gt_calloc((size_t) 1, sizeof *bgzf);
+  bgzf->fp = fp;
+  bgzf->is_writer = is_writer;
+  bgzf->numofblocks = bgzf->readahead = GT_BGZF_BLOCKS_PER_JOB * gt_jobs;
+  bgzf->blocks = gt_malloc(sizeof *bgzf->blocks * bgzf->numofblocks);
+  for (i = 0; i < bgzf->numofblocks; i++) {
+    bgzf->blocks[i].cdata = gt_malloc(sizeof (unsigned char) *
+                                      GT_BGZF_MAX_BLOCK_SIZE);
+    bgzf->blocks[i].udata = gt_malloc(sizeof (unsigned char) *
+                                      GT_BGZF_MAX_BLOCK_SIZE);
+    bgzf->blocks[i].clength = bgzf->blocks[i].ulength = 0;
+  }
+  bgzf->mutex = gt_mutex_new();
+  return bgzf;
+}
+
+GtBGZF* gt_bgzf_new_reader(FILE *fp)
+{
+  return bgzf_new(fp, false);
+}
+
+GtBGZF* gt_bgzf_new_writer(FILE *fp, int level)
+{
+  GtBGZF *bgzf = bgzf_new(fp, true);
+  bgzf->level = level;
+  return bgzf;
+}
+
+bool gt_bgzf_is_writer(const GtBGZF *bgzf)
+{
+  gt_assert(bgzf);
+  return bgzf->is_writer;
+}
+
+/* the worker threads fetch the index of the next block to process */
+static bool bgzf_next_job(GtBGZF *bgzf, unsigned int *blocknum)
+{
+  bool has_job = false;
+  gt_mutex_lock(bgzf->mutex);
+  if (bgzf->nextblock < bgzf->loaded) {
+    *blocknum = bgzf->nextblock++;
+    has_job = true;
+  }
+  gt_mutex_unlock(bgzf->mutex);
+  return has_job;
+}
+
+static void bgzf_set_failed(GtBGZF *bgzf)
+{
+  gt_mutex_lock(bgzf->mutex);
+  bgzf->failed = true;
+  gt_mutex_unlock(bgzf->mutex);
+}
+
+static bool bgzf_inflate_block(GtBGZFBlock *block)
+{
+  z_stream zs;
+  unsigned int extralen, isize;
+  bool ok;
+  extralen = bgzf_get16(block->cdata + 10);
+  isize = (unsigned int) bgzf_get32(block->cdata + block->clength - 4);
+  if (isize > GT_BGZF_MAX_BLOCK_SIZE)
+    return false;
+  memset(&zs, 0, sizeof zs);
+  if (inflateInit2(&zs, -15) != Z_OK)
+    return false;
+  zs.next_in = block->cdata + 12 + extralen;
+  zs.avail_in = block->clength - 12 - extralen - GT_BGZF_FOOTER_SIZE;
+  zs.next_out = block->udata;
+  zs.avail_out = GT_BGZF_MAX_BLOCK_SIZE;
+  ok = inflate(&zs, Z_FINISH) == Z_STREAM_END && zs.total_out == isize;
+  (void) inflateEnd(&zs);
+  block->ulength = isize;
+  return ok && crc32(crc32(0L, Z_NULL, 0), block->udata, isize)
+                 == bgzf_get32(block->cdata + block->clength - 8);
+}
+
+static bool bgzf_deflate_block(GtBGZFBlock *block, int level)
+{
+  z_stream zs;
+  bool ok;
+  memset(&zs, 0, sizeof zs);
+  if (deflateInit2(&zs, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    return false;
+  zs.next_in = block->udata;
+  zs.avail_in = block->ulength;
+  zs.next_out = block->cdata + GT_BGZF_HEADER_SIZE;
+  zs.avail_out = GT_BGZF_MAX_BLOCK_SIZE - GT_BGZF_HEADER_SIZE
+                 - GT_BGZF_FOOTER_SIZE;
+  ok = deflate(&zs, Z_FINISH) == Z_STREAM_END;
+  (void) deflateEnd(&zs);
+  if (!ok)
+    return false;
+  block->clength = GT_BGZF_HEADER_SIZE + (unsigned int) zs.total_out
+                   + GT_BGZF_FOOTER_SIZE;
+  memcpy(block->cdata, bgzf_header, sizeof bgzf_header);
+  block->cdata[16] = (unsigned char) ((block->clength - 1) & 0xff);
+  block->cdata[17] = (unsigned char) ((block->clength - 1) >> 8);
+  bgzf_put32(block->cdata + block->clength - 8,
+             crc32(crc32(0L, Z_NULL, 0), block->udata, block->ulength));
+  bgzf_put32(block->cdata + block->clength - 4, block->ulength);
+  return true;
+}
+
+static void* bgzf_process_blocks_thread(void *data)
+{
+  GtBGZF *bgzf = data;
+  unsigned int blocknum;
+  bool ok;
+  while (bgzf_next_job(bgzf, &blocknum)) {
+    if (bgzf->is_writer)
+      ok = bgzf_deflate_block(bgzf->blocks + blocknum, bgzf->level);
+    else
+      ok = bgzf_inflate_block(bgzf->blocks + blocknum);
+    if (!ok)
+      bgzf_set_failed(bgzf);
+  }
+  return NULL;
+}
+
+/* (de)compress the first <bgzf->loaded> blocks in parallel */
+static int bgzf_process_blocks(GtBGZF *bgzf, GtError *err)
+{
+  bgzf->nextblock = 0;
+  bgzf->failed = false;
+  if (bgzf->loaded == 1U)
+    (void) bgzf_process_blocks_thread(bgzf);
+  else if (gt_multithread(bgzf_process_blocks_thread, bgzf, err) != 0)
+    return -1;
+  if (bgzf->failed) {
+    gt_error_set(err, "cannot %s BGZF block: data corrupted",
+                 bgzf->is_writer ? "compress" : "decompress");
+    return -1;
+  }
+  return 0;
+}
+
+/* read the next round of compressed blocks and decompress them, returns 1 if
+   blocks were loaded, 0 if the end of the file has been reached, and -1 on
+   error */
+static int bgzf_load_blocks(GtBGZF *bgzf, GtError *err)
+{
+  GtBGZFBlock *block;
+  unsigned int blocksize;
+  size_t len;
+  int had_err = 0;
+  gt_assert(!bgzf->is_writer);
+  bgzf->loaded = bgzf->current = bgzf->position = 0;
+  while (!had_err && !bgzf->eof && bgzf->loaded < bgzf->readahead) {
+    block = bgzf->blocks + bgzf->loaded;
+    len = fread(block->cdata, 1, GT_BGZF_HEADER_SIZE, bgzf->fp);
+    if (len == 0) {
+      if (ferror(bgzf->fp)) {
+        gt_error_set(err, "cannot read BGZF block: %s", strerror(errno));
+        had_err = -1;
+      }
+      bgzf->eof = true;
+      break;
+    }
+    if (len < GT_BGZF_HEADER_SIZE ||
+        !(blocksize = bgzf_block_size(block->cdata)) ||
+        blocksize < GT_BGZF_HEADER_SIZE + GT_BGZF_FOOTER_SIZE) {
+      gt_error_set(err, "cannot read BGZF block: invalid block header");
+      had_err = -1;
+    }
+    else if (fread(block->cdata + GT_BGZF_HEADER_SIZE, 1,
+                   blocksize - GT_BGZF_HEADER_SIZE, bgzf->fp)
+               != blocksize - GT_BGZF_HEADER_SIZE) {
+      gt_error_set(err, "cannot read BGZF block: unexpected end of file");
+      had_err = -1;
+    }
+    else {
+      block->clength = blocksize;
+      bgzf->loaded++;
+    }
+  }
+  if (!had_err && bgzf->loaded > 0)
+    had_err = bgzf_process_blocks(bgzf, err);
+  if (had_err) {
+    /* do not hand out data of a partially processed round */
+    bgzf->loaded = 0;
+    return -1;
+  }
+  /* after a seek only few blocks are read, increase the amount again */
+  if (bgzf->readahead < bgzf->numofblocks) {
+    bgzf->readahead *= 2;
+    if (bgzf->readahead > bgzf->numofblocks)
+      bgzf->readahead = bgzf->numofblocks;
+  }
+  return bgzf->loaded > 0 ? 1 : 0;
+}
+
+/* make sure that the current block has unread data, returns 1 if so, 0 on EOF
+   and -1 on error */
+static int bgzf_fill(GtBGZF *bgzf, GtError *err)
+{
+  int rval;
+  while (bgzf->current >= bgzf->loaded ||
+         bgzf->position == bgzf->blocks[bgzf->current].ulength) {
+    if (bgzf->current + 1 < bgzf->loaded) {
+      bgzf->current++;
+      bgzf->position = 0;
+    }
+    else if ((rval = bgzf_load_blocks(bgzf, err)) != 1)
+      return rval;
+  }
+  return 1;
+}
+
+int gt_bgzf_fgetc(GtBGZF *bgzf, int *c, GtError *err)
+{
+  int rval;
+  gt_error_check(err);
+  gt_assert(bgzf && !bgzf->is_writer && c);
+  if (bgzf->current < bgzf->loaded &&
+      bgzf->position < bgzf->blocks[bgzf->current].ulength) {
+    *c = bgzf->blocks[bgzf->current].udata[bgzf->position++];
+    return 1;
+  }
+  if ((rval = bgzf_fill(bgzf, err)) == 1)
+    *c = bgzf->blocks[bgzf->current].udata[bgzf->position++];
+  return rval;
+}
+
+int gt_bgzf_read(GtBGZF *bgzf, void *buf, size_t nbytes, GtError *err)
+{
+  GtBGZFBlock *block;
+  size_t nread = 0, len;
+  int rval = 1;
+  gt_error_check(err);
+  gt_assert(bgzf && !bgzf->is_writer && buf);
+  while (nread < nbytes && (rval = bgzf_fill(bgzf, err)) == 1) {
+    block = bgzf->blocks + bgzf->current;
+    len = block->ulength - bgzf->position;
+    if (len > nbytes - nread)
+      len = nbytes - nread;
+    memcpy((unsigned char*) buf + nread, block->udata + bgzf->position, len);
+    bgzf->position += (unsigned int) len;
+    nread += len;
+  }
+  return rval == -1 ? -1 : (int) nread;
+}
+
+static int bgzf_fwrite(const void *buf, size_t nbytes, FILE *fp,
+                       GtError *err)
+{
+  if (fwrite(buf, 1, nbytes, fp) != nbytes) {
+    gt_error_set(err, "cannot write BGZF block: %s", strerror(errno));
+    return -1;
+  }
+  return 0;
+}
+
+/* compress all buffered blocks and write them in order */
+static int bgzf_write_blocks(GtBGZF *bgzf, GtError *err)
+{
+  unsigned int i;
+  int had_err = 0;
+  gt_assert(bgzf->is_writer);
+  if (bgzf->current < bgzf->numofblocks &&
+      bgzf->blocks[bgzf->current].ulength > 0) {
+    bgzf->current++;
+  }
+  bgzf->loaded = bgzf->current;
+  if (bgzf->loaded > 0) {
+    had_err = bgzf_process_blocks(bgzf, err);
+    for (i = 0; !had_err && i < bgzf->loaded; i++) {
+      had_err = bgzf_fwrite(bgzf->blocks[i].cdata,
+                            (size_t) bgzf->blocks[i].clength, bgzf->fp, err);
+    }
+    for (i = 0; i < bgzf->loaded; i++)
+      bgzf->blocks[i].ulength = 0;
+  }
+  bgzf->loaded = bgzf->current = 0;
+  return had_err;
+}
+
+int gt_bgzf_write(GtBGZF *bgzf, const void *buf, size_t nbytes, GtError *err)
+{
+  GtBGZFBlock *block;
+  size_t written = 0, len;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(bgzf && bgzf->is_writer && buf);
+  while (!had_err && written < nbytes) {
+    block = bgzf->blocks + bgzf->current;
+    len = GT_BGZF_BLOCK_DATA_SIZE - block->ulength;
+    if (len > nbytes - written)
+      len = nbytes - written;
+    memcpy(block->udata + block->ulength,
+           (const unsigned char*) buf + written, len);
+    block->ulength += (unsigned int) len;
+    written += len;
+    if (block->ulength == GT_BGZF_BLOCK_DATA_SIZE &&
+        ++bgzf->current == bgzf->numofblocks) {
+      had_err = bgzf_write_blocks(bgzf, err);
+    }
+  }
+  return had_err;
+}
+
+int gt_bgzf_finish(GtBGZF *bgzf, GtError *err)
+{
+  int had_err;
+  gt_error_check(err);
+  gt_assert(bgzf && bgzf->is_writer);
+  had_err = bgzf_write_blocks(bgzf, err);
+  if (!had_err)
+    had_err = bgzf_fwrite(bgzf_eof_block, sizeof bgzf_eof_block, bgzf->fp,
+                          err);
+  if (!had_err && fflush(bgzf->fp) != 0) {
+    gt_error_set(err, "cannot write BGZF block: %s", strerror(errno));
+    had_err = -1;
+  }
+  return had_err;
+}
+
+void gt_bgzf_rewind(GtBGZF *bgzf)
+{
+  gt_assert(bgzf && !bgzf->is_writer);
+  rewind(bgzf->fp);
+  bgzf->eof = false;
+  bgzf->loaded = bgzf->current = bgzf->position = 0;
+  bgzf->readahead = bgzf->numofblocks;
+}
+
+static void bgzf_index_add(GtBGZF *bgzf, GtUword *allocated,
+                           GtUint64 coffset, GtUint64 uoffset)
+{
+  if (bgzf->indexsize == *allocated) {
+    *allocated = *allocated * 2 + 16;
+    bgzf->coffsets = gt_realloc(bgzf->coffsets,
+                                sizeof *bgzf->coffsets * *allocated);
+    bgzf->uoffsets = gt_realloc(bgzf->uoffsets,
+                                sizeof *bgzf->uoffsets * *allocated);
+  }
+  bgzf->coffsets[bgzf->indexsize] = coffset;
+  bgzf->uoffsets[bgzf->indexsize++] = uoffset;
+}
+
+static void bgzf_index_reset(GtBGZF *bgzf)
+{
+  gt_free(bgzf->coffsets);
+  gt_free(bgzf->uoffsets);
+  bgzf->coffsets = bgzf->uoffsets = NULL;
+  bgzf->indexsize = 0;
+}
+
+int gt_bgzf_build_index(GtBGZF *bgzf, GtError *err)
+{
+  unsigned char header[GT_BGZF_HEADER_SIZE], isize[4];
+  GtUint64 coffset = 0, uoffset = 0;
+  GtUword allocated = 0;
+  unsigned int blocksize;
+  size_t len;
+  long pos;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(bgzf && !bgzf->is_writer);
+  bgzf_index_reset(bgzf);
+  pos = ftell(bgzf->fp);
+  gt_xfseek(bgzf->fp, 0, SEEK_SET);
+  /* only the headers and the ISIZE fields of the blocks have to be read */
+  while (!had_err && (len = fread(header, 1, sizeof header, bgzf->fp)) > 0) {
+    if (len < sizeof header || !(blocksize = bgzf_block_size(header)) ||
+        blocksize < GT_BGZF_HEADER_SIZE + GT_BGZF_FOOTER_SIZE) {
+      gt_error_set(err, "cannot index BGZF file: invalid block header");
+      had_err = -1;
+      break;
+    }
+    gt_xfseek(bgzf->fp, (long) (coffset + blocksize - 4), SEEK_SET);
+    if (fread(isize, 1, sizeof isize, bgzf->fp) != sizeof isize) {
+      gt_error_set(err, "cannot index BGZF file: unexpected end of file");
+      had_err = -1;
+      break;
+    }
+    bgzf_index_add(bgzf, &allocated, coffset, uoffset);
+    coffset += blocksize;
+    uoffset += bgzf_get32(isize);
+  }
+  if (!had_err && ferror(bgzf->fp)) {
+    gt_error_set(err, "cannot index BGZF file: %s", strerror(errno));
+    had_err = -1;
+  }
+  if (had_err)
+    bgzf_index_reset(bgzf);
+  clearerr(bgzf->fp);
+  gt_xfseek(bgzf->fp, pos, SEEK_SET);
+  return had_err;
+}
+bool gt_bgzf_has_index(const GtBGZF *bgzf)
+{
+  gt_assert(bgzf);
+  return bgzf->indexsize > 0;
+}
+
+static void bgzf_put64(unsigned char *buf, GtUint64 value)
+{
+  bgzf_put32(buf, value & 0xffffffffUL);
+  bgzf_put32(buf + 4, value >> 32);
+}
+
+static GtUint64 bgzf_get64(const unsigned char *buf)
+{
+  return bgzf_get32(buf) | (bgzf_get32(buf + 4) << 32);
+}
+
+/* The index is stored in the .gzi format of SAMtools: the number of entries
+   followed by pairs of compressed and uncompressed offsets, all as 64-bit
+   little endian integers. The first block is implicit. */
+int gt_bgzf_read_index(GtBGZF *bgzf, const char *path, GtError *err)
+{
+  unsigned char buf[16];
+  GtUint64 i, numofentries;
+  GtUword allocated = 0;
+  FILE *fp;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(bgzf && !bgzf->is_writer && path);
+  bgzf_index_reset(bgzf);
+  if (!(fp = gt_fa_fopen(path, "rb", err)))
+    return -1;
+  if (fread(buf, 1, 8, fp) != 8)
+    had_err = -1;
+  if (!had_err) {
+    numofentries = bgzf_get64(buf);
+    bgzf_index_add(bgzf, &allocated, 0, 0);
+    for (i = 0; !had_err && i < numofentries; i++) {
+      if (fread(buf, 1, sizeof buf, fp) != sizeof buf ||
+          bgzf_get64(buf) <= bgzf->coffsets[bgzf->indexsize-1] ||
+          bgzf_get64(buf + 8) < bgzf->uoffsets[bgzf->indexsize-1]) {
+        had_err = -1;
+      }
+      else
+        bgzf_index_add(bgzf, &allocated, bgzf_get64(buf), bgzf_get64(buf + 8));
+    }
+  }
+  if (had_err) {
+    gt_error_set(err, "BGZF index file \"%s\" is corrupt", path);
+    bgzf_index_reset(bgzf);
+  }
+  gt_fa_xfclose(fp);
+  return had_err;
+}
+
+int gt_bgzf_write_index(const GtBGZF *bgzf, const char *path, GtError *err)
+{
+  unsigned char buf[16];
+  GtUword i;
+  FILE *fp;
+  gt_error_check(err);
+  gt_assert(bgzf && bgzf->indexsize > 0 && path);
+  if (!(fp = gt_fa_fopen(path, "wb", err)))
+    return -1;
+  bgzf_put64(buf, (GtUint64) bgzf->indexsize - 1);
+  gt_xfwrite(buf, 1, 8, fp);
+  for (i = 1; i < bgzf->indexsize; i++) {
+    bgzf_put64(buf, bgzf->coffsets[i]);
+    bgzf_put64(buf + 8, bgzf->uoffsets[i]);
+    gt_xfwrite(buf, 1, sizeof buf, fp);
+  }
+  gt_fa_xfclose(fp);
+  return 0;
+}
+
+int gt_bgzf_seek(GtBGZF *bgzf, GtUint64 uoffset, GtError *err)
+{
+  GtUword left, right, mid, blocknum;
+  int rval;
+  gt_error_check(err);
+  gt_assert(bgzf && !bgzf->is_writer && bgzf->indexsize > 0);
+  /* binary search for the last block starting at or before <uoffset> */
+  left = 0;
+  right = bgzf->indexsize - 1;
+  while (left < right) {
+    mid = left + (right - left + 1) / 2;
+    if (bgzf->uoffsets[mid] <= uoffset)
+      left = mid;
+    else
+      right = mid - 1;
+  }
+  blocknum = left;
+  gt_xfseek(bgzf->fp, (long) bgzf->coffsets[blocknum], SEEK_SET);
+  bgzf->eof = false;
+  /* a seek usually precedes a short read, hence start with a single block */
+  bgzf->readahead = 1U;
+  if ((rval = bgzf_load_blocks(bgzf, err)) == 1) {
+    if (uoffset - bgzf->uoffsets[blocknum] > bgzf->blocks[0].ulength) {
+      gt_error_set(err, "cannot seek to offset " GT_LLU " of BGZF file: "
+                   "block index does not match the data",
+                   (unsigned long long) uoffset);
+      return -1;
+    }
+    bgzf->position = (unsigned int) (uoffset - bgzf->uoffsets[blocknum]);
+  }
+  return rval == -1 ? -1 : 0;
+}
+
+void gt_bgzf_delete(GtBGZF *bgzf)
+{
+  unsigned int i;
+  if (!bgzf) return;
+  gt_assert(!bgzf->is_writer || (bgzf->current == 0 &&
+                                 bgzf->blocks[0].ulength == 0));
+  for (i = 0; i < bgzf->numofblocks; i++) {
+    gt_free(bgzf->blocks[i].cdata);
+    gt_free(bgzf->blocks[i].udata);
+  }
+  gt_free(bgzf->blocks);
+  bgzf_index_reset(bgzf);
+  gt_mutex_delete(bgzf->mutex);
+  gt_free(bgzf);
+}
+
+int gt_bgzf_unit_test(GtError *err)
+{
+  GtBGZF *bgzf;
+  GtStr *tmpfilename;
+  FILE *fp;
+  unsigned char *data, *readdata;
+  size_t i, datalen = (size_t) 3 * GT_BGZF_BLOCK_DATA_SIZE * gt_jobs * 2 + 17;
+  int had_err = 0, c;
+  gt_error_check(err);
+
+  data = gt_malloc(sizeof *data * datalen);
+  readdata = gt_malloc(sizeof *readdata * datalen);
+  for (i = 0; i < datalen; i++)
+    data[i] = (unsigned char) (i % 7 == 0 ? rand() : 'a' + (i % 26));
+
+  tmpfilename = gt_str_new();
+  fp = gt_xtmpfp_generic(tmpfilename,
+                         GT_TMPFP_AUTOREMOVE | GT_TMPFP_OPENBINARY);
+  bgzf = gt_bgzf_new_writer(fp, Z_DEFAULT_COMPRESSION);
+  /* write in pieces of varying size */
+  for (i = 0; !had_err && i < datalen; i += 1000 + i % 3) {
+    had_err = gt_bgzf_write(bgzf, data + i,
+                            i + 1000 + i % 3 > datalen ? datalen - i
+                                                       : 1000 + i % 3,
+                            err);
+  }
+  if (!had_err)
+    had_err = gt_bgzf_finish(bgzf, err);
+  gt_bgzf_delete(bgzf);
+  rewind(fp);
+
+  gt_ensure(gt_bgzf_is_bgzf(fp));
+  bgzf = gt_bgzf_new_reader(fp);
+  if (!had_err) {
+    gt_ensure(gt_bgzf_read(bgzf, readdata, datalen, err) == (int) datalen);
+    gt_ensure(memcmp(data, readdata, datalen) == 0);
+    gt_ensure(gt_bgzf_fgetc(bgzf, &c, err) == 0);
+  }
+  if (!had_err) {
+    gt_bgzf_rewind(bgzf);
+    for (i = 0; !had_err && i < datalen; i++) {
+      gt_ensure(gt_bgzf_fgetc(bgzf, &c, err) == 1);
+      gt_ensure(c == (int) data[i]);
+    }
+    gt_ensure(gt_bgzf_fgetc(bgzf, &c, err) == 0);
+  }
+  if (!had_err) {
+    GtStr *indexfilename = gt_str_new();
+    FILE *indexfp;
+    GtUword j, offset, len;
+    had_err = gt_bgzf_build_index(bgzf, err);
+    gt_ensure(gt_bgzf_has_index(bgzf));
+    indexfp = gt_xtmpfp(indexfilename);
+    gt_fa_xfclose(indexfp);
+    if (!had_err)
+      had_err = gt_bgzf_write_index(bgzf, gt_str_get(indexfilename), err);
+    if (!had_err)
+      had_err = gt_bgzf_read_index(bgzf, gt_str_get(indexfilename), err);
+    gt_xremove(gt_str_get(indexfilename));
+    gt_str_delete(indexfilename);
+    /* random access, including block boundaries and the end of the data */
+    for (j = 0; !had_err && j < 100UL; j++) {
+      offset = j < 3UL ? j * GT_BGZF_BLOCK_DATA_SIZE
+                       : (GtUword) rand() % datalen;
+      len = (GtUword) rand() % 100000;
+      if (offset + len > datalen)
+        len = datalen - offset;
+      gt_ensure(gt_bgzf_seek(bgzf, offset, err) == 0);
+      gt_ensure(gt_bgzf_read(bgzf, readdata, len, err) == (int) len);
+      gt_ensure(memcmp(data + offset, readdata, len) == 0);
+    }
+    if (!had_err) {
+      gt_ensure(gt_bgzf_seek(bgzf, datalen, err) == 0);
+      gt_ensure(gt_bgzf_fgetc(bgzf, &c, err) == 0);
+    }
+  }
+  /* corrupt data is reported as an error */
+  if (!had_err) {
+    GtError *testerr = gt_error_new();
+    gt_xfseek(fp, 100L, SEEK_SET);
+    gt_xfwrite(data, 1, (size_t) 1000, fp);
+    gt_bgzf_rewind(bgzf);
+    gt_ensure(gt_bgzf_read(bgzf, readdata, datalen, testerr) == -1);
+    gt_ensure(gt_error_is_set(testerr));
+    gt_error_delete(testerr);
+  }
+  gt_bgzf_delete(bgzf);
+
+  gt_fa_xfclose(fp);
+  gt_str_delete(tmpfilename);
+  gt_free(data);
+  gt_free(readdata);
+  return had_err;
+}
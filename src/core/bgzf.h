@@ -0,0 +1,97 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BGZF_H
+#define BGZF_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* The <GtBGZF> class implements reading and writing of files in the blocked
+   gzip format (BGZF) known from SAMtools. A BGZF file is a series of gzip
+   members holding at most 64 KiB of uncompressed data each. Therefore it can
+   be read by every gzip decompressor, while the independent blocks allow to
+   compress and decompress with <gt_jobs> many threads in parallel.
+   Corrupt input and write errors are reported via <GtError>. */
+typedef struct GtBGZF GtBGZF;
+
+/* Returns <true> if the data at the current position of <fp> starts with a
+   BGZF block header. The position of <fp> is not changed. */
+bool    gt_bgzf_is_bgzf(FILE *fp);
+
+/* Return a new <GtBGZF> object reading compressed data from <fp>. */
+GtBGZF* gt_bgzf_new_reader(FILE *fp);
+
+/* Return a new <GtBGZF> object writing data compressed with the given zlib
+   compression <level> to <fp>. */
+GtBGZF* gt_bgzf_new_writer(FILE *fp, int level);
+
+/* Returns <true> if <bgzf> was created with <gt_bgzf_new_writer()>. */
+bool    gt_bgzf_is_writer(const GtBGZF *bgzf);
+
+/* Store the next character from <bgzf> in <c>. Returns 1 if a character was
+   read, 0 if end-of-file is reached, and -1 on error, in which case <err> is
+   set. */
+int     gt_bgzf_fgetc(GtBGZF *bgzf, int *c, GtError *err);
+
+/* Read up to <nbytes> from <bgzf> into <buf>. Returns the number of bytes
+   read, or -1 on error, in which case <err> is set. */
+int     gt_bgzf_read(GtBGZF *bgzf, void *buf, size_t nbytes, GtError *err);
+
+/* Compress <nbytes> from <buf> and write them to <bgzf>. Returns 0 on success
+   and -1 on error, in which case <err> is set. */
+int     gt_bgzf_write(GtBGZF *bgzf, const void *buf, size_t nbytes,
+                      GtError *err);
+
+/* Write all buffered data of a writing <bgzf> followed by the BGZF
+   end-of-file marker. Must be called once before a writing <bgzf> is deleted.
+   Returns 0 on success and -1 on error, in which case <err> is set. */
+int     gt_bgzf_finish(GtBGZF *bgzf, GtError *err);
+
+/* Rewind the reading <bgzf> to the beginning of the file. */
+void    gt_bgzf_rewind(GtBGZF *bgzf);
+
+/* Build the block index of the reading <bgzf> by scanning the headers of all
+   blocks. Only the block headers have to be read from disk for this.
+   Returns 0 on success and -1 on error, in which case <err> is set. */
+int     gt_bgzf_build_index(GtBGZF *bgzf, GtError *err);
+
+/* Returns <true> if <bgzf> has a block index. */
+bool    gt_bgzf_has_index(const GtBGZF *bgzf);
+
+/* Read the block index of <bgzf> from the SAMtools compatible .gzi file
+   <path>. Returns 0 on success and -1 on error, in which case <err> is set. */
+int     gt_bgzf_read_index(GtBGZF *bgzf, const char *path, GtError *err);
+
+/* Write the block index of <bgzf> to the .gzi file <path>. Returns 0 on
+   success and -1 on error, in which case <err> is set. */
+int     gt_bgzf_write_index(const GtBGZF *bgzf, const char *path,
+                            GtError *err);
+
+/* Position the reading <bgzf> at offset <uoffset> of the uncompressed data.
+   Only the blocks covering <uoffset> are decompressed. <bgzf> must have a
+   block index. Returns 0 on success and -1 on error, in which case <err> is
+   set. */
+int     gt_bgzf_seek(GtBGZF *bgzf, GtUint64 uoffset, GtError *err);
+
+/* Delete <bgzf>. The underlying file pointer is not closed. */
+void    gt_bgzf_delete(GtBGZF *bgzf);
+
+int     gt_bgzf_unit_test(GtError *err);
+
+#endif
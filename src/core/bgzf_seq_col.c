@@ -0,0 +1,941 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "core/alphabet_api.h"
+#include "core/bgzf.h"
+#include "core/bgzf_seq_col.h"
+#include "core/class_alloc_lock.h"
+#include "core/cstr_api.h"
+#include "core/fa_api.h"
+#include "core/fileutils_api.h"
+#include "core/grep.h"
+#include "core/hashmap_api.h"
+#include "core/ma_api.h"
+#include "core/md5_fingerprint_api.h"
+#include "core/md5_seqid_api.h"
+#include "core/parseutils_api.h"
+#include "core/seq_col_rep.h"
+#include "core/seq_info_cache.h"
+#include "core/splitter_api.h"
+#include "core/undef_api.h"
+
+/* number of residues used to guess the alphabet, as in <gt_alphabet_guess()> */
+#define GT_BGZF_SEQ_COL_GUESSLEN  5000UL
+/* size of the buffer used to index a sequence file */
+#define GT_BGZF_SEQ_COL_BUFSIZE   (1UL << 20)
+
+typedef struct {
+  char *name,        /* first word of the description */
+       *description, /* complete description, read on demand */
+       *md5;         /* MD5 fingerprint, computed on demand */
+  GtUword length,
+          offset,    /* offset of the first residue in the uncompressed file */
+          linebases, /* number of residues per line */
+          linewidth; /* number of bytes per line, including the line break */
+} GtBGZFSeqEntry;
+
+typedef struct {
+  GtStr *filename;
+  FILE *fp;
+  GtBGZF *bgzf;
+  GtBGZFSeqEntry *entries;
+  GtUword num_of_seqs,
+          allocated;
+  bool is_protein;
+} GtBGZFSeqFile;
+
+struct GtBGZFSeqCol {
+  GtSeqCol parent_instance;
+  GtBGZFSeqFile *files;
+  GtUword num_of_seqfiles;
+  GtSeqInfoCache *grep_cache,
+                 *md5_cache;
+  GtHashmap *duplicates;
+  bool matchdescstart;
+};
+
+const GtSeqColClass* gt_bgzf_seq_col_class(void);
+#define gt_bgzf_seq_col_cast(SC)\
+        gt_seq_col_cast(gt_bgzf_seq_col_class(), SC)
+
+static void bgzf_seq_file_reset_entries(GtBGZFSeqFile *file)
+{
+  GtUword i;
+  for (i = 0; i < file->num_of_seqs; i++) {
+    gt_free(file->entries[i].name);
+    gt_free(file->entries[i].description);
+    gt_free(file->entries[i].md5);
+  }
+  gt_free(file->entries);
+  file->entries = NULL;
+  file->num_of_seqs = file->allocated = 0;
+}
+
+static GtBGZFSeqEntry* bgzf_seq_file_add_entry(GtBGZFSeqFile *file)
+{
+  GtBGZFSeqEntry *entry;
+  if (file->num_of_seqs == file->allocated) {
+    file->allocated = file->allocated * 2 + 16;
+    file->entries = gt_realloc(file->entries,
+                               sizeof *file->entries * file->allocated);
+  }
+  entry = file->entries + file->num_of_seqs++;
+  memset(entry, 0, sizeof *entry);
+  return entry;
+}
+
+/* returns the offset of byte following the last sequence line of <entry> */
+static GtUword bgzf_seq_entry_end(const GtBGZFSeqEntry *entry)
+{
+  if (entry->length == 0)
+    return entry->offset;
+  return entry->offset + (entry->length / entry->linebases) * entry->linewidth
+         + (entry->length % entry->linebases
+            ? entry->length % entry->linebases
+              + entry->linewidth - entry->linebases
+            : 0);
+}
+
+static GtUword bgzf_seq_entry_position(const GtBGZFSeqEntry *entry,
+                                       GtUword pos)
+{
+  return entry->offset + (pos / entry->linebases) * entry->linewidth
+         + pos % entry->linebases;
+}
+
+static int bgzf_seq_file_read(GtBGZFSeqFile *file, char *buf, GtUword from,
+                              GtUword nbytes, GtError *err)
+{
+  int rval;
+  gt_error_check(err);
+  if (gt_bgzf_seek(file->bgzf, from, err) ||
+      (rval = gt_bgzf_read(file->bgzf, buf, nbytes, err)) == -1) {
+    GtStr *msg = gt_str_new_cstr(gt_error_get(err));
+    gt_error_set(err, "cannot read sequence from file \"%s\": %s",
+                 gt_str_get(file->filename), gt_str_get(msg));
+    gt_str_delete(msg);
+    return -1;
+  }
+  if (rval != (int) nbytes) {
+    gt_error_set(err, "cannot read sequence from file \"%s\": unexpected end "
+                      "of file, index outdated?", gt_str_get(file->filename));
+    return -1;
+  }
+  return 0;
+}
+
+/* returns the residues <start> to <end> of sequence <seqnum>, or NULL on
+   error */
+static char* bgzf_seq_file_get_range(GtBGZFSeqFile *file, GtUword seqnum,
+                                     GtUword start, GtUword end, GtError *err)
+{
+  const GtBGZFSeqEntry *entry;
+  GtUword from, nbytes, i, j;
+  char *buf, *seq;
+  gt_assert(file && seqnum < file->num_of_seqs && start <= end);
+  entry = file->entries + seqnum;
+  gt_assert(end < entry->length);
+  from = bgzf_seq_entry_position(entry, start);
+  nbytes = bgzf_seq_entry_position(entry, end) - from + 1;
+  buf = gt_malloc(sizeof (char) * nbytes);
+  if (bgzf_seq_file_read(file, buf, from, nbytes, err)) {
+    gt_free(buf);
+    return NULL;
+  }
+  seq = gt_calloc((size_t) (end - start + 1) + 1, sizeof (char));
+  for (i = 0, j = 0; i < nbytes; i++) {
+    if (buf[i] != '\n' && buf[i] != '\r') {
+      /* protein sequences are decoded in upper case by <GtBioseq> as well */
+      seq[j++] = file->is_protein ? toupper((unsigned char) buf[i]) : buf[i];
+    }
+  }
+  gt_assert(j == end - start + 1);
+  gt_free(buf);
+  return seq;
+}
+
+/* the description is the last line in front of the first residue */
+static const char* bgzf_seq_file_get_description(GtBGZFSeqFile *file,
+                                                 GtUword seqnum, GtError *err)
+{
+  GtBGZFSeqEntry *entry;
+  GtUword from, nbytes, i;
+  char *buf;
+  gt_assert(file && seqnum < file->num_of_seqs);
+  entry = file->entries + seqnum;
+  if (!entry->description) {
+    from = seqnum ? bgzf_seq_entry_end(entry - 1) : 0;
+    gt_assert(entry->offset > from);
+    nbytes = entry->offset - from;
+    buf = gt_malloc(sizeof (char) * nbytes);
+    if (bgzf_seq_file_read(file, buf, from, nbytes, err)) {
+      gt_free(buf);
+      return NULL;
+    }
+    nbytes--; /* skip line break */
+    if (nbytes > 0 && buf[nbytes-1] == '\r')
+      nbytes--;
+    for (i = nbytes; i > 0 && buf[i-1] != '\n'; i--)
+      /* Nothing. */;
+    if (i >= nbytes || buf[i] != '>') {
+      gt_error_set(err, "cannot read description of sequence "GT_WU" from file "
+                        "\"%s\", index outdated?", seqnum,
+                   gt_str_get(file->filename));
+      gt_free(buf);
+      return NULL;
+    }
+    entry->description = gt_cstr_dup_nt(buf + i + 1, nbytes - i - 1);
+    gt_free(buf);
+  }
+  return entry->description;
+}
+
+static const char* bgzf_seq_file_get_md5(GtBGZFSeqFile *file, GtUword seqnum,
+                                         GtError *err)
+{
+  GtBGZFSeqEntry *entry;
+  char *seq;
+  gt_assert(file && seqnum < file->num_of_seqs);
+  entry = file->entries + seqnum;
+  if (!entry->md5) {
+    if (entry->length == 0)
+      entry->md5 = gt_md5_fingerprint("", 0);
+    else {
+      if (!(seq = bgzf_seq_file_get_range(file, seqnum, 0, entry->length - 1,
+                                          err))) {
+        return NULL;
+      }
+      entry->md5 = gt_md5_fingerprint(seq, entry->length);
+      gt_free(seq);
+    }
+  }
+  return entry->md5;
+}
+
+static int bgzf_seq_file_end_line(GtBGZFSeqEntry *entry, GtUword linelength,
+                                  bool *shortline, bool *blankline,
+                                  const char *filename, GtError *err)
+{
+  if (linelength == 0) {
+    *blankline = true;
+    return 0;
+  }
+  if (*blankline || *shortline ||
+      (entry->linebases > 0 && linelength > entry->linebases)) {
+    gt_error_set(err, "cannot index sequence file \"%s\": lines of sequence "
+                      "\"%s\" have different lengths", filename, entry->name);
+    return -1;
+  }
+  if (entry->linebases == 0) {
+    entry->linebases = linelength;
+    entry->linewidth = linelength + 1;
+  }
+  else if (linelength < entry->linebases)
+    *shortline = true;
+  entry->length += linelength;
+  return 0;
+}
+
+/* construct the index of <file> in a single pass over the sequence data */
+static int bgzf_seq_file_index(GtBGZFSeqFile *file, const char *filename,
+                               GtError *err)
+{
+  GtBGZFSeqEntry *entry = NULL;
+  GtStr *header = gt_str_new();
+  GtUword offset = 0, linelength = 0, i;
+  bool in_header = false, shortline = false, blankline = false;
+  char *buf;
+  int len = 0, had_err = 0;
+  gt_error_check(err);
+  buf = gt_malloc(sizeof (char) * GT_BGZF_SEQ_COL_BUFSIZE);
+  gt_bgzf_rewind(file->bgzf);
+  while (!had_err &&
+         (len = gt_bgzf_read(file->bgzf, buf, GT_BGZF_SEQ_COL_BUFSIZE,
+                             err)) > 0) {
+    for (i = 0; !had_err && i < (GtUword) len; i++, offset++) {
+      char cc = buf[i];
+      if (in_header) {
+        if (cc == '\n') {
+          char *name = gt_str_get(header);
+          GtUword namelen = 0;
+          while (name[namelen] != '\0' && !isspace((unsigned char)
+                                                   name[namelen])) {
+            namelen++;
+          }
+          entry = bgzf_seq_file_add_entry(file);
+          entry->name = gt_cstr_dup_nt(name, namelen);
+          entry->offset = offset + 1;
+          shortline = blankline = false;
+          linelength = 0;
+          in_header = false;
+        }
+        else
+          gt_str_append_char(header, cc);
+      }
+      else if (cc == '>' && linelength == 0) {
+        gt_str_reset(header);
+        in_header = true;
+      }
+      else if (cc == '\n') {
+        if (entry)
+          had_err = bgzf_seq_file_end_line(entry, linelength, &shortline,
+                                           &blankline, filename, err);
+        linelength = 0;
+      }
+      else if (!entry || isspace((unsigned char) cc)) {
+        gt_error_set(err, "cannot index sequence file \"%s\": %s", filename,
+                     entry ? "sequence lines contain white space"
+                           : "file is not in FASTA format");
+        had_err = -1;
+      }
+      else
+        linelength++;
+    }
+  }
+  if (len == -1)
+    had_err = -1;
+  if (!had_err && in_header) {
+    gt_error_set(err, "cannot index sequence file \"%s\": unterminated "
+                      "description line", filename);
+    had_err = -1;
+  }
+  if (!had_err && entry && linelength > 0) {
+    /* the last line is not terminated */
+    had_err = bgzf_seq_file_end_line(entry, linelength, &shortline, &blankline,
+                                     filename, err);
+  }
+  gt_free(buf);
+  gt_str_delete(header);
+  return had_err;
+}
+
+static int bgzf_seq_file_read_fai(GtBGZFSeqFile *file, const char *path,
+                                  GtError *err)
+{
+  GtSplitter *splitter;
+  GtStr *line;
+  GtBGZFSeqEntry *entry;
+  GtUword linenum = 0;
+  FILE *fp;
+  int had_err = 0;
+  gt_error_check(err);
+  if (!(fp = gt_fa_fopen(path, "r", err)))
+    return -1;
+  line = gt_str_new();
+  splitter = gt_splitter_new();
+  while (!had_err && gt_str_read_next_line(line, fp) != EOF) {
+    linenum++;
+    gt_splitter_reset(splitter);
+    gt_splitter_split(splitter, gt_str_get(line), gt_str_length(line), '\t');
+    if (gt_splitter_size(splitter) != 5UL) {
+      had_err = -1;
+    }
+    else {
+      entry = bgzf_seq_file_add_entry(file);
+      entry->name = gt_cstr_dup(gt_splitter_get_token(splitter, 0));
+      if (gt_parse_uword(&entry->length, gt_splitter_get_token(splitter, 1)) ||
+          gt_parse_uword(&entry->offset, gt_splitter_get_token(splitter, 2)) ||
+          gt_parse_uword(&entry->linebases,
+                         gt_splitter_get_token(splitter, 3)) ||
+          gt_parse_uword(&entry->linewidth,
+                         gt_splitter_get_token(splitter, 4)) ||
+          (entry->length > 0 && (entry->linebases == 0 ||
+                                 entry->linewidth <= entry->linebases))) {
+        had_err = -1;
+      }
+    }
+    gt_str_reset(line);
+  }
+  if (had_err) {
+    gt_error_set(err, "line "GT_WU" of index file \"%s\" is invalid", linenum,
+                 path);
+  }
+  gt_splitter_delete(splitter);
+  gt_str_delete(line);
+  gt_fa_xfclose(fp);
+  return had_err;
+}
+
+static int bgzf_seq_file_write_fai(const GtBGZFSeqFile *file, const char *path,
+                                   GtError *err)
+{
+  const GtBGZFSeqEntry *entry;
+  GtUword i;
+  FILE *fp;
+  gt_error_check(err);
+  if (!(fp = gt_fa_fopen(path, "w", err)))
+    return -1;
+  for (i = 0; i < file->num_of_seqs; i++) {
+    entry = file->entries + i;
+    fprintf(fp, "%s\t"GT_WU"\t"GT_WU"\t"GT_WU"\t"GT_WU"\n", entry->name,
+            entry->length, entry->offset, entry->linebases, entry->linewidth);
+  }
+  gt_fa_xfclose(fp);
+  return 0;
+}
+
+/* the alphabet is guessed from the beginning of the file, as done by the
+   <GtEncseqEncoder> for <GtBioseq> */
+static int bgzf_seq_file_guess_alphabet(GtBGZFSeqFile *file, GtError *err)
+{
+  GtAlphabet *alphabet;
+  GtStr *residues = gt_str_new();
+  GtUword i, len;
+  char *seq;
+  gt_error_check(err);
+  for (i = 0; i < file->num_of_seqs &&
+              gt_str_length(residues) < GT_BGZF_SEQ_COL_GUESSLEN; i++) {
+    len = file->entries[i].length;
+    if (len > GT_BGZF_SEQ_COL_GUESSLEN - gt_str_length(residues))
+      len = GT_BGZF_SEQ_COL_GUESSLEN - gt_str_length(residues);
+    if (len > 0) {
+      if (!(seq = bgzf_seq_file_get_range(file, i, 0, len - 1, err))) {
+        gt_str_delete(residues);
+        return -1;
+      }
+      gt_str_append_cstr_nt(residues, seq, len);
+      gt_free(seq);
+    }
+  }
+  alphabet = gt_alphabet_guess(gt_str_get(residues), gt_str_length(residues));
+  file->is_protein = gt_alphabet_is_protein(alphabet);
+  gt_alphabet_delete(alphabet);
+  gt_str_delete(residues);
+  return 0;
+}
+
+/* loads the index of <filename> from the .gzi and .fai files next to it, if
+   they are up to date, or constructs it otherwise. A constructed index is
+   stored next to <filename> for later runs, if possible. */
+static int bgzf_seq_file_init(GtBGZFSeqFile *file, const char *filename,
+                              GtError *err)
+{
+  GtStr *fai = gt_str_new_cstr(filename),
+        *gzi = gt_str_new_cstr(filename);
+  bool write_gzi = false, write_fai = false;
+  int had_err = 0;
+  gt_error_check(err);
+  file->filename = gt_str_new_cstr(filename);
+  gt_str_append_cstr(fai, GT_FAIFILESUFFIX);
+  gt_str_append_cstr(gzi, GT_GZIFILESUFFIX);
+  if (!(file->fp = gt_fa_fopen(filename, "rb", err)))
+    had_err = -1;
+  if (!had_err && !gt_bgzf_is_bgzf(file->fp)) {
+    gt_error_set(err, "sequence file \"%s\" is not BGZF compressed", filename);
+    had_err = -1;
+  }
+  if (!had_err) {
+    file->bgzf = gt_bgzf_new_reader(file->fp);
+    if (gt_file_exists(gt_str_get(gzi)) &&
+        !gt_file_is_newer(filename, gt_str_get(gzi))) {
+      had_err = gt_bgzf_read_index(file->bgzf, gt_str_get(gzi), err);
+    }
+    else {
+      had_err = gt_bgzf_build_index(file->bgzf, err);
+      write_gzi = true;
+    }
+  }
+  if (!had_err) {
+    if (gt_file_exists(gt_str_get(fai)) &&
+        !gt_file_is_newer(filename, gt_str_get(fai))) {
+      had_err = bgzf_seq_file_read_fai(file, gt_str_get(fai), err);
+    }
+    else {
+      had_err = bgzf_seq_file_index(file, filename, err);
+      write_fai = true;
+    }
+  }
+  /* storing the index is optional, e.g. for read-only directories */
+  if (!had_err && write_gzi &&
+      gt_bgzf_write_index(file->bgzf, gt_str_get(gzi), err)) {
+    gt_error_unset(err);
+  }
+  if (!had_err && write_fai &&
+      bgzf_seq_file_write_fai(file, gt_str_get(fai), err)) {
+    gt_error_unset(err);
+  }
+  if (!had_err)
+    had_err = bgzf_seq_file_guess_alphabet(file, err);
+  gt_str_delete(gzi);
+  gt_str_delete(fai);
+  return had_err;
+}
+
+static void gt_bgzf_seq_col_delete(GtSeqCol *sc)
+{
+  GtUword i;
+  GtBGZFSeqCol *bsc;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  if (!bsc) return;
+  gt_seq_info_cache_delete(bsc->grep_cache);
+  gt_seq_info_cache_delete(bsc->md5_cache);
+  gt_hashmap_delete(bsc->duplicates);
+  for (i = 0; i < bsc->num_of_seqfiles; i++) {
+    bgzf_seq_file_reset_entries(bsc->files + i);
+    gt_bgzf_delete(bsc->files[i].bgzf);
+    gt_fa_fclose(bsc->files[i].fp);
+    gt_str_delete(bsc->files[i].filename);
+  }
+  gt_free(bsc->files);
+}
+
+static int grep_desc(GtBGZFSeqCol *bsc, GtUword *filenum, GtUword *seqnum,
+                     GtStr *seqid, GtError *err)
+{
+  GtUword i, j, num_matches = 0;
+  const GtSeqInfo *seq_info_ptr;
+  GtSeqInfo seq_info;
+  GtStr *pattern, *escaped;
+  bool match = false;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(bsc && filenum && seqnum && seqid);
+  /* create cache */
+  if (!bsc->grep_cache)
+    bsc->grep_cache = gt_seq_info_cache_new();
+  /* try to read from cache */
+  seq_info_ptr = gt_seq_info_cache_get(bsc->grep_cache, gt_str_get(seqid));
+  if (seq_info_ptr) {
+    if (bsc->duplicates && gt_hashmap_get(bsc->duplicates, gt_str_get(seqid))) {
+      gt_error_set(err, "query seqid '%s' could match more than one "
+                        "sequence description", gt_str_get(seqid));
+      return -1;
+    }
+    *filenum = seq_info_ptr->filenum;
+    *seqnum = seq_info_ptr->seqnum;
+    return 0;
+  }
+  pattern = gt_str_new();
+  escaped = gt_str_new();
+  gt_grep_escape_extended(escaped, gt_str_get(seqid), gt_str_length(seqid));
+  if (bsc->matchdescstart)
+    gt_str_append_cstr(pattern, "^");
+  gt_str_append_str(pattern, escaped);
+  if (bsc->matchdescstart)
+    gt_str_append_cstr(pattern, "([[:space:]]|$)");
+  for (i = 0; !had_err && i < bsc->num_of_seqfiles; i++) {
+    GtBGZFSeqFile *file = bsc->files + i;
+    for (j = 0; !had_err && j < file->num_of_seqs; j++) {
+      const char *desc;
+      if (!(desc = bgzf_seq_file_get_description(file, j, err))) {
+        had_err = -1;
+        break;
+      }
+      had_err = gt_grep(&match, gt_str_get(pattern), desc, err);
+      if (!had_err && match) {
+        num_matches++;
+        if (num_matches > 1) {
+          gt_error_set(err, "query seqid '%s' could match more than one "
+                            "sequence description", gt_str_get(seqid));
+          had_err = -1;
+          break;
+        }
+        *filenum = i;
+        *seqnum = j;
+        /* cache results */
+        seq_info.filenum = i;
+        seq_info.seqnum = j;
+        gt_seq_info_cache_add(bsc->grep_cache, gt_str_get(seqid), &seq_info);
+      }
+    }
+    if (match)
+      break;
+  }
+  gt_str_delete(pattern);
+  gt_str_delete(escaped);
+  if (!had_err && num_matches == 0) {
+    gt_error_set(err, "no description matched sequence ID '%s'",
+                 gt_str_get(seqid));
+    had_err = -1;
+  }
+  return had_err;
+}
+
+static void gt_bgzf_seq_col_enable_match_desc_start(GtSeqCol *sc)
+{
+  GtBGZFSeqCol *bsc;
+  GtSeqInfo seq_info;
+  GtUword i, j;
+  gt_assert(sc);
+  bsc = gt_bgzf_seq_col_cast(sc);
+  bsc->matchdescstart = true;
+  /* pre-cache seqids for faster search, the index already contains the first
+     word of each description */
+  if (!bsc->grep_cache)
+    bsc->grep_cache = gt_seq_info_cache_new();
+  for (i = 0; i < bsc->num_of_seqfiles; i++) {
+    GtBGZFSeqFile *file = bsc->files + i;
+    for (j = 0; j < file->num_of_seqs; j++) {
+      const char *name = file->entries[j].name;
+      seq_info.filenum = i;
+      seq_info.seqnum = j;
+      if (!gt_seq_info_cache_get(bsc->grep_cache, name))
+        gt_seq_info_cache_add(bsc->grep_cache, name, &seq_info);
+      else {
+        if (!bsc->duplicates)
+          bsc->duplicates = gt_hashmap_new(GT_HASH_STRING, NULL, NULL);
+        gt_hashmap_add(bsc->duplicates, (char*) name, (void*) 1);
+      }
+    }
+  }
+}
+
+static int check_range(GtBGZFSeqCol *bsc, GtUword filenum, GtUword seqnum,
+                       GtUword start, GtUword end, GtStr *seqid, GtError *err)
+{
+  GtUword seqlength = bsc->files[filenum].entries[seqnum].length;
+  gt_error_check(err);
+  if (start > seqlength - 1 || end > seqlength - 1) {
+    gt_error_set(err, "trying to extract range "GT_WU"-"GT_WU" on sequence "
+                      "``%s'' which is not covered by that sequence (only "
+                      ""GT_WU" characters in size). Has the sequence-region "
+                      "to sequence mapping been defined correctly?",
+                      start, end, gt_str_get(seqid), seqlength);
+    return -1;
+  }
+  return 0;
+}
+
+static int gt_bgzf_seq_col_grep_desc(GtSeqCol *sc, char **seq,
+                                     GtUword start, GtUword end,
+                                     GtStr *seqid, GtError *err)
+{
+  GtUword filenum = 0, seqnum = 0;
+  int had_err;
+  GtBGZFSeqCol *bsc;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_error_check(err);
+  gt_assert(bsc && seq && seqid);
+  had_err = grep_desc(bsc, &filenum, &seqnum, seqid, err);
+  if (!had_err)
+    had_err = check_range(bsc, filenum, seqnum, start, end, seqid, err);
+  if (!had_err &&
+      !(*seq = bgzf_seq_file_get_range(bsc->files + filenum, seqnum, start, end,
+                                       err))) {
+    had_err = -1;
+  }
+  return had_err;
+}
+
+static int gt_bgzf_seq_col_grep_desc_md5(GtSeqCol *sc, const char **md5,
+                                         GtStr *seqid, GtError *err)
+{
+  GtUword filenum = 0, seqnum = 0;
+  int had_err;
+  GtBGZFSeqCol *bsc;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_error_check(err);
+  gt_assert(bsc && md5 && seqid);
+  had_err = grep_desc(bsc, &filenum, &seqnum, seqid, err);
+  if (!had_err &&
+      !(*md5 = bgzf_seq_file_get_md5(bsc->files + filenum, seqnum, err))) {
+    had_err = -1;
+  }
+  return had_err;
+}
+
+static int gt_bgzf_seq_col_grep_desc_desc(GtSeqCol *sc, GtStr *desc,
+                                          GtStr *seqid, GtError *err)
+{
+  GtUword filenum = 0, seqnum = 0;
+  int had_err;
+  GtBGZFSeqCol *bsc;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_error_check(err);
+  gt_assert(bsc && desc && seqid);
+  had_err = grep_desc(bsc, &filenum, &seqnum, seqid, err);
+  if (!had_err) {
+    const char *description;
+    if ((description = bgzf_seq_file_get_description(bsc->files + filenum,
+                                                     seqnum, err))) {
+      gt_str_append_cstr(desc, description);
+    }
+    else
+      had_err = -1;
+  }
+  return had_err;
+}
+
+static int gt_bgzf_seq_col_grep_desc_sequence_length(GtSeqCol *sc,
+                                                     GtUword *length,
+                                                     GtStr *seqid,
+                                                     GtError *err)
+{
+  GtUword filenum = 0, seqnum = 0;
+  int had_err;
+  GtBGZFSeqCol *bsc;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_error_check(err);
+  gt_assert(bsc && length && seqid);
+  had_err = grep_desc(bsc, &filenum, &seqnum, seqid, err);
+  if (!had_err)
+    *length = bsc->files[filenum].entries[seqnum].length;
+  return had_err;
+}
+
+static int md5_to_index(GtUword *filenum, GtUword *seqnum, GtBGZFSeqCol *bsc,
+                        GtStr *md5_seqid, GtError *err)
+{
+  const GtSeqInfo *seq_info_ptr;
+  GtSeqInfo seq_info;
+  GtStr *md5;
+  GtUword i, j;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(filenum && seqnum && bsc && md5_seqid);
+  if (gt_str_length(md5_seqid) >= GT_MD5_SEQID_TOTAL_LEN &&
+      gt_str_get(md5_seqid)[GT_MD5_SEQID_TOTAL_LEN-1]
+                                                   != GT_MD5_SEQID_SEPARATOR) {
+    gt_error_set(err, "MD5 sequence id %s not terminated with '%c'",
+                 gt_str_get(md5_seqid), GT_MD5_SEQID_SEPARATOR);
+    return -1;
+  }
+  /* the fingerprints of all sequences are computed on first use */
+  if (!bsc->md5_cache) {
+    bsc->md5_cache = gt_seq_info_cache_new();
+    for (i = 0; i < bsc->num_of_seqfiles; i++) {
+      for (j = 0; j < bsc->files[i].num_of_seqs; j++) {
+        const char *fingerprint;
+        if (!(fingerprint = bgzf_seq_file_get_md5(bsc->files + i, j, err))) {
+          /* do not keep an incomplete cache */
+          gt_seq_info_cache_delete(bsc->md5_cache);
+          bsc->md5_cache = NULL;
+          return -1;
+        }
+        seq_info.filenum = i;
+        seq_info.seqnum = j;
+        if (!gt_seq_info_cache_get(bsc->md5_cache, fingerprint))
+          gt_seq_info_cache_add(bsc->md5_cache, fingerprint, &seq_info);
+      }
+    }
+  }
+  md5 = gt_str_new_cstr(gt_str_get(md5_seqid) + GT_MD5_SEQID_PREFIX_LEN);
+  if (gt_str_length(md5) > GT_MD5_SEQID_HASH_LEN)
+    gt_str_set_length(md5, GT_MD5_SEQID_HASH_LEN);
+  seq_info_ptr = gt_seq_info_cache_get(bsc->md5_cache, gt_str_get(md5));
+  if (seq_info_ptr) {
+    *filenum = seq_info_ptr->filenum;
+    *seqnum = seq_info_ptr->seqnum;
+  }
+  else {
+    gt_error_set(err, "sequence %s not found", gt_str_get(md5_seqid));
+    had_err = -1;
+  }
+  gt_str_delete(md5);
+  return had_err;
+}
+
+static int gt_bgzf_seq_col_md5_to_seq(GtSeqCol *sc, char **seq,
+                                      GtUword start, GtUword end,
+                                      GtStr *md5_seqid, GtError *err)
+{
+  GtUword filenum = 0, seqnum = GT_UNDEF_UWORD;
+  GtBGZFSeqCol *bsc;
+  int had_err = 0;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_error_check(err);
+  gt_assert(bsc && seq && md5_seqid && err);
+  gt_assert(gt_md5_seqid_has_prefix(gt_str_get(md5_seqid)));
+  if (!(had_err = md5_to_index(&filenum, &seqnum, bsc, md5_seqid, err))) {
+    gt_assert(seqnum != GT_UNDEF_UWORD);
+    if (!(*seq = bgzf_seq_file_get_range(bsc->files + filenum, seqnum, start,
+                                         end, err))) {
+      had_err = -1;
+    }
+  }
+  return had_err;
+}
+
+static int gt_bgzf_seq_col_md5_to_description(GtSeqCol *sc, GtStr *desc,
+                                              GtStr *md5_seqid, GtError *err)
+{
+  GtUword filenum = 0, seqnum = GT_UNDEF_UWORD;
+  GtBGZFSeqCol *bsc;
+  int had_err = 0;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_error_check(err);
+  gt_assert(bsc && desc && md5_seqid && err);
+  gt_assert(gt_md5_seqid_has_prefix(gt_str_get(md5_seqid)));
+  if (!(had_err = md5_to_index(&filenum, &seqnum, bsc, md5_seqid, err))) {
+    const char *description;
+    gt_assert(seqnum != GT_UNDEF_UWORD);
+    if ((description = bgzf_seq_file_get_description(bsc->files + filenum,
+                                                     seqnum, err))) {
+      gt_str_append_cstr(desc, description);
+    }
+    else
+      had_err = -1;
+  }
+  return had_err;
+}
+
+static int gt_bgzf_seq_col_md5_to_sequence_length(GtSeqCol *sc, GtUword *len,
+                                                  GtStr *md5_seqid,
+                                                  GtError *err)
+{
+  GtUword filenum = 0, seqnum = GT_UNDEF_UWORD;
+  GtBGZFSeqCol *bsc;
+  int had_err = 0;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_error_check(err);
+  gt_assert(bsc && len && md5_seqid && err);
+  gt_assert(gt_md5_seqid_has_prefix(gt_str_get(md5_seqid)));
+  if (!(had_err = md5_to_index(&filenum, &seqnum, bsc, md5_seqid, err))) {
+    gt_assert(seqnum != GT_UNDEF_UWORD);
+    *len = bsc->files[filenum].entries[seqnum].length;
+  }
+  return had_err;
+}
+
+static GtUword gt_bgzf_seq_col_num_of_files(const GtSeqCol *sc)
+{
+  const GtBGZFSeqCol *bsc;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_assert(bsc);
+  return bsc->num_of_seqfiles;
+}
+
+static GtUword gt_bgzf_seq_col_num_of_seqs(const GtSeqCol *sc, GtUword filenum)
+{
+  GtBGZFSeqCol *bsc;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_assert(bsc && filenum < bsc->num_of_seqfiles);
+  return bsc->files[filenum].num_of_seqs;
+}
+
+static const char* gt_bgzf_seq_col_get_md5_fingerprint(const GtSeqCol *sc,
+                                                       GtUword filenum,
+                                                       GtUword seqnum,
+                                                       GtError *err)
+{
+  GtBGZFSeqCol *bsc;
+  gt_error_check(err);
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_assert(bsc && filenum < bsc->num_of_seqfiles);
+  return bgzf_seq_file_get_md5(bsc->files + filenum, seqnum, err);
+}
+
+static char* gt_bgzf_seq_col_get_sequence(const GtSeqCol *sc, GtUword filenum,
+                                          GtUword seqnum, GtUword start,
+                                          GtUword end, GtError *err)
+{
+  GtBGZFSeqCol *bsc;
+  gt_error_check(err);
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_assert(bsc && filenum < bsc->num_of_seqfiles);
+  return bgzf_seq_file_get_range(bsc->files + filenum, seqnum, start, end, err);
+}
+
+static char* gt_bgzf_seq_col_get_description(const GtSeqCol *sc,
+                                             GtUword filenum,
+                                             GtUword seqnum, GtError *err)
+{
+  GtBGZFSeqCol *bsc;
+  const char *description;
+  gt_error_check(err);
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_assert(bsc && filenum < bsc->num_of_seqfiles);
+  if (!(description = bgzf_seq_file_get_description(bsc->files + filenum,
+                                                    seqnum, err))) {
+    return NULL;
+  }
+  return gt_cstr_dup(description);
+}
+
+static GtUword gt_bgzf_seq_col_get_sequence_length(const GtSeqCol *sc,
+                                                   GtUword filenum,
+                                                   GtUword seqnum)
+{
+  GtBGZFSeqCol *bsc;
+  bsc = gt_bgzf_seq_col_cast(sc);
+  gt_assert(bsc && filenum < bsc->num_of_seqfiles &&
+            seqnum < bsc->files[filenum].num_of_seqs);
+  return bsc->files[filenum].entries[seqnum].length;
+}
+
+const GtSeqColClass* gt_bgzf_seq_col_class(void)
+{
+  static const GtSeqColClass *bsc_class = NULL;
+  gt_class_alloc_lock_enter();
+  if (!bsc_class) {
+    bsc_class = gt_seq_col_class_new(sizeof (GtBGZFSeqCol),
+                                     gt_bgzf_seq_col_delete,
+                                     gt_bgzf_seq_col_enable_match_desc_start,
+                                     gt_bgzf_seq_col_grep_desc,
+                                     gt_bgzf_seq_col_grep_desc_desc,
+                                     gt_bgzf_seq_col_grep_desc_md5,
+                                     gt_bgzf_seq_col_grep_desc_sequence_length,
+                                     gt_bgzf_seq_col_md5_to_seq,
+                                     gt_bgzf_seq_col_md5_to_description,
+                                     gt_bgzf_seq_col_md5_to_sequence_length,
+                                     gt_bgzf_seq_col_num_of_files,
+                                     gt_bgzf_seq_col_num_of_seqs,
+                                     gt_bgzf_seq_col_get_md5_fingerprint,
+                                     gt_bgzf_seq_col_get_sequence,
+                                     gt_bgzf_seq_col_get_description,
+                                     gt_bgzf_seq_col_get_sequence_length);
+  }
+  gt_class_alloc_lock_leave();
+  return bsc_class;
+}
+
+bool gt_bgzf_seq_col_applicable(GtStrArray *sequence_files)
+{
+  GtUword i;
+  FILE *fp;
+  bool applicable = true;
+  gt_assert(sequence_files);
+  for (i = 0; applicable && i < gt_str_array_size(sequence_files); i++) {
+    const char *filename = gt_str_array_get(sequence_files, i);
+    if (strcmp(filename, "-") == 0 || !(fp = fopen(filename, "rb")))
+      applicable = false;
+    else {
+      applicable = gt_bgzf_is_bgzf(fp);
+      fclose(fp);
+    }
+  }
+  return applicable;
+}
+
+GtSeqCol* gt_bgzf_seq_col_new(GtStrArray *sequence_files, GtError *err)
+{
+  GtSeqCol *sc;
+  GtBGZFSeqCol *bsc;
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(sequence_files);
+  gt_assert(gt_str_array_size(sequence_files));
+  sc = gt_seq_col_create(gt_bgzf_seq_col_class());
+  bsc = gt_bgzf_seq_col_cast(sc);
+  bsc->grep_cache = bsc->md5_cache = NULL;
+  bsc->duplicates = NULL;
+  bsc->matchdescstart = false;
+  bsc->num_of_seqfiles = gt_str_array_size(sequence_files);
+  bsc->files = gt_calloc(bsc->num_of_seqfiles, sizeof *bsc->files);
+  for (i = 0; !had_err && i < bsc->num_of_seqfiles; i++) {
+    had_err = bgzf_seq_file_init(bsc->files + i,
+                                 gt_str_array_get(sequence_files, i), err);
+  }
+  if (had_err) {
+    gt_seq_col_delete(sc);
+    return NULL;
+  }
+  return sc;
+}
@@ -0,0 +1,43 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BGZF_SEQ_COL_H
+#define BGZF_SEQ_COL_H
+
+#include "core/error_api.h"
+#include "core/seq_col.h"
+#include "core/str_array_api.h"
+
+#define GT_FAIFILESUFFIX ".fai"
+#define GT_GZIFILESUFFIX ".gzi"
+
+/* A <GtSeqCol> implementation giving random access to BGZF compressed FASTA
+   files without decompressing them as a whole. The positions of the sequences
+   are taken from a SAMtools compatible .fai index, the positions of the
+   compressed blocks from a .gzi index. Missing or outdated index files are
+   created in a single pass over the sequence file and stored next to it, if
+   possible. */
+typedef struct GtBGZFSeqCol GtBGZFSeqCol;
+
+/* Returns <true> if all files in <sequence_files> are BGZF compressed. */
+bool      gt_bgzf_seq_col_applicable(GtStrArray *sequence_files);
+
+/* Returns a new <GtBGZFSeqCol> for the BGZF compressed FASTA files in
+   <sequence_files>. Returns NULL and sets <err> if a file cannot be indexed,
+   e.g. because its sequence lines are of unequal length. */
+GtSeqCol* gt_bgzf_seq_col_new(GtStrArray *sequence_files, GtError *err);
+
+#endif
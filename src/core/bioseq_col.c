@@ -344,9 +344,11 @@ static GtUword gt_bioseq_col_num_of_seqs(const GtSeqCol *sc,
 
 static const char* gt_bioseq_col_get_md5_fingerprint(const GtSeqCol *sc,
                                                      GtUword filenum,
-                                                     GtUword seqnum)
+                                                     GtUword seqnum,
+                                                     GtError *err)
 {
   GtBioseqCol *bsc;
+  gt_error_check(err);
   bsc = gt_bioseq_col_cast(sc);
   gt_assert(bsc && filenum < bsc->num_of_seqfiles);
   return gt_bioseq_get_md5_fingerprint(bsc->bioseqs[filenum], seqnum);
@@ -356,9 +358,11 @@ static char* gt_bioseq_col_get_sequence(const GtSeqCol *sc,
                                         GtUword filenum,
                                         GtUword seqnum,
                                         GtUword start,
-                                        GtUword end)
+                                        GtUword end,
+                                        GtError *err)
 {
   GtBioseqCol *bsc;
+  gt_error_check(err);
   bsc = gt_bioseq_col_cast(sc);
   gt_assert(bsc && filenum < bsc->num_of_seqfiles);
   return gt_bioseq_get_sequence_range(bsc->bioseqs[filenum], seqnum, start,
@@ -367,9 +371,11 @@ static char* gt_bioseq_col_get_sequence(const GtSeqCol *sc,
 
 static char* gt_bioseq_col_get_description(const GtSeqCol *sc,
                                            GtUword filenum,
-                                           GtUword seqnum)
+                                           GtUword seqnum,
+                                           GtError *err)
 {
   GtBioseqCol *bsc;
+  gt_error_check(err);
   bsc = gt_bioseq_col_cast(sc);
   gt_assert(bsc && filenum < bsc->num_of_seqfiles);
   return gt_cstr_dup(gt_bioseq_get_description(bsc->bioseqs[filenum], seqnum));
@@ -89,6 +89,35 @@ void gt_desc_buffer_append_char(GtDescBuffer *db, char c)
   db->buf[db->length++] = c;
 }
 
+void gt_desc_buffer_append_chars(GtDescBuffer *db, const char *cstr,
+                                 GtUword len)
+{
+  gt_assert(db && (cstr != NULL || len == 0));
+  if (db->shorten) {
+    GtUword idx;
+    if (db->seen_whitespace)
+      return;
+    for (idx = 0; idx < len && !isspace(cstr[idx]); idx++)
+      /* Nothing */;
+    if (idx < len)
+      db->seen_whitespace = true;
+    len = idx;
+  }
+  if (len == 0)
+    return;
+  if (db->finished) {
+    gt_queue_add(db->startqueue, (void*) (db->length));
+    db->finished = false;
+  }
+  if (db->length + len + 1 > db->allocated) {
+    db->buf = gt_dynalloc(db->buf, &db->allocated,
+                          (db->length + len + 1) * sizeof (char));
+  }
+  memcpy(db->buf + db->length, cstr, (size_t) len * sizeof (char));
+  db->curlength += len;
+  db->length += len;
+}
+
 const char* gt_desc_buffer_get_next(GtDescBuffer *db)
 {
   gt_assert(db);
@@ -243,5 +272,25 @@ int gt_desc_buffer_unit_test(GtError *err)
   gt_ensure(gt_desc_buffer_length(s) == 12);
   gt_desc_buffer_delete(s);
 
+  /* appending several characters at once, also with clipping */
+  for (i = 0; !had_err && i < 2UL; i++) {
+    s = gt_desc_buffer_new();
+    if (i == 1UL)
+      gt_desc_buffer_set_clip_at_whitespace(s);
+    gt_desc_buffer_append_chars(s, "foo", 3UL);
+    gt_desc_buffer_append_chars(s, " b", 2UL);
+    gt_desc_buffer_append_chars(s, "ar", 2UL);
+    gt_desc_buffer_finish(s);
+    gt_desc_buffer_append_chars(s, "", 0);
+    gt_desc_buffer_append_chars(s, strs[2], 3UL);
+    gt_desc_buffer_finish(s);
+    ret = gt_desc_buffer_get_next(s);
+    gt_ensure(strcmp(ret, i == 0 ? "foo bar" : strs[0]) == 0);
+    ret = gt_desc_buffer_get_next(s);
+    gt_ensure(strcmp(ret, strs[2]) == 0);
+    gt_ensure(gt_desc_buffer_max_length(s) == (i == 0 ? 8UL : 4UL));
+    gt_desc_buffer_delete(s);
+  }
+
   return had_err;
 }
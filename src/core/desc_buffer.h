@@ -35,6 +35,10 @@ GtUword       gt_desc_buffer_length(const GtDescBuffer *s);
 const char*   gt_desc_buffer_get_next(GtDescBuffer *db);
 /* Append character <c> to <db>. */
 void          gt_desc_buffer_append_char(GtDescBuffer *db, char c);
+/* Append the <len> characters of <cstr> to <db>, which is equivalent to
+   appending them one by one with <gt_desc_buffer_append_char()>. */
+void          gt_desc_buffer_append_chars(GtDescBuffer *db, const char *cstr,
+                                          GtUword len);
 void          gt_desc_buffer_finish(GtDescBuffer *db);
 /* Reset <db> to length 0. */
 void          gt_desc_buffer_reset(GtDescBuffer *db);
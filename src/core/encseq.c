@@ -51,7 +51,7 @@
 #include "core/ma_api.h"
 #include "core/mapspec.h"
 #include "core/mathsupport_api.h"
-#include "core/md5_encoder_api.h"
+#include "core/md5_tab_writer.h"
 #include "core/minmax_api.h"
 #include "core/progressbar.h"
 #include "core/sequence_buffer_fasta.h"
@@ -717,16 +717,151 @@ static void showGtRange(const GtRange *range)
 }
 #endif
 
-void gt_encseq_extract_encoded_with_reader(GtEncseqReader *esr,
-                               const GtEncseq *encseq,
-                               GtUchar *buffer,
-                               GtUword frompos,
-                               GtUword topos)
+/* Maps a byte of a <GtTwobitencoding> to the four codes it contains. */
+#define GT_BYTE2CODES(B)\
+        {((B) >> 6) & 3, ((B) >> 4) & 3, ((B) >> 2) & 3, (B) & 3}
+#define GT_BYTE2CODES4(B)\
+        GT_BYTE2CODES(B), GT_BYTE2CODES((B) + 1),\
+        GT_BYTE2CODES((B) + 2), GT_BYTE2CODES((B) + 3)
+#define GT_BYTE2CODES16(B)\
+        GT_BYTE2CODES4(B), GT_BYTE2CODES4((B) + 4),\
+        GT_BYTE2CODES4((B) + 8), GT_BYTE2CODES4((B) + 12)
+#define GT_BYTE2CODES64(B)\
+        GT_BYTE2CODES16(B), GT_BYTE2CODES16((B) + 16),\
+        GT_BYTE2CODES16((B) + 32), GT_BYTE2CODES16((B) + 48)
+
+static const GtUchar byte2codes[256][4] = {
+  GT_BYTE2CODES64(0), GT_BYTE2CODES64(64),
+  GT_BYTE2CODES64(128), GT_BYTE2CODES64(192)
+};
+
+static void unpacktwobitencoding(const GtTwobitencoding *tbe, GtUchar *buffer,
+                                 GtUword frompos, GtUword topos)
+{
+  GtUword pos = frompos, unit;
+
+  while (pos <= topos && GT_MODBYUNITSIN2BITENC(pos) != 0) {
+    *buffer++ = (GtUchar) EXTRACTENCODEDCHAR(tbe, pos);
+    pos++;
+  }
+  for (unit = GT_DIVBYUNITSIN2BITENC(pos);
+       pos + GT_UNITSIN2BITENC - 1 <= topos;
+       unit++, pos += GT_UNITSIN2BITENC) {
+    GtTwobitencoding bitwise = tbe[unit];
+    int shift;
+
+    for (shift = GT_INTWORDSIZE - CHAR_BIT; shift >= 0; shift -= CHAR_BIT) {
+      memcpy(buffer, byte2codes[(bitwise >> shift) & 0xFF],
+             sizeof (byte2codes[0]));
+      buffer += sizeof (byte2codes[0]);
+    }
+  }
+  for (/* Nothing */; pos <= topos; pos++)
+    *buffer++ = (GtUchar) EXTRACTENCODEDCHAR(tbe, pos);
+}
+
+static GtEncseqReaderViatablesinfo *assignSWstate(GtEncseqReader *esr,
+                                                  KindofSWtable kindsw);
+
+static GtUword fwdgetnexttwobitencodingstopposSW(GtEncseqReader *esr,
+                                                 KindofSWtable kindsw);
+
+/* overwrite the positions of the special ranges of the given kind in
+   <buffer> by <cc> */
+static void patchSWrangesinbuffer(GtEncseqReader *esr, GtUchar *buffer,
+                                  GtUword frompos, GtUword topos,
+                                  KindofSWtable kindsw, GtUchar cc)
+{
+  GtEncseqReaderViatablesinfo *swstate = assignSWstate(esr, kindsw);
+  GtUword pos = frompos, stoppos, endpos;
+
+  while (pos <= topos) {
+    esr->currentpos = pos;
+    stoppos = fwdgetnexttwobitencodingstopposSW(esr, kindsw);
+    if (stoppos > topos)
+      break;
+    gt_assert(swstate->hasprevious && swstate->previousrange.start <= stoppos &&
+              stoppos < swstate->previousrange.end);
+    endpos = GT_MIN(swstate->previousrange.end, topos + 1);
+    memset(buffer + stoppos - frompos, (int) cc, (size_t) (endpos - stoppos));
+    pos = endpos;
+  }
+}
+
+/* Extract the range from <frompos> to <topos> by unpacking whole units of the
+   two bit encoding and overwrite the special positions afterwards. */
+static void encseq_extract_encoded_bulk(GtEncseqReader *esr,
+                                        const GtEncseq *encseq,
+                                        GtUchar *buffer,
+                                        GtUword frompos,
+                                        GtUword topos)
+{
+  GtUword pos;
+
+  unpacktwobitencoding(encseq->twobitencoding, buffer, frompos, topos);
+  if (!encseq->has_specialranges)
+    return;
+  if (encseq->sat == GT_ACCESS_TYPE_EQUALLENGTH) {
+    GtUword seplen = encseq->equallength.valueunsignedlong + 1;
+
+    for (pos = seplen - 1 + (frompos / seplen) * seplen; pos <= topos;
+         pos += seplen) {
+      buffer[pos - frompos] = (GtUchar) GT_SEPARATOR;
+    }
+  }
+  else if (encseq->sat == GT_ACCESS_TYPE_BITACCESS) {
+    if (encseq->specialbits == NULL)
+      return;
+    pos = frompos;
+    while (pos <= topos) {
+      if (GT_MODWORDSIZE(pos) == 0 &&
+          encseq->specialbits[GT_DIVWORDSIZE(pos)] == 0) {
+        pos += GT_INTWORDSIZE;
+        continue;
+      }
+      if (GT_ISIBITSET(encseq->specialbits, pos) &&
+          buffer[pos - frompos] <= (GtUchar) 1) {
+        buffer[pos - frompos]
+          = buffer[pos - frompos] == (GtUchar) GT_TWOBITS_FOR_SEPARATOR
+              ? (GtUchar) GT_SEPARATOR
+              : (GtUchar) GT_WILDCARD;
+      }
+      pos++;
+    }
+  }
+  else {
+    gt_assert(encseq->accesstype_via_utables);
+    gt_encseq_reader_reinit_with_readmode(esr, encseq, GT_READMODE_FORWARD,
+                                          frompos);
+    if (encseq->has_wildcardranges) {
+      patchSWrangesinbuffer(esr, buffer, frompos, topos,
+                            SWtable_wildcardrange, (GtUchar) GT_WILDCARD);
+    }
+    if (encseq->numofdbsequences > 1UL) {
+      patchSWrangesinbuffer(esr, buffer, frompos, topos, SWtable_ssptab,
+                            (GtUchar) GT_SEPARATOR);
+    }
+  }
+}
+
+/* The bulk extraction unpacks whole words of the two bit encoding, as long
+   as the range is not in the mirrored part of the sequence. */
+static bool encseq_bulk_extraction_possible(const GtEncseq *encseq,
+                                            GtUword topos)
+{
+  return gt_encseq_has_twobitencoding(encseq) &&
+         encseq->twobitencoding != NULL &&
+         topos < encseq->totallength;
+}
+
+static void encseq_extract_encoded_per_char(GtEncseqReader *esr,
+                                            const GtEncseq *encseq,
+                                            GtUchar *buffer,
+                                            GtUword frompos,
+                                            GtUword topos)
 {
   GtUword idx, pos;
 
-  gt_assert(frompos <= topos && encseq != NULL &&
-            topos < encseq->logicaltotallength && buffer != NULL);
   gt_encseq_reader_reinit_with_readmode(esr, encseq, GT_READMODE_FORWARD,
                                         frompos);
   for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
@@ -734,22 +869,33 @@ void gt_encseq_extract_encoded_with_reader(GtEncseqReader *esr,
   }
 }
 
+void gt_encseq_extract_encoded_with_reader(GtEncseqReader *esr,
+                               const GtEncseq *encseq,
+                               GtUchar *buffer,
+                               GtUword frompos,
+                               GtUword topos)
+{
+  gt_assert(frompos <= topos && encseq != NULL &&
+            topos < encseq->logicaltotallength && buffer != NULL);
+  if (encseq_bulk_extraction_possible(encseq, topos))
+    encseq_extract_encoded_bulk(esr, encseq, buffer, frompos, topos);
+  else
+    encseq_extract_encoded_per_char(esr, encseq, buffer, frompos, topos);
+}
+
 void gt_encseq_extract_encoded(const GtEncseq *encseq,
                                GtUchar *buffer,
                                GtUword frompos,
                                GtUword topos)
 {
   GtEncseqReader *esr;
-  GtUword idx, pos;
 
   gt_assert(frompos <= topos && encseq != NULL &&
             topos < encseq->logicaltotallength && buffer != NULL);
   esr = gt_encseq_create_reader_with_readmode(encseq,
                                               GT_READMODE_FORWARD,
                                               frompos);
-  for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
-    buffer[idx] = gt_encseq_reader_next_encoded_char(esr);
-  }
+  gt_encseq_extract_encoded_with_reader(esr, encseq, buffer, frompos, topos);
   gt_encseq_reader_delete(esr);
 }
 
@@ -763,6 +909,23 @@ void gt_encseq_extract_decoded_with_reader(GtEncseqReader *esr,
 
   gt_assert(frompos <= topos && encseq != NULL &&
             topos < encseq->logicaltotallength && buffer != NULL);
+  if (!encseq->has_exceptiontable &&
+      encseq_bulk_extraction_possible(encseq, topos)) {
+    /* decode the extracted codes in place */
+    char decodetab[UCHAR_MAX + 1];
+    unsigned int cc, numofchars = gt_alphabet_num_of_chars(encseq->alpha);
+
+    for (cc = 0; cc < numofchars; cc++)
+      decodetab[cc] = gt_alphabet_decode(encseq->alpha, (GtUchar) cc);
+    decodetab[GT_WILDCARD] = gt_alphabet_decode(encseq->alpha,
+                                                (GtUchar) GT_WILDCARD);
+    decodetab[GT_SEPARATOR] = (char) GT_SEPARATOR;
+    encseq_extract_encoded_bulk(esr, encseq, (GtUchar *) buffer, frompos,
+                                topos);
+    for (idx = 0; idx <= topos - frompos; idx++)
+      buffer[idx] = decodetab[(GtUchar) buffer[idx]];
+    return;
+  }
   gt_encseq_reader_reinit_with_readmode(esr, encseq, GT_READMODE_FORWARD,
                                         frompos);
   for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
@@ -776,16 +939,13 @@ void gt_encseq_extract_decoded(const GtEncseq *encseq,
                                GtUword topos)
 {
   GtEncseqReader *esr;
-  GtUword idx, pos;
 
   gt_assert(frompos <= topos && encseq != NULL &&
             topos < encseq->logicaltotallength && buffer != NULL);
   esr = gt_encseq_create_reader_with_readmode(encseq,
                                               GT_READMODE_FORWARD,
                                               frompos);
-  for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
-    buffer[idx] = gt_encseq_reader_next_decoded_char(esr);
-  }
+  gt_encseq_extract_decoded_with_reader(esr, encseq, buffer, frompos, topos);
   gt_encseq_reader_delete(esr);
 }
 
@@ -2047,6 +2207,8 @@ void gt_encseq_delete(GtEncseq *encseq)
     gt_md5_tab_delete(encseq->md5_tab);
   if (encseq->indexname != NULL)
     gt_free(encseq->indexname);
+  gt_mutex_delete(encseq->lazy_lock);
+  gt_seqnum_index_delete(encseq->seqnumindex);
   gt_mutex_unlock(encseq->refcount_lock);
   gt_mutex_delete(encseq->refcount_lock);
   gt_free(encseq);
@@ -3187,6 +3349,11 @@ void gt_encseq_reader_delete(GtEncseqReader *esr)
 static GtUword gt_encseq_seqstartpos_viautables(const GtEncseq *encseq,
                                                       GtUword seqnum)
 {
+  if (encseq->seqnumindex != NULL) {
+    return seqnum == 0
+           ? 0
+           : gt_seqnum_index_separator(encseq->seqnumindex, seqnum - 1) + 1;
+  }
   switch (encseq->satsep) {
     case GT_ACCESS_TYPE_UCHARTABLES:
       return gt_encseq_seqstartposSW_uchar(&encseq->ssptab.st_uchar,
@@ -3938,6 +4105,9 @@ GtUword gt_encseq_seqnum(const GtEncseq *encseq,
     if (encseq->numofdbsequences == 1UL) {
       num = 0;
     }
+    else if (encseq->seqnumindex != NULL) {
+      num = gt_seqnum_index_seqnum(encseq->seqnumindex, position);
+    }
     else {
       num = gt_encseq_seqnum_ssptab(encseq, position);
     }
@@ -4130,6 +4300,12 @@ static GtEncseq *determineencseqkeyvalues(GtEncseqAccessType sat,
   encseq->headerptr.maxseqlenptr = NULL;
   encseq->reference_count = 0;
   encseq->refcount_lock = gt_mutex_new();
+  encseq->lazy_destab = false;
+  encseq->lazy_sdstab = false;
+  encseq->lazy_md5tab = false;
+  encseq->lazy_destabs_mapped = false;
+  encseq->lazy_lock = gt_mutex_new();
+  encseq->seqnumindex = NULL;
   encseq->destab = NULL;
   encseq->hasmirror = false;
   encseq->hasallocateddestab = false;
@@ -4656,12 +4832,109 @@ static GtEncseq *files2encodedsequence(const GtStrArray *filenametab,
   return haserr ? NULL : encseq;
 }
 
+static int encseq_map_destab(GtEncseq *encseq, GtError *err)
+{
+  size_t numofbytes;
+
+  encseq->destab = gt_fa_mmap_read_with_suffix(encseq->indexname,
+                                               GT_DESTABFILESUFFIX,
+                                               &numofbytes,
+                                               err);
+  encseq->destablength = (GtUword) numofbytes;
+  return encseq->destab == NULL ? -1 : 0;
+}
+
+static int encseq_map_sdstab(GtEncseq *encseq, GtError *err)
+{
+  gt_assert(encseq->numofdbsequences > 1UL);
+  encseq->sdstab = gt_fa_mmap_check_size_with_suffix(encseq->indexname,
+                                                     GT_SDSTABFILESUFFIX,
+                                                     encseq->numofdbsequences
+                                                       - 1,
+                                                     sizeof (*encseq->sdstab),
+                                                     err);
+  return encseq->sdstab == NULL ? -1 : 0;
+}
+
+static int encseq_map_md5tab(GtEncseq *encseq, GtError *err)
+{
+  GtStr *md5fn = gt_str_new_cstr(encseq->indexname);
+
+  gt_str_append_cstr(md5fn, GT_MD5TABFILESUFFIX);
+  encseq->md5_tab = gt_md5_tab_new_from_cache_file(gt_str_get(md5fn),
+                                                   encseq->numofdbsequences,
+                                                   true,
+                                                   err);
+  gt_str_delete(md5fn);
+  return encseq->md5_tab == NULL ? -1 : 0;
+}
+
+/* Checks at load time that a table deferred by a lazy loader can be read and
+   has <expectedsize> bytes, or is not empty if <expectedsize> is 0. Mapping
+   the table later can then only fail due to lack of resources. */
+static int encseq_lazy_table_check(const char *indexname, const char *suffix,
+                                   GtUword expectedsize, GtError *err)
+{
+  FILE *fp;
+  off_t size;
+
+  if (!(fp = gt_fa_fopen_with_suffix(indexname, suffix, "rb", err)))
+    return -1;
+  gt_fa_xfclose(fp);
+  size = gt_file_size_with_suffix(indexname, suffix);
+  if (expectedsize > 0 ? (GtUword) size != expectedsize : size == 0) {
+    gt_error_set(err, "file \"%s%s\" has an invalid size of "GT_WU" bytes",
+                 indexname, suffix, (GtUword) size);
+    return -1;
+  }
+  return 0;
+}
+
+/* Maps the description tables deferred by a lazy loader on their first
+   access. The lazy flags are never changed after loading. The lock is only
+   taken until the tables are mapped, <lazy_destabs_mapped> is set after the
+   table pointers. */
+static void encseq_map_lazy_destabs(const GtEncseq *encseq)
+{
+  GtEncseq *mutable_encseq = (GtEncseq*) encseq;
+  size_t numofbytes;
+
+  gt_mutex_lock(mutable_encseq->lazy_lock);
+  if (mutable_encseq->lazy_destab && mutable_encseq->destab == NULL) {
+    GtStr *filename = gt_str_new_cstr(encseq->indexname);
+    gt_str_append_cstr(filename, GT_DESTABFILESUFFIX);
+    mutable_encseq->destab = gt_fa_xmmap_read(gt_str_get(filename),
+                                              &numofbytes);
+    mutable_encseq->destablength = (GtUword) numofbytes;
+    gt_str_delete(filename);
+  }
+  if (mutable_encseq->lazy_sdstab && mutable_encseq->sdstab == NULL) {
+    GtStr *filename = gt_str_new_cstr(encseq->indexname);
+    gt_str_append_cstr(filename, GT_SDSTABFILESUFFIX);
+    mutable_encseq->sdstab = gt_fa_xmmap_read(gt_str_get(filename),
+                                              &numofbytes);
+    gt_assert(numofbytes == sizeof (*encseq->sdstab)
+                            * (encseq->numofdbsequences - 1));
+    gt_str_delete(filename);
+  }
+  mutable_encseq->lazy_destabs_mapped = true;
+  gt_mutex_unlock(mutable_encseq->lazy_lock);
+}
+
+#define GT_ENCSEQ_MAP_LAZY_DESTABS(ENCSEQ)\
+        do {\
+          if (((ENCSEQ)->lazy_destab || (ENCSEQ)->lazy_sdstab) &&\
+              !(ENCSEQ)->lazy_destabs_mapped)\
+            encseq_map_lazy_destabs(ENCSEQ);\
+        } while (0)
+
 static GtEncseq* gt_encseq_new_from_index(const char *indexname,
                                           bool withdestab,
                                           bool withsdstab,
                                           bool withssptab,
                                           bool withoistab,
                                           bool withmd5tab,
+                                          bool lazy,
                                           GtLogger *logger,
                                           GtError *err)
 {
@@ -4739,27 +5012,28 @@ static GtEncseq* gt_encseq_new_from_index(const char *indexname,
                                        encseq->headerptr.characterdistribution);
   }
   if (!haserr && withdestab) {
-    size_t numofbytes;
-
     gt_assert(encseq != NULL);
-    encseq->destab = gt_fa_mmap_read_with_suffix(indexname,
-                                                 GT_DESTABFILESUFFIX,
-                                                 &numofbytes,
-                                                 err);
-    encseq->destablength = (GtUword) numofbytes;
-    if (encseq->destab == NULL)
+    if (lazy) {
+      if (encseq_lazy_table_check(indexname, GT_DESTABFILESUFFIX, 0, err) != 0)
+        haserr = true;
+      encseq->lazy_destab = true;
+    }
+    else if (encseq_map_destab(encseq, err) != 0)
       haserr = true;
   }
   if (!haserr && withsdstab) {
     gt_assert(encseq != NULL);
     if (encseq->numofdbsequences > 1UL) {
-      encseq->sdstab =
-        gt_fa_mmap_check_size_with_suffix(indexname,
-                                          GT_SDSTABFILESUFFIX,
-                                          encseq->numofdbsequences - 1,
-                                          sizeof (*encseq->sdstab),
-                                          err);
-      if (encseq->sdstab == NULL)
+      if (lazy) {
+        if (encseq_lazy_table_check(indexname, GT_SDSTABFILESUFFIX,
+                                    sizeof (*encseq->sdstab)
+                                    * (encseq->numofdbsequences - 1),
+                                    err) != 0) {
+          haserr = true;
+        }
+        encseq->lazy_sdstab = true;
+      }
+      else if (encseq_map_sdstab(encseq, err) != 0)
         haserr = true;
     }
     else
@@ -4781,18 +5055,17 @@ static GtEncseq* gt_encseq_new_from_index(const char *indexname,
       haserr = true;
   }
   if (!haserr && withmd5tab) {
-    GtStr *md5fn;
     gt_assert(encseq != NULL);
-
-    md5fn = gt_str_new_cstr(indexname);
-    gt_str_append_cstr(md5fn, GT_MD5TABFILESUFFIX);
-    encseq->md5_tab = gt_md5_tab_new_from_cache_file(gt_str_get(md5fn),
-                                                     encseq->numofdbsequences,
-                                                     true,
-                                                     err);
-    if (!encseq->md5_tab)
+    if (lazy) {
+      /* each fingerprint is stored with a terminating '\0' */
+      if (encseq_lazy_table_check(indexname, GT_MD5TABFILESUFFIX,
+                                  encseq->numofdbsequences * 33, err) != 0) {
+        haserr = true;
+      }
+      encseq->lazy_md5tab = true;
+    }
+    else if (encseq_map_md5tab(encseq, err) != 0)
       haserr = true;
-    gt_str_delete(md5fn);
   }
   if (!haserr) {
     gt_assert(encseq != NULL);
@@ -4829,7 +5102,9 @@ const char* gt_encseq_description(const GtEncseq *encseq,
 {
   GtUword destablen;
 
-  gt_assert(encseq != NULL && encseq->destab != NULL);
+  gt_assert(encseq != NULL);
+  GT_ENCSEQ_MAP_LAZY_DESTABS(encseq);
+  gt_assert(encseq->destab != NULL);
   if (encseq->destab[encseq->destablength - 1] == '\n') {
     destablen = encseq->destablength;
   } else {
@@ -4864,7 +5139,9 @@ const char* gt_encseq_description(const GtEncseq *encseq,
 
 GtUword gt_encseq_max_desc_length(const GtEncseq *encseq)
 {
-  gt_assert(encseq && encseq->destab);
+  gt_assert(encseq);
+  GT_ENCSEQ_MAP_LAZY_DESTABS(encseq);
+  gt_assert(encseq->destab);
   /* decides whether destab contains max desc length as a separate field */
   if (encseq->destab[encseq->destablength - 1] == '\n') {
     GtUword i,
@@ -4960,9 +5237,9 @@ bool gt_encseq_has_multiseq_support(const GtEncseq *encseq)
 
 bool gt_encseq_has_description_support(const GtEncseq *encseq)
 {
-  bool ret = (encseq->destab != NULL
+  bool ret = ((encseq->lazy_destab || encseq->destab != NULL)
                 && (encseq->numofdbsequences == 1UL
-                      || encseq->sdstab != NULL));
+                      || encseq->lazy_sdstab || encseq->sdstab != NULL));
   return ret;
 }
 
@@ -5457,6 +5734,9 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
                                            GtUword *maxseqlen,
                                            bool clip_desc,
                                            GtDustMasker *dust_masker,
+                                           GtSequenceBufferQualityFunc
+                                                                  quality_func,
+                                           void *quality_data,
                                            GtLogger *logger,
                                            GtError *err)
 {
@@ -5469,16 +5749,12 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
                 lastnonspecialrangelength = 0,
                 lengthofcurrentsequence = 0,
                 lengthofalphadef,
-                *originaldistribution = NULL,
-                md5_blockcount = 0;
+                *originaldistribution = NULL;
   bool specialprefix = true, wildcardprefix = true, haserr = false;
   GtDiscDistri *distspecialrangelength = NULL, *distwildcardrangelength = NULL;
   GtDescBuffer *descqueue = NULL;
-  GtMD5Encoder *md5enc = NULL;
-  char *desc,
-       md5_blockbuf[64],
-       md5_outbuf[33];
-  unsigned char md5_output[16];
+  GtMD5TabWriter *md5tabwriter = NULL;
+  char *desc;
   FILE *desfp = NULL, *sdsfp = NULL, *oisfp = NULL, *md5fp = NULL;
 
   gt_error_check(err);
@@ -5500,6 +5776,15 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
   }
   if (!fb)
     haserr = true;
+  if (!haserr && quality_func != NULL) {
+    if (plainformat) {
+      gt_error_set(err, "qualities can only be read from FASTQ files");
+      haserr = true;
+    }
+    else if (gt_sequence_buffer_set_quality_func(fb, quality_func,
+                                                 quality_data, err) != 0)
+      haserr = true;
+  }
   if (!haserr && outdestab) {
     descqueue = gt_desc_buffer_new();
     if (clip_desc)
@@ -5533,7 +5818,7 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
     originaldistribution = gt_calloc((size_t) UCHAR_MAX,
                                      sizeof (GtUword));
     if (md5fp != NULL)
-      md5enc = gt_md5_encoder_new();
+      md5tabwriter = gt_md5_tab_writer_new(md5fp);
     for (currentpos = 0; !haserr; currentpos++) {
 #if !(defined (_LP64) || defined (_WIN64))
 #define MAXSFXLENFOR32BIT 4294000000UL
@@ -5579,10 +5864,10 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
             gt_disc_distri_add(distwildcardrangelength,
                                lastwildcardrangelength);
           }
-          if (md5enc != NULL) {
-            gt_md5_encoder_add_block(md5enc, md5_blockbuf, md5_blockcount);
-            gt_md5_encoder_finish(md5enc, md5_output, md5_outbuf);
-            gt_xfwrite(md5_outbuf, sizeof (char), (size_t) 33, md5fp);
+          if (md5tabwriter != NULL &&
+              (gt_md5_tab_writer_end_sequence(md5tabwriter, err) != 0 ||
+               gt_md5_tab_writer_flush(md5tabwriter, err) != 0)) {
+            haserr = true;
           }
           if (equallength->defined) {
             if (equallength->valueunsignedlong > 0) {
@@ -5605,7 +5890,7 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
         break;
       }
     }
-    gt_md5_encoder_delete(md5enc);
+    gt_md5_tab_writer_delete(md5tabwriter);
   }
   if (!haserr) {
     alphabet_to_key_values(alpha, NULL, &lengthofalphadef, NULL,
@@ -5685,40 +5970,42 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
   return haserr ? -1 : 0;
 }
 
-GtMD5Tab* gt_encseq_get_md5_tab(const GtEncseq *encseq,
-                                GT_UNUSED GtError *err)
+GtMD5Tab* gt_encseq_get_md5_tab(const GtEncseq *encseq, GtError *err)
 {
+  GtEncseq *mutable_encseq = (GtEncseq*) encseq;
+  GtMD5Tab *md5_tab;
   gt_assert(encseq);
   gt_error_check(err);
 
-  return gt_md5_tab_ref(encseq->md5_tab);
+  if (!encseq->lazy_md5tab)
+    return gt_md5_tab_ref(encseq->md5_tab);
+  gt_mutex_lock(mutable_encseq->lazy_lock);
+  if (encseq->md5_tab == NULL)
+    (void) encseq_map_md5tab(mutable_encseq, err);
+  md5_tab = gt_md5_tab_ref(encseq->md5_tab);
+  gt_mutex_unlock(mutable_encseq->lazy_lock);
+  return md5_tab;
 }
 
 bool gt_encseq_has_md5_support(const GtEncseq *encseq)
 {
   gt_assert(encseq);
-  return (encseq->md5_tab != NULL);
+  return (encseq->lazy_md5tab || encseq->md5_tab != NULL);
 }
 
 static void sequence2specialcharinfo(GtSpecialcharinfo *specialcharinfo,
                                      const GtUchar *seq,
                                      const GtUword len,
-                                     GtAlphabet *a,
                                      GtLogger *logger)
 {
   GtUchar charcode;
   GtUword currentpos,
                 lastspecialrangelength = 0,
                 lastnonspecialrangelength = 0,
-                lastwildcardrangelength = 0,
-                md5_blockcount = 0;
+                lastwildcardrangelength = 0;
   bool specialprefix = true, wildcardprefix = true;
   GtDiscDistri *distspecialrangelength,
                *distwildcardrangelength;
-  GtMD5Encoder *md5enc = NULL;
-  char md5_blockbuf[64];
-  GT_UNUSED char md5_outbuf[33];
-  unsigned char md5_output[16];
 
   specialcharinfo->specialcharacters = 0;
   specialcharinfo->wildcards = 0;
@@ -5727,10 +6014,7 @@ static void sequence2specialcharinfo(GtSpecialcharinfo *specialcharinfo,
   distspecialrangelength = gt_disc_distri_new();
   distwildcardrangelength = gt_disc_distri_new();
 
-  md5enc = gt_md5_encoder_new();
   for (currentpos = 0; currentpos < len; currentpos++) {
-    char cc = '\0';
-    bool outoistab = false;
     charcode = seq[currentpos];
 #undef WITHEQUALLENGTH_DES_SSP
 #undef WITHOISTAB
@@ -5753,7 +6037,6 @@ static void sequence2specialcharinfo(GtSpecialcharinfo *specialcharinfo,
   specialcharinfo->wildcardranges = specialcharinfo->realwildcardranges;
   gt_disc_distri_delete(distspecialrangelength);
   gt_disc_distri_delete(distwildcardrangelength);
-  gt_md5_encoder_delete(md5enc);
 }
 
 static GtUword fwdgetnexttwobitencodingstopposViaequallength(
@@ -7533,6 +7816,9 @@ static GtEncseq* gt_encseq_new_from_files(GtTimer *sfxprogress,
                                           GtUword dust_windowsize,
                                           double dust_threshold,
                                           GtUword dust_linker,
+                                          GtSequenceBufferQualityFunc
+                                                                  quality_func,
+                                          void *quality_data,
                                           GtLogger *logger,
                                           GtError *err)
 {
@@ -7630,6 +7916,8 @@ static GtEncseq* gt_encseq_new_from_files(GtTimer *sfxprogress,
                                         &maxseqlen,
                                         clip_desc,
                                         dust_masker,
+                                        quality_func,
+                                        quality_data,
                                         logger,
                                         err) != 0) {
       char buf[BUFSIZ];
@@ -8183,6 +8471,8 @@ struct GtEncseqEncoder {
   double dust_threshold;
   GtStr *sat,
         *smapfile;
+  GtSequenceBufferQualityFunc quality_func;
+  void *quality_data;
   GtLogger *logger;
   GtTimer *pt;
 };
@@ -8477,6 +8767,16 @@ void gt_encseq_encoder_enable_dust(GtEncseqEncoder *ee, bool echo, GtUword ws,
   ee->dust_linker = linker;
 }
 
+void gt_encseq_encoder_set_quality_func(GtEncseqEncoder *ee,
+                                        GtSequenceBufferQualityFunc
+                                                                  quality_func,
+                                        void *data)
+{
+  gt_assert(ee);
+  ee->quality_func = quality_func;
+  ee->quality_data = data;
+}
+
 bool gt_encseq_encoder_is_input_preencoded(GtEncseqEncoder *ee)
 {
   gt_assert(ee);
@@ -8551,6 +8851,8 @@ int gt_encseq_encoder_encode(GtEncseqEncoder *ee, GtStrArray *seqfiles,
                                     ee->dust_windowsize,
                                     ee->dust_threshold,
                                     ee->dust_linker,
+                                    ee->quality_func,
+                                    ee->quality_data,
                                     ee->logger,
                                     err);
   if (!encseq)
@@ -8574,7 +8876,9 @@ struct GtEncseqLoader {
        sdstab,
        md5tab,
        mirrored,
-       autodiscover;
+       autodiscover,
+       lazy,
+       seqnumindex;
   GtLogger *logger;
 };
 
@@ -8779,6 +9083,46 @@ void gt_encseq_loader_do_not_mirror(GtEncseqLoader *el)
   el->mirrored = false;
 }
 
+void gt_encseq_loader_enable_lazy_loading(GtEncseqLoader *el)
+{
+  gt_assert(el);
+  el->lazy = true;
+}
+
+void gt_encseq_loader_disable_lazy_loading(GtEncseqLoader *el)
+{
+  gt_assert(el);
+  el->lazy = false;
+}
+
+void gt_encseq_loader_enable_seqnum_index(GtEncseqLoader *el)
+{
+  gt_assert(el);
+  el->seqnumindex = true;
+}
+
+void gt_encseq_loader_disable_seqnum_index(GtEncseqLoader *el)
+{
+  gt_assert(el);
+  el->seqnumindex = false;
+}
+
+static void gt_encseq_build_seqnum_index(GtEncseq *encseq)
+{
+  GtUword *separators;
+
+  if (encseq->sat == GT_ACCESS_TYPE_EQUALLENGTH ||
+      encseq->numofdbsequences == 1UL)
+    return; /* positions are computed directly */
+  separators = gt_all_sequence_separators_get(encseq);
+  if (separators == NULL)
+    return; /* no ssptab loaded */
+  encseq->seqnumindex = gt_seqnum_index_new(separators,
+                                            encseq->numofdbsequences - 1,
+                                            encseq->totallength);
+  gt_free(separators);
+}
+
 GtEncseq* gt_encseq_loader_load(GtEncseqLoader *el, const char *indexname,
                                 GtError *err)
 {
@@ -8804,9 +9148,9 @@ GtEncseq* gt_encseq_loader_load(GtEncseqLoader *el, const char *indexname,
       el->md5tab = true;
   }
   gt_log_log("loading encseq %s with des: %d, sds: %d, ssp: %d, ois: %d, "
-             "md5: %d, mirr: %d",
+             "md5: %d, mirr: %d, lazy: %d",
              indexname, el->destab, el->sdstab, el->ssptab, el->oistab,
-             el->md5tab, el->mirrored);
+             el->md5tab, el->mirrored, el->lazy);
 
   encseq = gt_encseq_new_from_index(indexname,
                                     el->destab,
@@ -8814,8 +9158,11 @@ GtEncseq* gt_encseq_loader_load(GtEncseqLoader *el, const char *indexname,
                                     el->ssptab,
                                     el->oistab,
                                     el->md5tab,
+                                    el->lazy,
                                     el->logger,
                                     err);
+  if (encseq && el->seqnumindex)
+    gt_encseq_build_seqnum_index(encseq);
   if (encseq && el->mirrored) {
     if (gt_encseq_mirror(encseq, err) != 0) {
       gt_encseq_delete(encseq);
@@ -9152,7 +9499,7 @@ GtEncseq* gt_encseq_builder_build(GtEncseqBuilder *eb, GT_UNUSED GtError *err)
 
   gt_assert(eb->plainseq);
   sequence2specialcharinfo(&samplespecialcharinfo, eb->plainseq,
-                           eb->seqlen, eb->alpha, eb->logger);
+                           eb->seqlen, eb->logger);
   encseq = determineencseqkeyvalues(sat,
                                     eb->seqlen,
                                     eb->nof_seqs,
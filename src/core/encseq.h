@@ -32,6 +32,7 @@
 #include "core/md5_tab_api.h"
 #include "core/range_api.h"
 #include "core/readmode.h"
+#include "core/sequence_buffer.h"
 #include "core/str_api.h"
 #include "core/str_array.h"
 #include "core/types_api.h"
@@ -462,6 +463,14 @@ int gt_specialcharinfo_read(GtSpecialcharinfo *specialcharinfo,
    use. */
 void  gt_encseq_encoder_set_input_preencoded(GtEncseqEncoder *ee);
 
+/* Sets a function <quality_func> which is called with <data> for the
+   qualities of each sequence read by <ee> from FASTQ input, in the order of
+   the sequences. Encoding fails for input without qualities. */
+void gt_encseq_encoder_set_quality_func(GtEncseqEncoder *ee,
+                                        GtSequenceBufferQualityFunc
+                                                                  quality_func,
+                                        void *data);
+
 /* Returns <true> if the input sequence has been defined as being pre-encoded.
  */
 bool gt_encseq_encoder_is_input_preencoded(GtEncseqEncoder *ee);
@@ -446,6 +446,24 @@ void              gt_encseq_loader_mirror(GtEncseqLoader *el);
 /* Disables loading of a sequence using <el> with mirroring enabled right from
    the start. */
 void              gt_encseq_loader_do_not_mirror(GtEncseqLoader *el);
+/* Enables lazy loading of a sequence using <el>: the description tables (.des,
+   .sds) and the MD5 table (.md5) are only mapped on their first access, which
+   is thread-safe. Required tables are checked for readability and size when
+   loading, so that mapping them later on only fails if the system runs out of
+   resources. */
+void              gt_encseq_loader_enable_lazy_loading(GtEncseqLoader *el);
+/* Disables lazy loading of a sequence using <el>, all required tables are
+   mapped when loading. This is the default. */
+void              gt_encseq_loader_disable_lazy_loading(GtEncseqLoader *el);
+/* Enables building a sampled lookup table for the sequence separators when
+   loading a sequence using <el>, making <gt_encseq_seqnum()> and
+   <gt_encseq_seqstartpos()> almost constant time operations at the expense
+   of about five bytes per sequence. Useful for collections of many short
+   sequences, has no effect if multiseq support is not required. */
+void              gt_encseq_loader_enable_seqnum_index(GtEncseqLoader *el);
+/* Disables building a lookup table for the sequence separators when loading a
+   sequence using <el>. This is the default. */
+void              gt_encseq_loader_disable_seqnum_index(GtEncseqLoader *el);
 /* Attempts to map the index files as specified by <indexname> using the options
    set in <el> using this interface. Returns a <GtEncseq> instance
    on success, or <NULL> on error. If an error occurred, <err> is set
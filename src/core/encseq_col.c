@@ -182,7 +182,7 @@ static int gt_encseq_col_grep_desc(GtSeqCol *sc, char **seq,
     }
   }
   if (!had_err) {
-    *seq = gt_seq_col_get_sequence(sc, filenum, seqnum, start, end);
+    *seq = gt_seq_col_get_sequence(sc, filenum, seqnum, start, end, err);
   }
   return had_err;
 }
@@ -198,7 +198,7 @@ static int gt_encseq_col_grep_desc_md5(GtSeqCol *sc, const char **md5,
   gt_assert(esc && md5 && seqid);
   had_err = gt_encseq_col_do_grep_desc(esc, &filenum, &seqnum, seqid, err);
   if (!had_err)
-    *md5 = gt_seq_col_get_md5_fingerprint(sc, filenum, seqnum);
+    *md5 = gt_seq_col_get_md5_fingerprint(sc, filenum, seqnum, err);
   return had_err;
 }
 
@@ -213,7 +213,7 @@ static int gt_encseq_col_grep_desc_desc(GtSeqCol *sc, GtStr *desc,
   gt_assert(esc && desc && seqid);
   had_err = gt_encseq_col_do_grep_desc(esc, &filenum, &seqnum, seqid, err);
   if (!had_err) {
-    char *mydesc = gt_seq_col_get_description(sc, filenum, seqnum);
+    char *mydesc = gt_seq_col_get_description(sc, filenum, seqnum, err);
     if (mydesc)
       gt_str_append_cstr(desc, mydesc);
     gt_free(mydesc);
@@ -369,9 +369,11 @@ static GtUword gt_encseq_col_num_of_seqs(const GtSeqCol *sc,
 
 static const char* gt_encseq_col_get_md5_fingerprint(const GtSeqCol *sc,
                                                      GtUword filenum,
-                                                     GtUword seqnum)
+                                                     GtUword seqnum,
+                                                     GtError *err)
 {
   GtEncseqCol *esc;
+  gt_error_check(err);
   esc = gt_encseq_col_cast(sc);
   gt_assert(esc && filenum < gt_encseq_num_of_files(esc->encseq));
   return gt_md5_tab_get(esc->md5_tab,
@@ -383,11 +385,13 @@ static char* gt_encseq_col_get_sequence(const GtSeqCol *sc,
                                         GtUword filenum,
                                         GtUword seqnum,
                                         GtUword start,
-                                        GtUword end)
+                                        GtUword end,
+                                        GtError *err)
 {
   GtEncseqCol *esc;
   char *out;
   GtUword encseq_seqnum, startpos;
+  gt_error_check(err);
   esc = gt_encseq_col_cast(sc);
   gt_assert(esc && filenum < gt_encseq_num_of_files(esc->encseq));
   encseq_seqnum = gt_encseq_filenum_first_seqnum(esc->encseq, filenum) + seqnum;
@@ -401,11 +405,13 @@ static char* gt_encseq_col_get_sequence(const GtSeqCol *sc,
 
 static char* gt_encseq_col_get_description(const GtSeqCol *sc,
                                            GtUword filenum,
-                                           GtUword seqnum)
+                                           GtUword seqnum,
+                                           GtError *err)
 {
   GtEncseqCol *esc;
   const char *desc;
   GtUword encseq_seqnum, desclen;
+  gt_error_check(err);
   esc = gt_encseq_col_cast(sc);
   gt_assert(esc && filenum < gt_encseq_num_of_files(esc->encseq));
   encseq_seqnum = gt_encseq_filenum_first_seqnum(esc->encseq, filenum) + seqnum;
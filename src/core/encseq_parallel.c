@@ -0,0 +1,363 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/array_api.h"
+#include "core/assert_api.h"
+#include "core/encseq_parallel.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/multithread_api.h"
+#include "core/readmode.h"
+#include "core/thread_api.h"
+#include "core/unused_api.h"
+
+/* number of chunks processed in one parallel round per thread */
+#define GT_ENCSEQ_PARALLEL_CHUNKS_PER_JOB  4U
+/* bounds for the total length of the sequences of a chunk, the upper bound
+   limits the amount of results buffered before they are collected */
+#define GT_ENCSEQ_PARALLEL_MINCHUNKLENGTH  (1UL << 16)
+#define GT_ENCSEQ_PARALLEL_MAXCHUNKLENGTH  (1UL << 22)
+
+typedef struct {
+  GtUword from, to;
+  void *chunk;
+  GtError *err;
+  bool had_err;
+} GtEncseqParallelChunk;
+
+typedef struct {
+  const GtEncseq *encseq;
+  GtReadmode readmode;
+  GtEncseqSeqFunc seq_func;
+  void *data;
+  GtEncseqParallelChunk *chunks;
+  unsigned int numofchunks,
+               nextchunk;
+  GtMutex *mutex;
+} GtEncseqParallelInfo;
+
+/* returns the start position of sequence <seqnum> with respect to
+   <readmode> and stores its length in <seqlength> */
+static GtUword encseq_parallel_seqstartpos(const GtEncseq *encseq,
+                                           GtReadmode readmode,
+                                           GtUword seqnum,
+                                           GtUword *seqlength)
+{
+  GtUword physseqnum;
+
+  if (!GT_ISDIRREVERSE(readmode)) {
+    *seqlength = gt_encseq_seqlength(encseq, seqnum);
+    return gt_encseq_seqstartpos(encseq, seqnum);
+  }
+  physseqnum = gt_encseq_num_of_sequences(encseq) - 1 - seqnum;
+  *seqlength = gt_encseq_seqlength(encseq, physseqnum);
+  return gt_encseq_total_length(encseq)
+         - (gt_encseq_seqstartpos(encseq, physseqnum) + *seqlength);
+}
+
+/* returns the number of the sequence containing <position> with respect to
+   <readmode> */
+static GtUword encseq_parallel_seqnum(const GtEncseq *encseq,
+                                      GtReadmode readmode,
+                                      GtUword position)
+{
+  if (!GT_ISDIRREVERSE(readmode))
+    return gt_encseq_seqnum(encseq, position);
+  return gt_encseq_num_of_sequences(encseq) - 1
+         - gt_encseq_seqnum(encseq, gt_encseq_total_length(encseq) - 1
+                                    - position);
+}
+
+/* the worker threads fetch the index of the next chunk to process */
+static bool encseq_parallel_next_job(GtEncseqParallelInfo *info,
+                                     unsigned int *chunknum)
+{
+  bool has_job = false;
+  gt_mutex_lock(info->mutex);
+  if (info->nextchunk < info->numofchunks) {
+    *chunknum = info->nextchunk++;
+    has_job = true;
+  }
+  gt_mutex_unlock(info->mutex);
+  return has_job;
+}
+
+static void* encseq_parallel_thread(void *data)
+{
+  GtEncseqParallelInfo *info = data;
+  GtEncseqReader *esr = NULL;
+  unsigned int chunknum;
+
+  while (encseq_parallel_next_job(info, &chunknum)) {
+    GtEncseqParallelChunk *chunk = info->chunks + chunknum;
+    GtUword seqnum;
+
+    for (seqnum = chunk->from; !chunk->had_err && seqnum <= chunk->to;
+         seqnum++) {
+      GtUword seqlength,
+              seqstartpos = encseq_parallel_seqstartpos(info->encseq,
+                                                        info->readmode,
+                                                        seqnum, &seqlength);
+      if (seqlength > 0) {
+        if (esr == NULL) {
+          esr = gt_encseq_create_reader_with_readmode(info->encseq,
+                                                      info->readmode,
+                                                      seqstartpos);
+        } else {
+          gt_encseq_reader_reinit_with_readmode(esr, info->encseq,
+                                                info->readmode, seqstartpos);
+        }
+      }
+      if (info->seq_func(esr, seqnum, seqstartpos, seqlength, chunk->chunk,
+                         info->data, chunk->err) != 0) {
+        chunk->had_err = true;
+      }
+    }
+  }
+  gt_encseq_reader_delete(esr);
+  return NULL;
+}
+
+int gt_encseq_parallel_foreach_seq(const GtEncseq *encseq,
+                                   GtReadmode readmode,
+                                   GtUword from,
+                                   GtUword to,
+                                   GtEncseqChunkNewFunc chunk_new,
+                                   GtEncseqSeqFunc seq_func,
+                                   GtEncseqChunkCollectFunc chunk_collect,
+                                   GtEncseqChunkDeleteFunc chunk_delete,
+                                   void *data,
+                                   GtError *err)
+{
+  GtEncseqParallelInfo info;
+  GtUword seqlength, rangestart, rangeend, chunklength, nextseqnum;
+  unsigned int chunknum, maxnumofchunks;
+  int had_err = 0;
+
+  gt_error_check(err);
+  gt_assert(encseq != NULL && seq_func != NULL && from <= to &&
+            to < gt_encseq_num_of_sequences(encseq));
+  rangestart = encseq_parallel_seqstartpos(encseq, readmode, from,
+                                           &seqlength);
+  rangeend = encseq_parallel_seqstartpos(encseq, readmode, to, &seqlength)
+             + seqlength;
+  maxnumofchunks = gt_jobs * GT_ENCSEQ_PARALLEL_CHUNKS_PER_JOB;
+  chunklength = (rangeend - rangestart) / maxnumofchunks;
+  if (chunklength < GT_ENCSEQ_PARALLEL_MINCHUNKLENGTH)
+    chunklength = GT_ENCSEQ_PARALLEL_MINCHUNKLENGTH;
+  if (chunklength > GT_ENCSEQ_PARALLEL_MAXCHUNKLENGTH)
+    chunklength = GT_ENCSEQ_PARALLEL_MAXCHUNKLENGTH;
+  info.encseq = encseq;
+  info.readmode = readmode;
+  info.seq_func = seq_func;
+  info.data = data;
+  info.chunks = gt_malloc(sizeof (*info.chunks) * maxnumofchunks);
+  for (chunknum = 0; chunknum < maxnumofchunks; chunknum++)
+    info.chunks[chunknum].err = gt_error_new();
+  info.mutex = gt_mutex_new();
+  nextseqnum = from;
+  while (!had_err && nextseqnum <= to) {
+    /* split the next round of chunks, the sequence containing the position
+       <chunklength> after the start of a chunk is its last one */
+    info.numofchunks = 0;
+    while (info.numofchunks < maxnumofchunks && nextseqnum <= to) {
+      GtEncseqParallelChunk *chunk = info.chunks + info.numofchunks++;
+      GtUword chunkend = encseq_parallel_seqstartpos(encseq, readmode,
+                                                     nextseqnum, &seqlength)
+                         + chunklength;
+
+      chunk->from = nextseqnum;
+      if (chunkend >= rangeend) {
+        chunk->to = to;
+      } else {
+        chunk->to = encseq_parallel_seqnum(encseq, readmode, chunkend);
+        if (chunk->to > to)
+          chunk->to = to;
+      }
+      gt_assert(chunk->from <= chunk->to);
+      nextseqnum = chunk->to + 1;
+      chunk->chunk = chunk_new != NULL ? chunk_new(data) : NULL;
+      chunk->had_err = false;
+      gt_error_unset(chunk->err);
+    }
+    info.nextchunk = 0;
+    if (info.numofchunks == 1U)
+      (void) encseq_parallel_thread(&info);
+    else
+      had_err = gt_multithread(encseq_parallel_thread, &info, err);
+    for (chunknum = 0; chunknum < info.numofchunks; chunknum++) {
+      GtEncseqParallelChunk *chunk = info.chunks + chunknum;
+      if (!had_err) {
+        if (chunk->had_err) {
+          gt_error_set(err, "%s", gt_error_get(chunk->err));
+          had_err = -1;
+        } else if (chunk_collect != NULL) {
+          had_err = chunk_collect(chunk->chunk, data, err);
+        }
+      }
+      if (chunk_delete != NULL)
+        chunk_delete(chunk->chunk);
+    }
+  }
+  for (chunknum = 0; chunknum < maxnumofchunks; chunknum++)
+    gt_error_delete(info.chunks[chunknum].err);
+  gt_free(info.chunks);
+  gt_mutex_delete(info.mutex);
+  return had_err;
+}
+
+typedef struct {
+  const GtEncseq *encseq;
+  GtReadmode readmode;
+  GtUword nextseqnum,
+          numofchunks;
+  bool ok;
+} GtEncseqParallelTestInfo;
+
+static void* encseq_parallel_test_chunk_new(GT_UNUSED void *data)
+{
+  return gt_array_new(sizeof (GtUword));
+}
+
+static int encseq_parallel_test_seq(GtEncseqReader *esr, GtUword seqnum,
+                                    GtUword seqstartpos,
+                                    GtUword seqlength, void *chunk,
+                                    GT_UNUSED void *data,
+                                    GT_UNUSED GtError *err)
+{
+  GtUword idx, checksum = 0;
+
+  for (idx = 0; idx < seqlength; idx++) {
+    checksum = checksum * 31UL
+               + (GtUword) gt_encseq_reader_next_decoded_char(esr);
+  }
+  gt_array_add((GtArray*) chunk, seqnum);
+  gt_array_add((GtArray*) chunk, seqstartpos);
+  gt_array_add((GtArray*) chunk, seqlength);
+  gt_array_add((GtArray*) chunk, checksum);
+  return 0;
+}
+
+static int encseq_parallel_test_collect(void *chunk, void *data,
+                                        GT_UNUSED GtError *err)
+{
+  GtEncseqParallelTestInfo *info = data;
+  GtUword idx, *values = gt_array_get_space((GtArray*) chunk);
+
+  /* sequences must be collected in order and read completely */
+  for (idx = 0; idx < gt_array_size((GtArray*) chunk); idx += 4) {
+    GtUword pos, checksum = 0;
+
+    if (values[idx] != info->nextseqnum++)
+      info->ok = false;
+    for (pos = values[idx + 1]; pos < values[idx + 1] + values[idx + 2];
+         pos++) {
+      checksum = checksum * 31UL
+                 + (GtUword) gt_encseq_get_decoded_char(info->encseq, pos,
+                                                        info->readmode);
+    }
+    if (checksum != values[idx + 3])
+      info->ok = false;
+  }
+  info->numofchunks++;
+  return 0;
+}
+
+static void encseq_parallel_test_chunk_delete(void *chunk)
+{
+  gt_array_delete((GtArray*) chunk);
+}
+
+static int encseq_parallel_test_failing_seq(GT_UNUSED GtEncseqReader *esr,
+                                            GtUword seqnum,
+                                            GT_UNUSED GtUword seqstartpos,
+                                            GT_UNUSED GtUword seqlength,
+                                            GT_UNUSED void *chunk,
+                                            GT_UNUSED void *data,
+                                            GtError *err)
+{
+  if (seqnum == 1000UL) {
+    gt_error_set(err, "sequence "GT_WU"", seqnum);
+    return -1;
+  }
+  return 0;
+}
+
+int gt_encseq_parallel_unit_test(GtError *err)
+{
+  const GtUword numofseqs = 5000UL, maxseqlen = 100UL;
+  GtAlphabet *alpha;
+  GtEncseqBuilder *eb;
+  GtEncseq *encseq;
+  char *seqs;
+  GtUword seqnum, idx;
+  int had_err = 0;
+
+  gt_error_check(err);
+  alpha = gt_alphabet_new_dna();
+  eb = gt_encseq_builder_new(alpha);
+  gt_encseq_builder_create_ssp_tab(eb);
+  seqs = gt_malloc(sizeof (*seqs) * numofseqs * maxseqlen);
+  for (seqnum = 0; seqnum < numofseqs; seqnum++) {
+    char *seq = seqs + seqnum * maxseqlen;
+    GtUword seqlen = 1UL + gt_rand_max(maxseqlen - 1);
+
+    for (idx = 0; idx < seqlen; idx++)
+      seq[idx] = "acgt"[gt_rand_max(3UL)];
+    gt_encseq_builder_add_cstr(eb, seq, seqlen, NULL);
+  }
+  encseq = gt_encseq_builder_build(eb, err);
+  gt_ensure(encseq != NULL);
+  if (!had_err) {
+    GtReadmode readmode;
+
+    for (readmode = GT_READMODE_FORWARD;
+         !had_err && readmode <= GT_READMODE_REVCOMPL; readmode++) {
+      GtEncseqParallelTestInfo info;
+
+      info.encseq = encseq;
+      info.readmode = readmode;
+      info.nextseqnum = 10UL;
+      info.numofchunks = 0;
+      info.ok = true;
+      had_err = gt_encseq_parallel_foreach_seq(encseq, readmode, 10UL,
+                                             numofseqs - 1,
+                                             encseq_parallel_test_chunk_new,
+                                             encseq_parallel_test_seq,
+                                             encseq_parallel_test_collect,
+                                             encseq_parallel_test_chunk_delete,
+                                             &info, err);
+      gt_ensure(info.ok);
+      gt_ensure(info.nextseqnum == numofseqs);
+      gt_ensure(info.numofchunks > 0);
+    }
+  }
+  if (!had_err) {
+    /* errors of the sequence function are reported */
+    gt_ensure(gt_encseq_parallel_foreach_seq(encseq, GT_READMODE_FORWARD, 0,
+                                             numofseqs - 1, NULL,
+                                             encseq_parallel_test_failing_seq,
+                                             NULL, NULL, NULL, err) == -1);
+    gt_ensure(gt_error_is_set(err));
+    gt_error_unset(err);
+  }
+  gt_encseq_delete(encseq);
+  gt_encseq_builder_delete(eb);
+  gt_alphabet_delete(alpha);
+  gt_free(seqs);
+  return had_err;
+}
@@ -0,0 +1,71 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef ENCSEQ_PARALLEL_H
+#define ENCSEQ_PARALLEL_H
+
+#include "core/encseq_api.h"
+#include "core/error_api.h"
+#include "core/readmode_api.h"
+
+/* Function creating the state of a chunk of consecutive sequences processed
+   by <gt_encseq_parallel_foreach_seq()>. <data> is the pointer given to
+   <gt_encseq_parallel_foreach_seq()>. */
+typedef void* (*GtEncseqChunkNewFunc)(void *data);
+
+/* Function processing sequence <seqnum> of length <seqlength>, which starts at
+   position <seqstartpos> with respect to the readmode. <esr> is owned by the
+   calling thread and positioned at <seqstartpos>, it is undefined for
+   sequences of length 0. <chunk> is the state of the chunk the sequence
+   belongs to, it is the only state the function may modify.
+   Returns 0 on success and -1 on error, in which case <err> is set. */
+typedef int   (*GtEncseqSeqFunc)(GtEncseqReader *esr, GtUword seqnum,
+                                 GtUword seqstartpos, GtUword seqlength,
+                                 void *chunk, void *data, GtError *err);
+
+/* Function collecting the results of a completely processed <chunk>. It is
+   called in the calling thread of <gt_encseq_parallel_foreach_seq()> for the
+   chunks in the order of their sequences. Returns 0 on success and -1 on
+   error, in which case <err> is set. */
+typedef int   (*GtEncseqChunkCollectFunc)(void *chunk, void *data,
+                                          GtError *err);
+
+/* Function freeing the memory of <chunk>. */
+typedef void  (*GtEncseqChunkDeleteFunc)(void *chunk);
+
+/* Calls <seq_func> for the sequences <from> to <to> (inclusive) of <encseq>
+   read in <readmode>, using <gt_jobs> many threads. The sequences are split
+   into chunks of consecutive sequences of about equal total length, each
+   chunk is processed by a single thread. The chunks are processed in rounds
+   of <gt_jobs> chunks, after each round <chunk_collect> (if not <NULL>) is
+   called for the chunks of the round in order, so the results can be output
+   in the order of the sequences with limited memory. <chunk_new> and
+   <chunk_delete> are called in the calling thread. Returns 0 on success and -1
+   on error, in which case <err> is set. */
+int gt_encseq_parallel_foreach_seq(const GtEncseq *encseq,
+                                   GtReadmode readmode,
+                                   GtUword from,
+                                   GtUword to,
+                                   GtEncseqChunkNewFunc chunk_new,
+                                   GtEncseqSeqFunc seq_func,
+                                   GtEncseqChunkCollectFunc chunk_collect,
+                                   GtEncseqChunkDeleteFunc chunk_delete,
+                                   void *data,
+                                   GtError *err);
+
+int gt_encseq_parallel_unit_test(GtError *err);
+
+#endif
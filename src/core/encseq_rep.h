@@ -33,6 +33,7 @@
 #include "core/filelengthvalues.h"
 #include "core/intbits.h"
 #include "core/md5_tab_api.h"
+#include "core/seqnum_index.h"
 #include "core/types_api.h"
 #include "core/str_array_api.h"
 #include "core/defined-types.h"
@@ -219,6 +220,19 @@ struct GtEncseq
   /* MD5 sums */
   GtMD5Tab *md5_tab;
 
+  /* tables to be mapped on their first access when loaded lazily, the flags
+     are not changed after loading, the tables are mapped under <lazy_lock>.
+     <lazy_destabs_mapped> is set once the description tables are mapped,
+     afterwards they are accessed without the lock. */
+  bool lazy_destab,
+       lazy_sdstab,
+       lazy_md5tab,
+       lazy_destabs_mapped;
+  GtMutex *lazy_lock;
+
+  /* optional sampled lookup table for the sequence separators */
+  GtSeqnumIndex *seqnumindex;
+
   bool hasmirror,
        accesstype_via_utables;
 
@@ -318,11 +318,13 @@ static inline const char* gt_fa_try_tmpdir(const char *dirname)
   return NULL;
 }
 
-FILE* gt_xtmpfp_generic_func(GtStr *template_arg, enum tmpfp_flags flags,
-                             const char *src_file, int src_line)
+static FILE* tmpfp_generic(GtStr *template_arg, enum tmpfp_flags flags,
+                           bool hard_fail, const char *src_file, int src_line,
+                           GtError *err)
 {
-  FILE *fp;
+  FILE *fp = NULL;
   GtStr *template;
+  gt_error_check(err);
   gt_assert(fa);
   if (flags & GT_TMPFP_USETEMPLATE)
   {
@@ -351,6 +353,13 @@ FILE* gt_xtmpfp_generic_func(GtStr *template_arg, enum tmpfp_flags flags,
         tmpdir = gt_fa_try_tmpdir("/usr/tmp");
       if (!tmpdir)
         tmpdir = gt_fa_try_tmpdir(".");
+      if (!tmpdir && !hard_fail)
+      {
+        gt_error_set(err, "no directory for temporary files is writable");
+        if (!template_arg)
+          gt_str_delete(template);
+        return NULL;
+      }
       gt_assert(tmpdir);
       gt_str_set(template, tmpdir);
     }
@@ -359,7 +368,29 @@ FILE* gt_xtmpfp_generic_func(GtStr *template_arg, enum tmpfp_flags flags,
   {
     int fd = gt_mkstemp(gt_str_get(template));
     char mode[] = { 'w', '+', flags & GT_TMPFP_OPENBINARY?'b':'\0', '\0' };
-    fp = gt_xfdopen(fd, mode);
+    if (hard_fail)
+      fp = gt_xfdopen(fd, mode);
+    else
+    {
+      if (fd == -1)
+      {
+        gt_error_set(err, "cannot create temporary file \"%s\": %s",
+                     gt_str_get(template), strerror(errno));
+      }
+      else if (!(fp = fdopen(fd, mode)))
+      {
+        gt_error_set(err, "cannot open temporary file \"%s\": %s",
+                     gt_str_get(template), strerror(errno));
+        (void) close(fd);
+        (void) remove(gt_str_get(template));
+      }
+      if (!fp)
+      {
+        if (!template_arg)
+          gt_str_delete(template);
+        return NULL;
+      }
+    }
   }
   gt_assert(fp);
   if (flags & GT_TMPFP_AUTOREMOVE)
@@ -380,6 +411,19 @@ FILE* gt_xtmpfp_generic_func(GtStr *template_arg, enum tmpfp_flags flags,
   return fp;
 }
 
+FILE* gt_tmpfp_generic_func(GtStr *template_arg, enum tmpfp_flags flags,
+                            const char *src_file, int src_line, GtError *err)
+{
+  gt_error_check(err);
+  return tmpfp_generic(template_arg, flags, false, src_file, src_line, err);
+}
+
+FILE* gt_xtmpfp_generic_func(GtStr *template_arg, enum tmpfp_flags flags,
+                             const char *src_file, int src_line)
+{
+  return tmpfp_generic(template_arg, flags, true, src_file, src_line, NULL);
+}
+
 void* gt_fa_mmap_generic_fd_func(GT_UNUSED int fd, const char *filename,
                                  size_t len, GT_UNUSED size_t offset,
                                  bool mapwritable, bool hard_fail,
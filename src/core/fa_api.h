@@ -108,6 +108,12 @@ enum tmpfp_flags
   GT_TMPFP_OPENBINARY    = 1 << 2, /**< use stdio mode "w+b", "w+" otherwise */
   GT_TMPFP_DEFAULT_FLAGS = 0,
 };
+/* Create a temp file optionally using template analogous to mkstemp(3).
+   If an error occurs, NULL is returned and <err> is set accordingly. */
+#define gt_tmpfp_generic(template_code, flags, err) \
+        gt_tmpfp_generic_func(template_code, flags, __FILE__, __LINE__, err)
+FILE*   gt_tmpfp_generic_func(GtStr *template_code, enum tmpfp_flags flags,
+                              const char*, int, GtError *err);
 /* Create a temp file optionally using template analogous to mkstemp(3). */
 #define gt_xtmpfp_generic(template_code, flags) \
         gt_xtmpfp_generic_func(template_code, flags, \
@@ -15,15 +15,37 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <ctype.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include "core/bgzf.h"
 #include "core/cstr_api.h"
 #include "core/fa_api.h"
+#include "core/file.h"
 #include "core/ma_api.h"
+#include "core/thread_api.h"
 #include "core/xansi_api.h"
 #include "core/xbzlib.h"
 #include "core/xzlib.h"
 
+/* size of each of the two read-ahead buffers */
+#define GT_FILE_READAHEAD_SIZE  (1U << 20)
+
+/* Plain gzip and bzip2 input is a single sequential stream. With more than one
+   thread, it is decompressed by a separate thread into one of two buffers,
+   while the data of the other buffer is consumed. */
+typedef struct {
+  GtFile *file;
+  char *buffers[2];
+  size_t lengths[2],
+         position;
+  unsigned int current;
+  GtThread *thread;
+  bool started,
+       eof;
+} GtFileReadahead;
+
 struct GtFile {
   GtFileMode mode;
   GtUword reference_count;
@@ -32,6 +54,9 @@ struct GtFile {
     gzFile gzfile;
     BZFILE *bzfile;
   } fileptr;
+  GtBGZF *bgzf; /* if set, <fileptr.file> is a gzip file in BGZF format */
+  GtError *bgzf_err;
+  GtFileReadahead *readahead;
   char *orig_path,
        *orig_mode,
        unget_char;
@@ -84,6 +109,228 @@ size_t gt_file_basename_length(const char *path)
   return path_length;
 }
 
+/* Returns <true> if <mode> opens a file for writing, in which case
+   <fopen_mode> and the compression <level> requested in <mode> (e.g., "w9")
+   are set. */
+static bool file_gzip_write_mode(const char *mode, char *fopen_mode,
+                                 int *level)
+{
+  gt_assert(mode && fopen_mode && level);
+  if (mode[0] != 'w' && mode[0] != 'a')
+    return false;
+  fopen_mode[0] = mode[0];
+  fopen_mode[1] = 'b';
+  fopen_mode[2] = '\0';
+  *level = Z_DEFAULT_COMPRESSION;
+  for (; *mode != '\0'; mode++) {
+    if (isdigit((int) *mode))
+      *level = *mode - '0';
+  }
+  return true;
+}
+
+static void* file_readahead_thread(void *data)
+{
+  GtFileReadahead *ra = data;
+  unsigned int fill = 1U - ra->current;
+  size_t len = 0;
+  int rval;
+  do {
+    if (ra->file->mode == GT_FILE_MODE_GZIP)
+      rval = gt_xgzread(ra->file->fileptr.gzfile, ra->buffers[fill] + len,
+                        (unsigned) (GT_FILE_READAHEAD_SIZE - len));
+    else
+      rval = gt_xbzread(ra->file->fileptr.bzfile, ra->buffers[fill] + len,
+                        (unsigned) (GT_FILE_READAHEAD_SIZE - len));
+    len += (size_t) rval;
+  } while (rval > 0 && len < GT_FILE_READAHEAD_SIZE);
+  ra->lengths[fill] = len;
+  if (len < GT_FILE_READAHEAD_SIZE)
+    ra->eof = true;
+  return NULL;
+}
+
+/* starts filling the buffer not in use, if no thread can be started it is
+   filled directly */
+static void file_readahead_start(GtFileReadahead *ra)
+{
+  GtError *err;
+  gt_assert(!ra->thread);
+  if (ra->eof) {
+    ra->lengths[1U - ra->current] = 0;
+    return;
+  }
+  err = gt_error_new();
+  if (!(ra->thread = gt_thread_new(file_readahead_thread, ra, err)))
+    (void) file_readahead_thread(ra);
+  gt_error_delete(err);
+}
+
+static void file_readahead_wait(GtFileReadahead *ra)
+{
+  if (ra->thread) {
+#ifdef GT_THREADS_ENABLED
+    gt_thread_join(ra->thread);
+#endif
+    gt_thread_delete(ra->thread);
+    ra->thread = NULL;
+  }
+}
+
+/* switches to the buffer filled in the background, returns <false> on EOF */
+static bool file_readahead_next(GtFileReadahead *ra)
+{
+  if (!ra->started) {
+    ra->started = true;
+    file_readahead_start(ra);
+  }
+  file_readahead_wait(ra);
+  /* the exhausted buffer stays current at the end of the file */
+  if (ra->lengths[1U - ra->current] == 0)
+    return false;
+  ra->current = 1U - ra->current;
+  ra->position = 0;
+  file_readahead_start(ra);
+  return true;
+}
+
+static GtFileReadahead* file_readahead_new(GtFile *file)
+{
+  GtFileReadahead *ra = gt_calloc((size_t) 1, sizeof *ra);
+  ra->file = file;
+  ra->buffers[0] = gt_malloc(sizeof (char) * GT_FILE_READAHEAD_SIZE);
+  ra->buffers[1] = gt_malloc(sizeof (char) * GT_FILE_READAHEAD_SIZE);
+  return ra;
+}
+
+static int file_readahead_xfgetc(GtFileReadahead *ra)
+{
+  if (ra->position == ra->lengths[ra->current] && !file_readahead_next(ra))
+    return EOF;
+  return (unsigned char) ra->buffers[ra->current][ra->position++];
+}
+
+static int file_readahead_xread(GtFileReadahead *ra, void *buf, size_t nbytes)
+{
+  size_t nread = 0, len;
+  while (nread < nbytes) {
+    if (ra->position == ra->lengths[ra->current] && !file_readahead_next(ra))
+      break;
+    len = ra->lengths[ra->current] - ra->position;
+    if (len > nbytes - nread)
+      len = nbytes - nread;
+    memcpy((char*) buf + nread, ra->buffers[ra->current] + ra->position, len);
+    ra->position += len;
+    nread += len;
+  }
+  return (int) nread;
+}
+
+/* the underlying file must be rewound after the reading thread has stopped */
+static void file_readahead_reset(GtFileReadahead *ra)
+{
+  file_readahead_wait(ra);
+  ra->lengths[0] = ra->lengths[1] = ra->position = 0;
+  ra->current = 0;
+  ra->started = ra->eof = false;
+}
+
+static void file_readahead_delete(GtFileReadahead *ra)
+{
+  if (!ra) return;
+  file_readahead_wait(ra);
+  gt_free(ra->buffers[0]);
+  gt_free(ra->buffers[1]);
+  gt_free(ra);
+}
+
+/* reads ahead in plain gzip or bzip2 input opened with <mode> if more than one
+   thread is available */
+static void file_enable_readahead(GtFile *file, const char *mode)
+{
+  if (gt_jobs > 1U && mode[0] == 'r' && !file->bgzf)
+    file->readahead = file_readahead_new(file);
+}
+
+/* the errors of the BGZF layer are fatal in the <GtFile> layer, as for the
+   zlib and the bzlib */
+static void file_bgzf_fatal(GtFile *file, const char *what)
+{
+  fprintf(stderr, "cannot %s compressed file: %s\n", what,
+          gt_error_get(file->bgzf_err));
+  exit(EXIT_FAILURE);
+}
+
+static int file_bgzf_xfgetc(GtFile *file)
+{
+  int c, rval = gt_bgzf_fgetc(file->bgzf, &c, file->bgzf_err);
+  if (rval == -1)
+    file_bgzf_fatal(file, "read from");
+  return rval == 1 ? c : EOF;
+}
+
+static int file_bgzf_xread(GtFile *file, void *buf, size_t nbytes)
+{
+  int rval = gt_bgzf_read(file->bgzf, buf, nbytes, file->bgzf_err);
+  if (rval == -1)
+    file_bgzf_fatal(file, "read from");
+  return rval;
+}
+
+static void file_bgzf_xwrite(GtFile *file, const void *buf, size_t nbytes)
+{
+  if (gt_bgzf_write(file->bgzf, buf, nbytes, file->bgzf_err))
+    file_bgzf_fatal(file, "write to");
+}
+
+/* opens the gzip file <path>, BGZF input is read via the parallel BGZF reader,
+   all other files via the zlib. Returns <false> and sets <err> if <path> could
+   not be opened */
+static bool file_gzopen(GtFile *file, const char *path, const char *mode,
+                        bool abort_on_error, GtError *err)
+{
+  char fopen_mode[3];
+  int level;
+  gt_error_check(err);
+  if (!file_gzip_write_mode(mode, fopen_mode, &level)) {
+    if (abort_on_error)
+      file->fileptr.file = gt_fa_xfopen(path, "rb");
+    else if (!(file->fileptr.file = gt_fa_fopen(path, "rb", err)))
+      return false;
+    if (gt_bgzf_is_bgzf(file->fileptr.file)) {
+      file->bgzf = gt_bgzf_new_reader(file->fileptr.file);
+      file->bgzf_err = gt_error_new();
+      return true;
+    }
+    gt_fa_xfclose(file->fileptr.file);
+  }
+  if (abort_on_error)
+    file->fileptr.gzfile = gt_fa_xgzopen(path, mode);
+  else if (!(file->fileptr.gzfile = gt_fa_gzopen(path, mode, err)))
+    return false;
+  file_enable_readahead(file, mode);
+  return true;
+}
+
+GtFile* gt_file_xopen_bgzf(const char *path, const char *mode)
+{
+  GtFile *file;
+  char fopen_mode[3];
+  int level;
+  gt_assert(path && mode);
+  if (!file_gzip_write_mode(mode, fopen_mode, &level)) {
+    fprintf(stderr, "cannot open BGZF file '%s' for reading with mode '%s'\n",
+            path, mode);
+    exit(EXIT_FAILURE);
+  }
+  file = gt_calloc(1, sizeof (GtFile));
+  file->mode = GT_FILE_MODE_GZIP;
+  file->fileptr.file = gt_fa_xfopen(path, fopen_mode);
+  file->bgzf = gt_bgzf_new_writer(file->fileptr.file, level);
+  file->bgzf_err = gt_error_new();
+  return file;
+}
+
 GtFile* gt_file_new(const char *path, const char *mode, GtError *err)
 {
   gt_error_check(err);
@@ -117,8 +364,7 @@ GtFile* gt_file_open(GtFileMode file_mode, const char *path, const char *mode,
         }
         break;
       case GT_FILE_MODE_GZIP:
-        file->fileptr.gzfile = gt_fa_gzopen(path, mode, err);
-        if (!file->fileptr.gzfile) {
+        if (!file_gzopen(file, path, mode, false, err)) {
           gt_file_delete_without_handle(file);
           return NULL;
         }
@@ -131,6 +377,7 @@ GtFile* gt_file_open(GtFileMode file_mode, const char *path, const char *mode,
         }
         file->orig_path = gt_cstr_dup(path);
         file->orig_mode = gt_cstr_dup(path);
+        file_enable_readahead(file, mode);
         break;
       default: gt_assert(0);
     }
@@ -157,12 +404,13 @@ GtFile* gt_file_xopen_file_mode(GtFileMode file_mode, const char *path,
         file->fileptr.file = gt_fa_xfopen(path, mode);
         break;
       case GT_FILE_MODE_GZIP:
-        file->fileptr.gzfile = gt_fa_xgzopen(path, mode);
+        (void) file_gzopen(file, path, mode, true, NULL);
         break;
       case GT_FILE_MODE_BZIP2:
         file->fileptr.bzfile = gt_fa_xbzopen(path, mode);
         file->orig_path = gt_cstr_dup(path);
         file->orig_mode = gt_cstr_dup(path);
+        file_enable_readahead(file, mode);
         break;
       default: gt_assert(0);
     }
@@ -212,10 +460,18 @@ int gt_file_xfgetc(GtFile *file)
           c = gt_xfgetc(file->fileptr.file);
           break;
         case GT_FILE_MODE_GZIP:
-          c = gt_xgzfgetc(file->fileptr.gzfile);
+          if (file->bgzf)
+            c = file_bgzf_xfgetc(file);
+          else if (file->readahead)
+            c = file_readahead_xfgetc(file->readahead);
+          else
+            c = gt_xgzfgetc(file->fileptr.gzfile);
           break;
         case GT_FILE_MODE_BZIP2:
-          c = gt_xbzfgetc(file->fileptr.bzfile);
+          if (file->readahead)
+            c = file_readahead_xfgetc(file->readahead);
+          else
+            c = gt_xbzfgetc(file->fileptr.bzfile);
           break;
         default: gt_assert(0);
       }
@@ -261,6 +517,30 @@ static int vgzprintf(gzFile file, const char *format, va_list va, int buflen)
   return 0; /* success */
 }
 
+static int vbgzfprintf(GtFile *file, const char *format, va_list va,
+                       int buflen)
+{
+  int len;
+  if (!buflen) {
+    char buf[BUFSIZ];
+    /* no buffer length given -> try static buffer */
+    len = gt_xvsnprintf(buf, sizeof (buf), format, va);
+    if (len >= BUFSIZ)
+      return len; /* unsuccessful trial -> return buffer length for next call */
+    file_bgzf_xwrite(file, buf, len);
+  }
+  else {
+    char *dynbuf;
+    /* buffer length given -> use dynamic buffer */
+    dynbuf = gt_malloc((buflen + 1) * sizeof (char));
+    len = gt_xvsnprintf(dynbuf, (buflen + 1) * sizeof (char), format, va);
+    gt_assert(len == buflen);
+    file_bgzf_xwrite(file, dynbuf, buflen);
+    gt_free(dynbuf);
+  }
+  return 0; /* success */
+}
+
 static int vbzprintf(BZFILE *file, const char *format, va_list va, int buflen)
 {
   int len;
@@ -296,7 +576,10 @@ static int xvprintf(GtFile *file, const char *format, va_list va, int buflen)
         gt_xvfprintf(file->fileptr.file, format, va);
         break;
       case GT_FILE_MODE_GZIP:
-        rval = vgzprintf(file->fileptr.gzfile, format, va, buflen);
+        if (file->bgzf)
+          rval = vbgzfprintf(file, format, va, buflen);
+        else
+          rval = vgzprintf(file->fileptr.gzfile, format, va, buflen);
         break;
       case GT_FILE_MODE_BZIP2:
         rval = vbzprintf(file->fileptr.bzfile, format, va, buflen);
@@ -334,7 +617,12 @@ void gt_file_xfputc(int c, GtFile *file)
       gt_xfputc(c, file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-      gt_xgzfputc(c, file->fileptr.gzfile);
+      if (file->bgzf) {
+        char cc = (char) c;
+        file_bgzf_xwrite(file, &cc, sizeof cc);
+      }
+      else
+        gt_xgzfputc(c, file->fileptr.gzfile);
       break;
     case GT_FILE_MODE_BZIP2:
       gt_xbzfputc(c, file->fileptr.bzfile);
@@ -352,7 +640,10 @@ void gt_file_xfputs(const char *cstr, GtFile *file)
       gt_xfputs(cstr, file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-      gt_xgzfputs(cstr, file->fileptr.gzfile);
+      if (file->bgzf)
+        file_bgzf_xwrite(file, cstr, strlen(cstr));
+      else
+        gt_xgzfputs(cstr, file->fileptr.gzfile);
       break;
     case GT_FILE_MODE_BZIP2:
       gt_xbzfputs(cstr, file->fileptr.bzfile);
@@ -370,10 +661,18 @@ int gt_file_xread(GtFile *file, void *buf, size_t nbytes)
         rval = gt_xfread(buf, 1, nbytes, file->fileptr.file);
         break;
       case GT_FILE_MODE_GZIP:
-        rval = gt_xgzread(file->fileptr.gzfile, buf, nbytes);
+        if (file->bgzf)
+          rval = file_bgzf_xread(file, buf, nbytes);
+        else if (file->readahead)
+          rval = file_readahead_xread(file->readahead, buf, nbytes);
+        else
+          rval = gt_xgzread(file->fileptr.gzfile, buf, nbytes);
         break;
       case GT_FILE_MODE_BZIP2:
-        rval = gt_xbzread(file->fileptr.bzfile, buf, nbytes);
+        if (file->readahead)
+          rval = file_readahead_xread(file->readahead, buf, nbytes);
+        else
+          rval = gt_xbzread(file->fileptr.bzfile, buf, nbytes);
         break;
       default: gt_assert(0);
     }
@@ -394,7 +693,10 @@ void gt_file_xwrite(GtFile *file, void *buf, size_t nbytes)
       gt_xfwrite(buf, 1, nbytes, file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-      gt_xgzwrite(file->fileptr.gzfile, buf, nbytes);
+      if (file->bgzf)
+        file_bgzf_xwrite(file, buf, nbytes);
+      else
+        gt_xgzwrite(file->fileptr.gzfile, buf, nbytes);
       break;
     case GT_FILE_MODE_BZIP2:
       gt_xbzwrite(file->fileptr.bzfile, buf, nbytes);
@@ -411,9 +713,17 @@ void gt_file_xrewind(GtFile *file)
       rewind(file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-      gt_xgzrewind(file->fileptr.gzfile);
+      if (file->bgzf)
+        gt_bgzf_rewind(file->bgzf);
+      else {
+        if (file->readahead)
+          file_readahead_reset(file->readahead);
+        gt_xgzrewind(file->fileptr.gzfile);
+      }
       break;
     case GT_FILE_MODE_BZIP2:
+      if (file->readahead)
+        file_readahead_reset(file->readahead);
       gt_xbzrewind(&file->fileptr.bzfile, file->orig_path, file->orig_mode);
       break;
     default: gt_assert(0);
@@ -423,6 +733,8 @@ void gt_file_xrewind(GtFile *file)
 void gt_file_delete_without_handle(GtFile *file)
 {
   if (!file) return;
+  file_readahead_delete(file->readahead);
+  gt_error_delete(file->bgzf_err);
   gt_free(file->orig_path);
   gt_free(file->orig_mode);
   gt_free(file);
@@ -435,13 +747,25 @@ void gt_file_delete(GtFile *file)
     file->reference_count--;
     return;
   }
+  /* the reading thread must be stopped before the file is closed */
+  if (file->readahead)
+    file_readahead_wait(file->readahead);
   switch (file->mode) {
     case GT_FILE_MODE_UNCOMPRESSED:
         if (!file->is_stdin)
           gt_fa_fclose(file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-        gt_fa_gzclose(file->fileptr.gzfile);
+        if (file->bgzf) {
+          if (gt_bgzf_is_writer(file->bgzf) &&
+              gt_bgzf_finish(file->bgzf, file->bgzf_err)) {
+            file_bgzf_fatal(file, "write to");
+          }
+          gt_bgzf_delete(file->bgzf);
+          gt_fa_fclose(file->fileptr.file);
+        }
+        else
+          gt_fa_gzclose(file->fileptr.gzfile);
       break;
     case GT_FILE_MODE_BZIP2:
         gt_fa_bzclose(file->fileptr.bzfile);
@@ -0,0 +1,29 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef FILE_H
+#define FILE_H
+
+#include "core/file_api.h"
+
+/* Create a new <GtFile> object writing the gzip compressed file <path> in the
+   blocked gzip format (BGZF). Every gzip decompressor reads such files, but
+   the blocks are compressed with <gt_jobs> threads in parallel. <mode> must
+   open the file for writing ("w" or "a", optionally followed by the
+   compression level). Terminates the program if the file cannot be opened. */
+GtFile* gt_file_xopen_bgzf(const char *path, const char *mode);
+
+#endif
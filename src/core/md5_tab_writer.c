@@ -0,0 +1,305 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <ctype.h>
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/md5_encoder_api.h"
+#include "core/md5_fingerprint_api.h"
+#include "core/md5_tab_writer.h"
+#include "core/multithread_api.h"
+#include "core/str_api.h"
+#include "core/thread_api.h"
+#include "core/xansi_api.h"
+
+/* length of a fingerprint in the MD5 table, including the \0 */
+#define GT_MD5_TAB_WRITER_FPLENGTH    33U
+/* the fingerprints are computed when this many characters are buffered */
+#define GT_MD5_TAB_WRITER_BATCHSIZE   (1UL << 22)
+/* or when this many sequences are buffered */
+#define GT_MD5_TAB_WRITER_MAXSEQS     (1UL << 16)
+/* a thread takes consecutive sequences of about this total length */
+#define GT_MD5_TAB_WRITER_JOBLENGTH   (1UL << 16)
+/* the block length of the MD5 encoder */
+#define GT_MD5_TAB_WRITER_BLOCK       64UL
+
+struct GtMD5TabWriter {
+  FILE *outfp;
+  char *buffer,
+       *fingerprints;
+  GtUword *seqends,
+          buflen,
+          bufsize,
+          batchsize,
+          numofseqs,
+          maxseqs,
+          nextseq;
+  /* encoder for the first sequence in the buffer, if its leading blocks
+     were encoded before to make room in the buffer */
+  GtMD5Encoder *openenc;
+  bool openstarted;
+  GtMutex *mutex;
+};
+
+static GtMD5TabWriter* md5_tab_writer_new_with_sizes(FILE *outfp,
+                                                     GtUword batchsize,
+                                                     GtUword maxseqs)
+{
+  GtMD5TabWriter *mtw;
+
+  gt_assert(outfp != NULL && batchsize > GT_MD5_TAB_WRITER_BLOCK &&
+            maxseqs > 0);
+  mtw = gt_malloc(sizeof (*mtw));
+  mtw->outfp = outfp;
+  mtw->batchsize = batchsize;
+  /* leave room to continue the last sequence of a batch */
+  mtw->bufsize = 2 * batchsize;
+  mtw->buffer = gt_malloc(sizeof (*mtw->buffer) * mtw->bufsize);
+  mtw->buflen = 0;
+  mtw->maxseqs = maxseqs;
+  mtw->seqends = gt_malloc(sizeof (*mtw->seqends) * maxseqs);
+  mtw->fingerprints = gt_malloc(sizeof (*mtw->fingerprints) * maxseqs *
+                                GT_MD5_TAB_WRITER_FPLENGTH);
+  mtw->numofseqs = 0;
+  mtw->nextseq = 0;
+  mtw->openenc = gt_md5_encoder_new();
+  mtw->openstarted = false;
+  mtw->mutex = gt_mutex_new();
+  return mtw;
+}
+
+GtMD5TabWriter* gt_md5_tab_writer_new(FILE *outfp)
+{
+  return md5_tab_writer_new_with_sizes(outfp, GT_MD5_TAB_WRITER_BATCHSIZE,
+                                       GT_MD5_TAB_WRITER_MAXSEQS);
+}
+
+/* feeds the blocks to <enc> in the same way as <gt_md5_fingerprint()>: a block
+   is only added if more characters follow, so the last block is never
+   empty unless the sequence is */
+static void md5_tab_writer_encode(GtMD5Encoder *enc, const char *seq,
+                                  GtUword seqlen, char *fingerprint)
+{
+  unsigned char output[16];
+  GtUword pos = 0;
+
+  while (seqlen - pos > GT_MD5_TAB_WRITER_BLOCK) {
+    gt_md5_encoder_add_block(enc, seq + pos, GT_MD5_TAB_WRITER_BLOCK);
+    pos += GT_MD5_TAB_WRITER_BLOCK;
+  }
+  gt_md5_encoder_add_block(enc, seq + pos, seqlen - pos);
+  gt_md5_encoder_finish(enc, output, fingerprint);
+  gt_md5_encoder_reset(enc);
+}
+
+#define MD5_TAB_WRITER_SEQSTART(MTW,SEQNUM)\
+        ((SEQNUM) == 0 ? 0 : (MTW)->seqends[(SEQNUM) - 1])
+
+/* the threads fetch runs of consecutive sequences */
+static bool md5_tab_writer_next_job(GtMD5TabWriter *mtw, GtUword *from,
+                                    GtUword *to)
+{
+  bool has_job = false;
+
+  gt_mutex_lock(mtw->mutex);
+  if (mtw->nextseq < mtw->numofseqs) {
+    GtUword joblimit = MD5_TAB_WRITER_SEQSTART(mtw, mtw->nextseq)
+                       + GT_MD5_TAB_WRITER_JOBLENGTH;
+    *from = mtw->nextseq;
+    while (mtw->nextseq < mtw->numofseqs &&
+           mtw->seqends[mtw->nextseq] < joblimit) {
+      mtw->nextseq++;
+    }
+    if (mtw->nextseq == *from)
+      mtw->nextseq++;
+    *to = mtw->nextseq;
+    has_job = true;
+  }
+  gt_mutex_unlock(mtw->mutex);
+  return has_job;
+}
+
+static void* md5_tab_writer_thread(void *data)
+{
+  GtMD5TabWriter *mtw = data;
+  GtMD5Encoder *enc = NULL;
+  GtUword from, to, seqnum;
+
+  while (md5_tab_writer_next_job(mtw, &from, &to)) {
+    if (enc == NULL)
+      enc = gt_md5_encoder_new();
+    for (seqnum = from; seqnum < to; seqnum++) {
+      GtUword start = MD5_TAB_WRITER_SEQSTART(mtw, seqnum);
+      md5_tab_writer_encode(enc, mtw->buffer + start,
+                            mtw->seqends[seqnum] - start,
+                            mtw->fingerprints +
+                            seqnum * GT_MD5_TAB_WRITER_FPLENGTH);
+    }
+  }
+  if (enc != NULL)
+    gt_md5_encoder_delete(enc);
+  return NULL;
+}
+
+/* computes and writes the fingerprints of the ended sequences in the buffer
+   and moves the characters of the current sequence to its start */
+static int md5_tab_writer_process(GtMD5TabWriter *mtw, bool parallel,
+                                  GtError *err)
+{
+  GtUword openstart;
+  int had_err = 0;
+
+  mtw->nextseq = 0;
+  if (mtw->numofseqs > 0 && mtw->openstarted) {
+    md5_tab_writer_encode(mtw->openenc, mtw->buffer, mtw->seqends[0],
+                          mtw->fingerprints);
+    mtw->openstarted = false;
+    mtw->nextseq = 1UL;
+  }
+  if (mtw->nextseq < mtw->numofseqs) {
+    if (parallel && gt_jobs > 1U &&
+        mtw->seqends[mtw->numofseqs - 1] > GT_MD5_TAB_WRITER_JOBLENGTH) {
+      had_err = gt_multithread(md5_tab_writer_thread, mtw, err);
+    } else {
+      (void) md5_tab_writer_thread(mtw);
+    }
+  }
+  if (!had_err && mtw->numofseqs > 0) {
+    gt_xfwrite(mtw->fingerprints, sizeof (char),
+               (size_t) (mtw->numofseqs * GT_MD5_TAB_WRITER_FPLENGTH),
+               mtw->outfp);
+  }
+  openstart = MD5_TAB_WRITER_SEQSTART(mtw, mtw->numofseqs);
+  if (openstart > 0) {
+    memmove(mtw->buffer, mtw->buffer + openstart,
+            (size_t) (mtw->buflen - openstart));
+    mtw->buflen -= openstart;
+  }
+  mtw->numofseqs = 0;
+  return had_err;
+}
+
+void gt_md5_tab_writer_add_char(GtMD5TabWriter *mtw, char cc)
+{
+  gt_assert(mtw != NULL);
+  if (mtw->buflen == mtw->bufsize) {
+    /* the remaining ended sequences are shorter than a batch, so they are
+       handled in this thread without the need to report errors */
+    (void) md5_tab_writer_process(mtw, false, NULL);
+    if (mtw->buflen == mtw->bufsize) {
+      /* the buffer only contains the current sequence: encode its leading
+         blocks, but keep at least one character for the last block */
+      GtUword pos;
+      for (pos = 0; mtw->buflen - pos > GT_MD5_TAB_WRITER_BLOCK;
+           pos += GT_MD5_TAB_WRITER_BLOCK) {
+        gt_md5_encoder_add_block(mtw->openenc, mtw->buffer + pos,
+                                 GT_MD5_TAB_WRITER_BLOCK);
+      }
+      memmove(mtw->buffer, mtw->buffer + pos, (size_t) (mtw->buflen - pos));
+      mtw->buflen -= pos;
+      mtw->openstarted = true;
+    }
+  }
+  mtw->buffer[mtw->buflen++] = (char) toupper((int) cc);
+}
+
+int gt_md5_tab_writer_end_sequence(GtMD5TabWriter *mtw, GtError *err)
+{
+  gt_error_check(err);
+  gt_assert(mtw != NULL && mtw->numofseqs < mtw->maxseqs);
+  mtw->seqends[mtw->numofseqs++] = mtw->buflen;
+  if (mtw->numofseqs == mtw->maxseqs || mtw->buflen >= mtw->batchsize)
+    return md5_tab_writer_process(mtw, true, err);
+  return 0;
+}
+
+int gt_md5_tab_writer_flush(GtMD5TabWriter *mtw, GtError *err)
+{
+  gt_error_check(err);
+  gt_assert(mtw != NULL);
+  if (mtw->numofseqs > 0)
+    return md5_tab_writer_process(mtw, true, err);
+  return 0;
+}
+
+void gt_md5_tab_writer_delete(GtMD5TabWriter *mtw)
+{
+  if (mtw == NULL)
+    return;
+  gt_free(mtw->buffer);
+  gt_free(mtw->seqends);
+  gt_free(mtw->fingerprints);
+  gt_md5_encoder_delete(mtw->openenc);
+  gt_mutex_delete(mtw->mutex);
+  gt_free(mtw);
+}
+
+int gt_md5_tab_writer_unit_test(GtError *err)
+{
+  const GtUword numofseqs = 300UL, maxseqlen = 2000UL;
+  char *seq, fingerprint[GT_MD5_TAB_WRITER_FPLENGTH];
+  GtUword run, seqnum, i;
+  int had_err = 0;
+
+  gt_error_check(err);
+  seq = gt_malloc(sizeof (*seq) * numofseqs * maxseqlen);
+  /* small batches force long sequences to be encoded incrementally */
+  for (run = 0; !had_err && run < 4UL; run++) {
+    GtUword seqlengths[300], batchsize = run == 0 ? 1000UL : 100UL * run,
+            offset = 0;
+    GtStr *tmpfilename = gt_str_new();
+    GtMD5TabWriter *mtw;
+    FILE *fp;
+
+    fp = gt_xtmpfp_generic(tmpfilename,
+                           GT_TMPFP_AUTOREMOVE | GT_TMPFP_OPENBINARY);
+    mtw = md5_tab_writer_new_with_sizes(fp, batchsize, 7UL + run);
+    for (seqnum = 0; !had_err && seqnum < numofseqs; seqnum++) {
+      /* include empty sequences and lengths around the block length */
+      seqlengths[seqnum] = seqnum % 10 == 0 ? gt_rand_max(maxseqlen)
+                                            : gt_rand_max(130UL);
+      for (i = 0; i < seqlengths[seqnum]; i++) {
+        seq[offset + i] = "acgtNACGTn"[gt_rand_max(9UL)];
+        gt_md5_tab_writer_add_char(mtw, seq[offset + i]);
+      }
+      offset += seqlengths[seqnum];
+      had_err = gt_md5_tab_writer_end_sequence(mtw, err);
+    }
+    if (!had_err)
+      had_err = gt_md5_tab_writer_flush(mtw, err);
+    gt_md5_tab_writer_delete(mtw);
+    rewind(fp);
+    offset = 0;
+    for (seqnum = 0; !had_err && seqnum < numofseqs; seqnum++) {
+      char *expected = gt_md5_fingerprint(seq + offset, seqlengths[seqnum]);
+      gt_ensure(fread(fingerprint, sizeof (char),
+                      (size_t) GT_MD5_TAB_WRITER_FPLENGTH, fp)
+                == (size_t) GT_MD5_TAB_WRITER_FPLENGTH);
+      gt_ensure(strcmp(fingerprint, expected) == 0);
+      gt_free(expected);
+      offset += seqlengths[seqnum];
+    }
+    gt_ensure(fgetc(fp) == EOF);
+    gt_fa_xfclose(fp);
+    gt_str_delete(tmpfilename);
+  }
+  gt_free(seq);
+  return had_err;
+}
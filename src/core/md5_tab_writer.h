@@ -0,0 +1,57 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef MD5_TAB_WRITER_H
+#define MD5_TAB_WRITER_H
+
+#include <stdio.h>
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* The <GtMD5TabWriter> class writes the MD5 fingerprints of a stream of
+   sequences, given character by character, in the format of the MD5 table of
+   an encoded sequence (a \0-terminated string of 32 hexadecimal digits per
+   sequence). The characters of a batch of sequences are buffered and the
+   fingerprints of the sequences in a batch are computed by <gt_jobs> many
+   threads, long sequences are encoded incrementally. */
+typedef struct GtMD5TabWriter GtMD5TabWriter;
+
+/* Returns a new <GtMD5TabWriter> writing to <outfp>. */
+GtMD5TabWriter* gt_md5_tab_writer_new(FILE *outfp);
+
+/* Appends character <cc> to the current sequence of <mtw>. The character is
+   transformed to upper case letters (with toupper(3)) as in
+   <gt_md5_fingerprint()>. */
+void            gt_md5_tab_writer_add_char(GtMD5TabWriter *mtw, char cc);
+
+/* Ends the current sequence of <mtw>, the following characters belong to the
+   next sequence. Returns 0 on success and -1 on error, in which case <err> is
+   set. */
+int             gt_md5_tab_writer_end_sequence(GtMD5TabWriter *mtw,
+                                               GtError *err);
+
+/* Writes the fingerprints of all ended sequences of <mtw> which have not been
+   written yet. Returns 0 on success and -1 on error, in which case <err> is
+   set. */
+int             gt_md5_tab_writer_flush(GtMD5TabWriter *mtw, GtError *err);
+
+/* Deletes <mtw>, the fingerprints of sequences ended since the last flush
+   are discarded. */
+void            gt_md5_tab_writer_delete(GtMD5TabWriter *mtw);
+
+int             gt_md5_tab_writer_unit_test(GtError *err);
+
+#endif
@@ -16,7 +16,7 @@
 */
 
 #include <string.h>
-#include "core/file_api.h"
+#include "core/file.h"
 #include "core/fileutils_api.h"
 #include "core/ma_api.h"
 #include "core/output_file_api.h"
@@ -25,6 +25,7 @@
 struct GtOutputFileInfo {
   GtStr *output_filename;
   bool gzip,
+       bgzf,
        bzip2,
        force;
   GtFile **outfp;
@@ -71,9 +72,13 @@ static int determine_outfp(void *data, GtError *err)
         had_err = -1;
     }
     if (!had_err) {
-      *ofi->outfp = gt_file_xopen_file_mode(file_mode,
-                                            gt_str_get(ofi->output_filename),
-                                            "w");
+      if (ofi->bgzf)
+        *ofi->outfp = gt_file_xopen_bgzf(gt_str_get(ofi->output_filename), "w");
+      else {
+        *ofi->outfp = gt_file_xopen_file_mode(file_mode,
+                                              gt_str_get(ofi->output_filename),
+                                              "w");
+      }
       gt_assert(*ofi->outfp);
     }
   }
@@ -83,7 +88,7 @@ static int determine_outfp(void *data, GtError *err)
 void gt_output_file_info_register_options(GtOutputFileInfo *ofi,
                                           GtOptionParser *op, GtFile **outfp)
 {
-  GtOption *opto, *optgzip, *optbzip2, *optforce;
+  GtOption *opto, *optgzip, *optbgzf, *optbzip2, *optforce;
   gt_assert(outfp && ofi);
   ofi->outfp = outfp;
   /* register option -o */
@@ -94,6 +99,12 @@ void gt_output_file_info_register_options(GtOutputFileInfo *ofi,
   optgzip = gt_option_new_bool("gzip", "write gzip compressed output file",
                                &ofi->gzip, false);
   gt_option_parser_add_option(op, optgzip);
+  /* register option -bgzf */
+  optbgzf = gt_option_new_bool("bgzf", "write gzip compressed output file in "
+                               "the blocked BGZF format, which is compressed "
+                               "in parallel with -j",
+                               &ofi->bgzf, false);
+  gt_option_parser_add_option(op, optbgzf);
   /* register option -bzip2 */
   optbzip2 = gt_option_new_bool("bzip2", "write bzip2 compressed output file",
                                 &ofi->bzip2, false);
@@ -107,6 +118,7 @@ void gt_output_file_info_register_options(GtOutputFileInfo *ofi,
   gt_option_exclude(optgzip, optbzip2);
   /* option implications */
   gt_option_imply(optgzip, opto);
+  gt_option_imply(optbgzf, optgzip);
   gt_option_imply(optbzip2, opto);
   gt_option_imply(optforce, opto);
   /* set hook function to determine <outfp> */
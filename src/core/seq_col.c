@@ -175,30 +175,34 @@ GtUword gt_seq_col_num_of_seqs(const GtSeqCol *sc, GtUword filenum)
 
 const char* gt_seq_col_get_md5_fingerprint(const GtSeqCol *sc,
                                            GtUword filenum,
-                                           GtUword seqnum)
+                                           GtUword seqnum,
+                                           GtError *err)
 {
   gt_assert(sc);
+  gt_error_check(err);
   if (sc->c_class->get_md5)
-    return sc->c_class->get_md5(sc, filenum, seqnum);
+    return sc->c_class->get_md5(sc, filenum, seqnum, err);
   return 0;
 }
 
 char* gt_seq_col_get_sequence(const GtSeqCol *sc, GtUword filenum,
                               GtUword seqnum,GtUword start,
-                              GtUword end)
+                              GtUword end, GtError *err)
 {
   gt_assert(sc);
+  gt_error_check(err);
   if (sc->c_class->get_seq)
-    return sc->c_class->get_seq(sc, filenum, seqnum, start, end);
+    return sc->c_class->get_seq(sc, filenum, seqnum, start, end, err);
   return 0;
 }
 
 char* gt_seq_col_get_description(const GtSeqCol *sc, GtUword filenum,
-                                 GtUword seqnum)
+                                 GtUword seqnum, GtError *err)
 {
   gt_assert(sc);
+  gt_error_check(err);
   if (sc->c_class->get_seq)
-    return sc->c_class->get_desc(sc, filenum, seqnum);
+    return sc->c_class->get_desc(sc, filenum, seqnum, err);
   return 0;
 }
 
@@ -45,17 +45,22 @@ int         gt_seq_col_md5_to_sequence_length(GtSeqCol*, GtUword *len,
                                               GtStr *md5_seqid, GtError *err);
 GtUword     gt_seq_col_num_of_files(const GtSeqCol*);
 GtUword     gt_seq_col_num_of_seqs(const GtSeqCol*, GtUword filenum);
+/* The following three functions return NULL and set <err> if the sequence
+   data cannot be read. */
 const char* gt_seq_col_get_md5_fingerprint(const GtSeqCol*,
                                            GtUword filenum,
-                                           GtUword seqnum);
+                                           GtUword seqnum,
+                                           GtError *err);
 char*       gt_seq_col_get_sequence(const GtSeqCol*,
                                     GtUword filenum,
                                     GtUword seqnum,
                                     GtUword start,
-                                    GtUword end);
+                                    GtUword end,
+                                    GtError *err);
 char*       gt_seq_col_get_description(const GtSeqCol*,
                                        GtUword filenum,
-                                       GtUword seqnum);
+                                       GtUword seqnum,
+                                       GtError *err);
 GtUword     gt_seq_col_get_sequence_length(const GtSeqCol*,
                                            GtUword filenum,
                                            GtUword seqnum);
@@ -49,15 +49,18 @@ typedef GtUword     (*GtSeqColNumSeqsFunc)(const GtSeqCol*,
                                            GtUword filenum);
 typedef const char* (*GtSeqColGetMD5Func)(const GtSeqCol*,
                                           GtUword filenum,
-                                          GtUword seqnum);
+                                          GtUword seqnum,
+                                          GtError *err);
 typedef       char* (*GtSeqColGetSeqFunc)(const GtSeqCol*,
                                           GtUword filenum,
                                           GtUword seqnum,
                                           GtUword start,
-                                          GtUword end);
+                                          GtUword end,
+                                          GtError *err);
 typedef       char* (*GtSeqColGetDescFunc)(const GtSeqCol*,
                                            GtUword filenum,
-                                           GtUword seqnum);
+                                           GtUword seqnum,
+                                           GtError *err);
 typedef GtUword     (*GtSeqColGetSeqlenFunc)(const GtSeqCol*,
                                              GtUword filenum,
                                              GtUword seqnum);
@@ -15,12 +15,14 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <string.h>
 #include "core/chardef_api.h"
 #include "core/class_alloc_lock.h"
 #include "core/colorspace.h"
 #include "core/cstr_api.h"
 #include "core/file_api.h"
 #include "core/filelengthvalues.h"
+#include "core/minmax_api.h"
 #include "core/seq_iterator_fastq_api.h"
 #include "core/seq_iterator_rep.h"
 #include "core/str_array.h"
@@ -90,6 +92,42 @@ static inline void fastq_buf_ungetchar(GtSeqIteratorFastQ *seqit)
   seqit->use_ungetchar = true;
 }
 
+/* Appends to <buffer> the longest prefix (of at most <maxlen> characters) of
+   the input already buffered which contains no newline and, depending on
+   <stop_at_space> and <stop_at_plus>, no blank and no '+'. The appended
+   characters are consumed and their number is returned. The characters
+   ending the prefix are left for <fastq_buf_getchar()>, so that the callers
+   can handle them as before, while plain runs of characters are located with
+   memchr(3) and copied as a whole. */
+static inline GtUword fastq_buf_append_plain(GtSeqIteratorFastQ *seqit,
+                                             GtStr *buffer,
+                                             GtUword maxlen,
+                                             bool stop_at_space,
+                                             bool stop_at_plus)
+{
+  const unsigned char *start, *stop;
+  GtUword len;
+
+  if (seqit->use_ungetchar || seqit->currentinpos >= seqit->currentfillpos)
+    return 0;
+  start = seqit->inbuf + seqit->currentinpos;
+  len = GT_MIN(seqit->currentfillpos - seqit->currentinpos, maxlen);
+  if ((stop = memchr(start, GT_FASTQ_NEWLINESYMBOL, (size_t) len)) != NULL)
+    len = (GtUword) (stop - start);
+  if (stop_at_space && (stop = memchr(start, ' ', (size_t) len)) != NULL)
+    len = (GtUword) (stop - start);
+  if (stop_at_plus && (stop = memchr(start, GT_FASTQ_QUAL_SEPARATOR_CHAR,
+                                     (size_t) len)) != NULL)
+    len = (GtUword) (stop - start);
+  if (len > 0) {
+    gt_str_append_cstr_nt(buffer, (const char*) start, len);
+    seqit->currentinpos += len;
+    seqit->currentread += len;
+    seqit->ungetchar = start[len-1];
+  }
+  return len;
+}
+
 static inline int parse_fastq_seqname(GtSeqIteratorFastQ *seqit,
                                       GtStr *buffer,
                                       char startchar,
@@ -115,6 +153,7 @@ static inline int parse_fastq_seqname(GtSeqIteratorFastQ *seqit,
       gt_str_append_char(buffer, currentchar);
     else
       firstsymbol = false;
+    (void) fastq_buf_append_plain(seqit, buffer, GT_UWORD_MAX, false, false);
     if ((currentchar = fastq_buf_getchar(seqit)) == EOF)
       return EOF;
     seqit->currentread++;
@@ -144,6 +183,7 @@ static int parse_fastq_sequence(GtSeqIteratorFastQ *seqit,
     } else if (currentchar == '\n') {
       seqit->curline++;
     }
+    (void) fastq_buf_append_plain(seqit, tmp_str, GT_UWORD_MAX, true, true);
     if ((currentchar = fastq_buf_getchar(seqit)) == EOF) {
       gt_str_delete(tmp_str);
       return EOF;
@@ -217,6 +257,9 @@ static inline int parse_fastq_qualities(GtSeqIteratorFastQ *seqit,
   for (i=0;i<gt_str_length(seqit->sequencebuffer);i++) {
     if (currentchar != '\n' && currentchar != ' ') {
       gt_str_append_char(seqit->qualsbuffer, currentchar);
+      i += fastq_buf_append_plain(seqit, seqit->qualsbuffer,
+                                  gt_str_length(seqit->sequencebuffer) - i - 1,
+                                  true, false);
     } else if (currentchar == '\n') {
       seqit->curline++;
       i--;
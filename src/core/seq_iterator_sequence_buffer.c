@@ -16,6 +16,7 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <string.h>
 #include "core/arraydef_api.h"
 #include "core/chardef_api.h"
 #include "core/class_alloc_lock.h"
@@ -103,7 +104,8 @@ static int gt_seq_iterator_sequence_buffer_next(GtSeqIterator *si,
                                                GtError *err)
 {
   GtSeqIteratorSequenceBuffer *seqit;
-  GtUchar charcode;
+  const GtUchar *segment;
+  GtUword segmentlength;
   int retval;
   bool haserr = false, foundseq = false;
   gt_assert(si);
@@ -118,7 +120,9 @@ static int gt_seq_iterator_sequence_buffer_next(GtSeqIterator *si,
   }
   while (true)
   {
-    retval = gt_sequence_buffer_next(seqit->fb,&charcode,err);
+    bool atseparator;
+    retval = gt_sequence_buffer_next_segment(seqit->fb, &segment,
+                                             &segmentlength, err);
     if (retval < 0)
     {
       haserr = true;
@@ -131,9 +135,27 @@ static int gt_seq_iterator_sequence_buffer_next(GtSeqIterator *si,
     }
     if (seqit->currentread < seqit->maxread)
     {
-      seqit->currentread++;
+      seqit->currentread = GT_MIN(seqit->currentread + segmentlength,
+                                  seqit->maxread);
     }
-    if (charcode == (GtUchar) GT_SEPARATOR)
+    atseparator = segment[segmentlength - 1] == (GtUchar) GT_SEPARATOR;
+    if (atseparator)
+    {
+      segmentlength--;
+    }
+    if (seqit->withsequence)
+    {
+      /* leave space for the terminating '\0' */
+      GT_CHECKARRAYSPACEMULTI(&seqit->sequencebuffer, GtUchar,
+                              GT_MAX(1024UL,
+                                     seqit->sequencebuffer.nextfreeGtUchar
+                                       / 2) + segmentlength + 1);
+      memcpy(seqit->sequencebuffer.spaceGtUchar
+               + seqit->sequencebuffer.nextfreeGtUchar,
+             segment, (size_t) segmentlength);
+    }
+    seqit->sequencebuffer.nextfreeGtUchar += segmentlength;
+    if (atseparator)
     {
       if (seqit->sequencebuffer.nextfreeGtUchar == 0 && seqit->withsequence)
       {
@@ -155,15 +177,6 @@ static int gt_seq_iterator_sequence_buffer_next(GtSeqIterator *si,
       seqit->unitnum++;
       break;
     }
-    if (seqit->withsequence)
-    {
-      GT_STOREINARRAY(&seqit->sequencebuffer, GtUchar,
-                   GT_MAX(1024UL, seqit->sequencebuffer.nextfreeGtUchar * 0.5),
-                   charcode);
-    } else
-    {
-      seqit->sequencebuffer.nextfreeGtUchar++;
-    }
   }
   if (!haserr && seqit->sequencebuffer.nextfreeGtUchar > 0)
   {
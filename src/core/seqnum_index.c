@@ -0,0 +1,212 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <inttypes.h>
+#include "core/assert_api.h"
+#include "core/divmodmul_api.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/seqnum_index.h"
+
+/* the lower bits of a separator position are stored in an uint16_t */
+#define GT_SEQNUM_INDEX_MAXBUCKETBITS   16U
+/* the number of separators before a bucket is stored relative to the number
+   before the enclosing superbucket of 2^16 buckets, which fits into an
+   uint32_t as long as a bucket spans at most 2^16 positions */
+#define GT_SEQNUM_INDEX_SUPERBITS       16U
+/* the bucket of every 2^4th separator is sampled */
+#define GT_SEQNUM_INDEX_SAMPLEBITS      4U
+/* up to this many separators in a bucket are scanned linearly */
+#define GT_SEQNUM_INDEX_LINEARSCAN      8UL
+
+struct GtSeqnumIndex {
+  GtUword *superrank,
+          *selectsample,
+          numofseparators,
+          numofbuckets,
+          numofsamples,
+          lowmask;
+  uint32_t *bucketrank;
+  uint16_t *lowbits;
+  unsigned int bucketbits;
+};
+
+#define GT_SEQNUM_INDEX_RANK(SI,BUCKET)\
+        ((SI)->superrank[(BUCKET) >> GT_SEQNUM_INDEX_SUPERBITS] +\
+         (GtUword) (SI)->bucketrank[BUCKET])
+
+GtSeqnumIndex* gt_seqnum_index_new(const GtUword *separators,
+                                   GtUword numofseparators,
+                                   GtUword totallength)
+{
+  GtSeqnumIndex *si;
+  GtUword bucket, sepidx = 0;
+
+  gt_assert(numofseparators == 0 ||
+            separators[numofseparators - 1] < totallength);
+  si = gt_malloc(sizeof (*si));
+  si->numofseparators = numofseparators;
+  /* choose the bucket width such that a bucket holds about two separators */
+  si->bucketbits = 0;
+  while (si->bucketbits < GT_SEQNUM_INDEX_MAXBUCKETBITS &&
+         (numofseparators << (si->bucketbits + 1)) <= 2 * totallength) {
+    si->bucketbits++;
+  }
+  si->lowmask = (1UL << si->bucketbits) - 1;
+  si->numofbuckets = (totallength >> si->bucketbits) + 1;
+  si->numofsamples = numofseparators == 0
+                     ? 0
+                     : ((numofseparators - 1) >> GT_SEQNUM_INDEX_SAMPLEBITS)
+                       + 1;
+  si->superrank = gt_malloc(sizeof (*si->superrank) *
+                            ((si->numofbuckets >> GT_SEQNUM_INDEX_SUPERBITS)
+                             + 1));
+  si->bucketrank = gt_malloc(sizeof (*si->bucketrank) *
+                             (si->numofbuckets + 1));
+  si->lowbits = gt_malloc(sizeof (*si->lowbits) * numofseparators);
+  si->selectsample = gt_malloc(sizeof (*si->selectsample) *
+                               si->numofsamples);
+  for (bucket = 0; bucket <= si->numofbuckets; bucket++) {
+    if ((bucket & ((1UL << GT_SEQNUM_INDEX_SUPERBITS) - 1)) == 0) {
+      si->superrank[bucket >> GT_SEQNUM_INDEX_SUPERBITS] = sepidx;
+    }
+    gt_assert(sepidx - si->superrank[bucket >> GT_SEQNUM_INDEX_SUPERBITS]
+              <= (GtUword) UINT32_MAX);
+    si->bucketrank[bucket]
+      = (uint32_t) (sepidx - si->superrank[bucket
+                                           >> GT_SEQNUM_INDEX_SUPERBITS]);
+    while (sepidx < numofseparators &&
+           (separators[sepidx] >> si->bucketbits) == bucket) {
+      gt_assert(sepidx == 0 || separators[sepidx - 1] < separators[sepidx]);
+      si->lowbits[sepidx] = (uint16_t) (separators[sepidx] & si->lowmask);
+      if ((sepidx & ((1UL << GT_SEQNUM_INDEX_SAMPLEBITS) - 1)) == 0) {
+        si->selectsample[sepidx >> GT_SEQNUM_INDEX_SAMPLEBITS] = bucket;
+      }
+      sepidx++;
+    }
+  }
+  gt_assert(sepidx == numofseparators);
+  return si;
+}
+
+GtUword gt_seqnum_index_seqnum(const GtSeqnumIndex *si, GtUword position)
+{
+  GtUword bucket, left, right;
+  uint16_t key;
+
+  gt_assert(si != NULL);
+  bucket = position >> si->bucketbits;
+  gt_assert(bucket < si->numofbuckets);
+  left = GT_SEQNUM_INDEX_RANK(si, bucket);
+  right = GT_SEQNUM_INDEX_RANK(si, bucket + 1);
+  key = (uint16_t) (position & si->lowmask);
+  if (right - left <= GT_SEQNUM_INDEX_LINEARSCAN) {
+    while (left < right && si->lowbits[left] < key) {
+      left++;
+    }
+    return left;
+  }
+  /* many empty sequences: find the first separator not smaller than key */
+  while (left < right) {
+    GtUword mid = left + GT_DIV2(right - left);
+    if (si->lowbits[mid] < key) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
+  }
+  return left;
+}
+
+GtUword gt_seqnum_index_separator(const GtSeqnumIndex *si, GtUword sepnum)
+{
+  GtUword sample, left, right;
+
+  gt_assert(si != NULL && sepnum < si->numofseparators);
+  sample = sepnum >> GT_SEQNUM_INDEX_SAMPLEBITS;
+  left = si->selectsample[sample];
+  right = sample + 1 < si->numofsamples ? si->selectsample[sample + 1]
+                                        : si->numofbuckets - 1;
+  /* the bucket of separator sepnum is the last one not preceded by more than
+     sepnum separators */
+  while (left < right) {
+    GtUword mid = left + GT_DIV2(right - left + 1);
+    if (GT_SEQNUM_INDEX_RANK(si, mid) <= sepnum) {
+      left = mid;
+    } else {
+      right = mid - 1;
+    }
+  }
+  return (left << si->bucketbits) | (GtUword) si->lowbits[sepnum];
+}
+
+size_t gt_seqnum_index_size(const GtSeqnumIndex *si)
+{
+  gt_assert(si != NULL);
+  return sizeof (*si)
+         + sizeof (*si->superrank) *
+           ((si->numofbuckets >> GT_SEQNUM_INDEX_SUPERBITS) + 1)
+         + sizeof (*si->bucketrank) * (si->numofbuckets + 1)
+         + sizeof (*si->lowbits) * si->numofseparators
+         + sizeof (*si->selectsample) * si->numofsamples;
+}
+
+void gt_seqnum_index_delete(GtSeqnumIndex *si)
+{
+  if (si == NULL)
+    return;
+  gt_free(si->superrank);
+  gt_free(si->bucketrank);
+  gt_free(si->lowbits);
+  gt_free(si->selectsample);
+  gt_free(si);
+}
+
+int gt_seqnum_index_unit_test(GtError *err)
+{
+  const GtUword maxlength = 20000UL;
+  GtUword *separators, run;
+  int had_err = 0;
+
+  gt_error_check(err);
+  separators = gt_malloc(sizeof (*separators) * maxlength);
+  for (run = 0; !had_err && run < 40UL; run++) {
+    GtSeqnumIndex *si;
+    GtUword totallength = 1UL + gt_rand_max(maxlength - 1),
+            maxgap = run % 4 == 0 ? 1UL : gt_rand_max(run * run * 10UL),
+            numofseparators = 0, pos, idx, seqnum = 0;
+
+    /* maxgap 1 yields empty sequences between adjacent separators */
+    for (pos = gt_rand_max(maxgap); pos < totallength;
+         pos += 1UL + gt_rand_max(maxgap)) {
+      separators[numofseparators++] = pos;
+    }
+    si = gt_seqnum_index_new(separators, numofseparators, totallength);
+    for (idx = 0; !had_err && idx < numofseparators; idx++) {
+      gt_ensure(gt_seqnum_index_separator(si, idx) == separators[idx]);
+    }
+    for (pos = 0; !had_err && pos < totallength; pos++) {
+      gt_ensure(gt_seqnum_index_seqnum(si, pos) == seqnum);
+      if (seqnum < numofseparators && separators[seqnum] == pos) {
+        seqnum++;
+      }
+    }
+    gt_seqnum_index_delete(si);
+  }
+  gt_free(separators);
+  return had_err;
+}
@@ -0,0 +1,56 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef SEQNUM_INDEX_H
+#define SEQNUM_INDEX_H
+
+#include <stdlib.h>
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* The <GtSeqnumIndex> class stores the sorted positions of the sequence
+   separators of a sequence collection in an Elias-Fano like layout: the lower
+   bits of each position are kept explicitly, the upper bits (the bucket of
+   the position) are represented by the number of separators in all previous
+   buckets, together with a sample of the bucket of every 16th separator.
+   The bucket width is chosen such that a bucket contains about two
+   separators, so that the sequence number of a position and the position of
+   a separator are found in almost constant time. */
+typedef struct GtSeqnumIndex GtSeqnumIndex;
+
+/* Returns a new <GtSeqnumIndex> for the <numofseparators> strictly increasing
+   separator positions in <separators>, all smaller than <totallength>. */
+GtSeqnumIndex* gt_seqnum_index_new(const GtUword *separators,
+                                   GtUword numofseparators,
+                                   GtUword totallength);
+
+/* Returns the number of separators in <si> at positions smaller than
+   <position>, that is, the number of the sequence containing <position>. */
+GtUword        gt_seqnum_index_seqnum(const GtSeqnumIndex *si,
+                                      GtUword position);
+
+/* Returns the position of separator <sepnum> stored in <si>. */
+GtUword        gt_seqnum_index_separator(const GtSeqnumIndex *si,
+                                         GtUword sepnum);
+
+/* Returns the number of bytes occupied by <si>. */
+size_t         gt_seqnum_index_size(const GtSeqnumIndex *si);
+
+void           gt_seqnum_index_delete(GtSeqnumIndex *si);
+
+int            gt_seqnum_index_unit_test(GtError *err);
+
+#endif
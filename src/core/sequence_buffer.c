@@ -127,6 +127,23 @@ void gt_sequence_buffer_set_desc_buffer(GtSequenceBuffer *si, GtDescBuffer *db)
   si->pvt->descptr = db;
 }
 
+int gt_sequence_buffer_set_quality_func(GtSequenceBuffer *si,
+                                        GtSequenceBufferQualityFunc
+                                                                  quality_func,
+                                        void *data,
+                                        GtError *err)
+{
+  gt_error_check(err);
+  gt_assert(si && si->pvt && quality_func);
+  if (si->c_class != gt_sequence_buffer_fastq_class()) {
+    gt_error_set(err, "qualities can only be read from FASTQ files");
+    return -1;
+  }
+  si->pvt->quality_func = quality_func;
+  si->pvt->quality_data = data;
+  return 0;
+}
+
 void gt_sequence_buffer_set_filelengthtab(GtSequenceBuffer *si,
                                           GtFilelengthvalues *flv)
 {
@@ -177,6 +194,38 @@ int gt_sequence_buffer_next(GtSequenceBuffer *sb, GtUchar *val,
   return 1;
 }
 
+int gt_sequence_buffer_next_segment(GtSequenceBuffer *sb,
+                                    const GtUchar **segment,
+                                    GtUword *length,
+                                    GtError *err)
+{
+  GtSequenceBufferMembers *pvt;
+  const GtUchar *start, *separator;
+  pvt = sb->pvt;
+  if (pvt->nextread >= pvt->nextfree) {
+    if (pvt->complete) {
+      return 0;
+    }
+    if (pvt->descptr && pvt->nextread > 0)
+      gt_desc_buffer_reset(pvt->descptr);
+    if (gt_sequence_buffer_advance(sb, err) != 0) {
+      return -1;
+    }
+    pvt->nextread = 0;
+    if (pvt->nextfree == 0) {
+      return 0;
+    }
+  }
+  start = pvt->outbuf + pvt->nextread;
+  separator = memchr(start, GT_SEPARATOR,
+                     (size_t) (pvt->nextfree - pvt->nextread));
+  *length = separator != NULL ? (GtUword) (separator - start) + 1
+                              : pvt->nextfree - pvt->nextread;
+  *segment = start;
+  pvt->nextread += *length;
+  return 1;
+}
+
 int gt_sequence_buffer_next_with_original_raw(GtSequenceBuffer *sb,
                                               GtUchar *val, char *orig,
                                               GtError *err)
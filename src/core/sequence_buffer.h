@@ -50,6 +50,19 @@ GtSequenceBuffer*  gt_sequence_buffer_new_guess_type(const GtStrArray*,
    -1 on error (see the <GtError> object for details). */
 int           gt_sequence_buffer_next(GtSequenceBuffer*, GtUchar*, GtError*);
 
+/* Fetches the next characters from <GtSequenceBuffer> without copying them:
+   <*segment> is set to the buffered characters up to and including the next
+   separator, or up to the end of the buffer if it contains no further
+   separator, and <*length> to their number. The characters are the same as
+   delivered by <gt_sequence_buffer_next()>, they are valid until the next call
+   of a function fetching characters from the buffer.
+   Returns 1 if characters could be read, 0 if all files are exhausted, or
+   -1 on error (see the <GtError> object for details). */
+int           gt_sequence_buffer_next_segment(GtSequenceBuffer*,
+                                              const GtUchar **segment,
+                                              GtUword *length,
+                                              GtError*);
+
 /* Fetches next character from <GtSequenceBuffer>.
    This method also always delivers the original character at the current
    reading position, regardless of symbol mappings that may apply.
@@ -89,6 +102,26 @@ void          gt_sequence_buffer_set_filelengthtab(GtSequenceBuffer*,
 void          gt_sequence_buffer_set_desc_buffer(GtSequenceBuffer *si,
                                                  GtDescBuffer *db);
 
+/* Function called by a <GtSequenceBuffer> for each sequence read, in the order
+   of the sequences, with the <qualities> of the <length> characters of the
+   sequence. <data> is the pointer given to
+   <gt_sequence_buffer_set_quality_func()>. Returns 0 on success and -1 on
+   error, in which case <err> is set. */
+typedef int (*GtSequenceBufferQualityFunc)(const GtUchar *qualities,
+                                           GtUword length,
+                                           void *data,
+                                           GtError *err);
+
+/* Assigns a function <quality_func> which is called with <data> for the
+   qualities of each sequence. Only FASTQ input provides qualities, for all
+   other types of input -1 is returned and <err> is set. Otherwise 0 is
+   returned. */
+int           gt_sequence_buffer_set_quality_func(GtSequenceBuffer *si,
+                                             GtSequenceBufferQualityFunc
+                                                                  quality_func,
+                                                  void *data,
+                                                  GtError *err);
+
 /* Assigns an array which counts the occurrences of each alphabet character in
    the read sequence. It must have at least as many elements as the number of
    characters in the expected alphabet.
@@ -15,6 +15,8 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <limits.h>
+#include <stdlib.h>
 #include <string.h>
 #include "core/arraydef_api.h"
 #include "core/sequence_buffer_dust.h"
@@ -23,9 +25,6 @@
 #include "core/minmax_api.h"
 #include "core/chardef_api.h"
 
-typedef unsigned char GtInl_Queueelem;
-#include "match/queue-inline.h"
-
 #define GT_MAXTRIPLETVALUE 63
 #define GT_ARRAYEXTENDSIZE 100
 #define GT_TREATNASRANDOM 0
@@ -54,8 +53,9 @@ struct GtDustMasker {
   GtUword buf_remaining;
   GtUword buf_size;
 
-  unsigned char nuc_val1;
-  unsigned char nuc_val2; /* last 2 nucleotide values */
+  unsigned char nuc_tab[UCHAR_MAX + 1]; /* nucleotide value of characters */
+  unsigned char triplet_val; /* last triplet, the last 2 nucleotide values are
+                                shifted into the next one */
 
   /* following variables named according to Morgulis et al. 2006 */
   unsigned int rv, rw;
@@ -63,7 +63,13 @@ struct GtDustMasker {
                cw[GT_MAXTRIPLETVALUE + 1],
                ctmp[GT_MAXTRIPLETVALUE + 1];
   GtUword L_param;
-  GtInl_Queue *w_queue;
+  /* the triplets of the window w, a ring buffer whose size is a power of 2,
+     the oldest triplet is at index <w_start> */
+  unsigned char *w_triplets;
+  GtUword w_start,
+          w_numoftriplets,
+          w_mask;
+  double cv_limit; /* triplet count in v which triggers shrinking of v */
 
   GtUword total_length,   /* Total chars written from file into buffer */
           current_length; /* Chars written in current sequence */
@@ -106,13 +112,24 @@ GtDustMasker* gt_dust_masker_new(bool echo, GtUword windowsize,
   dust_masker->buf_insertpos = 0;
   dust_masker->buf_remaining = 0;
 
-  dust_masker->nuc_val1 = 0;
-  dust_masker->nuc_val2 = 0;
+  memset(dust_masker->nuc_tab, 0, sizeof dust_masker->nuc_tab);
+  dust_masker->nuc_tab['c'] = dust_masker->nuc_tab['C'] = 1;
+  dust_masker->nuc_tab['g'] = dust_masker->nuc_tab['G'] = 2;
+  dust_masker->nuc_tab['t'] = dust_masker->nuc_tab['T'] = 3;
+  dust_masker->triplet_val = 0;
 
   dust_masker->rv = 0;
   dust_masker->rw = 0;
   dust_masker->L_param = 0;
-  dust_masker->w_queue = gt_inl_queue_new(windowsize);
+  for (dust_masker->w_mask = 1UL; dust_masker->w_mask < windowsize;
+       dust_masker->w_mask <<= 1)
+    /* Nothing */;
+  dust_masker->w_triplets = gt_malloc(dust_masker->w_mask *
+                                      sizeof *(dust_masker->w_triplets));
+  dust_masker->w_mask--;
+  dust_masker->w_start = 0;
+  dust_masker->w_numoftriplets = 0;
+  dust_masker->cv_limit = 2 * threshold;
 
   dust_masker->total_length = 0;
   dust_masker->current_length = 0;
@@ -136,7 +153,7 @@ void gt_dust_masker_delete(GtDustMasker *dust_masker)
 {
   if (dust_masker) {
     gt_free(dust_masker->buf);
-    gt_inl_queue_delete(dust_masker->w_queue);
+    gt_free(dust_masker->w_triplets);
     GT_FREEARRAY(&dust_masker->masked_regions,GtDustRange);
     gt_free(dust_masker);
   }
@@ -151,24 +168,22 @@ static inline void wrap_value_once(GtUword *val, GtUword limit)
   }
 }
 
-static inline unsigned char nucleotide_value(char c)
+static inline unsigned char nucleotide_value(const GtDustMasker *dust_masker,
+                                            char c)
 {
-  switch (c) {
-    case ('a'):
-    case ('A'): return 0;
-    case ('c'):
-    case ('C'): return 1;
-    case ('g'):
-    case ('G'): return 2;
-    case ('t'):
-    case ('T'): return 3;
 #if GT_TREATNASRANDOM
-    case ('n'):
-    case ('N'): return rand() % 4;
+  if (c == 'n' || c == 'N')
+    return rand() % 4;
 #endif
-    default: return 0;
-  }
-  return 0;
+  return dust_masker->nuc_tab[(unsigned char) c];
+}
+
+/* Returns the <n>-th triplet of the window w, counting from the oldest. */
+static inline unsigned char window_triplet(const GtDustMasker *dust_masker,
+                                           GtUword n)
+{
+  return dust_masker->w_triplets[(dust_masker->w_start + n)
+                                 & dust_masker->w_mask];
 }
 
 static inline void add_triplet_info(unsigned int *r, unsigned int *c,
@@ -206,7 +221,7 @@ static inline void find_perfect(GtDustMasker *dust_masker)
   if (dust_masker->current_length < dust_masker->buf_size) {
     readpos = dust_masker->last_seq_start;
   }
-  length = dust_masker->w_queue->noofelements - dust_masker->L_param - 1;
+  length = dust_masker->w_numoftriplets - dust_masker->L_param - 1;
   for (step = 0; step <= length; step++) {
     unsigned char t;
     idx = length - step;
@@ -214,9 +229,9 @@ static inline void find_perfect(GtDustMasker *dust_masker)
     wrap_value_once(&window_idx, dust_masker->buf_size);
     score_to_beat = GT_MAX(score_to_beat,
                            dust_masker->buf[window_idx].max_score);
-    t = gt_inl_queue_get_at_index(dust_masker->w_queue, idx);
+    t = window_triplet(dust_masker, idx);
     add_triplet_info(&r, dust_masker->ctmp, t);
-    new_score = (float) r/(float)(dust_masker->w_queue->noofelements - idx - 1);
+    new_score = (float) r/(float)(dust_masker->w_numoftriplets - idx - 1);
     if (new_score > dust_masker->threshold && new_score >= max_score &&
         new_score >= score_to_beat) {
       found = true;
@@ -230,7 +245,7 @@ static inline void find_perfect(GtDustMasker *dust_masker)
     buf_idx = (readpos + best_idx + linker_offset);
     wrap_value_once(&buf_idx, dust_masker->buf_size);
     dust_masker->buf[buf_idx].mask_length
-      = GT_MAX(dust_masker->w_queue->noofelements + 2 - best_idx,
+      = GT_MAX(dust_masker->w_numoftriplets + 2 - best_idx,
                dust_masker->buf[buf_idx].mask_length);
 
     if (dust_masker->linker > 1) {
@@ -277,34 +292,36 @@ static int gt_dust_masker_shift_window(GtDustMasker* dust_masker,
 
   if (!dust_masker->masking_done) {
     if (t_val != GT_SEPARATOR) {
-      nuc_val = nucleotide_value(t_orig);
-      triplet_val = dust_masker->nuc_val1 * 16 +
-                    dust_masker->nuc_val2 * 4 + nuc_val;
-      dust_masker->nuc_val1 = dust_masker->nuc_val2;
-      dust_masker->nuc_val2 = nuc_val;
+      nuc_val = nucleotide_value(dust_masker, t_orig);
+      triplet_val = dust_masker->triplet_val =
+        (unsigned char) (((dust_masker->triplet_val << 2) | nuc_val)
+                         & GT_MAXTRIPLETVALUE);
 
       if (dust_masker->current_length <= 2) {
         return 1;
       }
 
       /* next part according to SHIFT_WINDOW-procedure in Morgulis et al 2006 */
-      if (dust_masker->w_queue->noofelements >= dust_masker->windowsize - 2) {
-        s = (char) gt_inl_queue_get(dust_masker->w_queue);
+      if (dust_masker->w_numoftriplets >= dust_masker->windowsize - 2) {
+        s = window_triplet(dust_masker, 0);
+        dust_masker->w_start++;
+        dust_masker->w_numoftriplets--;
         rem_triplet_info(&dust_masker->rw, dust_masker->cw, s);
-        if (dust_masker->L_param > dust_masker->w_queue->noofelements) {
+        if (dust_masker->L_param > dust_masker->w_numoftriplets) {
           dust_masker->L_param--;
           rem_triplet_info(&dust_masker->rv, dust_masker->cv, s);
         }
       }
-      gt_inl_queue_add(dust_masker->w_queue, triplet_val, false);
+      dust_masker->w_triplets[(dust_masker->w_start
+                               + dust_masker->w_numoftriplets++)
+                              & dust_masker->w_mask] = triplet_val;
       dust_masker->L_param++;
       add_triplet_info(&dust_masker->rw, dust_masker->cw, triplet_val);
       add_triplet_info(&dust_masker->rv, dust_masker->cv, triplet_val);
-      if (dust_masker->cv[triplet_val] > (2 * dust_masker->threshold)) {
+      if (dust_masker->cv[triplet_val] > dust_masker->cv_limit) {
         do {
-          s = gt_inl_queue_get_at_index(dust_masker->w_queue,
-                                        dust_masker->w_queue->noofelements
-                                          - dust_masker->L_param);
+          s = window_triplet(dust_masker, dust_masker->w_numoftriplets
+                                            - dust_masker->L_param);
           rem_triplet_info(&dust_masker->rv, dust_masker->cv, s);
           dust_masker->L_param--;
         } while (s != triplet_val);
@@ -316,8 +333,7 @@ static int gt_dust_masker_shift_window(GtDustMasker* dust_masker,
     } else {
       /* Reset variables for next sequence in multiseq fasta file. */
       dust_masker->last_seq_start = dust_masker->buf_insertpos;
-      dust_masker->nuc_val1 = 0;
-      dust_masker->nuc_val2 = 0;
+      dust_masker->triplet_val = 0;
       dust_masker->rv = 0;
       dust_masker->rw = 0;
       dust_masker->L_param = 0;
@@ -326,8 +342,8 @@ static int gt_dust_masker_shift_window(GtDustMasker* dust_masker,
              sizeof *(dust_masker->cv) * (GT_MAXTRIPLETVALUE + 1));
       memset(dust_masker->cw, 0,
              sizeof *(dust_masker->cw) * (GT_MAXTRIPLETVALUE + 1));
-      gt_inl_queue_delete(dust_masker->w_queue);
-      dust_masker->w_queue = gt_inl_queue_new(dust_masker->windowsize);
+      dust_masker->w_start = 0;
+      dust_masker->w_numoftriplets = 0;
     }
   }
   return 1;
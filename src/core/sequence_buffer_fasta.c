@@ -17,6 +17,7 @@
 */
 
 #include <ctype.h>
+#include <string.h>
 #include "core/cstr_api.h"
 #include "core/sequence_buffer_fasta.h"
 #include "core/sequence_buffer_rep.h"
@@ -38,9 +39,48 @@ struct GtSequenceBufferFasta {
 #define gt_sequence_buffer_fasta_cast(SB)\
         gt_sequence_buffer_cast(gt_sequence_buffer_fasta_class(), SB)
 
+/* Consumes the characters of the current description line in the input
+   buffer, up to and including the newline. Returns the number of characters
+   consumed. */
+static GtUword gt_sequence_buffer_fasta_scan_desc(GtSequenceBuffer *sb)
+{
+  GtSequenceBufferMembers *pvt = sb->pvt;
+  GtSequenceBufferFasta *sbf = (GtSequenceBufferFasta*) sb;
+  const unsigned char *start = pvt->inbuf + pvt->currentinpos,
+                      *end = pvt->inbuf + pvt->currentfillpos,
+                      *newline;
+
+  newline = memchr(start, NEWLINESYMBOL, (size_t) (end - start));
+  if (newline != NULL)
+    end = newline;
+  if (pvt->descptr != NULL)
+  {
+    const unsigned char *ptr = start, *cr;
+    /* carriage returns are not part of the description */
+    while ((cr = memchr(ptr, CRSYMBOL, (size_t) (end - ptr))) != NULL)
+    {
+      gt_desc_buffer_append_chars(pvt->descptr, (const char *) ptr,
+                                  (GtUword) (cr - ptr));
+      ptr = cr + 1;
+    }
+    gt_desc_buffer_append_chars(pvt->descptr, (const char *) ptr,
+                                (GtUword) (end - ptr));
+  }
+  if (newline != NULL)
+  {
+    pvt->linenum++;
+    sbf->indesc = false;
+    if (pvt->descptr != NULL)
+      gt_desc_buffer_finish(pvt->descptr);
+    end++;
+  }
+  pvt->currentinpos = (GtUword) (end - pvt->inbuf);
+  return (GtUword) (end - start);
+}
+
 static int gt_sequence_buffer_fasta_advance(GtSequenceBuffer *sb, GtError *err)
 {
-  int currentchar, ret = 0;
+  int ret = 0;
   GtUword currentoutpos = 0, currentfileadd = 0, currentfileread = 0;
   GtSequenceBufferMembers *pvt;
   GtSequenceBufferFasta *sbf;
@@ -82,8 +122,14 @@ static int gt_sequence_buffer_fasta_advance(GtSequenceBuffer *sb, GtError *err)
       pvt->currentfillpos = 0;
     } else
     {
-      currentchar = inlinebuf_getchar(sb, pvt->inputstream);
-      if (currentchar == EOF)
+      if (pvt->currentinpos >= pvt->currentfillpos)
+      {
+        pvt->currentfillpos = (GtUword) gt_file_xread(pvt->inputstream,
+                                                      pvt->inbuf,
+                                                      (size_t) INBUFSIZE);
+        pvt->currentinpos = 0;
+      }
+      if (pvt->currentfillpos == 0)
       {
         gt_file_delete(pvt->inputstream);
         pvt->inputstream = NULL;
@@ -99,62 +145,50 @@ static int gt_sequence_buffer_fasta_advance(GtSequenceBuffer *sb, GtError *err)
         }
         pvt->filenum++;
         sbf->nextfile = true;
+      } else if (sbf->indesc)
+      {
+        currentfileread += gt_sequence_buffer_fasta_scan_desc(sb);
       } else
       {
-        currentfileread++;
-        if (sbf->indesc)
+        /* consume the sequence characters in the input buffer until the
+           output buffer is full or a description starts */
+        while (pvt->currentinpos < pvt->currentfillpos &&
+               currentoutpos < (GtUword) OUTBUFSIZE)
         {
-          if (currentchar == NEWLINESYMBOL)
-          {
-            pvt->linenum++;
-            sbf->indesc = false;
-          }
-          if (pvt->descptr != NULL)
+          unsigned char currentchar = pvt->inbuf[pvt->currentinpos++];
+          currentfileread++;
+          if (isspace((int) currentchar))
           {
             if (currentchar == NEWLINESYMBOL)
             {
-              gt_desc_buffer_finish(pvt->descptr);
-            } else
-            {
-              if (currentchar != CRSYMBOL)
-                gt_desc_buffer_append_char(pvt->descptr, currentchar);
+              pvt->linenum++;
             }
-          }
-        } else
-        {
-          if (currentchar == NEWLINESYMBOL)
+          } else if (currentchar == FASTASEPARATOR)
           {
-            pvt->linenum++;
-          }
-          if (!isspace((int) currentchar))
-          {
-            if (currentchar == FASTASEPARATOR)
+            if (sbf->firstoverallseq)
+            {
+              sbf->firstoverallseq = false;
+              sbf->firstseqinfile = false;
+            } else
             {
-              if (sbf->firstoverallseq)
+              if (sbf->firstseqinfile)
               {
-                sbf->firstoverallseq = false;
                 sbf->firstseqinfile = false;
               } else
               {
-                if (sbf->firstseqinfile)
-                {
-                  sbf->firstseqinfile = false;
-                } else
-                {
-                  currentfileadd++;
-                }
-                pvt->outbuf[currentoutpos++] = (unsigned char) GT_SEPARATOR;
-                pvt->lastspeciallength++;
+                currentfileadd++;
               }
-              sbf->indesc = true;
-            } else
-            {
-              if ((ret = process_char(sb, currentoutpos,
-                                      (unsigned char) currentchar, err)))
-                return ret;
-              currentoutpos++;
-              currentfileadd++;
+              pvt->outbuf[currentoutpos++] = (unsigned char) GT_SEPARATOR;
+              pvt->lastspeciallength++;
             }
+            sbf->indesc = true;
+            break;
+          } else
+          {
+            if ((ret = process_char(sb, currentoutpos, currentchar, err)))
+              return ret;
+            currentoutpos++;
+            currentfileadd++;
           }
         }
       }
@@ -34,6 +34,7 @@ struct GtSequenceBufferFastQ
   const GtStrArray *sequences;
   bool carryseparator;
   GtStr *overflowbuffer;
+  const GtUchar *qualities;
 };
 
 #define gt_sequence_buffer_fastq_cast(SB)\
@@ -57,6 +58,9 @@ static int gt_sequence_buffer_fastq_advance(GtSequenceBuffer *sb, GtError *err)
     sbfq->seqit = (GtSeqIteratorFastQ*)
                          gt_seq_iterator_fastq_new(sbfq->sequences, err);
     if (!sbfq->seqit) return -1;
+    if (pvt->quality_func != NULL)
+      gt_seq_iterator_set_quality_buffer((GtSeqIterator*) sbfq->seqit,
+                                         &sbfq->qualities);
   }
 
   /* did the last buffer end with a sequence boundary?
@@ -134,17 +138,26 @@ static int gt_sequence_buffer_fastq_advance(GtSequenceBuffer *sb, GtError *err)
       break;
     }
 
+    /* pass the qualities of the sequence on */
+    if (pvt->quality_func != NULL &&
+        pvt->quality_func(sbfq->qualities, seqlen, pvt->quality_data,
+                          err) != 0) {
+      return -1;
+    }
+
     /* copy sequence */
-    for (cnt=0;cnt<seqlen;cnt++) {
-      if (currentoutpos >= (GtUword) OUTBUFSIZE) {
-        gt_str_append_char(sbfq->overflowbuffer, seq[cnt]);
-      } else {
-        if ((had_err = process_char(sb, currentoutpos, seq[cnt], err)))
-          return had_err;
-        currentoutpos++;
-        currentfileadd++;
-        currentfileread++;
-      }
+    for (cnt=0;cnt<seqlen && currentoutpos < (GtUword) OUTBUFSIZE;cnt++) {
+      if ((had_err = process_char(sb, currentoutpos, seq[cnt], err)))
+        return had_err;
+      currentoutpos++;
+      currentfileadd++;
+      currentfileread++;
+    }
+    /* the part not fitting into the output buffer is kept for the next
+       round */
+    if (cnt < seqlen) {
+      gt_str_append_cstr_nt(sbfq->overflowbuffer, (const char*) seq + cnt,
+                            seqlen - cnt);
     }
 
     /* place separator after sequence (or defer) */
@@ -164,10 +177,7 @@ static int gt_sequence_buffer_fastq_advance(GtSequenceBuffer *sb, GtError *err)
 
     /* enqueue description */
     if (pvt->descptr) {
-      int i;
-      for (i = 0; i < strlen(desc); i++) {
-        gt_desc_buffer_append_char(pvt->descptr, desc[i]);
-      }
+      gt_desc_buffer_append_chars(pvt->descptr, desc, desclen - 1);
       gt_desc_buffer_finish(pvt->descptr);
     }
 
@@ -50,6 +50,8 @@ struct GtSequenceBufferMembers {
   bool complete,
        use_ungetchar;
   GtDescBuffer *descptr;
+  GtSequenceBufferQualityFunc quality_func;
+  void *quality_data;
   GtFile *inputstream;
   GtUword reference_count,
                 *chardisttab,
@@ -0,0 +1,279 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/xxhash.h"
+
+#define GT_XXH_PRIME1 0x9E3779B185EBCA87ULL
+#define GT_XXH_PRIME2 0xC2B2AE3D27D4EB4FULL
+#define GT_XXH_PRIME3 0x165667B19E3779F9ULL
+#define GT_XXH_PRIME4 0x85EBCA77C2B2AE63ULL
+#define GT_XXH_PRIME5 0x27D4EB2F165667C5ULL
+
+/* number of bytes consumed by one round over the four accumulators */
+#define GT_XXH_STRIPE 32U
+
+#define GT_XXH_ROTL(X,R) (((X) << (R)) | ((X) >> (64 - (R))))
+
+struct GtXXHash64 {
+  GtUint64 seed,
+           acc[4],
+           totallength;
+  unsigned char buffer[GT_XXH_STRIPE];
+  unsigned int buffered;
+};
+
+/* the input is read in little endian byte order on all platforms, the
+   compiler turns this into a single load where possible */
+static inline GtUint64 gt_xxh_read64(const unsigned char *p)
+{
+  return (GtUint64) p[0] | ((GtUint64) p[1] << 8) | ((GtUint64) p[2] << 16) |
+         ((GtUint64) p[3] << 24) | ((GtUint64) p[4] << 32) |
+         ((GtUint64) p[5] << 40) | ((GtUint64) p[6] << 48) |
+         ((GtUint64) p[7] << 56);
+}
+
+static inline GtUint64 gt_xxh_read32(const unsigned char *p)
+{
+  return (GtUint64) p[0] | ((GtUint64) p[1] << 8) | ((GtUint64) p[2] << 16) |
+         ((GtUint64) p[3] << 24);
+}
+
+static inline GtUint64 gt_xxh_round(GtUint64 acc, GtUint64 input)
+{
+  acc += input * GT_XXH_PRIME2;
+  acc = GT_XXH_ROTL(acc, 31);
+  return acc * GT_XXH_PRIME1;
+}
+
+static inline GtUint64 gt_xxh_merge_round(GtUint64 acc, GtUint64 val)
+{
+  acc ^= gt_xxh_round(0, val);
+  return acc * GT_XXH_PRIME1 + GT_XXH_PRIME4;
+}
+
+static void gt_xxh_init_acc(GtUint64 *acc, GtUint64 seed)
+{
+  acc[0] = seed + GT_XXH_PRIME1 + GT_XXH_PRIME2;
+  acc[1] = seed + GT_XXH_PRIME2;
+  acc[2] = seed;
+  acc[3] = seed - GT_XXH_PRIME1;
+}
+
+/* processes all complete stripes of the <len> bytes at <p>, returns the
+   number of bytes consumed */
+static size_t gt_xxh_stripes(GtUint64 *acc, const unsigned char *p,
+                             size_t len)
+{
+  const unsigned char *start = p, *limit = p + len - len % GT_XXH_STRIPE;
+  GtUint64 v1 = acc[0], v2 = acc[1], v3 = acc[2], v4 = acc[3];
+
+  while (p < limit) {
+    v1 = gt_xxh_round(v1, gt_xxh_read64(p));
+    v2 = gt_xxh_round(v2, gt_xxh_read64(p + 8));
+    v3 = gt_xxh_round(v3, gt_xxh_read64(p + 16));
+    v4 = gt_xxh_round(v4, gt_xxh_read64(p + 24));
+    p += GT_XXH_STRIPE;
+  }
+  acc[0] = v1;
+  acc[1] = v2;
+  acc[2] = v3;
+  acc[3] = v4;
+  return (size_t) (p - start);
+}
+
+/* combines the state with the remaining <len> < 32 bytes at <p> */
+static GtUint64 gt_xxh_finalize(const GtUint64 *acc, GtUint64 seed,
+                                GtUint64 totallength,
+                                const unsigned char *p, size_t len)
+{
+  GtUint64 h;
+
+  gt_assert(len < (size_t) GT_XXH_STRIPE);
+  if (totallength >= (GtUint64) GT_XXH_STRIPE) {
+    h = GT_XXH_ROTL(acc[0], 1) + GT_XXH_ROTL(acc[1], 7) +
+        GT_XXH_ROTL(acc[2], 12) + GT_XXH_ROTL(acc[3], 18);
+    h = gt_xxh_merge_round(h, acc[0]);
+    h = gt_xxh_merge_round(h, acc[1]);
+    h = gt_xxh_merge_round(h, acc[2]);
+    h = gt_xxh_merge_round(h, acc[3]);
+  } else {
+    h = seed + GT_XXH_PRIME5;
+  }
+  h += totallength;
+  for (; len >= 8; p += 8, len -= 8) {
+    h ^= gt_xxh_round(0, gt_xxh_read64(p));
+    h = GT_XXH_ROTL(h, 27) * GT_XXH_PRIME1 + GT_XXH_PRIME4;
+  }
+  if (len >= 4) {
+    h ^= gt_xxh_read32(p) * GT_XXH_PRIME1;
+    h = GT_XXH_ROTL(h, 23) * GT_XXH_PRIME2 + GT_XXH_PRIME3;
+    p += 4;
+    len -= 4;
+  }
+  for (; len > 0; p++, len--) {
+    h ^= (GtUint64) *p * GT_XXH_PRIME5;
+    h = GT_XXH_ROTL(h, 11) * GT_XXH_PRIME1;
+  }
+  h ^= h >> 33;
+  h *= GT_XXH_PRIME2;
+  h ^= h >> 29;
+  h *= GT_XXH_PRIME3;
+  h ^= h >> 32;
+  return h;
+}
+
+GtXXHash64* gt_xxhash64_new(GtUint64 seed)
+{
+  GtXXHash64 *xxh = gt_malloc(sizeof (*xxh));
+  gt_xxhash64_reset(xxh, seed);
+  return xxh;
+}
+
+void gt_xxhash64_reset(GtXXHash64 *xxh, GtUint64 seed)
+{
+  gt_assert(xxh != NULL);
+  xxh->seed = seed;
+  gt_xxh_init_acc(xxh->acc, seed);
+  xxh->totallength = 0;
+  xxh->buffered = 0;
+}
+
+void gt_xxhash64_add(GtXXHash64 *xxh, const void *data, size_t len)
+{
+  const unsigned char *p = data;
+
+  gt_assert(xxh != NULL && (data != NULL || len == 0));
+  xxh->totallength += (GtUint64) len;
+  if (xxh->buffered > 0) {
+    size_t fill = GT_XXH_STRIPE - xxh->buffered;
+    if (len < fill) {
+      memcpy(xxh->buffer + xxh->buffered, p, len);
+      xxh->buffered += (unsigned int) len;
+      return;
+    }
+    memcpy(xxh->buffer + xxh->buffered, p, fill);
+    (void) gt_xxh_stripes(xxh->acc, xxh->buffer, (size_t) GT_XXH_STRIPE);
+    xxh->buffered = 0;
+    p += fill;
+    len -= fill;
+  }
+  if (len >= (size_t) GT_XXH_STRIPE) {
+    size_t consumed = gt_xxh_stripes(xxh->acc, p, len);
+    p += consumed;
+    len -= consumed;
+  }
+  memcpy(xxh->buffer, p, len);
+  xxh->buffered = (unsigned int) len;
+}
+
+GtUint64 gt_xxhash64_digest(const GtXXHash64 *xxh)
+{
+  gt_assert(xxh != NULL);
+  return gt_xxh_finalize(xxh->acc, xxh->seed, xxh->totallength, xxh->buffer,
+                         (size_t) xxh->buffered);
+}
+
+void gt_xxhash64_delete(GtXXHash64 *xxh)
+{
+  if (!xxh) return;
+  gt_free(xxh);
+}
+
+GtUint64 gt_xxhash64(const void *data, size_t len, GtUint64 seed)
+{
+  GtUint64 acc[4];
+  size_t consumed;
+
+  gt_assert(data != NULL || len == 0);
+  gt_xxh_init_acc(acc, seed);
+  consumed = len >= (size_t) GT_XXH_STRIPE
+             ? gt_xxh_stripes(acc, data, len)
+             : 0;
+  return gt_xxh_finalize(acc, seed, (GtUint64) len,
+                         (const unsigned char *) data + consumed,
+                         len - consumed);
+}
+
+void gt_xxhash64_fingerprint(char *fingerprint, const char *sequence,
+                             GtUword seqlen)
+{
+  unsigned char buf[256];
+  GtXXHash64 xxh;
+  GtUword i, pos = 0;
+
+  gt_assert(fingerprint != NULL);
+  gt_xxhash64_reset(&xxh, 0);
+  for (i = 0; i < seqlen; i++) {
+    if (pos == sizeof (buf)) {
+      gt_xxhash64_add(&xxh, buf, sizeof (buf));
+      pos = 0;
+    }
+    buf[pos++] = (unsigned char) toupper((int) sequence[i]);
+  }
+  gt_xxhash64_add(&xxh, buf, (size_t) pos);
+  (void) snprintf(fingerprint, (size_t) GT_XXHASH64_FINGERPRINT_LENGTH,
+                  "%016llx", (unsigned long long) gt_xxhash64_digest(&xxh));
+}
+
+int gt_xxhash64_unit_test(GtError *err)
+{
+  static const char *text = "Nobody inspects the spammish repetition";
+  char data[1000], fp1[GT_XXHASH64_FINGERPRINT_LENGTH],
+       fp2[GT_XXHASH64_FINGERPRINT_LENGTH];
+  GtXXHash64 *xxh;
+  size_t i, len;
+  int had_err = 0;
+
+  gt_error_check(err);
+  /* reference values of the original implementation */
+  gt_ensure(gt_xxhash64("", 0, 0) == 0xEF46DB3751D8E999ULL);
+  gt_ensure(gt_xxhash64("abc", 3, 0) == 0x44BC2CF5AD770999ULL);
+  gt_ensure(gt_xxhash64(text, strlen(text), 0) == 0xFBCEA83C8A378BF1ULL);
+
+  /* adding the data in pieces yields the same hash */
+  for (i = 0; i < sizeof (data); i++)
+    data[i] = (char) (i * 7 + 3);
+  xxh = gt_xxhash64_new(42);
+  for (len = 0; !had_err && len <= sizeof (data); len += 37) {
+    size_t pos = 0, piece = 1;
+    gt_xxhash64_reset(xxh, 42);
+    while (pos < len) {
+      size_t add = piece < len - pos ? piece : len - pos;
+      gt_xxhash64_add(xxh, data + pos, add);
+      pos += add;
+      piece = piece % 40 + 3;
+    }
+    gt_ensure(gt_xxhash64_digest(xxh) == gt_xxhash64(data, len, 42));
+  }
+  gt_xxhash64_delete(xxh);
+
+  /* fingerprints ignore the case */
+  if (!had_err) {
+    gt_xxhash64_fingerprint(fp1, "acgtNNacgt", 10UL);
+    gt_xxhash64_fingerprint(fp2, "ACGTnnACGT", 10UL);
+    gt_ensure(strlen(fp1) == GT_XXHASH64_FINGERPRINT_LENGTH - 1);
+    gt_ensure(strcmp(fp1, fp2) == 0);
+    gt_xxhash64_fingerprint(fp2, "ACGTNNACGA", 10UL);
+    gt_ensure(strcmp(fp1, fp2) != 0);
+  }
+  return had_err;
+}
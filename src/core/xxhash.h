@@ -0,0 +1,59 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef XXHASH_H
+#define XXHASH_H
+
+#include <stdlib.h>
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* Length of the string representation of a 64-bit xxHash fingerprint,
+   including the terminating \0. */
+#define GT_XXHASH64_FINGERPRINT_LENGTH 17
+
+/* The <GtXXHash64> class implements the non-cryptographic 64-bit xxHash
+   (XXH64) for data given in pieces of arbitrary length. It is much faster
+   than MD5 and suitable for duplicate detection, but not for
+   cryptographic purposes. */
+typedef struct GtXXHash64 GtXXHash64;
+
+/* Returns a new <GtXXHash64> object for the hash with the given <seed>. */
+GtXXHash64* gt_xxhash64_new(GtUint64 seed);
+/* Resets <xxh> to represent the hash of the empty string with the given
+   <seed>. */
+void        gt_xxhash64_reset(GtXXHash64 *xxh, GtUint64 seed);
+/* Adds the <len> bytes at <data> to the hash currently represented by
+   <xxh>. */
+void        gt_xxhash64_add(GtXXHash64 *xxh, const void *data, size_t len);
+/* Returns the hash of all data added to <xxh>, <xxh> is not changed. */
+GtUint64    gt_xxhash64_digest(const GtXXHash64 *xxh);
+/* Deletes <xxh> and frees all associated space. */
+void        gt_xxhash64_delete(GtXXHash64 *xxh);
+
+/* Returns the 64-bit xxHash of the <len> bytes at <data> with <seed>. */
+GtUint64    gt_xxhash64(const void *data, size_t len, GtUint64 seed);
+
+/* Writes the xxHash fingerprint of <sequence> of length <seqlen>, transformed
+   to upper case letters (with toupper(3)) as for MD5 fingerprints, as a
+   \0-terminated hexadecimal string to <fingerprint>, which must provide space
+   for <GT_XXHASH64_FINGERPRINT_LENGTH> characters. */
+void        gt_xxhash64_fingerprint(char *fingerprint, const char *sequence,
+                                    GtUword seqlen);
+
+int         gt_xxhash64_unit_test(GtError *err);
+
+#endif
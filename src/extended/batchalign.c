@@ -0,0 +1,739 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/chardef_api.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/minmax_api.h"
+#include "extended/alignment.h"
+#include "extended/batchalign.h"
+#include "extended/linearalign.h"
+#include "extended/linearalign_affinegapcost.h"
+#include "extended/linspace_management.h"
+#include "extended/stripedalign.h"
+
+/* like the striped kernels, the inter-sequence kernels are compiled with
+   function specific target options and chosen at runtime */
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__)) && \
+    (defined (__clang__) || __GNUC__ > 4 || \
+     (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define GT_BATCHALIGN_X86
+#include <immintrin.h>
+#endif
+
+#define GT_BATCHALIGN_MAXLANES 32UL
+/* result of a lane whose values do not fit into the lane width */
+#define GT_BATCHALIGN_OVERFLOW GT_WORD_MAX
+/* codes of the characters which never match, the character classes occurring
+   in a batch are numbered from 0 */
+#define GT_BATCHALIGN_UPAD     254
+#define GT_BATCHALIGN_VPAD     255
+/* the values of longer pairs hardly ever fit into 8 bit lanes */
+#define GT_BATCHALIGN_MAXLEN8  128UL
+
+typedef struct {
+  GtUword maxulen, maxvlen,
+          ulens[GT_BATCHALIGN_MAXLANES],
+          vlens[GT_BATCHALIGN_MAXLANES];
+  const uint8_t *ucodes, *vcodes;
+  void *hcol, *fcol;
+  GtWord matchvalue, mismatchvalue, gap_opening, gap_extension,
+         results[GT_BATCHALIGN_MAXLANES];
+} GtBatchalignProblem;
+
+#ifdef GT_BATCHALIGN_X86
+
+#define GT_BA_VEC             __m128i
+#define GT_BA_LANES           16UL
+#define GT_BA_INT             int8_t
+#define GT_BA_INTMAX          INT8_MAX
+#define GT_BA_INTMIN          INT8_MIN
+#define GT_BA_TARGET          __attribute__ ((target ("sse4.1")))
+#define GT_BA_NAME(X)         gt_batchalign_##X##_sse41_8
+#define GT_BA_LOAD(P)         _mm_loadu_si128((const __m128i *) (P))
+#define GT_BA_STORE(P,V)      _mm_storeu_si128((__m128i *) (P), V)
+#define GT_BA_LOADCODES(P)    GT_BA_LOAD(P)
+#define GT_BA_SET1(X)         _mm_set1_epi8((char) (X))
+#define GT_BA_ADDS(A,B)       _mm_adds_epi8(A, B)
+#define GT_BA_MIN(A,B)        _mm_min_epi8(A, B)
+#define GT_BA_MAX(A,B)        _mm_max_epi8(A, B)
+#define GT_BA_CMPEQ(A,B)      _mm_cmpeq_epi8(A, B)
+#define GT_BA_BLEND(A,B,M)    _mm_blendv_epi8(A, B, M)
+#include "extended/batchalign-kernel.inc"
+#undef GT_BA_VEC
+#undef GT_BA_LANES
+#undef GT_BA_INT
+#undef GT_BA_INTMAX
+#undef GT_BA_INTMIN
+#undef GT_BA_TARGET
+#undef GT_BA_NAME
+#undef GT_BA_LOAD
+#undef GT_BA_STORE
+#undef GT_BA_LOADCODES
+#undef GT_BA_SET1
+#undef GT_BA_ADDS
+#undef GT_BA_MIN
+#undef GT_BA_MAX
+#undef GT_BA_CMPEQ
+#undef GT_BA_BLEND
+
+#define GT_BA_VEC             __m128i
+#define GT_BA_LANES           8UL
+#define GT_BA_INT             int16_t
+#define GT_BA_INTMAX          INT16_MAX
+#define GT_BA_INTMIN          INT16_MIN
+#define GT_BA_TARGET          __attribute__ ((target ("sse4.1")))
+#define GT_BA_NAME(X)         gt_batchalign_##X##_sse41_16
+#define GT_BA_LOAD(P)         _mm_loadu_si128((const __m128i *) (P))
+#define GT_BA_STORE(P,V)      _mm_storeu_si128((__m128i *) (P), V)
+#define GT_BA_LOADCODES(P)    _mm_cvtepu8_epi16(\
+                                _mm_loadl_epi64((const __m128i *) (P)))
+#define GT_BA_SET1(X)         _mm_set1_epi16((short) (X))
+#define GT_BA_ADDS(A,B)       _mm_adds_epi16(A, B)
+#define GT_BA_MIN(A,B)        _mm_min_epi16(A, B)
+#define GT_BA_MAX(A,B)        _mm_max_epi16(A, B)
+#define GT_BA_CMPEQ(A,B)      _mm_cmpeq_epi16(A, B)
+#define GT_BA_BLEND(A,B,M)    _mm_blendv_epi8(A, B, M)
+#include "extended/batchalign-kernel.inc"
+#undef GT_BA_VEC
+#undef GT_BA_LANES
+#undef GT_BA_INT
+#undef GT_BA_INTMAX
+#undef GT_BA_INTMIN
+#undef GT_BA_TARGET
+#undef GT_BA_NAME
+#undef GT_BA_LOAD
+#undef GT_BA_STORE
+#undef GT_BA_LOADCODES
+#undef GT_BA_SET1
+#undef GT_BA_ADDS
+#undef GT_BA_MIN
+#undef GT_BA_MAX
+#undef GT_BA_CMPEQ
+#undef GT_BA_BLEND
+
+#define GT_BA_VEC             __m256i
+#define GT_BA_LANES           32UL
+#define GT_BA_INT             int8_t
+#define GT_BA_INTMAX          INT8_MAX
+#define GT_BA_INTMIN          INT8_MIN
+#define GT_BA_TARGET          __attribute__ ((target ("avx2")))
+#define GT_BA_NAME(X)         gt_batchalign_##X##_avx2_8
+#define GT_BA_LOAD(P)         _mm256_loadu_si256((const __m256i *) (P))
+#define GT_BA_STORE(P,V)      _mm256_storeu_si256((__m256i *) (P), V)
+#define GT_BA_LOADCODES(P)    GT_BA_LOAD(P)
+#define GT_BA_SET1(X)         _mm256_set1_epi8((char) (X))
+#define GT_BA_ADDS(A,B)       _mm256_adds_epi8(A, B)
+#define GT_BA_MIN(A,B)        _mm256_min_epi8(A, B)
+#define GT_BA_MAX(A,B)        _mm256_max_epi8(A, B)
+#define GT_BA_CMPEQ(A,B)      _mm256_cmpeq_epi8(A, B)
+#define GT_BA_BLEND(A,B,M)    _mm256_blendv_epi8(A, B, M)
+#include "extended/batchalign-kernel.inc"
+#undef GT_BA_VEC
+#undef GT_BA_LANES
+#undef GT_BA_INT
+#undef GT_BA_INTMAX
+#undef GT_BA_INTMIN
+#undef GT_BA_TARGET
+#undef GT_BA_NAME
+#undef GT_BA_LOAD
+#undef GT_BA_STORE
+#undef GT_BA_LOADCODES
+#undef GT_BA_SET1
+#undef GT_BA_ADDS
+#undef GT_BA_MIN
+#undef GT_BA_MAX
+#undef GT_BA_CMPEQ
+#undef GT_BA_BLEND
+
+#define GT_BA_VEC             __m256i
+#define GT_BA_LANES           16UL
+#define GT_BA_INT             int16_t
+#define GT_BA_INTMAX          INT16_MAX
+#define GT_BA_INTMIN          INT16_MIN
+#define GT_BA_TARGET          __attribute__ ((target ("avx2")))
+#define GT_BA_NAME(X)         gt_batchalign_##X##_avx2_16
+#define GT_BA_LOAD(P)         _mm256_loadu_si256((const __m256i *) (P))
+#define GT_BA_STORE(P,V)      _mm256_storeu_si256((__m256i *) (P), V)
+#define GT_BA_LOADCODES(P)    _mm256_cvtepu8_epi16(\
+                                _mm_loadu_si128((const __m128i *) (P)))
+#define GT_BA_SET1(X)         _mm256_set1_epi16((short) (X))
+#define GT_BA_ADDS(A,B)       _mm256_adds_epi16(A, B)
+#define GT_BA_MIN(A,B)        _mm256_min_epi16(A, B)
+#define GT_BA_MAX(A,B)        _mm256_max_epi16(A, B)
+#define GT_BA_CMPEQ(A,B)      _mm256_cmpeq_epi16(A, B)
+#define GT_BA_BLEND(A,B,M)    _mm256_blendv_epi8(A, B, M)
+#include "extended/batchalign-kernel.inc"
+#undef GT_BA_VEC
+#undef GT_BA_LANES
+#undef GT_BA_INT
+#undef GT_BA_INTMAX
+#undef GT_BA_INTMIN
+#undef GT_BA_TARGET
+#undef GT_BA_NAME
+#undef GT_BA_LOAD
+#undef GT_BA_STORE
+#undef GT_BA_LOADCODES
+#undef GT_BA_SET1
+#undef GT_BA_ADDS
+#undef GT_BA_MIN
+#undef GT_BA_MAX
+#undef GT_BA_CMPEQ
+#undef GT_BA_BLEND
+
+#endif
+
+typedef void (*GtBatchalignKernelFunc)(GtBatchalignProblem *problem);
+
+/* a lane width, in which the pairs not yet aligned are tried */
+typedef struct {
+  GtBatchalignKernelFunc kernelfunc;
+  GtUword lanes, maxlen;
+  GtWord intmax, intmin;
+  size_t intsize;
+} GtBatchalignLaneWidth;
+
+typedef struct {
+  GtUword pairidx, ulen, vlen;
+} GtBatchalignPair;
+
+static int gt_batchalign_pair_compare(const void *a, const void *b)
+{
+  const GtBatchalignPair *pa = a, *pb = b;
+
+  if (pa->ulen != pb->ulen)
+  {
+    return pa->ulen < pb->ulen ? -1 : 1;
+  }
+  if (pa->vlen != pb->vlen)
+  {
+    return pa->vlen < pb->vlen ? -1 : 1;
+  }
+  return pa->pairidx < pb->pairidx ? -1 : (pa->pairidx > pb->pairidx ? 1 : 0);
+}
+
+/* the DP for the pairs which cannot be aligned by the vector kernels */
+static GtWord gt_batchalign_scalar(bool global,
+                                   const GtScoreHandler *scorehandler,
+                                   const GtUchar *useq, GtUword ulen,
+                                   const GtUchar *vseq, GtUword vlen)
+{
+  const GtWord gap_opening = gt_scorehandler_get_gap_opening(scorehandler),
+               gap_extension = gt_scorehandler_get_gapscore(scorehandler),
+               undefined = global ? GT_WORD_MAX / 4 : GT_WORD_MIN / 4;
+  GtWord *hcol, *fcol, northwest, west, evalue, result = 0;
+  GtUword rowindex, colindex;
+
+  hcol = gt_malloc(sizeof *hcol * 2 * (ulen + 1));
+  fcol = hcol + ulen + 1;
+  hcol[0] = 0;
+  for (rowindex = 1UL; rowindex <= ulen; rowindex++)
+  {
+    hcol[rowindex] = global ? gap_opening + (GtWord) rowindex * gap_extension
+                            : 0;
+    fcol[rowindex] = undefined;
+  }
+  if (global && vlen == 0)
+  {
+    result = hcol[ulen];
+  }
+  for (colindex = 1UL; colindex <= vlen; colindex++)
+  {
+    northwest = hcol[0];
+    if (global)
+    {
+      hcol[0] = gap_opening + (GtWord) colindex * gap_extension;
+    }
+    evalue = undefined;
+    for (rowindex = 1UL; rowindex <= ulen; rowindex++)
+    {
+      const GtWord replacement
+        = gt_scorehandler_get_replacement(scorehandler, useq[rowindex-1],
+                                          vseq[colindex-1]);
+      GtWord value;
+
+      west = hcol[rowindex];
+      if (global)
+      {
+        fcol[rowindex] = GT_MIN(fcol[rowindex] + gap_extension,
+                                west + gap_opening + gap_extension);
+        evalue = GT_MIN(evalue + gap_extension,
+                        hcol[rowindex-1] + gap_opening + gap_extension);
+        value = GT_MIN3(northwest + replacement, evalue, fcol[rowindex]);
+      } else
+      {
+        fcol[rowindex] = GT_MAX(fcol[rowindex] + gap_extension,
+                                west + gap_opening + gap_extension);
+        evalue = GT_MAX(evalue + gap_extension,
+                        hcol[rowindex-1] + gap_opening + gap_extension);
+        value = GT_MAX(GT_MAX3(northwest + replacement, evalue,
+                               fcol[rowindex]), 0);
+        result = GT_MAX(result, value);
+      }
+      hcol[rowindex] = value;
+      northwest = west;
+    }
+    if (global && colindex == vlen)
+    {
+      result = hcol[ulen];
+    }
+  }
+  gt_free(hcol);
+  return result;
+}
+
+/* assigns codes to the characters of the batch, such that characters
+   compared as equal by <scorehandler> get the same code. Returns false if
+   the codes do not fit into a byte. */
+static bool gt_batchalign_charcodes(const GtScoreHandler *scorehandler,
+                                    GtUword numofpairs,
+                                    const GtUchar * const *useqs,
+                                    const GtUword *ulens,
+                                    const GtUchar * const *vseqs,
+                                    const GtUword *vlens,
+                                    uint8_t *ucodes,
+                                    uint8_t *vcodes)
+{
+  bool occurs[UCHAR_MAX+1] = {false};
+  GtWord classcode[UCHAR_MAX+1];
+  GtUword pairidx, idx, cc, numofcodes = 0;
+
+  for (pairidx = 0; pairidx < numofpairs; pairidx++)
+  {
+    for (idx = 0; idx < ulens[pairidx]; idx++)
+    {
+      occurs[useqs[pairidx][idx]] = true;
+    }
+    for (idx = 0; idx < vlens[pairidx]; idx++)
+    {
+      occurs[vseqs[pairidx][idx]] = true;
+    }
+  }
+  for (cc = 0; cc <= UCHAR_MAX; cc++)
+  {
+    classcode[cc] = -1;
+  }
+  for (cc = 0; cc <= UCHAR_MAX; cc++)
+  {
+    GtWord charclass;
+
+    ucodes[cc] = GT_BATCHALIGN_UPAD;
+    vcodes[cc] = GT_BATCHALIGN_VPAD;
+    if (!occurs[cc] ||
+        (charclass = gt_scorehandler_get_charclass(scorehandler,
+                                                   (GtUchar) cc)) < 0)
+    {
+      continue;
+    }
+    if (classcode[charclass] < 0)
+    {
+      if (numofcodes == (GtUword) GT_BATCHALIGN_UPAD)
+      {
+        return false;
+      }
+      classcode[charclass] = (GtWord) numofcodes++;
+    }
+    ucodes[cc] = vcodes[cc] = (uint8_t) classcode[charclass];
+  }
+  return true;
+}
+
+/* returns true if the values of <scorehandler> allow to use lanes with values
+   from <intmin> to <intmax>, such that saturated values only occur in the
+   lanes whose result does not fit */
+static bool gt_batchalign_admissible(bool global,
+                                     const GtScoreHandler *scorehandler,
+                                     GtWord intmin, GtWord intmax)
+{
+  const GtWord matchvalue = gt_scorehandler_get_matchscore(scorehandler),
+               mismatchvalue = gt_scorehandler_get_mismatchscore(scorehandler),
+               gap_opening = gt_scorehandler_get_gap_opening(scorehandler),
+               gap_extension = gt_scorehandler_get_gapscore(scorehandler);
+
+  if (global)
+  {
+    /* costs are never negative, the saturated values are infinite */
+    return matchvalue >= 0 && mismatchvalue >= 0 && gap_opening >= 0 &&
+           gap_extension >= 0 && matchvalue < intmax &&
+           mismatchvalue < intmax && gap_opening + gap_extension < intmax
+           ? true : false;
+  }
+  /* the padding characters and gaps must not increase the scores, such that
+     the maximum of each lane is that of its own DP matrix */
+  return mismatchvalue <= 0 && gap_opening <= 0 && gap_extension <= 0 &&
+         matchvalue < intmax && mismatchvalue > intmin &&
+         gap_opening + gap_extension > intmin ? true : false;
+}
+
+/* aligns the pairs in <pairs> with lanes of width <width> and stores the
+   results. Returns the number of pairs, which are not aligned, because they
+   are too long or their values do not fit. These are moved to the front of
+   <pairs>. */
+static GtUword gt_batchalign_lanewidth(const GtScoreHandler *scorehandler,
+                                       const GtBatchalignLaneWidth *width,
+                                       GtBatchalignPair *pairs,
+                                       GtUword numofpairs,
+                                       const GtUchar * const *useqs,
+                                       const GtUchar * const *vseqs,
+                                       const uint8_t *ucodes,
+                                       const uint8_t *vcodes,
+                                       GtWord *results)
+{
+  GtBatchalignProblem problem;
+  GtBatchalignPair *group;
+  uint8_t *codes = NULL;
+  GtUword lane, rowindex, groupsize, maxlen = 0, remaining = 0,
+          nextpair = 0;
+
+  problem.matchvalue = gt_scorehandler_get_matchscore(scorehandler);
+  problem.mismatchvalue = gt_scorehandler_get_mismatchscore(scorehandler);
+  problem.gap_opening = gt_scorehandler_get_gap_opening(scorehandler);
+  problem.gap_extension = gt_scorehandler_get_gapscore(scorehandler);
+  problem.hcol = problem.fcol = NULL;
+  group = gt_malloc(sizeof *group * width->lanes);
+  while (nextpair < numofpairs)
+  {
+    /* collect the next group, the pairs too long for this width remain */
+    for (groupsize = 0; nextpair < numofpairs && groupsize < width->lanes;
+         nextpair++)
+    {
+      if (pairs[nextpair].ulen <= width->maxlen &&
+          pairs[nextpair].vlen <= width->maxlen)
+      {
+        group[groupsize++] = pairs[nextpair];
+      } else
+      {
+        pairs[remaining++] = pairs[nextpair];
+      }
+    }
+    if (groupsize == 0)
+    {
+      break;
+    }
+    problem.maxulen = problem.maxvlen = 0;
+    for (lane = 0; lane < width->lanes; lane++)
+    {
+      problem.ulens[lane] = lane < groupsize ? group[lane].ulen : 0;
+      problem.vlens[lane] = lane < groupsize ? group[lane].vlen : 0;
+      problem.maxulen = GT_MAX(problem.maxulen, problem.ulens[lane]);
+      problem.maxvlen = GT_MAX(problem.maxvlen, problem.vlens[lane]);
+    }
+    if (GT_MAX(problem.maxulen, problem.maxvlen) + 1 > maxlen)
+    {
+      maxlen = GT_MAX(problem.maxulen, problem.maxvlen) + 1;
+      codes = gt_realloc(codes, sizeof *codes * 2 * maxlen * width->lanes);
+      problem.hcol = gt_realloc(problem.hcol,
+                                width->intsize * 2 * maxlen * width->lanes);
+      problem.fcol = (char *) problem.hcol + width->intsize * maxlen *
+                                             width->lanes;
+    }
+    /* the characters of the group are interleaved, row by row */
+    problem.ucodes = codes;
+    problem.vcodes = codes + maxlen * width->lanes;
+    for (lane = 0; lane < width->lanes; lane++)
+    {
+      const GtUchar *useq = lane < groupsize ? useqs[group[lane].pairidx]
+                                             : NULL,
+                    *vseq = lane < groupsize ? vseqs[group[lane].pairidx]
+                                             : NULL;
+
+      for (rowindex = 0; rowindex < problem.maxulen; rowindex++)
+      {
+        codes[rowindex * width->lanes + lane]
+          = rowindex < problem.ulens[lane] ? ucodes[useq[rowindex]]
+                                           : GT_BATCHALIGN_UPAD;
+      }
+      for (rowindex = 0; rowindex < problem.maxvlen; rowindex++)
+      {
+        codes[(maxlen + rowindex) * width->lanes + lane]
+          = rowindex < problem.vlens[lane] ? vcodes[vseq[rowindex]]
+                                           : GT_BATCHALIGN_VPAD;
+      }
+    }
+    width->kernelfunc(&problem);
+    for (lane = 0; lane < groupsize; lane++)
+    {
+      if (problem.results[lane] == GT_BATCHALIGN_OVERFLOW)
+      {
+        pairs[remaining++] = group[lane];
+      } else
+      {
+        results[group[lane].pairidx] = problem.results[lane];
+      }
+    }
+  }
+  gt_free(group);
+  gt_free(codes);
+  gt_free(problem.hcol);
+  return remaining;
+}
+
+/* returns the number of lane widths tried with <kernel> */
+static GtUword gt_batchalign_lanewidths(GtBatchalignLaneWidth *widths,
+                                        bool global,
+                                        GtStripedalignKernel kernel)
+{
+#ifdef GT_BATCHALIGN_X86
+  if (kernel == GT_STRIPEDALIGN_SCALAR)
+  {
+    return 0;
+  }
+  widths[0].lanes = kernel == GT_STRIPEDALIGN_AVX2 ? 32UL : 16UL;
+  widths[0].maxlen = GT_BATCHALIGN_MAXLEN8;
+  widths[0].intmax = INT8_MAX;
+  widths[0].intmin = INT8_MIN;
+  widths[0].intsize = sizeof (int8_t);
+  widths[1].lanes = kernel == GT_STRIPEDALIGN_AVX2 ? 16UL : 8UL;
+  widths[1].maxlen = GT_UWORD_MAX - 1;
+  widths[1].intmax = INT16_MAX;
+  widths[1].intmin = INT16_MIN;
+  widths[1].intsize = sizeof (int16_t);
+  if (kernel == GT_STRIPEDALIGN_AVX2)
+  {
+    widths[0].kernelfunc = global ? gt_batchalign_global_avx2_8
+                                  : gt_batchalign_local_avx2_8;
+    widths[1].kernelfunc = global ? gt_batchalign_global_avx2_16
+                                  : gt_batchalign_local_avx2_16;
+  } else
+  {
+    widths[0].kernelfunc = global ? gt_batchalign_global_sse41_8
+                                  : gt_batchalign_local_sse41_8;
+    widths[1].kernelfunc = global ? gt_batchalign_global_sse41_16
+                                  : gt_batchalign_local_sse41_16;
+  }
+  return 2UL;
+#else
+  (void) widths;
+  (void) global;
+  (void) kernel;
+  return 0;
+#endif
+}
+
+static void gt_batchalign_with_kernel(GtStripedalignKernel kernel,
+                                      bool global,
+                                      const GtScoreHandler *scorehandler,
+                                      GtUword numofpairs,
+                                      const GtUchar * const *useqs,
+                                      const GtUword *ulens,
+                                      const GtUchar * const *vseqs,
+                                      const GtUword *vlens,
+                                      GtWord *results)
+{
+  GtBatchalignLaneWidth widths[2];
+  GtBatchalignPair *pairs;
+  uint8_t ucodes[UCHAR_MAX+1], vcodes[UCHAR_MAX+1];
+  GtUword idx, numofwidths, remaining = numofpairs;
+
+  gt_assert(scorehandler != NULL);
+  pairs = gt_malloc(sizeof *pairs * numofpairs);
+  for (idx = 0; idx < numofpairs; idx++)
+  {
+    pairs[idx].pairidx = idx;
+    pairs[idx].ulen = ulens[idx];
+    pairs[idx].vlen = vlens[idx];
+  }
+  numofwidths = gt_batchalign_lanewidths(widths, global, kernel);
+  if (numofwidths > 0 && numofpairs > 1UL &&
+      !gt_scorehandler_has_scorematrix(scorehandler) &&
+      gt_batchalign_charcodes(scorehandler, numofpairs, useqs, ulens, vseqs,
+                              vlens, ucodes, vcodes))
+  {
+    /* pairs of similar lengths are aligned in the same group */
+    qsort(pairs, (size_t) numofpairs, sizeof *pairs,
+          gt_batchalign_pair_compare);
+    for (idx = 0; idx < numofwidths && remaining > 0; idx++)
+    {
+      if (gt_batchalign_admissible(global, scorehandler, widths[idx].intmin,
+                                   widths[idx].intmax))
+      {
+        remaining = gt_batchalign_lanewidth(scorehandler, widths + idx,
+                                            pairs, remaining,
+                                            useqs, vseqs, ucodes, vcodes,
+                                            results);
+      }
+    }
+  }
+  for (idx = 0; idx < remaining; idx++)
+  {
+    const GtUword pairidx = pairs[idx].pairidx;
+
+    results[pairidx] = gt_batchalign_scalar(global, scorehandler,
+                                            useqs[pairidx], ulens[pairidx],
+                                            vseqs[pairidx], vlens[pairidx]);
+  }
+  gt_free(pairs);
+}
+
+void gt_batchalign_global(const GtScoreHandler *costhandler,
+                          GtUword numofpairs,
+                          const GtUchar * const *useqs,
+                          const GtUword *ulens,
+                          const GtUchar * const *vseqs,
+                          const GtUword *vlens,
+                          GtUword *distances)
+{
+  GtWord *results = gt_malloc(sizeof *results * numofpairs);
+  GtUword idx;
+
+  gt_batchalign_with_kernel(gt_stripedalign_get_kernel(), true, costhandler,
+                            numofpairs, useqs, ulens, vseqs, vlens, results);
+  for (idx = 0; idx < numofpairs; idx++)
+  {
+    distances[idx] = (GtUword) results[idx];
+  }
+  gt_free(results);
+}
+
+void gt_batchalign_local(const GtScoreHandler *scorehandler,
+                         GtUword numofpairs,
+                         const GtUchar * const *useqs,
+                         const GtUword *ulens,
+                         const GtUchar * const *vseqs,
+                         const GtUword *vlens,
+                         GtWord *scores)
+{
+  gt_batchalign_with_kernel(gt_stripedalign_get_kernel(), false, scorehandler,
+                            numofpairs, useqs, ulens, vseqs, vlens, scores);
+}
+
+int gt_batchalign_unit_test(GtError *err)
+{
+  const GtUword maxpairs = 80UL, maxlen = 200UL;
+  GtLinspaceManagement *spacemanager;
+  GtAlignment *align;
+  GtUchar **useqs, **vseqs;
+  GtUword trial, pairidx, idx, *ulens, *vlens;
+  GtWord *results, *refresults;
+  int had_err = 0;
+
+  gt_error_check(err);
+  align = gt_alignment_new();
+  useqs = gt_malloc(sizeof *useqs * 2 * maxpairs);
+  vseqs = useqs + maxpairs;
+  for (pairidx = 0; pairidx < 2 * maxpairs; pairidx++)
+  {
+    useqs[pairidx] = gt_malloc(sizeof **useqs * maxlen);
+  }
+  ulens = gt_malloc(sizeof *ulens * 2 * maxpairs);
+  vlens = ulens + maxpairs;
+  results = gt_malloc(sizeof *results * 2 * maxpairs);
+  refresults = results + maxpairs;
+  for (trial = 0; !had_err && trial < 40UL; trial++)
+  {
+    const bool global = trial % 2 == 0 ? true : false,
+               longvalues = gt_rand_max(4UL) == 0 ? true : false;
+    const GtUword numofpairs = 1UL + gt_rand_max(maxpairs - 1),
+                  alphasize = 2UL + gt_rand_max(18UL),
+                  factor = longvalues ? 150UL : 1UL;
+    GtScoreHandler *scorehandler;
+    GtStripedalignKernel kernel;
+
+    /* the space manager sets up its local state only on the first local
+       alignment, hence it is not shared between global and local trials */
+    spacemanager = gt_linspace_management_new();
+    if (global)
+    {
+      scorehandler = gt_scorehandler_new((GtWord) gt_rand_max(1UL),
+                                         (GtWord) (factor *
+                                                   (1UL + gt_rand_max(3UL))),
+                                         (GtWord) gt_rand_max(4UL),
+                                         (GtWord) (factor *
+                                                   (1UL + gt_rand_max(2UL))));
+    } else
+    {
+      scorehandler = gt_scorehandler_new((GtWord) (factor *
+                                                   (1UL + gt_rand_max(2UL))),
+                                         -(GtWord) (1UL + gt_rand_max(3UL)),
+                                         -(GtWord) gt_rand_max(4UL),
+                                         -(GtWord) (1UL + gt_rand_max(2UL)));
+    }
+    for (pairidx = 0; pairidx < numofpairs; pairidx++)
+    {
+      /* similar pairs of different lengths, some wildcards never match */
+      ulens[pairidx] = gt_rand_max(maxlen - 1);
+      vlens[pairidx] = ulens[pairidx] + gt_rand_max(10UL);
+      vlens[pairidx] = GT_MIN(maxlen - 1, vlens[pairidx]);
+      for (idx = 0; idx < ulens[pairidx]; idx++)
+      {
+        useqs[pairidx][idx] = gt_rand_max(50UL) == 0
+                                ? (GtUchar) GT_WILDCARD
+                                : (GtUchar) gt_rand_max(alphasize - 1);
+      }
+      for (idx = 0; idx < vlens[pairidx]; idx++)
+      {
+        vseqs[pairidx][idx] = idx < ulens[pairidx] && gt_rand_max(3UL) > 0
+                                ? useqs[pairidx][idx]
+                                : (GtUchar) gt_rand_max(alphasize - 1);
+      }
+      if (ulens[pairidx] == 0 || vlens[pairidx] == 0)
+      {
+        refresults[pairidx]
+          = gt_batchalign_scalar(global, scorehandler, useqs[pairidx],
+                                 ulens[pairidx], vseqs[pairidx],
+                                 vlens[pairidx]);
+        continue;
+      }
+      gt_alignment_reset(align);
+      if (global)
+      {
+        refresults[pairidx] = (GtWord)
+          (gt_scorehandler_get_gap_opening(scorehandler) == 0
+             ? gt_linearalign_compute_generic
+             : gt_linearalign_affinegapcost_compute_generic)
+               (spacemanager, scorehandler, align, useqs[pairidx], 0,
+                ulens[pairidx], vseqs[pairidx], 0, vlens[pairidx]);
+      } else
+      {
+        refresults[pairidx]
+          = (gt_scorehandler_get_gap_opening(scorehandler) == 0
+               ? gt_linearalign_compute_local_generic
+               : gt_linearalign_affinegapcost_compute_local_generic)
+                 (spacemanager, scorehandler, align, useqs[pairidx], 0,
+                  ulens[pairidx], vseqs[pairidx], 0, vlens[pairidx]);
+      }
+    }
+    for (kernel = GT_STRIPEDALIGN_SCALAR;
+         !had_err && kernel <= gt_stripedalign_supported_kernel(); kernel++)
+    {
+      gt_batchalign_with_kernel(kernel, global, scorehandler, numofpairs,
+                                (const GtUchar * const *) useqs, ulens,
+                                (const GtUchar * const *) vseqs, vlens,
+                                results);
+      for (pairidx = 0; !had_err && pairidx < numofpairs; pairidx++)
+      {
+        gt_ensure(results[pairidx] == refresults[pairidx]);
+      }
+    }
+    gt_scorehandler_delete(scorehandler);
+    gt_linspace_management_delete(spacemanager);
+  }
+  for (pairidx = 0; pairidx < 2 * maxpairs; pairidx++)
+  {
+    gt_free(useqs[pairidx]);
+  }
+  gt_free(useqs);
+  gt_free(ulens);
+  gt_free(results);
+  gt_alignment_delete(align);
+  return had_err;
+}
@@ -0,0 +1,60 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BATCHALIGN_H
+#define BATCHALIGN_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+#include "extended/scorehandler.h"
+
+/* The batch aligner computes the optimal distances of global alignments or
+   the optimal scores of local alignments of many independent sequence pairs,
+   without the alignments themselves. The pairs are sorted by length and
+   aligned in groups with one pair per lane of an SSE4.1 or AVX2 vector, such
+   that all lanes evaluate the same cell of their DP matrices at once. The
+   values are first computed with saturated 8 bit lanes and, for the pairs
+   whose values do not fit, with saturated 16 bit lanes, before the remaining
+   pairs are aligned by the scalar DP. The vector kernels are used for cost or
+   score handlers with constant match and mismatch values and for the kernels
+   enabled by <gt_stripedalign_set_kernel()>. Gaps of length l cost or score
+   gap_opening + l * gap_extension, as in the linear space aligners. */
+
+/* Stores in <distances>[i] the distance of the global alignment of
+   <useqs>[i] of length <ulens>[i] and <vseqs>[i] of length <vlens>[i] for
+   all i < <numofpairs>, with the cost values of <costhandler>. */
+void gt_batchalign_global(const GtScoreHandler *costhandler,
+                          GtUword numofpairs,
+                          const GtUchar * const *useqs,
+                          const GtUword *ulens,
+                          const GtUchar * const *vseqs,
+                          const GtUword *vlens,
+                          GtUword *distances);
+
+/* Stores in <scores>[i] the score of the local alignment of <useqs>[i] of
+   length <ulens>[i] and <vseqs>[i] of length <vlens>[i] for all
+   i < <numofpairs>, with the score values of <scorehandler>. */
+void gt_batchalign_local(const GtScoreHandler *scorehandler,
+                         GtUword numofpairs,
+                         const GtUchar * const *useqs,
+                         const GtUword *ulens,
+                         const GtUchar * const *vseqs,
+                         const GtUword *vlens,
+                         GtWord *scores);
+
+int  gt_batchalign_unit_test(GtError *err);
+
+#endif
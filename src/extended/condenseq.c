@@ -26,6 +26,7 @@
 #include "core/log_api.h"
 #include "core/ma_api.h"
 #include "core/safearith_api.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "core/warning_api.h"
@@ -218,6 +219,202 @@ const char *gt_condenseq_description(const GtCondenseq *condenseq,
   }
 }
 
+/* Links are kept in a doubly linked list ordered by the time of their last
+   use, the least recently used ones are removed once the decoded links use more
+   than <maxsize> bytes. */
+typedef struct {
+  GtUchar *seq;
+  GtUword  len,
+           lid,
+           newer,
+           older;
+} GtCondenseqLinkCacheEntry;
+
+struct GtCondenseqLinkCache {
+  GtCondenseqLinkCacheEntry *entries;
+  GtMutex                   *mutex;
+  GtUword                   *link2entry,
+                             allocated,
+                             freelist,
+                             hits,
+                             maxsize,
+                             misses,
+                             newest,
+                             nextfree,
+                             oldest,
+                             size;
+};
+
+static GtCondenseqLinkCache *condenseq_link_cache_new(GtUword numoflinks,
+                                                      GtUword maxsize)
+{
+  GtUword idx;
+  GtCondenseqLinkCache *cache = gt_malloc(sizeof (*cache));
+
+  cache->entries = NULL;
+  cache->mutex = gt_mutex_new();
+  cache->link2entry = gt_malloc(sizeof (*cache->link2entry) * numoflinks);
+  for (idx = 0; idx < numoflinks; idx++)
+    cache->link2entry[idx] = GT_UNDEF_UWORD;
+  cache->allocated =
+    cache->hits =
+    cache->misses =
+    cache->nextfree =
+    cache->size = 0;
+  cache->freelist =
+    cache->newest =
+    cache->oldest = GT_UNDEF_UWORD;
+  cache->maxsize = maxsize;
+  return cache;
+}
+
+static void condenseq_link_cache_delete(GtCondenseqLinkCache *cache)
+{
+  if (cache != NULL) {
+    GtUword idx;
+    gt_log_log("link cache: " GT_WU " hits, " GT_WU " misses, " GT_WU
+               " bytes used", cache->hits, cache->misses, cache->size);
+    for (idx = 0; idx < cache->nextfree; idx++)
+      gt_free(cache->entries[idx].seq);
+    gt_free(cache->entries);
+    gt_free(cache->link2entry);
+    gt_mutex_delete(cache->mutex);
+    gt_free(cache);
+  }
+}
+
+static void condenseq_link_cache_unlink(GtCondenseqLinkCache *cache,
+                                        GtUword entry)
+{
+  GtCondenseqLinkCacheEntry *e = cache->entries + entry;
+  if (e->newer != GT_UNDEF_UWORD)
+    cache->entries[e->newer].older = e->older;
+  else
+    cache->newest = e->older;
+  if (e->older != GT_UNDEF_UWORD)
+    cache->entries[e->older].newer = e->newer;
+  else
+    cache->oldest = e->newer;
+}
+
+static void condenseq_link_cache_push(GtCondenseqLinkCache *cache,
+                                      GtUword entry)
+{
+  GtCondenseqLinkCacheEntry *e = cache->entries + entry;
+  e->newer = GT_UNDEF_UWORD;
+  e->older = cache->newest;
+  if (cache->newest != GT_UNDEF_UWORD)
+    cache->entries[cache->newest].newer = entry;
+  else
+    cache->oldest = entry;
+  cache->newest = entry;
+}
+
+/* insert decoded link <lid> of length <len>, takes ownership of <seq>.
+   Links longer than the cache are not cached. */
+static void condenseq_link_cache_insert(GtCondenseqLinkCache *cache,
+                                        GtUword lid,
+                                        GtUchar *seq,
+                                        GtUword len)
+{
+  GtUword entry;
+
+  if (len > cache->maxsize) {
+    gt_free(seq);
+    return;
+  }
+  while (cache->oldest != GT_UNDEF_UWORD &&
+         cache->size + len > cache->maxsize) {
+    GtCondenseqLinkCacheEntry *old;
+    entry = cache->oldest;
+    old = cache->entries + entry;
+    condenseq_link_cache_unlink(cache, entry);
+    cache->link2entry[old->lid] = GT_UNDEF_UWORD;
+    gt_assert(cache->size >= old->len);
+    cache->size -= old->len;
+    gt_free(old->seq);
+    old->seq = NULL;
+    old->older = cache->freelist;
+    cache->freelist = entry;
+  }
+  if (cache->freelist != GT_UNDEF_UWORD) {
+    entry = cache->freelist;
+    cache->freelist = cache->entries[entry].older;
+  }
+  else {
+    if (cache->nextfree == cache->allocated) {
+      cache->allocated = cache->allocated * 2 + 16UL;
+      cache->entries = gt_realloc(cache->entries,
+                                  sizeof (*cache->entries) * cache->allocated);
+    }
+    entry = cache->nextfree++;
+  }
+  cache->entries[entry].seq = seq;
+  cache->entries[entry].len = len;
+  cache->entries[entry].lid = lid;
+  condenseq_link_cache_push(cache, entry);
+  cache->link2entry[lid] = entry;
+  cache->size += len;
+}
+
+/* copy positions <from>..<to> of the decoded link <lid> to <buffer>, decoding
+   and inserting it if it is not in the cache */
+static void condenseq_link_cache_extract(const GtCondenseq *cs,
+                                         GtUword lid,
+                                         GtUchar *buffer,
+                                         GtUword from,
+                                         GtUword to)
+{
+  GtCondenseqLinkCache *cache = cs->link_cache;
+  const GtCondenseqLink *link = cs->links + lid;
+  GtUchar *seq;
+  GtUword entry;
+  GT_UNUSED GtUword written;
+
+  gt_mutex_lock(cache->mutex);
+  entry = cache->link2entry[lid];
+  if (entry != GT_UNDEF_UWORD) {
+    cache->hits++;
+    memcpy(buffer, cache->entries[entry].seq + from,
+           sizeof (*buffer) * (to - from + 1));
+    condenseq_link_cache_unlink(cache, entry);
+    condenseq_link_cache_push(cache, entry);
+    gt_mutex_unlock(cache->mutex);
+    return;
+  }
+  cache->misses++;
+  gt_mutex_unlock(cache->mutex);
+
+  /* decode without holding the lock, another thread might do the same */
+  seq = gt_malloc(sizeof (*seq) * link->len);
+  written =
+    gt_editscript_get_sub_sequence_v(link->editscript, cs->unique_es,
+                                     gt_encseq_seqstartpos(cs->unique_es,
+                                                           link->unique_id) +
+                                     link->unique_offset,
+                                     GT_READMODE_FORWARD, 0,
+                                     (GtUword) link->len - 1, seq);
+  gt_assert(written == (GtUword) link->len);
+  memcpy(buffer, seq + from, sizeof (*buffer) * (to - from + 1));
+
+  gt_mutex_lock(cache->mutex);
+  if (cache->link2entry[lid] == GT_UNDEF_UWORD)
+    condenseq_link_cache_insert(cache, lid, seq, (GtUword) link->len);
+  else
+    gt_free(seq);
+  gt_mutex_unlock(cache->mutex);
+}
+
+void gt_condenseq_set_link_cache_size(GtCondenseq *condenseq, GtUword maxsize)
+{
+  gt_assert(condenseq != NULL);
+  condenseq_link_cache_delete(condenseq->link_cache);
+  condenseq->link_cache = NULL;
+  if (maxsize > 0 && condenseq->lds_nelems > 0)
+    condenseq->link_cache = condenseq_link_cache_new(condenseq->lds_nelems,
+                                                     maxsize);
+}
+
 static GtCondenseq *condenseq_new_empty(const GtAlphabet *alph)
 {
   GtCondenseq *condenseq = gt_malloc(sizeof (*condenseq));
@@ -236,6 +433,7 @@ static GtCondenseq *condenseq_new_empty(const GtAlphabet *alph)
 
   condenseq->buffer = NULL;
   condenseq->filename = NULL;
+  condenseq->link_cache = NULL;
   condenseq->links = NULL;
   condenseq->orig_ids = NULL;
   condenseq->sdstab = NULL;
@@ -389,6 +587,7 @@ void gt_condenseq_delete(GtCondenseq *condenseq)
     gt_encseq_delete(condenseq->unique_es);
     gt_free(condenseq->buffer);
     gt_free(condenseq->filename);
+    condenseq_link_cache_delete(condenseq->link_cache);
     gt_free(condenseq->links);
     gt_free(condenseq->orig_ids);
     gt_free(condenseq->ubuffer);
@@ -717,6 +916,11 @@ static GtUword condenseq_link_extract_encoded(const GtCondenseq *cs,
     endpos = link.len - 1;
   else
     endpos = startoffset + targetlength - 1;
+  if (cs->link_cache != NULL &&
+      (GtUword) link.len <= cs->link_cache->maxsize) {
+    condenseq_link_cache_extract(cs, id, buffer, startoffset, endpos);
+    return endpos - startoffset + 1;
+  }
   written =
     gt_editscript_get_sub_sequence_v(editscript, cs->unique_es,
                                      unique_startpos + link.unique_offset,
@@ -726,17 +930,18 @@ static GtUword condenseq_link_extract_encoded(const GtCondenseq *cs,
   return written;
 }
 
-const GtUchar *gt_condenseq_extract_encoded_range(GtCondenseq *condenseq,
-                                                  GtRange range)
+void gt_condenseq_extract_encoded_range_to_buffer(
+                                                   const GtCondenseq *condenseq,
+                                                   GtRange range,
+                                                   GtUchar *buf)
 {
-  GtUchar *buf;
   GtUword nextsep,
           linkid = 0,
           uniqueid,
           buffoffset = 0,
           length;
-  GtCondenseqLink *link = NULL;
-  GtCondenseqUnique *unique = NULL;
+  const GtCondenseqLink *link = NULL;
+  const GtCondenseqUnique *unique = NULL;
 
   gt_assert(condenseq && condenseq->uds_nelems != 0);
   gt_assert(condenseq->uniques[0].orig_startpos == 0);
@@ -749,16 +954,6 @@ const GtUchar *gt_condenseq_extract_encoded_range(GtCondenseq *condenseq,
 
   length = range.end - range.start + 1;
 
-  /* TODO DW check if there is another way than using this buffer, so we could
-     use const for condenseq here. */
-  if (condenseq->ubuffer == NULL || condenseq->ubuffsize < length) {
-    condenseq->ubuffer = gt_realloc(condenseq->ubuffer,
-                                    sizeof (*condenseq->ubuffer) * length);
-    condenseq->ubuffsize = length;
-  }
-
-  buf = condenseq->ubuffer;
-
   unique = &condenseq->uniques[uniqueid];
 
   if (unique->orig_startpos + unique->len <= range.start) {
@@ -824,7 +1019,22 @@ const GtUchar *gt_condenseq_extract_encoded_range(GtCondenseq *condenseq,
     }
   }
   gt_assert(buffoffset == length);
-  return buf;
+}
+
+const GtUchar *gt_condenseq_extract_encoded_range(GtCondenseq *condenseq,
+                                                  GtRange range)
+{
+  GtUword length = range.end - range.start + 1;
+
+  gt_assert(range.start <= range.end);
+  if (condenseq->ubuffer == NULL || condenseq->ubuffsize < length) {
+    condenseq->ubuffer = gt_realloc(condenseq->ubuffer,
+                                    sizeof (*condenseq->ubuffer) * length);
+    condenseq->ubuffsize = length;
+  }
+  gt_condenseq_extract_encoded_range_to_buffer(condenseq, range,
+                                               condenseq->ubuffer);
+  return condenseq->ubuffer;
 }
 
 const GtUchar *gt_condenseq_extract_encoded(GtCondenseq *condenseq,
@@ -842,14 +1052,29 @@ const GtUchar *gt_condenseq_extract_encoded(GtCondenseq *condenseq,
   return gt_condenseq_extract_encoded_range(condenseq, range);
 }
 
+static void condenseq_decode(const GtCondenseq *condenseq,
+                             const GtUchar *ubuf,
+                             GtUword length,
+                             char separator,
+                             char *buf)
+{
+  GtUword idx;
+  for (idx = 0; idx < length; ++idx) {
+    if (ubuf[idx] == GT_SEPARATOR) {
+      buf[idx] = separator;
+    }
+    else {
+      buf[idx] = gt_alphabet_decode(condenseq->alphabet, ubuf[idx]);
+    }
+  }
+}
+
 const char *gt_condenseq_extract_decoded_range(GtCondenseq *condenseq,
                                                GtRange range,
                                                char separator)
 {
-  GtUword length = range.end - range.start + 1,
-          idx;
+  GtUword length = range.end - range.start + 1;
   const GtUchar *ubuf;
-  char *buf;
   gt_assert(range.start <= range.end);
   ubuf = gt_condenseq_extract_encoded_range(condenseq, range);
   if (condenseq->buffer == NULL || condenseq->buffsize < length) {
@@ -857,16 +1082,21 @@ const char *gt_condenseq_extract_decoded_range(GtCondenseq *condenseq,
                                    sizeof (*condenseq->buffer) * length);
     condenseq->buffsize = length;
   }
-  buf = condenseq->buffer;
-  for (idx = 0; idx < length; ++idx) {
-    if (ubuf[idx] == GT_SEPARATOR) {
-      buf[idx] = separator;
-    }
-    else {
-      buf[idx] = gt_alphabet_decode(condenseq->alphabet, ubuf[idx]);
-    }
-  }
-  return buf;
+  condenseq_decode(condenseq, ubuf, length, separator, condenseq->buffer);
+  return condenseq->buffer;
+}
+
+void gt_condenseq_extract_decoded_range_to_buffer(
+                                                   const GtCondenseq *condenseq,
+                                                   GtRange range,
+                                                   char separator,
+                                                   GtUchar *ubuffer,
+                                                   char *buffer)
+{
+  gt_assert(range.start <= range.end);
+  gt_condenseq_extract_encoded_range_to_buffer(condenseq, range, ubuffer);
+  condenseq_decode(condenseq, ubuffer, range.end - range.start + 1, separator,
+                   buffer);
 }
 
 const char *gt_condenseq_extract_decoded(GtCondenseq *condenseq,
@@ -1226,6 +1456,11 @@ GtAlphabet *gt_condenseq_alphabet(const GtCondenseq *condenseq)
   return gt_alphabet_ref(condenseq->alphabet);
 }
 
+const GtEncseq *gt_condenseq_unique_encseq(const GtCondenseq *condenseq)
+{
+  return condenseq->unique_es;
+}
+
 GtUword gt_condenseq_count_relevant_uniques(const GtCondenseq *condenseq,
                                             unsigned int min_align_len)
 {
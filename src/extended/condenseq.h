@@ -103,6 +103,32 @@ const char*        gt_condenseq_extract_decoded(GtCondenseq *condenseq,
 const char*        gt_condenseq_extract_decoded_range(GtCondenseq *condenseq,
                                                       GtRange range,
                                                       char separator);
+/* Writes the encoded representation of the substring defined by (inclusive)
+   range <range> of <condenseq> to <buffer>, which has to be large enough to
+   hold it. Separators are written as GT_SEPARATOR. Unlike
+   <gt_condenseq_extract_encoded_range()> no buffer of <condenseq> is used, so
+   several threads can extract from the same <condenseq> concurrently. */
+void               gt_condenseq_extract_encoded_range_to_buffer(
+                                                   const GtCondenseq *condenseq,
+                                                   GtRange range,
+                                                   GtUchar *buffer);
+/* Like <gt_condenseq_extract_encoded_range_to_buffer()>, but writes the decoded
+   representation to <buffer>, using <separator> for sequence separators.
+   <ubuffer> is used for the encoded representation, both have to be large
+   enough to hold the range. */
+void               gt_condenseq_extract_decoded_range_to_buffer(
+                                                   const GtCondenseq *condenseq,
+                                                   GtRange range,
+                                                   char separator,
+                                                   GtUchar *ubuffer,
+                                                   char *buffer);
+/* Keep links of <condenseq> that were decoded by one of the extraction
+   functions in a cache of at most <maxsize> bytes, evicting the least recently
+   used ones first. Overlapping or repeated extractions then do not need to
+   apply the editscripts of the links again. The cache can be used from several
+   threads. <maxsize> 0 disables the cache, which is the default. */
+void               gt_condenseq_set_link_cache_size(GtCondenseq *condenseq,
+                                                    GtUword maxsize);
 /* Function type used to process redundant seqs, should return != 0 on error
    and set <err> accordingly. */
 typedef int (GtCondenseqProcessExtractedSeqs)(void *data,
@@ -195,6 +221,11 @@ const GtEditscript* gt_condenseq_link_editscript(const GtCondenseq *condenseq,
    <condenseq> are based. */
 GtAlphabet*         gt_condenseq_alphabet(const GtCondenseq *condenseq);
 
+/* Returns the <GtEncseq> holding the unique sequences of <condenseq>, the
+   unique with id <uid> being its sequence number <uid>. <condenseq> retains
+   ownership of it. */
+const GtEncseq*     gt_condenseq_unique_encseq(const GtCondenseq *condenseq);
+
 /* Free space for <condenseq> */
 void                gt_condenseq_delete(GtCondenseq *condenseq);
 #endif
@@ -25,10 +25,12 @@
 #include "core/log_api.h"
 #include "core/logger.h"
 #include "core/ma_api.h"
+#include "core/multithread_api.h"
 #include "core/range_api.h"
 #include "core/safearith_api.h"
 #include "core/showtime.h"
 #include "core/str_array.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "extended/kmer_database.h"
@@ -49,8 +51,6 @@
 /* outputs the diagonals data structure after every update */
 /* #define GT_CONDENSEQ_CREATOR_DIAGS_DEBUG */
 
-static GtUword ces_c_xdrops = 0;
-
 #define GT_CES_C_SPARSE_DIAGS_RESIZE(A, MINELEMS) \
   if (A->nextfree + MINELEMS >= A->allocated) { \
     A->allocated *= 1.2; \
@@ -146,6 +146,18 @@ static void ces_c_diags_delete(CesCDiags *diags)
   }
 }
 
+/* forget all diagonals, used to start a new sequence independent of the
+   sequences processed before */
+static void ces_c_diags_reset(CesCDiags *diags)
+{
+  if (diags != NULL && diags->sparse != NULL) {
+    diags->sparse->nextfree = 0;
+    diags->sparse->add_nextfree = 0;
+    diags->sparse->marked = 0;
+    gt_rbtree_clear(diags->sparse->add_tree);
+  }
+}
+
 #ifndef S_SPLINT_S
 /* no double values allowed */
 static CesCDiag *ces_c_diags_bs_lseq_r(CesCDiag *left,
@@ -289,6 +301,23 @@ typedef struct {
                count;
 } GtCondenseqCreatorWindow;
 
+/* changes to the <GtCondenseq> and the k-mer database found while processing
+   a sequence of a batch, applied in sequence order after the batch */
+typedef enum {
+  GT_CES_C_OP_UNIQUE,
+  GT_CES_C_OP_KMERS,
+  GT_CES_C_OP_LINK
+} CesCOpType;
+
+typedef struct {
+  GtCondenseqLink link;
+  GtUword         start,
+                  end;
+  CesCOpType      type;
+} CesCOp;
+
+GT_DECLAREARRAYSTRUCT(CesCOp);
+
 typedef int
 (*gt_condenseq_creator_extend_fkt)(GtCondenseqCreator *condenseq_creator,
                                    GtCondenseqLink *best_link,
@@ -296,6 +325,7 @@ typedef int
 
 struct GtCondenseqCreator {
   GtEncseq           *input_es;
+  GtArrayCesCOp      *ops;
   GtKmerDatabase     *kmer_db;
   GtKmercodeiterator *adding_iter, *main_kmer_iter;
   GtLogger           *logger;
@@ -304,10 +334,12 @@ struct GtCondenseqCreator {
   GtDiscDistri       *add,
                      *replace,
                      *delete;
+  const GtXdropArbitraryscores   *scores;
   gt_condenseq_creator_extend_fkt extend;
   GtCondenseqCreatorXdrop         xdrop;
   GtCondenseqCreatorWindow        window;
-  GtUword                         current_orig_start,
+  GtUword                         batchsize,
+                                  current_orig_start,
                                   current_seq_len,
                                   current_seq_pos,
                                   current_seq_start,
@@ -320,7 +352,9 @@ struct GtCondenseqCreator {
                                   mean_fraction,
                                   min_d,
                                   max_d,
-                                  min_nu_kmers;
+                                  min_nu_kmers,
+                                  seqnum_end,
+                                  xdrops;
   unsigned int                    kmersize,
                                   windowsize,
                                   cleanup_percent;
@@ -347,7 +381,7 @@ static void ces_c_sparse_diags_clean(GtCondenseqCreator *ces_c)
   }
   gt_assert(d_dest < d_src);
 #ifdef GT_CONDENSEQ_CREATOR_DIST_DEBUG
-  if (gt_log_enabled())
+  if (gt_log_enabled() && ces_c->delete != NULL)
     gt_disc_distri_add(ces_c->delete, (GtUword) (end - d_dest));
 #endif
   diags->nextfree = (GtUword) (d_dest - diags->space);
@@ -423,7 +457,7 @@ static void ces_c_sparse_diags_mark(CesCSparseDiags *diags,
   }
 }
 
-static void ces_c_xdrop_init(GtXdropArbitraryscores *scores,
+static void ces_c_xdrop_init(const GtXdropArbitraryscores *scores,
                              GtWord xdropscore,
                              GtCondenseqCreatorXdrop *xdrop)
 {
@@ -440,6 +474,20 @@ static void ces_c_xdrop_init(GtXdropArbitraryscores *scores,
   xdrop->xdropscore = xdropscore;
 }
 
+static void ces_c_xdrop_delete(GtCondenseqCreatorXdrop *xdrop)
+{
+  gt_seqabstract_delete(xdrop->current_seq_bwd);
+  gt_seqabstract_delete(xdrop->current_seq_fwd);
+  gt_seqabstract_delete(xdrop->unique_seq_bwd);
+  gt_seqabstract_delete(xdrop->unique_seq_fwd);
+  gt_xdrop_resources_delete(xdrop->best_left_res);
+  gt_xdrop_resources_delete(xdrop->best_right_res);
+  gt_xdrop_resources_delete(xdrop->left_xdrop_res);
+  gt_xdrop_resources_delete(xdrop->right_xdrop_res);
+  gt_free(xdrop->left);
+  gt_free(xdrop->right);
+}
+
 #define GT_CES_LENCHECK(TO_STORE)                                           \
   do {                                                                      \
     if ((TO_STORE) > CES_UNSIGNED_MAX) {                                    \
@@ -481,7 +529,7 @@ static int ces_c_xdrop(GtCondenseqCreator *ces_c,
                                  ces_c->input_es,
                                  i - subject_bounds.start,
                                  subject_bounds.start);
-    ces_c_xdrops++;
+    ces_c->xdrops++;
     gt_evalxdroparbitscoresextend(!forward,
                                   &left_xdrop,
                                   xdrop->left_xdrop_res,
@@ -497,7 +545,7 @@ static int ces_c_xdrop(GtCondenseqCreator *ces_c,
                                  ces_c->input_es,
                                  subject_bounds.end - i,
                                  i);
-    ces_c_xdrops++;
+    ces_c->xdrops++;
     gt_evalxdroparbitscoresextend(forward,
                                   &right_xdrop,
                                   xdrop->right_xdrop_res,
@@ -610,7 +658,7 @@ static int ces_c_extend_seeds_window(GtCondenseqCreator *ces_c,
                  querypos,
                  query_bounds.end,
                  ces_c->windowsize,
-                 ces_c_xdrops);
+                 ces_c->xdrops);
     had_err = -1;
   }
 
@@ -981,6 +1029,7 @@ GtCondenseqCreator *gt_condenseq_creator_new(GtUword initsize,
     return NULL;
   }
   ces_c->adding_iter = NULL;
+  ces_c->batchsize = 0;
   ces_c->ces = NULL;
   ces_c->current_orig_start = 0;
   ces_c->cleanup_percent = GT_DIAGS_CLEAN_LIMIT;
@@ -1001,6 +1050,9 @@ GtCondenseqCreator *gt_condenseq_creator_new(GtUword initsize,
   ces_c->mean_fraction = (GtUword) 2;
   ces_c->min_d = GT_UNDEF_UWORD;
   ces_c->min_align_len = minalignlength;
+  ces_c->ops = NULL;
+  ces_c->scores = scores;
+  ces_c->seqnum_end = 0;
   ces_c->use_diagonals = true;
   ces_c->use_full_diags = false;
   ces_c->use_cutoff = false;
@@ -1009,6 +1061,7 @@ GtCondenseqCreator *gt_condenseq_creator_new(GtUword initsize,
   ces_c->window.count = 0;
   ces_c->window.next = 0;
   ces_c->windowsize = windowsize;
+  ces_c->xdrops = 0;
 
   ces_c->extend = ces_c_extend_seeds_diags;
 
@@ -1047,6 +1100,14 @@ void gt_condenseq_creator_set_diags_clean_limit(
   condenseq_creator->cleanup_percent = percent;
 }
 
+void gt_condenseq_creator_set_batchsize(
+                                          GtCondenseqCreator *condenseq_creator,
+                                          GtUword batchsize)
+{
+  gt_assert(condenseq_creator != NULL);
+  condenseq_creator->batchsize = batchsize;
+}
+
 void gt_condenseq_creator_enable_brute_force(
                                           GtCondenseqCreator *condenseq_creator)
 {
@@ -1147,16 +1208,7 @@ void gt_condenseq_creator_delete(GtCondenseqCreator *condenseq_creator)
     gt_free(condenseq_creator->window.idxs);
     gt_free(condenseq_creator->window.pos_arrs);
     gt_kmer_database_delete(condenseq_creator->kmer_db);
-    gt_seqabstract_delete(condenseq_creator->xdrop.current_seq_bwd);
-    gt_seqabstract_delete(condenseq_creator->xdrop.current_seq_fwd);
-    gt_seqabstract_delete(condenseq_creator->xdrop.unique_seq_bwd);
-    gt_seqabstract_delete(condenseq_creator->xdrop.unique_seq_fwd);
-    gt_xdrop_resources_delete(condenseq_creator->xdrop.best_left_res);
-    gt_xdrop_resources_delete(condenseq_creator->xdrop.best_right_res);
-    gt_xdrop_resources_delete(condenseq_creator->xdrop.left_xdrop_res);
-    gt_xdrop_resources_delete(condenseq_creator->xdrop.right_xdrop_res);
-    gt_free(condenseq_creator->xdrop.left);
-    gt_free(condenseq_creator->xdrop.right);
+    ces_c_xdrop_delete(&condenseq_creator->xdrop);
 
     gt_free(condenseq_creator);
   }
@@ -1193,7 +1245,7 @@ static CesCState ces_c_reset_pos_and_iter(GtCondenseqCreator *ces_c,
 static CesCState
 ces_c_reset_pos_and_iter_to_current_seq(GtCondenseqCreator *ces_c)
 {
-  if (ces_c->main_seqnum >= ces_c->ces->orig_num_seq) {
+  if (ces_c->main_seqnum >= ces_c->seqnum_end) {
     return GT_CONDENSEQ_CREATOR_EOD;
   }
   ces_c->current_seq_start =
@@ -1214,10 +1266,39 @@ ces_c_reset_pos_and_iter_to_current_seq(GtCondenseqCreator *ces_c)
   }                                                                         \
   while (false)
 
+/* while a batch is processed the changes are only recorded in <ces_c->ops>,
+   the <GtCondenseq> and k-mer database are shared by all threads */
+static void ces_c_add_unique(GtCondenseqCreator *ces_c,
+                             GtUword start,
+                             GtUword len)
+{
+  if (ces_c->ops != NULL) {
+    CesCOp *op;
+    GT_GETNEXTFREEINARRAY(op, ces_c->ops, CesCOp, 32UL);
+    op->type = GT_CES_C_OP_UNIQUE;
+    op->start = start;
+    op->end = start + len;
+  }
+  else
+    gt_condenseq_add_unique_to_db(ces_c->ces, start, (ces_unsigned) len);
+}
+
+static void ces_c_add_link(GtCondenseqCreator *ces_c, GtCondenseqLink link)
+{
+  if (ces_c->ops != NULL) {
+    CesCOp *op;
+    GT_GETNEXTFREEINARRAY(op, ces_c->ops, CesCOp, 32UL);
+    op->type = GT_CES_C_OP_LINK;
+    op->link = link;
+  }
+  else
+    gt_condenseq_add_link_to_db(ces_c->ces, link);
+}
+
 static CesCState ces_c_skip_short_seqs(GtCondenseqCreator *ces_c)
 {
 
-  while (ces_c->main_seqnum < ces_c->ces->orig_num_seq) {
+  while (ces_c->main_seqnum < ces_c->seqnum_end) {
     ces_c->current_seq_len = gt_condenseq_seqlength(ces_c->ces,
                                                     ces_c->main_seqnum);
     if (ces_c->current_seq_len < ces_c->min_align_len) {
@@ -1225,14 +1306,13 @@ static CesCState ces_c_skip_short_seqs(GtCondenseqCreator *ces_c)
                                                ces_c->main_seqnum);
       /* no check for overflow of length necessary, as minalignlength was
          checked not to overflow */
-      gt_condenseq_add_unique_to_db(ces_c->ces, start,
-                                    ces_c->current_seq_len);
+      ces_c_add_unique(ces_c, start, ces_c->current_seq_len);
       ces_c->main_seqnum++;
     }
     else
       break;
   }
-  return ces_c->main_seqnum >= ces_c->ces->orig_num_seq ?
+  return ces_c->main_seqnum >= ces_c->seqnum_end ?
     GT_CONDENSEQ_CREATOR_EOD : GT_CONDENSEQ_CREATOR_CONT;
 }
 
@@ -1242,7 +1322,14 @@ static void ces_c_add_kmers(GtCondenseqCreator *ces_c,
                             GtUword end)
 {
   gt_assert(start < end);
-  if (start + ces_c->min_align_len <= end)
+  if (ces_c->ops != NULL) {
+    CesCOp *op;
+    GT_GETNEXTFREEINARRAY(op, ces_c->ops, CesCOp, 32UL);
+    op->type = GT_CES_C_OP_KMERS;
+    op->start = start;
+    op->end = end;
+  }
+  else if (start + ces_c->min_align_len <= end)
     gt_kmer_database_add_interval(ces_c->kmer_db, start, end - 1,
                                   ces_c->ces->uds_nelems - 1);
 }
@@ -1258,9 +1345,7 @@ static CesCState ces_c_handle_seqend(GtCondenseqCreator *ces_c,
   if (length != 0) {
     GT_CES_LENCHECK_STATE(length);
     if (state != GT_CONDENSEQ_CREATOR_ERROR) {
-      gt_condenseq_add_unique_to_db(ces_c->ces,
-                                    ces_c->current_orig_start,
-                                    length);
+      ces_c_add_unique(ces_c, ces_c->current_orig_start, length);
       if (length >= ces_c->min_align_len)
         ces_c_add_kmers(ces_c, ces_c->current_orig_start,
                         ces_c->current_orig_start + length);
@@ -1325,9 +1410,8 @@ static CesCState ces_c_extend_seed_kmer(GtCondenseqCreator *ces_c,
       else {
         GT_CES_LENCHECK_STATE(leading_unique_len);
         if (state != GT_CONDENSEQ_CREATOR_ERROR) {
-          gt_condenseq_add_unique_to_db(ces_c->ces,
-                                        ces_c->current_orig_start,
-                                        leading_unique_len);
+          ces_c_add_unique(ces_c, ces_c->current_orig_start,
+                           leading_unique_len);
           ces_c_add_kmers(ces_c, ces_c->current_orig_start, link.orig_startpos);
         }
       }
@@ -1363,7 +1447,7 @@ static CesCState ces_c_extend_seed_kmer(GtCondenseqCreator *ces_c,
                                                          link.orig_startpos,
                                                          GT_READMODE_FORWARD);
       gt_multieoplist_delete(linkops);
-      gt_condenseq_add_link_to_db(ces_c->ces, link);
+      ces_c_add_link(ces_c, link);
 
       if (state != GT_CONDENSEQ_CREATOR_EOD &&
           remaining < ces_c->min_align_len) {
@@ -1528,6 +1612,232 @@ static int ces_c_init_kmer_db(GtCondenseqCreator *ces_c, GtError *err)
   return had_err;
 }
 
+/* A batch of sequences is processed by workers, each a shallow copy of the
+   creator with its own window, xdrop resources, diagonals and k-mer iterator.
+   The workers only read the k-mer database and the uniques, which are not
+   changed until all sequences of the batch are processed. */
+typedef struct {
+  GtCondenseqCreator *workers;
+  GtArrayCesCOp      *seqops;
+  GtError            *err;
+  GtMutex            *mutex;
+  GtUword             firstseq,
+                      lastseq,
+                      nextseq,
+                      nextworker;
+  int                 had_err;
+} CesCBatch;
+
+static void ces_c_worker_init(GtCondenseqCreator *worker,
+                              const GtCondenseqCreator *ces_c)
+{
+  *worker = *ces_c;
+  ces_c_xdrop_init(ces_c->scores, ces_c->xdrop.xdropscore, &worker->xdrop);
+  worker->window.idxs = gt_calloc((size_t) ces_c->windowsize,
+                                  sizeof (*worker->window.idxs));
+  worker->window.pos_arrs = gt_calloc((size_t) ces_c->windowsize,
+                                      sizeof (*worker->window.pos_arrs));
+  worker->window.count = 0;
+  worker->window.next = 0;
+  worker->add = NULL;
+  worker->replace = NULL;
+  worker->delete = NULL;
+  worker->adding_iter = NULL;
+  worker->main_kmer_iter = gt_kmercodeiterator_encseq_new(ces_c->input_es,
+                                                          GT_READMODE_FORWARD,
+                                                          ces_c->kmersize,
+                                                          0);
+  worker->ops = NULL;
+  worker->xdrops = 0;
+  worker->diagonals = NULL;
+  /* full diagonals span the whole input, workers use sparse ones only */
+  if (ces_c->diagonals != NULL) {
+    worker->diagonals = gt_malloc(sizeof (*worker->diagonals));
+    worker->diagonals->full = NULL;
+    worker->diagonals->sparse =
+      ces_c_sparse_diags_new((size_t) ces_c->initsize);
+  }
+}
+
+static void ces_c_worker_fini(GtCondenseqCreator *worker)
+{
+  ces_c_xdrop_delete(&worker->xdrop);
+  gt_free(worker->window.idxs);
+  gt_free(worker->window.pos_arrs);
+  gt_kmercodeiterator_delete(worker->main_kmer_iter);
+  ces_c_diags_delete(worker->diagonals);
+}
+
+/* process sequence <seqnum> on its own, the diagonals are reset so the result
+   does not depend on the sequences the worker processed before */
+static int ces_c_analyse_seq(GtCondenseqCreator *worker, GtUword seqnum,
+                             GtError *err)
+{
+  const GtKmercode *main_kmercode;
+  CesCState state;
+  int had_err = 0;
+
+  worker->main_seqnum = seqnum;
+  worker->seqnum_end = seqnum + 1;
+  ces_c_diags_reset(worker->diagonals);
+  state = ces_c_skip_short_seqs(worker);
+  if (state == GT_CONDENSEQ_CREATOR_CONT)
+    state = ces_c_reset_pos_and_iter_to_current_seq(worker);
+  while ((state == GT_CONDENSEQ_CREATOR_CONT ||
+          state == GT_CONDENSEQ_CREATOR_RESET) &&
+         (main_kmercode =
+          gt_kmercodeiterator_encseq_next(worker->main_kmer_iter)) != NULL) {
+    state = ces_c_process_kmer(worker, main_kmercode, err);
+    /* after a reset the next kmer starts at the new position */
+    if (state == GT_CONDENSEQ_CREATOR_CONT) {
+      worker->main_pos++;
+      worker->current_seq_pos++;
+    }
+  }
+  if (state == GT_CONDENSEQ_CREATOR_ERROR)
+    had_err = -1;
+  else if (state != GT_CONDENSEQ_CREATOR_EOD) {
+    gt_error_set(err, "Processing of kmers stopped, but end of sequence "
+                 GT_WU " not reached", seqnum);
+    had_err = -1;
+  }
+  return had_err;
+}
+
+static void* ces_c_batch_thread(void *data)
+{
+  CesCBatch *batch = data;
+  GtCondenseqCreator *worker;
+  GtError *err = gt_error_new();
+  GtUword seqnum;
+  int had_err = 0;
+
+  gt_mutex_lock(batch->mutex);
+  worker = batch->workers + batch->nextworker++;
+  gt_mutex_unlock(batch->mutex);
+  while (!had_err) {
+    gt_mutex_lock(batch->mutex);
+    if (batch->had_err || batch->nextseq == batch->lastseq)
+      seqnum = GT_UNDEF_UWORD;
+    else
+      seqnum = batch->nextseq++;
+    gt_mutex_unlock(batch->mutex);
+    if (seqnum == GT_UNDEF_UWORD)
+      break;
+    worker->ops = batch->seqops + (seqnum - batch->firstseq);
+    had_err = ces_c_analyse_seq(worker, seqnum, err);
+    worker->ops = NULL;
+  }
+  if (had_err) {
+    gt_mutex_lock(batch->mutex);
+    if (!batch->had_err) {
+      batch->had_err = had_err;
+      gt_error_set(batch->err, "%s", gt_error_get(err));
+    }
+    gt_mutex_unlock(batch->mutex);
+  }
+  gt_error_delete(err);
+  return NULL;
+}
+
+/* apply the changes recorded for one sequence, in the order they were found */
+static void ces_c_batch_commit(GtCondenseqCreator *ces_c, GtArrayCesCOp *ops)
+{
+  GtUword idx;
+
+  for (idx = 0; idx < ops->nextfreeCesCOp; idx++) {
+    CesCOp *op = ops->spaceCesCOp + idx;
+    switch (op->type) {
+      case GT_CES_C_OP_UNIQUE:
+        gt_condenseq_add_unique_to_db(ces_c->ces, op->start,
+                                      (ces_unsigned) (op->end - op->start));
+        break;
+      case GT_CES_C_OP_KMERS:
+        ces_c_add_kmers(ces_c, op->start, op->end);
+        break;
+      case GT_CES_C_OP_LINK:
+        gt_condenseq_add_link_to_db(ces_c->ces, op->link);
+        break;
+    }
+  }
+  ops->nextfreeCesCOp = 0;
+}
+
+static void ces_c_batch_discard(GtArrayCesCOp *ops)
+{
+  GtUword idx;
+
+  for (idx = 0; idx < ops->nextfreeCesCOp; idx++) {
+    if (ops->spaceCesCOp[idx].type == GT_CES_C_OP_LINK)
+      gt_editscript_delete(ops->spaceCesCOp[idx].link.editscript);
+  }
+  ops->nextfreeCesCOp = 0;
+}
+
+/* Process the sequences from <ces_c->main_seqnum> on in batches of
+   <ces_c->batchsize> sequences, each compared to the uniques of the preceding
+   batches. The results are committed in sequence order, so they do not depend
+   on the number of threads. */
+static int ces_c_analyse_batches(GtCondenseqCreator *ces_c, GtError *err)
+{
+  CesCBatch batch;
+  GtUword idx,
+          numofworkers = gt_jobs > 1U ? (GtUword) gt_jobs : 1UL;
+  int had_err = 0;
+
+  gt_assert(ces_c->batchsize > 0);
+  batch.workers = gt_malloc(sizeof (*batch.workers) * numofworkers);
+  for (idx = 0; idx < numofworkers; idx++)
+    ces_c_worker_init(batch.workers + idx, ces_c);
+  batch.seqops = gt_malloc(sizeof (*batch.seqops) * ces_c->batchsize);
+  for (idx = 0; idx < ces_c->batchsize; idx++)
+    GT_INITARRAY(batch.seqops + idx, CesCOp);
+  batch.mutex = gt_mutex_new();
+  batch.err = err;
+  batch.had_err = 0;
+
+  for (batch.firstseq = ces_c->main_seqnum;
+       !had_err && batch.firstseq < ces_c->seqnum_end;
+       batch.firstseq = batch.lastseq) {
+    batch.lastseq = batch.firstseq + ces_c->batchsize < ces_c->seqnum_end ?
+                    batch.firstseq + ces_c->batchsize :
+                    ces_c->seqnum_end;
+    batch.nextseq = batch.firstseq;
+    batch.nextworker = 0;
+    if (gt_jobs > 1U && batch.lastseq - batch.firstseq > 1UL)
+      had_err = gt_multithread(ces_c_batch_thread, &batch, err);
+    else
+      (void) ces_c_batch_thread(&batch);
+    if (!had_err)
+      had_err = batch.had_err;
+    if (!had_err) {
+      for (idx = 0; idx < batch.lastseq - batch.firstseq; idx++)
+        ces_c_batch_commit(ces_c, batch.seqops + idx);
+      /* make the new uniques visible to the next batch */
+      gt_kmer_database_flush(ces_c->kmer_db);
+      for (idx = 0; idx < numofworkers; idx++) {
+        ces_c->xdrops += batch.workers[idx].xdrops;
+        batch.workers[idx].xdrops = 0;
+      }
+      gt_log_log(GT_WU " of " GT_WU " sequences processed, " GT_WU " uniques, "
+                 GT_WU " links", batch.lastseq, ces_c->seqnum_end,
+                 ces_c->ces->uds_nelems, ces_c->ces->lds_nelems);
+    }
+  }
+  ces_c->main_seqnum = ces_c->seqnum_end;
+
+  gt_mutex_delete(batch.mutex);
+  for (idx = 0; idx < ces_c->batchsize; idx++) {
+    ces_c_batch_discard(batch.seqops + idx);
+    GT_FREEARRAY(batch.seqops + idx, CesCOp);
+  }
+  gt_free(batch.seqops);
+  for (idx = 0; idx < numofworkers; idx++)
+    ces_c_worker_fini(batch.workers + idx);
+  gt_free(batch.workers);
+  return had_err;
+}
+
 /* scan the seq and fill tables */
 static int ces_c_analyse(GtCondenseqCreator *ces_c, GtTimer *timer,
                          GtError *err)
@@ -1536,6 +1846,7 @@ static int ces_c_analyse(GtCondenseqCreator *ces_c, GtTimer *timer,
   CesCState state = GT_CONDENSEQ_CREATOR_CONT;
   int had_err = 0;
 
+  ces_c->seqnum_end = ces_c->ces->orig_num_seq;
   ces_c->main_kmer_iter = gt_kmercodeiterator_encseq_new(ces_c->input_es,
                                                          GT_READMODE_FORWARD,
                                                          ces_c->kmersize,
@@ -1543,6 +1854,9 @@ static int ces_c_analyse(GtCondenseqCreator *ces_c, GtTimer *timer,
   if (gt_showtime_enabled())
     gt_timer_show_progress(timer, "analyse data, init kmer_db", stderr);
   had_err = ces_c_init_kmer_db(ces_c, err);
+  /* in batch mode only the rest of the current sequence is processed here */
+  if (!had_err && ces_c->batchsize > 0)
+    ces_c->seqnum_end = ces_c->main_seqnum + 1;
   if (!had_err &&
       !gt_kmercodeiterator_inputexhausted(ces_c->main_kmer_iter)) {
     GtUword percentile;
@@ -1581,7 +1895,7 @@ static int ces_c_analyse(GtCondenseqCreator *ces_c, GtTimer *timer,
           gt_log_log(GT_WU "%% processed.", percentile);
           gt_log_log(GT_WU " kmer positions in unique (kmer_db)",
                      gt_kmer_database_get_kmer_count(ces_c->kmer_db));
-          gt_log_log(GT_WU " times xdrop was called", ces_c_xdrops);
+          gt_log_log(GT_WU " times xdrop was called", ces_c->xdrops);
           gt_log_log(GT_WU " uniques", ces_c->ces->uds_nelems);
           gt_log_log(GT_WU " links", ces_c->ces->lds_nelems);
           if (gt_showtime_enabled()) {
@@ -1601,6 +1915,17 @@ static int ces_c_analyse(GtCondenseqCreator *ces_c, GtTimer *timer,
       gt_error_set(err, "Processing of kmers stopped, but end of data not "
                    "reached");
     }
+    if (!had_err && ces_c->batchsize > 0) {
+      /* the sequence might have ended with a link reaching its end */
+      ces_c->main_seqnum = ces_c->seqnum_end;
+      ces_c->seqnum_end = ces_c->ces->orig_num_seq;
+      if (gt_showtime_enabled())
+        gt_timer_show_progress_formatted(timer, stderr,
+                                         "analyse data, search hits in "
+                                         "batches of " GT_WU " sequences",
+                                         ces_c->batchsize);
+      had_err = ces_c_analyse_batches(ces_c, err);
+    }
   }
   gt_kmercodeiterator_delete(ces_c->main_kmer_iter);
   gt_kmercodeiterator_delete(ces_c->adding_iter);
@@ -1725,7 +2050,7 @@ int gt_condenseq_creator_create(GtCondenseqCreator *condenseq_creator,
   else
     condenseq_creator->diagonals = NULL;
 
-  ces_c_xdrops = 0;
+  condenseq_creator->xdrops = 0;
   had_err = ces_c_analyse(condenseq_creator, timer, err);
 
   if (!had_err) {
@@ -1733,7 +2058,7 @@ int gt_condenseq_creator_create(GtCondenseqCreator *condenseq_creator,
       gt_timer_show_progress(timer, "write data, alphabet", stderr);
     gt_log_log(GT_WU " kmer positions in final kmer_db",
                gt_kmer_database_get_kmer_count(condenseq_creator->kmer_db));
-    gt_log_log(GT_WU " xdrop calls.", ces_c_xdrops);
+    gt_log_log(GT_WU " xdrop calls.", condenseq_creator->xdrops);
     gt_log_log(GT_WU " uniques", condenseq_creator->ces->uds_nelems);
     gt_log_log(GT_WU " links", condenseq_creator->ces->lds_nelems);
     gt_log_log(GT_WU " bytes in final kmer_db",
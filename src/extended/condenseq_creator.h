@@ -106,6 +106,15 @@ void                gt_condenseq_creator_disable_prune(
 void                gt_condenseq_creator_set_mean_fraction(
                                           GtCondenseqCreator *condenseq_creator,
                                           GtUword fraction);
+/* Process the sequences following the initial k-mer database in batches of
+   <batchsize> sequences, using <gt_jobs> many threads. The sequences of a batch
+   are only compared to the uniques of the preceding batches, the results are
+   added in the order of the sequences, so they do not depend on the number of
+   threads. Similar sequences within one batch are not compressed against each
+   other. 0 (the default) processes all sequences one after the other. */
+void                gt_condenseq_creator_set_batchsize(
+                                          GtCondenseqCreator *condenseq_creator,
+                                          GtUword batchsize);
 /* Percentage of sparse diagonals that is allowed to be outside of used ranges
    and marked for deletion. 0 <= <percent> < 100. */
 void gt_condenseq_creator_set_diags_clean_limit(
@@ -57,9 +57,13 @@ typedef struct {
   ces_unsigned    len;
 } GtCondenseqUnique;
 
+/* least recently used cache of completely decoded links */
+typedef struct GtCondenseqLinkCache GtCondenseqLinkCache;
+
 struct GtCondenseq {
-  GtAlphabet        *alphabet;
-  GtCondenseqLink   *links;
+  GtAlphabet           *alphabet;
+  GtCondenseqLink      *links;
+  GtCondenseqLinkCache *link_cache;
   GtCondenseqUnique *uniques;
   GtEncseq          *unique_es;
   GtIntset          *sdstab,
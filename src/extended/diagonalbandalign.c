@@ -27,6 +27,7 @@
 #include "core/unused_api.h"
 #include "extended/diagonalbandalign.h"
 #include "extended/linspace_management.h"
+#include "extended/myersedist.h"
 #include "extended/reconstructalignment.h"
 #include "match/squarededist.h"
 
@@ -318,9 +319,11 @@ GT_UNUSED  static void dtab_in_square_space(GtLinspaceManagement *spacemanager,
   Dtab[0].last_type = edge;
 }
 
-/* calculate only distance with diagonalband in linear space O(n) */
+/* calculate only distance with diagonalband in linear space O(n), unit costs
+   are handled by <myersedist> */
 
-static GtUword diagonalband_linear_distance_only(const GtUchar *useq,
+static GtUword diagonalband_linear_distance_only(GtMyersEdist *myersedist,
+                                                 const GtUchar *useq,
                                                  GtUword ustart,
                                                  GtUword ulen,
                                                  const GtUchar *vseq,
@@ -344,6 +347,13 @@ static GtUword diagonalband_linear_distance_only(const GtUchar *useq,
     return GT_UWORD_MAX;
   }
 
+  if (matchcost == 0 && mismatchcost == 1 && gapcost == 1)
+  {
+    gt_assert(myersedist != NULL);
+    return gt_myersedist_banded(myersedist, useq + ustart, ulen,
+                                vseq + vstart, vlen, left_dist, right_dist);
+  }
+
   width = right_dist - left_dist + 1;
   EDtabcolumn = gt_malloc(sizeof(*EDtabcolumn) * width);
 
@@ -981,6 +991,7 @@ void gt_diagonalbandalign_check(GT_UNUSED bool forward,
   GtAlignment *align;
   GtLinspaceManagement *spacemanager;
   GtScoreHandler *scorehandler;
+  GtMyersEdist *myersedist;
 
   if (memchr(useq, LINEAR_EDIST_GAP,ulen) != NULL)
   {
@@ -1006,9 +1017,12 @@ void gt_diagonalbandalign_check(GT_UNUSED bool forward,
   scorehandler = gt_scorehandler_new(matchcost, mismatchcost, 0, gapcost);
   gt_scorehandler_plain(scorehandler);
   gt_scorehandler_downcase(scorehandler);
-  edist1 = diagonalband_linear_distance_only(useq, 0, ulen, vseq, 0, vlen,
+  myersedist = gt_myersedist_new(scorehandler);
+  edist1 = diagonalband_linear_distance_only(myersedist,
+                                             useq, 0, ulen, vseq, 0, vlen,
                                              left_dist, right_dist, matchcost,
                                              mismatchcost, gapcost);
+  gt_myersedist_delete(myersedist);
 
   edist2 = diagonalband_squarespace_distance_only(useq, 0, ulen, vseq, 0, vlen,
                                                   left_dist, right_dist,
@@ -33,7 +33,9 @@
 #include "core/hashmap-generic.h"
 #include "core/log_api.h"
 #include "core/ma_api.h"
+#include "core/multithread_api.h"
 #include "core/parseutils.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/warning_api.h"
 #include "core/xansi_api.h"
@@ -155,10 +157,10 @@ static inline void prepare_numeric_field(GtEncdesc *encdesc,
   else if (!cur_field->is_value_const || !cur_field->is_delta_const) {
     if (cur_field->use_delta_coding) {
       if (cur_field->is_delta_negative)
-        gt_assert(value < cur_field->prev_value);
+        gt_assert(value < info->prev_values[info->cur_field_num]);
       if (cur_field->is_delta_positive)
-        gt_assert(value > cur_field->prev_value);
-      to_store = (GtUword) ((value - cur_field->prev_value) -
+        gt_assert(value > info->prev_values[info->cur_field_num]);
+      to_store = (GtUword) ((value - info->prev_values[info->cur_field_num]) -
                             cur_field->min_delta);
       gt_assert(to_store <= (GtUword) cur_field->max_delta -
                 cur_field->min_delta);
@@ -176,7 +178,7 @@ static inline void prepare_numeric_field(GtEncdesc *encdesc,
     else
       numeric_field_prepare_verbose_value(encdesc, info, to_store);
   }
-  cur_field->prev_value = value;
+  info->prev_values[info->cur_field_num] = value;
 }
 
 static void inline regular_field_prepare_length(GtEncdesc *encdesc,
@@ -219,7 +221,6 @@ static void prepare_write_data_and_count_bits(GtEncdesc *encdesc,
   info->cur_field_num = 0;
   info->cur_field_start_pos = 0;
   info->total_bits_prepared = 0;
-  gt_assert(info->codes->nextfreeEncdescCode == 0);
 
   if (!encdesc->num_of_fields_is_const) {
     encdesc_prepare_num_of_fields(encdesc, info);
@@ -260,22 +261,6 @@ static void prepare_write_data_and_count_bits(GtEncdesc *encdesc,
   }
 }
 
-static inline void
-append_data_to_bitstream_and_reset_info(EncdescWriteInfo *info,
-                                        GtBitOutStream *bitstream)
-{
-  EncdescCode *codes =      info->codes->spaceEncdescCode;
-  GtUword number_of_codes = info->codes->nextfreeEncdescCode,
-          idx;
-
-  for (idx = 0; idx < number_of_codes; idx++)
-  {
-    gt_bitoutstream_append(bitstream, codes[idx].code, codes[idx].length);
-  }
-  info->codes->nextfreeEncdescCode = 0;
-  info->total_bits_prepared = 0;
-}
-
 static inline unsigned count_leading_zeros(const char *number)
 {
   int idx;
@@ -302,6 +287,9 @@ static unsigned encdesc_digits_per_value(GtUword value,
     return 1U;
 }
 
+static void encdesc_delete_desc_fields(DescField *fields,
+                                       GtUword numoffields);
+
 static int encdesc_hashmap_distr_add(GtHashtable *hm_distri, GtWord key)
 {
   GtUint64 *valueptr;
@@ -317,33 +305,666 @@ static int encdesc_hashmap_distr_add(GtHashtable *hm_distri, GtWord key)
   }
 }
 
+static void encdesc_field_init_stats(DescField *field)
+{
+  GtUword idx;
+
+  field->max_len = field->len;
+  field->min_len = field->len;
+  field->is_const = true;
+  field->fieldlen_is_const = true;
+  field->has_zero_padding = false;
+  field->chars =
+    gt_calloc((size_t) field->max_len, sizeof (field->chars));
+
+  for (idx = 0; idx < field->max_len; idx++)
+    field->chars[idx] = li_ull_gt_hashmap_new();
+
+  field->num_values = li_ull_gt_hashmap_new();
+  field->delta_values = li_ull_gt_hashmap_new();
+  field->zero_count = gt_disc_distri_new();
+  field->max_zero = 0;
+  field->num_values_size = 0;
+  field->delta_values_size = 0;
+  field->bittab = gt_bittab_new(field->len);
+  gt_assert(field->bittab != NULL);
+  /* Set all bits to 1*/
+  for (idx = 0; idx < field->len; idx++) {
+    gt_bittab_set_bit(field->bittab, idx);
+  }
+}
+
+/* returns fields to collect the statistics of a part of the descriptions,
+   which are merged into the fields of <encdesc> later */
+static DescField* encdesc_fields_new_partial(const GtEncdesc *encdesc)
+{
+  DescField *fields = gt_calloc((size_t) encdesc->num_of_fields,
+                                sizeof (*fields));
+  GtUword idx;
+
+  for (idx = 0; idx < encdesc->num_of_fields; idx++) {
+    fields[idx].sep = encdesc->fields[idx].sep;
+    fields[idx].len = encdesc->fields[idx].len;
+    fields[idx].data = encdesc->fields[idx].data;
+    fields[idx].is_numeric = encdesc->fields[idx].is_numeric;
+    encdesc_field_init_stats(fields + idx);
+  }
+  return fields;
+}
+
+static void encdesc_fields_delete_partial(DescField *fields,
+                                          GtUword numoffields)
+{
+  GtUword idx;
+
+  if (fields == NULL)
+    return;
+  /* the data is owned by the fields of the <GtEncdesc> */
+  for (idx = 0; idx < numoffields; idx++)
+    fields[idx].data = NULL;
+  encdesc_delete_desc_fields(fields, numoffields);
+}
+
+static enum iterator_op encdesc_hashmap_distr_merge_iter(GtWord key,
+                                                         GtUint64 value,
+                                                         void *data,
+                                                         GT_UNUSED GtError *err)
+{
+  GtHashtable *hm_distri = data;
+  GtUint64 *valueptr = li_ull_gt_hashmap_get(hm_distri, key);
+
+  if (!valueptr)
+    li_ull_gt_hashmap_add(hm_distri, key, value);
+  else
+    (*valueptr) += value;
+  return CONTINUE_ITERATION;
+}
+
+static void encdesc_hashmap_distr_merge(GtHashtable *hm_distri,
+                                        GtHashtable *other)
+{
+  /* error is NULL as encdesc_hashmap_distr_merge_iter() cannot fail */
+  (void) li_ull_gt_hashmap_foreach(other, encdesc_hashmap_distr_merge_iter,
+                                   hm_distri, NULL);
+}
+
+static void encdesc_disc_distri_merge_iter(GtUword key, GtUint64 value,
+                                           void *data)
+{
+  gt_disc_distri_add_multi((GtDiscDistri*) data, key, value);
+}
+
+/* adds the statistics of description <desc>, which is modified, to <fields>.
+   <descnum> is the number of <desc> among the descriptions analyzed with
+   <fields>. Returns the number of fields of <desc>. */
+static GtUword encdesc_analyze_desc(DescField *fields, GtUword num_of_fields,
+                                    char *desc, GtUword descnum)
+{
+  DescField *cur_field;
+  GtUword    chars_len,
+             cur_field_num = 0,
+             desc_char_idx,
+             desclength = (GtUword) strlen(desc),
+             k_idx,
+             start_pos = 0,
+             numoffields;
+  GtWord     out,
+             value,
+             value_delta;
+  unsigned   zero_count;
+
+  for (desc_char_idx = 0;
+       desc_char_idx <= desclength && cur_field_num < num_of_fields;
+       desc_char_idx++) {
+    cur_field = &fields[cur_field_num];
+    /* check for end of string, if there are less fields then in longest */
+    if (desc[desc_char_idx] ==  cur_field->sep ||
+        desc[desc_char_idx] == '\0') {
+      desc[desc_char_idx] = '\0';
+
+      chars_len = desc_char_idx - start_pos;
+      if (chars_len > cur_field->max_len) {
+        cur_field->is_const = false;
+        cur_field->fieldlen_is_const = false;
+        cur_field->chars =
+          gt_realloc(cur_field->chars,
+                     (size_t) chars_len * sizeof (GtHashtable*));
+        for (k_idx = cur_field->max_len; k_idx < chars_len; k_idx++)
+          cur_field->chars[k_idx] = li_ull_gt_hashmap_new();
+
+        cur_field->max_len = chars_len;
+      }
+      else if (chars_len < cur_field->min_len) {
+        cur_field->is_const = false;
+        cur_field->fieldlen_is_const = false;
+        cur_field->min_len = chars_len;
+      }
+
+      for (k_idx = 0; k_idx < chars_len; k_idx++) {
+        (void) encdesc_hashmap_distr_add(cur_field->chars[k_idx],
+                                         (GtWord) desc[start_pos + k_idx]);
+      }
+
+      if (cur_field->is_const) {
+        if (strcmp(cur_field->data, desc + start_pos) != 0)
+          cur_field->is_const = false;
+      }
+
+      if (cur_field->is_numeric) {
+        if (gt_parse_word(&out, (desc + start_pos)) != 0)
+          cur_field->is_numeric = false;
+        else {
+          value = out;
+
+          zero_count = count_leading_zeros((desc + start_pos));
+          if (zero_count > 0)
+            cur_field->has_zero_padding = true;
+          if (zero_count > cur_field->max_zero)
+            cur_field->max_zero = zero_count;
+          gt_disc_distri_add(cur_field->zero_count,
+                             (GtUword) zero_count);
+
+          if (descnum == 0) {
+            cur_field->global_value =
+              cur_field->min_value =
+              cur_field->max_value = value;
+            cur_field->is_value_const =
+              cur_field->is_delta_positive =
+              cur_field->is_delta_negative = true;
+          }
+          else {
+            value_delta = value - cur_field->prev_value;
+            if (value_delta != 0) {
+              cur_field->is_value_const = false;
+              if (value < cur_field->min_value) {
+                cur_field->min_value = value;
+              }
+              if (value > cur_field->max_value) {
+                cur_field->max_value = value;
+              }
+            }
+            if (value_delta <= 0)
+              cur_field->is_delta_positive = false;
+            if (value_delta >= 0)
+              cur_field->is_delta_negative = false;
+
+            if (descnum == 1UL) {
+              cur_field->max_delta =
+                cur_field->min_delta =
+                cur_field->global_delta = value_delta;
+              cur_field->is_delta_const = true;
+            }
+            else {
+              if (value_delta > cur_field->max_delta) {
+                cur_field->is_delta_const = false;
+                cur_field->max_delta = value_delta;
+              }
+              if (value_delta < cur_field->min_delta) {
+                cur_field->is_delta_const = false;
+                cur_field->min_delta = value_delta;
+              }
+            }
+            (void) encdesc_hashmap_distr_add(cur_field->delta_values,
+                                             value_delta);
+          }
+          (void) encdesc_hashmap_distr_add(cur_field->num_values, value);
+          cur_field->prev_value = value;
+        }
+      }
+
+      /* unmark non constant positions */
+      if (!cur_field->is_const) {
+        for (k_idx = 0; k_idx < cur_field->len; k_idx++) {
+          if (k_idx < chars_len) {
+            if (cur_field->data[k_idx] != desc[k_idx + start_pos])
+              gt_bittab_unset_bit(cur_field->bittab, k_idx);
+          }
+          else
+            gt_bittab_unset_bit(cur_field->bittab, k_idx);
+        }
+      }
+      start_pos = desc_char_idx + 1;
+      cur_field_num++;
+    }
+  }
+
+  gt_assert(desc_char_idx == desclength + 1);
+  numoffields = cur_field_num;
+
+  /* TODO DW this heuristic is bad, if the 2nd field is missing, all
+     following fields are missing too! */
+  /* change this so a field can be absent in a single description */
+  /* absent fields are non constant */
+  for (/* nothing */;
+       cur_field_num < num_of_fields;
+       cur_field_num++) {
+    cur_field = &fields[cur_field_num];
+    cur_field->is_const = false;
+    cur_field->fieldlen_is_const = false;
+    cur_field->is_numeric = false;
+  }
+  return numoffields;
+}
+
+/* merges the value statistics of <part>, collected for <part_numofdescs>
+   descriptions, into those of <field>, collected for the <numofdescs>
+   descriptions before. The delta between the two parts is added here. */
+static void encdesc_field_merge_values(DescField *field, const DescField *part,
+                                       GtUword numofdescs,
+                                       GtUword part_numofdescs)
+{
+  field->has_zero_padding = field->has_zero_padding || part->has_zero_padding;
+  if (part->max_zero > field->max_zero)
+    field->max_zero = part->max_zero;
+  gt_disc_distri_foreach(part->zero_count, encdesc_disc_distri_merge_iter,
+                         field->zero_count);
+  encdesc_hashmap_distr_merge(field->num_values, part->num_values);
+  encdesc_hashmap_distr_merge(field->delta_values, part->delta_values);
+
+  if (numofdescs == 0) {
+    field->global_value = part->global_value;
+    field->min_value = part->min_value;
+    field->max_value = part->max_value;
+    field->is_value_const = part->is_value_const;
+    field->is_delta_positive = part->is_delta_positive;
+    field->is_delta_negative = part->is_delta_negative;
+    if (part_numofdescs > 1UL) {
+      field->global_delta = part->global_delta;
+      field->min_delta = part->min_delta;
+      field->max_delta = part->max_delta;
+      field->is_delta_const = part->is_delta_const;
+    }
+  }
+  else {
+    GtWord value_delta = part->global_value - field->prev_value;
+
+    field->is_value_const = field->is_value_const && part->is_value_const &&
+                            value_delta == 0;
+    if (part->min_value < field->min_value)
+      field->min_value = part->min_value;
+    if (part->max_value > field->max_value)
+      field->max_value = part->max_value;
+    field->is_delta_positive = field->is_delta_positive &&
+                               part->is_delta_positive && value_delta > 0;
+    field->is_delta_negative = field->is_delta_negative &&
+                               part->is_delta_negative && value_delta < 0;
+
+    if (numofdescs == 1UL) {
+      field->max_delta =
+        field->min_delta =
+        field->global_delta = value_delta;
+      field->is_delta_const = true;
+    }
+    else {
+      if (value_delta > field->max_delta) {
+        field->is_delta_const = false;
+        field->max_delta = value_delta;
+      }
+      if (value_delta < field->min_delta) {
+        field->is_delta_const = false;
+        field->min_delta = value_delta;
+      }
+    }
+    if (part_numofdescs > 1UL) {
+      if (!part->is_delta_const)
+        field->is_delta_const = false;
+      if (part->max_delta > field->max_delta) {
+        field->is_delta_const = false;
+        field->max_delta = part->max_delta;
+      }
+      if (part->min_delta < field->min_delta) {
+        field->is_delta_const = false;
+        field->min_delta = part->min_delta;
+      }
+    }
+    (void) encdesc_hashmap_distr_add(field->delta_values, value_delta);
+  }
+  field->prev_value = part->prev_value;
+}
+
+/* merges the statistics of <part> into <field>, see
+   <encdesc_field_merge_values()> */
+static void encdesc_field_merge(DescField *field, const DescField *part,
+                                GtUword numofdescs, GtUword part_numofdescs)
+{
+  GtUword idx;
+
+  if (part->max_len > field->max_len) {
+    field->chars = gt_realloc(field->chars,
+                              (size_t) part->max_len * sizeof (GtHashtable*));
+    for (idx = field->max_len; idx < part->max_len; idx++)
+      field->chars[idx] = li_ull_gt_hashmap_new();
+    field->max_len = part->max_len;
+  }
+  if (part->min_len < field->min_len)
+    field->min_len = part->min_len;
+  for (idx = 0; idx < part->max_len; idx++)
+    encdesc_hashmap_distr_merge(field->chars[idx], part->chars[idx]);
+  field->is_const = field->is_const && part->is_const;
+  field->fieldlen_is_const = field->fieldlen_is_const &&
+                             part->fieldlen_is_const;
+  for (idx = 0; idx < field->len; idx++) {
+    if (!gt_bittab_bit_is_set(part->bittab, idx))
+      gt_bittab_unset_bit(field->bittab, idx);
+  }
+  field->is_numeric = field->is_numeric && part->is_numeric;
+  if (field->is_numeric)
+    encdesc_field_merge_values(field, part, numofdescs, part_numofdescs);
+}
+
+/* the descriptions are read in batches of about this many characters */
+#define GT_ENCDESC_BATCH_CHARS (1UL << 20)
+/* a thread takes consecutive descriptions of about this many characters */
+#define GT_ENCDESC_JOB_CHARS   (1UL << 16)
+
+typedef enum {
+  ENCDESC_COUNT_FIELDS,
+  ENCDESC_ANALYZE,
+  ENCDESC_PREPARE
+} EncdescPhase;
+
+/* The descriptions <from> to <to>-1 of a batch, processed by one thread. */
+typedef struct {
+  DescField        *fields;
+  EncdescWriteInfo  info;
+  GtUint64          num_of_chars;
+  GtUword           from,
+                    to,
+                    longest,
+                    max_num_of_fields;
+  bool              num_of_fields_is_const;
+} EncdescJob;
+
+/* A batch of descriptions, processed by <gt_jobs> many threads. The phase
+   determines what is done with the descriptions of a job. */
+typedef struct {
+  GtEncdesc    *encdesc;
+  EncdescJob   *jobs;
+  GtMutex      *mutex;
+  char         *chars,
+               *prevdesc;
+  GtUword      *descstarts,
+               *descbits,
+               *codeends,
+                firstdesc,
+                numofdescs,
+                allocateddescs,
+                numofchars,
+                allocatedchars,
+                numofjobs,
+                allocatedjobs,
+                nextjob;
+  EncdescPhase  phase;
+  bool          eof;
+} EncdescBatch;
+
+static EncdescBatch* encdesc_batch_new(GtEncdesc *encdesc)
+{
+  EncdescBatch *batch = gt_calloc((size_t) 1, sizeof (*batch));
+
+  batch->encdesc = encdesc;
+  batch->allocateddescs = 1024UL;
+  batch->descstarts = gt_malloc(sizeof (*batch->descstarts) *
+                                (batch->allocateddescs + 1));
+  batch->descstarts[0] = 0;
+  batch->descbits = gt_malloc(sizeof (*batch->descbits) *
+                              batch->allocateddescs);
+  batch->codeends = gt_malloc(sizeof (*batch->codeends) *
+                              batch->allocateddescs);
+  batch->mutex = gt_mutex_new();
+  return batch;
+}
+
+static void encdesc_batch_delete(EncdescBatch *batch)
+{
+  GtUword idx;
+
+  if (batch == NULL)
+    return;
+  for (idx = 0; idx < batch->allocatedjobs; idx++) {
+    EncdescJob *job = batch->jobs + idx;
+    encdesc_fields_delete_partial(job->fields, batch->encdesc->num_of_fields);
+    if (job->info.codes != NULL) {
+      GT_FREEARRAY(job->info.codes, EncdescCode);
+      gt_free(job->info.codes);
+    }
+    gt_free(job->info.descbuffer);
+    gt_free(job->info.prev_values);
+  }
+  gt_free(batch->jobs);
+  gt_free(batch->chars);
+  gt_free(batch->prevdesc);
+  gt_free(batch->descstarts);
+  gt_free(batch->descbits);
+  gt_free(batch->codeends);
+  gt_mutex_delete(batch->mutex);
+  gt_free(batch);
+}
+
+static int encdesc_batch_reset(EncdescBatch *batch,
+                               GtCstrIterator *cstr_iterator, GtError *err)
+{
+  batch->firstdesc = batch->numofdescs = batch->numofchars = 0;
+  batch->eof = false;
+  gt_free(batch->prevdesc);
+  batch->prevdesc = NULL;
+  return gt_cstr_iterator_reset(cstr_iterator, err);
+}
+
+static void encdesc_batch_add(EncdescBatch *batch, const char *desc)
+{
+  GtUword len = (GtUword) strlen(desc) + 1;
+
+  if (batch->numofchars + len > batch->allocatedchars) {
+    batch->allocatedchars = 2 * (batch->numofchars + len);
+    batch->chars = gt_realloc(batch->chars, (size_t) batch->allocatedchars);
+  }
+  if (batch->numofdescs == batch->allocateddescs) {
+    batch->allocateddescs *= 2;
+    batch->descstarts = gt_realloc(batch->descstarts,
+                                   sizeof (*batch->descstarts) *
+                                   (batch->allocateddescs + 1));
+    batch->descbits = gt_realloc(batch->descbits,
+                                 sizeof (*batch->descbits) *
+                                 batch->allocateddescs);
+    batch->codeends = gt_realloc(batch->codeends,
+                                 sizeof (*batch->codeends) *
+                                 batch->allocateddescs);
+  }
+  memcpy(batch->chars + batch->numofchars, desc, (size_t) len);
+  batch->numofchars += len;
+  batch->descstarts[++batch->numofdescs] = batch->numofchars;
+}
+
+/* reads the next batch of descriptions from <cstr_iterator> and splits it into
+   jobs, an empty batch means that all descriptions were read */
+static int encdesc_batch_read(EncdescBatch *batch,
+                              GtCstrIterator *cstr_iterator, GtError *err)
+{
+  const char *descbuffer = NULL;
+  GtUword from = 0, to;
+  int status;
+
+  if (batch->numofdescs > 0) {
+    /* the last description is needed for the delta coding of the next one */
+    gt_free(batch->prevdesc);
+    batch->prevdesc = gt_cstr_dup(batch->chars +
+                                  batch->descstarts[batch->numofdescs - 1]);
+    batch->firstdesc += batch->numofdescs;
+  }
+  batch->numofdescs = batch->numofchars = 0;
+  while (!batch->eof && batch->numofchars < GT_ENCDESC_BATCH_CHARS) {
+    status = gt_cstr_iterator_next(cstr_iterator, &descbuffer, err);
+    if (status < 0)
+      return status;
+    if (status == 0)
+      batch->eof = true;
+    else {
+      gt_assert(descbuffer != NULL);
+      encdesc_batch_add(batch, descbuffer);
+    }
+  }
+
+  batch->numofjobs = 0;
+  while (from < batch->numofdescs) {
+    GtUword limit = batch->descstarts[from] + GT_ENCDESC_JOB_CHARS;
+    for (to = from + 1;
+         to < batch->numofdescs && batch->descstarts[to + 1] <= limit;
+         to++)
+      /* Nothing */;
+    if (batch->numofjobs == batch->allocatedjobs) {
+      GtUword oldsize = batch->allocatedjobs;
+      batch->allocatedjobs = 2 * batch->allocatedjobs + 16UL;
+      batch->jobs = gt_realloc(batch->jobs, sizeof (*batch->jobs) *
+                                            batch->allocatedjobs);
+      memset(batch->jobs + oldsize, 0, sizeof (*batch->jobs) *
+                                       (batch->allocatedjobs - oldsize));
+    }
+    batch->jobs[batch->numofjobs].from = from;
+    batch->jobs[batch->numofjobs].to = to;
+    batch->numofjobs++;
+    from = to;
+  }
+  return 0;
+}
+
+static GtUword encdesc_count_fields(const char *descbuffer)
+{
+  const char sep[GT_ENCDESC_NUMOFSEPS] = {GT_ENCDESC_SEPS};
+  GtUword desc_char_idx,
+          desclength = (GtUword) strlen(descbuffer),
+          numoffields = 0,
+          sep_idx,
+          start_pos = 0;
+
+  for (desc_char_idx = 0; desc_char_idx <= desclength; desc_char_idx++) {
+    for (sep_idx = 0; sep_idx < GT_ENCDESC_NUMOFSEPS; sep_idx++) {
+      if (descbuffer[desc_char_idx] == sep[sep_idx]) {
+        if (desc_char_idx - start_pos > 0) {
+          numoffields++;
+          start_pos = desc_char_idx + 1;
+        }
+        break;
+      }
+    }
+  }
+  return numoffields;
+}
+
+static void encdesc_job_count_fields(EncdescBatch *batch, EncdescJob *job)
+{
+  GtUword descnum;
+
+  job->max_num_of_fields = 0;
+  for (descnum = job->from; descnum < job->to; descnum++) {
+    GtUword numoffields =
+      encdesc_count_fields(batch->chars + batch->descstarts[descnum]);
+    if (numoffields > job->max_num_of_fields) {
+      job->max_num_of_fields = numoffields;
+      job->longest = descnum;
+    }
+  }
+}
+
+static void encdesc_job_analyze(EncdescBatch *batch, EncdescJob *job)
+{
+  GtEncdesc *encdesc = batch->encdesc;
+  GtUword descnum;
+
+  gt_assert(job->fields == NULL);
+  job->fields = encdesc_fields_new_partial(encdesc);
+  job->num_of_chars = 0;
+  job->num_of_fields_is_const = true;
+  for (descnum = job->from; descnum < job->to; descnum++) {
+    char *desc = batch->chars + batch->descstarts[descnum];
+    GtUword numoffields;
+
+    job->num_of_chars += (GtUint64) strlen(desc);
+    numoffields = encdesc_analyze_desc(job->fields, encdesc->num_of_fields,
+                                       desc, descnum - job->from);
+    if (numoffields != encdesc->num_of_fields) {
+      gt_log_log(GT_WU "!= " GT_WU " less fields in desc: " GT_WU,
+                 numoffields, encdesc->num_of_fields,
+                 batch->firstdesc + descnum);
+      job->num_of_fields_is_const = false;
+    }
+    encdesc->num_of_fields_tab.spaceGtUword[batch->firstdesc + descnum] =
+      numoffields;
+  }
+}
+
+static void encdesc_job_prepare(EncdescBatch *batch, EncdescJob *job);
+
+static EncdescJob* encdesc_batch_next_job(EncdescBatch *batch)
+{
+  EncdescJob *job = NULL;
+
+  gt_mutex_lock(batch->mutex);
+  if (batch->nextjob < batch->numofjobs)
+    job = batch->jobs + batch->nextjob++;
+  gt_mutex_unlock(batch->mutex);
+  return job;
+}
+
+static void* encdesc_batch_thread(void *data)
+{
+  EncdescBatch *batch = data;
+  EncdescJob *job;
+
+  while ((job = encdesc_batch_next_job(batch)) != NULL) {
+    switch (batch->phase) {
+      case ENCDESC_COUNT_FIELDS:
+        encdesc_job_count_fields(batch, job);
+        break;
+      case ENCDESC_ANALYZE:
+        encdesc_job_analyze(batch, job);
+        break;
+      case ENCDESC_PREPARE:
+        encdesc_job_prepare(batch, job);
+        break;
+    }
+  }
+  return NULL;
+}
+
+static int encdesc_batch_run(EncdescBatch *batch, EncdescPhase phase,
+                             GtError *err)
+{
+  int had_err = 0;
+
+  batch->phase = phase;
+  batch->nextjob = 0;
+  if (gt_jobs > 1U && batch->numofjobs > 1UL)
+    had_err = gt_multithread(encdesc_batch_thread, batch, err);
+  else
+    (void) encdesc_batch_thread(batch);
+  return had_err;
+}
+
+/* The descriptions are analyzed in two passes, each reading the descriptions
+   batch by batch. The first pass finds the description with the maximum number
+   of fields, which defines the fields. The second pass collects the statistics
+   of the fields. Each job of a batch collects statistics of its own, these are
+   merged in the order of the descriptions. */
 static int encdesc_analyze_descs(GtEncdesc *encdesc,
                                  GtCstrIterator *cstr_iterator,
+                                 EncdescBatch *batch,
                                  GtError *err)
 {
   DescField  *cur_field;
-  const char *descbuffer = NULL;
   char       *longest_desc = NULL,
-             *mutable_desc = NULL,
               sep[GT_ENCDESC_NUMOFSEPS] = {GT_ENCDESC_SEPS};
-  GtUword     chars_len,
-              cur_desc = 0,
+  GtUword     cur_desc = 0,
               cur_field_num,
               desc_char_idx,
               desclength,
               j_idx,
-              k_idx,
               len_diff,
               longest_desc_field_idx = 0,
               sep_idx,
-              start_pos = 0,
-              tmp_numoffields;
-  GtWord      out,
-              value,
-              value_delta;
-  int         had_err = 0,
-              status;
-  unsigned    zero_count;
+              start_pos = 0;
+  GtWord      out;
+  int         had_err = 0;
   bool        found;
 
   encdesc->num_of_fields = 0;
@@ -351,36 +972,24 @@ static int encdesc_analyze_descs(GtEncdesc *encdesc,
   GT_INITARRAY(&encdesc->num_of_fields_tab, GtUword);
 
   /* find description with maximum number of fields */
-  /* TODO DW check constant number of fields here */
-  /* TODO DW count totalnumofchars here */
   gt_error_check(err);
-  status = gt_cstr_iterator_next(cstr_iterator, &descbuffer, err);
-  while (status != 0) {
-    if (status < 0)
-      return status;
-    gt_assert(descbuffer != NULL);
-
-    desclength = (GtUword) strlen(descbuffer);
-
-    tmp_numoffields = 0;
-    for (desc_char_idx = 0; desc_char_idx <= desclength; desc_char_idx++) {
-      for (sep_idx = 0; sep_idx < GT_ENCDESC_NUMOFSEPS; sep_idx++) {
-        if (descbuffer[desc_char_idx] == sep[sep_idx]) {
-          if (desc_char_idx - start_pos > 0) {
-            tmp_numoffields++;
-            start_pos = desc_char_idx + 1;
-          }
-          break;
-        }
+  while (!had_err &&
+         !(had_err = encdesc_batch_read(batch, cstr_iterator, err)) &&
+         batch->numofdescs > 0) {
+    had_err = encdesc_batch_run(batch, ENCDESC_COUNT_FIELDS, err);
+    for (j_idx = 0; !had_err && j_idx < batch->numofjobs; j_idx++) {
+      EncdescJob *job = batch->jobs + j_idx;
+      if (job->max_num_of_fields > encdesc->num_of_fields) {
+        encdesc->num_of_fields = job->max_num_of_fields;
+        gt_free(longest_desc);
+        longest_desc = gt_cstr_dup(batch->chars +
+                                   batch->descstarts[job->longest]);
       }
     }
-    if (tmp_numoffields > encdesc->num_of_fields) {
-      encdesc->num_of_fields = tmp_numoffields;
-      gt_free(longest_desc);
-      longest_desc = gt_cstr_dup(descbuffer);
-    }
-    cur_desc++;
-    status = gt_cstr_iterator_next(cstr_iterator, &descbuffer, err);
+  }
+  if (had_err) {
+    gt_free(longest_desc);
+    return had_err;
   }
   if (encdesc->num_of_fields == 0) {
     gt_error_set(err, "The file given seems to have no descriptions, there is "
@@ -413,35 +1022,12 @@ static int encdesc_analyze_descs(GtEncdesc *encdesc,
         longest_desc[desc_char_idx] = '\0';
         cur_field->len = desc_char_idx - start_pos;
         cur_field->data = gt_cstr_dup(longest_desc + start_pos);
-
-        cur_field->max_len = cur_field->len;
-        cur_field->min_len = cur_field->len;
-        cur_field->is_const = true;
-        cur_field->fieldlen_is_const = true;
-        cur_field->has_zero_padding = false;
-        cur_field->chars =
-          gt_calloc((size_t) cur_field->max_len, sizeof (cur_field->chars));
-
-        for (j_idx = 0; j_idx < cur_field->max_len; j_idx++)
-          cur_field->chars[j_idx] = li_ull_gt_hashmap_new();
-
-        cur_field->num_values = li_ull_gt_hashmap_new();
-        cur_field->delta_values = li_ull_gt_hashmap_new();
-        cur_field->zero_count = gt_disc_distri_new();
-        cur_field->max_zero = 0;
-        cur_field->num_values_size = 0;
-        cur_field->delta_values_size = 0;
+        encdesc_field_init_stats(cur_field);
         if (gt_parse_word(&out, cur_field->data) == 0) {
           cur_field->is_numeric = true;
           cur_field->max_value = out;
           cur_field->min_value = out;
         }
-        cur_field->bittab = gt_bittab_new(cur_field->len);
-        gt_assert(cur_field->bittab != NULL);
-        /* Set all bits to 1*/
-        for (j_idx = 0; j_idx < cur_field->len; j_idx++) {
-          gt_bittab_set_bit(cur_field->bittab, j_idx);
-        }
 
         start_pos = desc_char_idx + 1;
         longest_desc_field_idx++;
@@ -452,180 +1038,37 @@ static int encdesc_analyze_descs(GtEncdesc *encdesc,
     gt_free(longest_desc);
   }
 
-  if (!had_err) {
-    if (gt_cstr_iterator_reset(cstr_iterator, err) != 0)
-      had_err = 1;
-  }
-
-  if (!had_err) {
-    cur_desc = 0;
-
-    /* analyze all descriptions */
-    status = gt_cstr_iterator_next(cstr_iterator, &descbuffer, err);
-    while (status != 0) {
-      if (status == -1)
-        return -1;
-      gt_assert(descbuffer != NULL);
-
-      gt_free(mutable_desc);
-      desclength = (GtUword) strlen(descbuffer);
-      encdesc->total_num_of_chars += desclength;
-      mutable_desc = gt_cstr_dup(descbuffer);
-
-      cur_field_num = 0;
-      start_pos = 0;
-
-      for (desc_char_idx = 0;
-           desc_char_idx <= desclength &&
-             cur_field_num < encdesc->num_of_fields;
-           desc_char_idx++) {
-        cur_field = &encdesc->fields[cur_field_num];
-        /* check for end of string, if there are less fields then in longest */
-        if (mutable_desc[desc_char_idx] ==  cur_field->sep ||
-            mutable_desc[desc_char_idx] == '\0') {
-          mutable_desc[desc_char_idx] = '\0';
-
-          chars_len = desc_char_idx - start_pos;
-          if (chars_len > cur_field->max_len) {
-            cur_field->is_const = false;
-            cur_field->fieldlen_is_const = false;
-            cur_field->chars =
-              gt_realloc(cur_field->chars,
-                         (size_t) chars_len * sizeof (GtHashtable*));
-            for (k_idx = cur_field->max_len; k_idx < chars_len; k_idx++)
-              cur_field->chars[k_idx] = li_ull_gt_hashmap_new();
-
-            cur_field->max_len = chars_len;
-          }
-          else if (chars_len < cur_field->min_len) {
-            cur_field->is_const = false;
-            cur_field->fieldlen_is_const = false;
-            cur_field->min_len = chars_len;
-          }
-
-          for (k_idx = 0; k_idx < chars_len; k_idx++) {
-            (void) encdesc_hashmap_distr_add(
-                                      cur_field->chars[k_idx],
-                                      (GtWord) mutable_desc[start_pos + k_idx]);
-          }
-
-          if (cur_field->is_const) {
-            if (strcmp(cur_field->data, mutable_desc + start_pos) != 0)
-              cur_field->is_const = false;
-          }
-
-          if (cur_field->is_numeric) {
-            if (gt_parse_word(&out, (mutable_desc + start_pos)) != 0)
-              cur_field->is_numeric = false;
-            else {
-              value = out;
-
-              zero_count = count_leading_zeros((mutable_desc + start_pos));
-              if (zero_count > 0)
-                cur_field->has_zero_padding = true;
-              if (zero_count > cur_field->max_zero)
-                cur_field->max_zero = zero_count;
-              gt_disc_distri_add(cur_field->zero_count,
-                                 (GtUword) zero_count);
-
-              if (cur_desc == 0) {
-                cur_field->global_value =
-                  cur_field->min_value =
-                  cur_field->max_value = value;
-                cur_field->is_value_const =
-                  cur_field->is_delta_positive =
-                  cur_field->is_delta_negative = true;
-              }
-              else {
-                value_delta = value - cur_field->prev_value;
-                if (value_delta != 0) {
-                  cur_field->is_value_const = false;
-                  if (value < cur_field->min_value) {
-                    cur_field->min_value = value;
-                  }
-                  if (value > cur_field->max_value) {
-                    cur_field->max_value = value;
-                  }
-                }
-                if (value_delta <= 0)
-                  cur_field->is_delta_positive = false;
-                if (value_delta >= 0)
-                  cur_field->is_delta_negative = false;
-
-                if (cur_desc == 1UL) {
-                  cur_field->max_delta =
-                    cur_field->min_delta =
-                    cur_field->global_delta = value_delta;
-                  cur_field->is_delta_const = true;
-                }
-                else {
-                  if (value_delta > cur_field->max_delta) {
-                    cur_field->is_delta_const = false;
-                    cur_field->max_delta = value_delta;
-                  }
-                  if (value_delta < cur_field->min_delta) {
-                    cur_field->is_delta_const = false;
-                    cur_field->min_delta = value_delta;
-                  }
-                }
-                if (encdesc_hashmap_distr_add(cur_field->delta_values,
-                                              value_delta) == 1)
-                  cur_field->delta_values_size++;
-              }
-              if (encdesc_hashmap_distr_add(cur_field->num_values,
-                                            value) == 1)
-                cur_field->num_values_size++;
-              cur_field->prev_value = value;
-            }
-          }
-
-          /* unmark non constant positions */
-          if (!cur_field->is_const) {
-            for (k_idx = 0; k_idx < cur_field->len; k_idx++) {
-              if (k_idx < chars_len) {
-                if (cur_field->data[k_idx] != mutable_desc[k_idx + start_pos])
-                  gt_bittab_unset_bit(cur_field->bittab, k_idx);
-              }
-              else
-                gt_bittab_unset_bit(cur_field->bittab, k_idx);
-            }
-          }
-          start_pos = desc_char_idx + 1;
-          cur_field_num++;
-        }
-      }
-
-      gt_assert(desc_char_idx == desclength + 1);
-      gt_assert(cur_field_num <= longest_desc_field_idx);
-      if (cur_field_num != longest_desc_field_idx) {
-        gt_log_log(GT_WU "!= " GT_WU " less fields in desc: " GT_WU ": %s\t"
-                   GT_WU "!=" GT_WU,
-                   cur_field_num, longest_desc_field_idx,
-                   cur_desc, descbuffer,
-                   desc_char_idx, desclength);
-        encdesc->num_of_fields_is_const = false;
-      }
-
-      GT_STOREINARRAY(&encdesc->num_of_fields_tab, GtUword, 128 ,cur_field_num);
-
-      /* TODO DW this heuristic is bad, if the 2nd field is missing, all
-         following fields are missing too! */
-      /* change this so a field can be absent in a single description */
-      /* absent fields are non constant */
-      for (/* nothing */;
+  if (!had_err)
+    had_err = encdesc_batch_reset(batch, cstr_iterator, err);
+
+  /* analyze all descriptions */
+  while (!had_err &&
+         !(had_err = encdesc_batch_read(batch, cstr_iterator, err)) &&
+         batch->numofdescs > 0) {
+    GT_CHECKARRAYSPACEMULTI(&encdesc->num_of_fields_tab, GtUword,
+                            batch->numofdescs);
+    had_err = encdesc_batch_run(batch, ENCDESC_ANALYZE, err);
+    for (j_idx = 0; !had_err && j_idx < batch->numofjobs; j_idx++) {
+      EncdescJob *job = batch->jobs + j_idx;
+      GtUword part_numofdescs = job->to - job->from;
+
+      for (cur_field_num = 0;
            cur_field_num < encdesc->num_of_fields;
-           cur_field_num++) {
-        cur_field = &encdesc->fields[cur_field_num];
-        cur_field->is_const = false;
-        cur_field->fieldlen_is_const = false;
-        cur_field->is_numeric = false;
-      }
-      cur_desc++;
-      status = gt_cstr_iterator_next(cstr_iterator, &descbuffer, err);
+           cur_field_num++)
+        encdesc_field_merge(encdesc->fields + cur_field_num,
+                            job->fields + cur_field_num,
+                            cur_desc, part_numofdescs);
+      encdesc->total_num_of_chars += job->num_of_chars;
+      if (!job->num_of_fields_is_const)
+        encdesc->num_of_fields_is_const = false;
+      encdesc_fields_delete_partial(job->fields, encdesc->num_of_fields);
+      job->fields = NULL;
+      cur_desc += part_numofdescs;
     }
-    gt_free(mutable_desc);
-    mutable_desc = NULL;
+    encdesc->num_of_fields_tab.nextfreeGtUword += batch->numofdescs;
+  }
 
+  if (!had_err) {
     encdesc->num_of_descs = cur_desc;
     if (encdesc->num_of_fields_is_const) {
       GT_FREEARRAY(&encdesc->num_of_fields_tab, GtUword);
@@ -652,6 +1095,10 @@ static int encdesc_analyze_descs(GtEncdesc *encdesc,
         /* TODO DW range can be large, but the size of the dist is more
            important for huffman coding */
         GtWord value_range, delta_range, value_diff;
+        cur_field->num_values_size =
+          (GtUword) gt_hashtable_fill(cur_field->num_values);
+        cur_field->delta_values_size =
+          (GtUword) gt_hashtable_fill(cur_field->delta_values);
         value_range = labs(cur_field->max_value - cur_field->min_value);
         delta_range = labs(cur_field->max_delta - cur_field->min_delta);
         gt_log_log("value range: " GT_WD " delta range: " GT_WD, value_range,
@@ -694,96 +1141,141 @@ static int encdesc_analyze_descs(GtEncdesc *encdesc,
   return had_err;
 }
 
+/* prepares the codes of the descriptions of <job>, which are appended to the
+   codes of the preceding descriptions of <job>. The numeric fields are coded
+   relative to the values of the description preceding <job>. */
+static void encdesc_job_prepare(EncdescBatch *batch, EncdescJob *job)
+{
+  GtEncdesc *encdesc = batch->encdesc;
+  EncdescWriteInfo *info = &job->info;
+  const char *prevdesc;
+  GtUword descnum;
+
+  if (info->codes == NULL) {
+    info->codes = gt_malloc(sizeof (*info->codes));
+    GT_INITARRAY(info->codes, EncdescCode);
+    info->prev_values = gt_calloc((size_t) encdesc->num_of_fields,
+                                  sizeof (*info->prev_values));
+  }
+  prevdesc = job->from > 0
+               ? batch->chars + batch->descstarts[job->from - 1]
+               : batch->prevdesc;
+  if (prevdesc != NULL) {
+    /* only sets the previous values, the codes are discarded */
+    gt_free(info->descbuffer);
+    info->descbuffer = gt_cstr_dup(prevdesc);
+    info->sample = true;
+    info->cur_desc = batch->firstdesc + job->from - 1;
+    prepare_write_data_and_count_bits(encdesc, info);
+  }
+  info->codes->nextfreeEncdescCode = 0;
+  info->sample = false;
+  for (descnum = job->from; descnum < job->to; descnum++) {
+    gt_free(info->descbuffer);
+    info->descbuffer = gt_cstr_dup(batch->chars + batch->descstarts[descnum]);
+    info->cur_desc = batch->firstdesc + descnum;
+    prepare_write_data_and_count_bits(encdesc, info);
+    batch->descbits[descnum] = info->total_bits_prepared;
+    batch->codeends[descnum] = info->codes->nextfreeEncdescCode;
+  }
+}
+
+/* The codes of the descriptions of a batch are prepared by the jobs in
+   parallel, then the sampling is determined and the codes are written in the
+   order of the descriptions. */
 static int encdesc_write_encoding(GtEncdesc *encdesc,
                                   GtCstrIterator *cstr_iterator,
+                                  EncdescBatch *batch,
                                   FILE *fp, GtError *err)
 {
-  int had_err = 0, str_iter_ret;
-  const char *descbuffer;
+  int had_err = 0;
   GtUword desc_counter = 0,
           page_counter = 0,
-          idx = 0,
-          bits_left_in_page;
+          bits_left_in_page,
+          descnum,
+          j_idx;
   EncdescWriteInfo *info = gt_calloc((size_t) 1, sizeof (*info));
   GtBitOutStream *bitstream;
 
   bits_left_in_page = (GtUword) encdesc->pagesize * 8UL;
 
   info->codes = gt_malloc(sizeof (*info->codes));
-  info->cur_desc = 0;
+  info->prev_values = gt_calloc((size_t) encdesc->num_of_fields,
+                                sizeof (*info->prev_values));
   GT_INITARRAY(info->codes, EncdescCode);
 
   bitstream = gt_bitoutstream_new(fp);
 
-  had_err = gt_cstr_iterator_reset(cstr_iterator, err);
-  if (!had_err) {
+  had_err = encdesc_batch_reset(batch, cstr_iterator, err);
+  while (!had_err &&
+         !(had_err = encdesc_batch_read(batch, cstr_iterator, err)) &&
+         batch->numofdescs > 0) {
+    had_err = encdesc_batch_run(batch, ENCDESC_PREPARE, err);
+    for (j_idx = 0; !had_err && j_idx < batch->numofjobs; j_idx++) {
+      EncdescJob *job = batch->jobs + j_idx;
+      for (descnum = job->from; descnum < job->to; descnum++) {
+        const char *descbuffer = batch->chars + batch->descstarts[descnum];
+        EncdescCode *codes = job->info.codes->spaceEncdescCode;
+        GtUword idx,
+                codestart = descnum == job->from ? 0
+                                                 : batch->codeends[descnum - 1],
+                codeend = batch->codeends[descnum],
+                total_bits_prepared = batch->descbits[descnum];
+        bool sample = false;
+
+        info->cur_desc = batch->firstdesc + descnum;
+        /* check if a new sample has to be added */
+        if (encdesc->sampling != NULL) {
+          sample =
+            gt_sampling_is_next_element_sample(encdesc->sampling,
+                                               page_counter,
+                                               desc_counter,
+                                               total_bits_prepared,
+                                               bits_left_in_page);
+          if (sample) {
+            gt_log_log("sampling at description " GT_WU,
+                       info->cur_desc);
+            gt_free(info->descbuffer);
+            info->descbuffer = gt_cstr_dup(descbuffer);
+            /* sampled size and type of codes is different from unsampled */
+            info->sample = true;
+            info->codes->nextfreeEncdescCode = 0;
+            prepare_write_data_and_count_bits(encdesc, info);
+            codes = info->codes->spaceEncdescCode;
+            codestart = 0;
+            codeend = info->codes->nextfreeEncdescCode;
+            total_bits_prepared = info->total_bits_prepared;
+            gt_bitoutstream_flush_advance(bitstream);
+
+            gt_sampling_add_sample(encdesc->sampling,
+                                   (size_t) gt_bitoutstream_pos(bitstream),
+                                   info->cur_desc);
+
+            desc_counter = 0;
+            page_counter = 0;
+            bits_left_in_page = (GtUword) encdesc->pagesize * 8;
+          }
+        }
 
-    for (idx = 0; idx < encdesc->num_of_fields; idx++)
-      encdesc->fields[idx].prev_value = 0;
-
-    for (str_iter_ret = gt_cstr_iterator_next(cstr_iterator,
-                                              &descbuffer, err);
-         str_iter_ret > 0;
-         str_iter_ret = gt_cstr_iterator_next(cstr_iterator,
-                                              &descbuffer, err)) {
-      gt_free(info->descbuffer);
-      info->descbuffer = gt_cstr_dup(descbuffer);
-      info->sample = false;
-
-      /* count bits, needed for checking of sampling */
-      prepare_write_data_and_count_bits(encdesc,
-                                        info);
-
-      /* check if a new sample has to be added */
-      if (encdesc->sampling != NULL) {
-        info->sample =
-          gt_sampling_is_next_element_sample(encdesc->sampling,
-                                             page_counter,
-                                             desc_counter,
-                                             info->total_bits_prepared,
-                                             bits_left_in_page);
-        if (info->sample) {
-          gt_log_log("sampling at description " GT_WU,
-                     info->cur_desc);
-          /* retrieve the unmodified buffer, as the '\0' in the other one would
-             be complicated */
-          gt_free(info->descbuffer);
-          info->descbuffer = gt_cstr_dup(descbuffer);
-          /* sampled size and type of codes is different from unsampled */
-          info->codes->nextfreeEncdescCode = 0;
-          prepare_write_data_and_count_bits(encdesc,
-                                            info);
-          gt_bitoutstream_flush_advance(bitstream);
-
-          gt_sampling_add_sample(encdesc->sampling,
-                                 (size_t) gt_bitoutstream_pos(bitstream),
-                                 info->cur_desc);
-
-          desc_counter = 0;
-          page_counter = 0;
+        while (bits_left_in_page < total_bits_prepared) {
+          page_counter++;
+          total_bits_prepared -= bits_left_in_page;
           bits_left_in_page = (GtUword) encdesc->pagesize * 8;
         }
+        bits_left_in_page -= total_bits_prepared;
+        /* always set first page as written */
+        if (page_counter == 0)
+          page_counter++;
+        desc_counter++;
+
+        for (idx = codestart; idx < codeend; idx++)
+          gt_bitoutstream_append(bitstream, codes[idx].code,
+                                 codes[idx].length);
       }
-
-      while (bits_left_in_page < info->total_bits_prepared) {
-        page_counter++;
-        info->total_bits_prepared -= bits_left_in_page;
-        bits_left_in_page = (GtUword) encdesc->pagesize * 8;
-      }
-      bits_left_in_page -= info->total_bits_prepared;
-      /* always set first page as written */
-      if (page_counter == 0)
-        page_counter++;
-      desc_counter++;
-      info->cur_desc++;
-
-      append_data_to_bitstream_and_reset_info(info, bitstream);
-    }
-    if (str_iter_ret != 0) {
-      had_err = str_iter_ret;
-      gt_assert(gt_error_is_set(err));
     }
   }
+  if (had_err)
+    gt_assert(gt_error_is_set(err));
 
   if (!had_err) {
     gt_bitoutstream_flush(bitstream);
@@ -796,6 +1288,7 @@ static int encdesc_write_encoding(GtEncdesc *encdesc,
   GT_FREEARRAY(info->codes, EncdescCode);
   gt_free(info->codes);
   gt_free(info->descbuffer);
+  gt_free(info->prev_values);
   gt_free(info);
   return had_err;
 }
@@ -999,6 +1492,7 @@ int gt_encdesc_encoder_encode(GtEncdescEncoder *ee,
   GtWord sampling_start_safe_pos = 0;
   const GtUword dummy = 0;
   GtUword pagesize;
+  EncdescBatch *batch;
 
   gt_assert(ee != NULL);
   gt_assert(cstr_iterator != NULL);
@@ -1007,7 +1501,8 @@ int gt_encdesc_encoder_encode(GtEncdescEncoder *ee,
   if (ee->timer != NULL) {
     gt_timer_show_progress(ee->timer, "analyze descriptions", stdout);
   }
-  had_err = encdesc_analyze_descs(ee->encdesc, cstr_iterator, err);
+  batch = encdesc_batch_new(ee->encdesc);
+  had_err = encdesc_analyze_descs(ee->encdesc, cstr_iterator, batch, err);
 
   if (!had_err) {
     if (ee->timer != NULL) {
@@ -1053,8 +1548,10 @@ int gt_encdesc_encoder_encode(GtEncdescEncoder *ee,
       ee->encdesc->sampling =
         gt_sampling_new_regular(ee->sampling_rate,
                                 (off_t) ee->encdesc->start_of_encoding);
-    had_err = encdesc_write_encoding(ee->encdesc, cstr_iterator, fp, err);
+    had_err = encdesc_write_encoding(ee->encdesc, cstr_iterator, batch, fp,
+                                     err);
   }
+  encdesc_batch_delete(batch);
   if (!had_err) {
     if (ee->encdesc->sampling != NULL) {
       gt_xfseek(fp, sampling_start_safe_pos, SEEK_SET);
@@ -1209,8 +1706,14 @@ static int encdesc_next_desc(GtEncdesc *encdesc, GtStr *desc, GtError *err)
     return -1;
   }
 
-  if (encdesc->sampling != NULL &&
-      encdesc->cur_desc == gt_sampling_get_next_elementnum(encdesc->sampling)) {
+  if (encdesc->at_sample) {
+    /* the decoder was reset to the sample of this description */
+    encdesc->at_sample = false;
+    sampled = true;
+  }
+  else if (encdesc->sampling != NULL &&
+           encdesc->cur_desc ==
+             gt_sampling_get_next_elementnum(encdesc->sampling)) {
     int sample_status;
     size_t startofnearestsample;
     gt_log_log("get next sampled description (" GT_WU ")", encdesc->cur_desc);
@@ -1450,6 +1953,7 @@ int gt_encdesc_decode(GtEncdesc *encdesc,
       gt_bitinstream_reinit(encdesc->bitinstream,
                             startofnearestsample);
       encdesc->cur_desc = nearestsample;
+      encdesc->at_sample = true;
       descs2read = num - nearestsample;
     }
   }
@@ -60,8 +60,10 @@ GtUword           gt_encdesc_encoder_get_sampling_rate(
                                                     const GtEncdescEncoder *ee);
 
 /* Uses the settings in <ee> to encode the strings provided by <cstr_iterator>
-   and writes them to a file with prefix <name>. Returns 0 on success, otherwise
-   <err> is set accordingly. */
+   and writes them to a file with prefix <name>. The strings are analyzed and
+   encoded by <gt_jobs> many threads, the encoding does not depend on the
+   number of threads. Returns 0 on success, otherwise <err> is set
+   accordingly. */
 int               gt_encdesc_encoder_encode(GtEncdescEncoder *ee,
                                             GtCstrIterator *cstr_iterator,
                                             const char *name,
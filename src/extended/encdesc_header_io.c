@@ -283,9 +283,11 @@ static inline GtHashtable *write_hashmap_distri(GtHashtable *h_table,
 {
   int had_err = 0;
   data->written_elems = 0;
-  had_err = li_ull_gt_hashmap_foreach(h_table,
-                                      encdesc_li_ull_hashmap_iter_write,
-                                      data, err);
+  /* the layout of the hashmap depends on the order of insertion, which
+     depends on the number of threads used for the analysis */
+  had_err = li_ull_gt_hashmap_foreach_in_default_order(h_table,
+                                             encdesc_li_ull_hashmap_iter_write,
+                                             data, err);
   if (!had_err && data->written_elems != size)
     gt_log_log(GT_WU " != " GT_WU, size, data->written_elems);
   if (!had_err)
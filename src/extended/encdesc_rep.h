@@ -95,7 +95,8 @@ struct GtEncdesc {
   GtWord          start_of_samplingtab,
                   start_of_encoding;
   unsigned int    bits_per_field;
-  bool            num_of_fields_is_const;
+  bool            at_sample,
+                  num_of_fields_is_const;
 };
 
 struct GtEncdescEncoder {
@@ -113,9 +114,12 @@ typedef struct {
 
 GT_DECLAREARRAYSTRUCT(EncdescCode);
 
+/* the values of the numeric fields of the previous description are kept in
+   <prev_values>, so that descriptions can be prepared by several threads */
 typedef struct {
   GtArrayEncdescCode *codes;
   char               *descbuffer;
+  GtWord             *prev_values;
   GtUword             total_bits_prepared,
                       bits_to_write,
                       cur_field_start_pos,
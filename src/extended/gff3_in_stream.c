@@ -155,6 +155,12 @@ void gt_gff3_in_stream_fix_region_boundaries(GtGFF3InStream *is)
              gt_tidy_region_node_stream_new(is->last_stream);
 }
 
+void gt_gff3_in_stream_enable_two_pass_mode(GtGFF3InStream *is)
+{
+  gt_assert(is);
+  gt_gff3_in_stream_plain_enable_two_pass_mode(is->gff3_in_stream_plain);
+}
+
 GtNodeStream* gt_gff3_in_stream_new_unsorted(int num_of_files,
                                              const char **filenames)
 {
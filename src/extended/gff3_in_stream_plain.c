@@ -37,7 +37,8 @@ struct GtGFF3InStreamPlain {
        stdin_argument,
        stdin_processed,
        file_is_open,
-       progress_bar;
+       progress_bar,
+       two_pass;
   GtFile *fpin;
   GtUint64 line_number;
   GtQueue *genome_node_buffer;
@@ -108,6 +109,14 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
           is->stdin_argument = true;
         }
         else {
+          if (is->two_pass) {
+            had_err = gt_gff3_parser_index_trees(is->gff3_parser,
+                                                 gt_str_array_get(is->files,
+                                                                is->next_file),
+                                                 err);
+            if (had_err)
+              break;
+          }
           is->fpin = gt_file_xopen(gt_str_array_get(is->files,
                                                        is->next_file), "r");
           is->file_is_open = true;
@@ -305,6 +314,13 @@ void gt_gff3_in_stream_plain_enable_strict_mode(GtNodeStream *ns)
   gt_gff3_parser_enable_strict_mode(is->gff3_parser);
 }
 
+void gt_gff3_in_stream_plain_enable_two_pass_mode(GtNodeStream *ns)
+{
+  GtGFF3InStreamPlain *is = gff3_in_stream_plain_cast(ns);
+  gt_assert(is);
+  is->two_pass = true;
+}
+
 void gt_gff3_in_stream_plain_enable_tidy_mode(GtNodeStream *ns)
 {
   GtGFF3InStreamPlain *is = gff3_in_stream_plain_cast(ns);
@@ -19,7 +19,7 @@
 #include "core/cstr_table.h"
 #include "extended/genome_node.h"
 #include "extended/gff3_out_stream_api.h"
-#include "extended/gff3_visitor_api.h"
+#include "extended/gff3_visitor.h"
 #include "extended/node_stream_api.h"
 
 struct GtGFF3OutStream {
@@ -41,6 +41,10 @@ static int gff3_out_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
   had_err = gt_node_stream_next(gff3_out_stream->in_stream, gn, err);
   if (!had_err && *gn)
     had_err = gt_genome_node_accept(*gn, gff3_out_stream->gff3_visitor, err);
+  /* make sure the output is complete once the stream is exhausted */
+  if (had_err || !*gn) {
+    gt_gff3_visitor_flush((GtGFF3Visitor*) gff3_out_stream->gff3_visitor);
+  }
   return had_err;
 }
 
@@ -71,6 +75,13 @@ GtNodeStream* gt_gff3_out_stream_new(GtNodeStream *in_stream, GtFile *outfp)
   GtGFF3OutStream *gff3_out_stream = gff3_out_stream_cast(ns);
   gff3_out_stream->in_stream = gt_node_stream_ref(in_stream);
   gff3_out_stream->gff3_visitor = gt_gff3_visitor_new(outfp);
+  /* other output to stdout may be interleaved with the nodes, so only output
+     to a file of its own is written in large blocks */
+  if (outfp != NULL) {
+    gt_gff3_visitor_set_blocksize((GtGFF3Visitor*)
+                                  gff3_out_stream->gff3_visitor,
+                                  GT_GFF3_VISITOR_BLOCKSIZE);
+  }
   return ns;
 }
 
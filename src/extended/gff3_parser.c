@@ -67,6 +67,9 @@ struct GtGFF3Parser {
   GtTypeChecker *type_checker;
   GtXRFChecker *xrf_checker;
   unsigned int last_terminator; /* line number of the last terminator */
+  GtArray *tree_ends; /* lines after which all feature trees are complete, only
+                         used in two-pass mode */
+  GtUword next_tree_end;
 };
 
 typedef struct {
@@ -179,6 +182,164 @@ void gt_gff3_parser_enable_tidy_mode(GtGFF3Parser *parser)
   parser->tidy = true;
 }
 
+/* union-find on the feature lines of a file, lines are joined if they share
+   an ID or refer to it as a parent */
+static GtUword tree_index_find(GtUword *parents, GtUword i)
+{
+  while (parents[i] != i) {
+    parents[i] = parents[parents[i]];
+    i = parents[i];
+  }
+  return i;
+}
+
+static void tree_index_join(GtUword *parents, GtUint64 *last_lines, GtUword a,
+                            GtUword b)
+{
+  a = tree_index_find(parents, a);
+  b = tree_index_find(parents, b);
+  if (a == b)
+    return;
+  if (a > b) {
+    GtUword tmp = a;
+    a = b;
+    b = tmp;
+  }
+  parents[b] = a;
+  if (last_lines[b] > last_lines[a])
+    last_lines[a] = last_lines[b];
+}
+
+static void tree_index_add_id(GtHashmap *ids, const char *id, GtUword *parents,
+                              GtUint64 *last_lines, GtUword linenum)
+{
+  GtUword *other = gt_hashmap_get(ids, id);
+  if (other)
+    tree_index_join(parents, last_lines, *other, linenum);
+  else {
+    other = gt_malloc(sizeof *other);
+    *other = linenum;
+    gt_hashmap_add(ids, gt_cstr_dup(id), other);
+  }
+}
+
+int gt_gff3_parser_index_trees(GtGFF3Parser *parser, const char *filename,
+                               GtError *err)
+{
+  GtSplitter *columns, *attributes, *tag_value, *values;
+  GtHashmap *ids;
+  GtStr *line;
+  GtFile *fpin;
+  GtUint64 line_number = 0, reach = 0, *line_numbers = NULL,
+           *last_lines = NULL;
+  GtUword *parents = NULL, num_of_lines = 0, allocated = 0, i, j, k;
+  gt_error_check(err);
+  gt_assert(parser && filename);
+
+  if (!(fpin = gt_file_new(filename, "r", err)))
+    return -1;
+  line = gt_str_new();
+  columns = gt_splitter_new();
+  attributes = gt_splitter_new();
+  tag_value = gt_splitter_new();
+  values = gt_splitter_new();
+  ids = gt_hashmap_new(GT_HASH_STRING, gt_free_func, gt_free_func);
+
+  /* only the ID and Parent attributes of the feature lines are considered */
+  while (gt_str_read_next_line_generic(line, fpin) != EOF) {
+    char *cline = gt_str_get(line);
+    line_number++;
+    if (cline[0] == '>' || strncmp(cline, GT_GFF_FASTA_DIRECTIVE,
+                                   strlen(GT_GFF_FASTA_DIRECTIVE)) == 0) {
+      break;
+    }
+    gt_splitter_reset(columns);
+    if (cline[0] != '#')
+      gt_splitter_split(columns, cline, gt_str_length(line), '\t');
+    if (gt_splitter_size(columns) == 9UL) {
+      if (num_of_lines == allocated) {
+        allocated = allocated * 2 + 1024;
+        line_numbers = gt_realloc(line_numbers,
+                                  sizeof *line_numbers * allocated);
+        last_lines = gt_realloc(last_lines, sizeof *last_lines * allocated);
+        parents = gt_realloc(parents, sizeof *parents * allocated);
+      }
+      line_numbers[num_of_lines] = last_lines[num_of_lines] = line_number;
+      parents[num_of_lines] = num_of_lines;
+      gt_splitter_reset(attributes);
+      gt_splitter_split(attributes, gt_splitter_get_token(columns, 8),
+                        strlen(gt_splitter_get_token(columns, 8)), ';');
+      for (i = 0; i < gt_splitter_size(attributes); i++) {
+        char *tag, *token = gt_splitter_get_token(attributes, i);
+        gt_splitter_reset(tag_value);
+        gt_splitter_split(tag_value, token, strlen(token), '=');
+        if (gt_splitter_size(tag_value) != 2UL)
+          continue;
+        tag = gt_splitter_get_token(tag_value, 0);
+        while (tag[0] == ' ')
+          tag++;
+        if (strcmp(tag, GT_GFF_ID) == 0) {
+          tree_index_add_id(ids, gt_splitter_get_token(tag_value, 1), parents,
+                            last_lines, num_of_lines);
+        }
+        else if (strcmp(tag, GT_GFF_PARENT) == 0) {
+          char *parent_attr = gt_splitter_get_token(tag_value, 1);
+          gt_splitter_reset(values);
+          gt_splitter_split(values, parent_attr, strlen(parent_attr), ',');
+          for (j = 0; j < gt_splitter_size(values); j++) {
+            tree_index_add_id(ids, gt_splitter_get_token(values, j), parents,
+                              last_lines, num_of_lines);
+          }
+        }
+      }
+      num_of_lines++;
+    }
+    gt_str_reset(line);
+  }
+
+  /* a tree ends at line <l> if no tree started before <l> ends after it */
+  if (!parser->tree_ends)
+    parser->tree_ends = gt_array_new(sizeof (GtUint64));
+  gt_array_reset(parser->tree_ends);
+  parser->next_tree_end = 0;
+  for (k = 0; k < num_of_lines; k++) {
+    GtUint64 last = last_lines[tree_index_find(parents, k)];
+    if (last > reach)
+      reach = last;
+    if (reach == line_numbers[k])
+      gt_array_add(parser->tree_ends, line_numbers[k]);
+  }
+
+  gt_hashmap_delete(ids);
+  gt_splitter_delete(values);
+  gt_splitter_delete(tag_value);
+  gt_splitter_delete(attributes);
+  gt_splitter_delete(columns);
+  gt_str_delete(line);
+  gt_free(parents);
+  gt_free(last_lines);
+  gt_free(line_numbers);
+  gt_file_delete(fpin);
+  return 0;
+}
+
+static bool gff3_parser_is_tree_end(GtGFF3Parser *parser,
+                                    GtUint64 line_number)
+{
+  GtUint64 *tree_end;
+  if (!parser->tree_ends)
+    return false;
+  while (parser->next_tree_end < gt_array_size(parser->tree_ends)) {
+    tree_end = gt_array_get(parser->tree_ends, parser->next_tree_end);
+    if (*tree_end > line_number)
+      break;
+    parser->next_tree_end++;
+    if (*tree_end == line_number)
+      return true;
+  }
+  return false;
+}
+
 static int offset_possible(const GtRange *range, GtWord offset,
                            const char *filename, unsigned int line_number,
                            GtError *err)
@@ -1804,6 +1965,23 @@ static int process_orphans(GtOrphanage *orphanage, GtFeatureInfo *feature_info,
   return had_err;
 }
 
+/* called if all nodes parsed so far are complete */
+static int process_complete_nodes(GtGFF3Parser *parser, GtQueue *genome_nodes,
+                                  GtError *err)
+{
+  int had_err = 0;
+  gt_error_check(err);
+  if (!parser->strict) {
+    had_err = process_orphans(parser->orphanage, parser->feature_info,
+                              parser->strict, parser->last_terminator,
+                              parser->type_checker, genome_nodes, err);
+  }
+  parser->incomplete_node = false;
+  if (!parser->checkids)
+    gt_feature_info_reset(parser->feature_info);
+  return had_err;
+}
+
 static bool invalid_gvf_pragma(const char *line)
 {
   return (strncmp(line, GT_GVF_REFERENCE_FASTA, strlen(GT_GVF_REFERENCE_FASTA))
@@ -2008,15 +2186,7 @@ static int parse_meta_gff3_line(GtGFF3Parser *parser, GtQueue *genome_nodes,
       gt_warning("superfluous information after terminator in line %u of file "
                  "\"%s\": %s", line_number, filename, line);
     }
-    /* now all nodes are complete */
-    if (!parser->strict) {
-      had_err = process_orphans(parser->orphanage, parser->feature_info,
-                                parser->strict, parser->last_terminator,
-                                parser->type_checker, genome_nodes, err);
-    }
-    parser->incomplete_node = false;
-    if (!parser->checkids)
-      gt_feature_info_reset(parser->feature_info);
+    had_err = process_complete_nodes(parser, genome_nodes, err);
     parser->last_terminator = line_number;
   }
   else if (strncmp(line, GT_GFF_VERSION_PREFIX,
@@ -2163,6 +2333,9 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
       had_err = parse_gff3_feature_line(parser, genome_nodes, used_types, line,
                                         line_length, filenamestr, *line_number,
                                         err);
+      /* in two-pass mode, the end of a tree acts like a terminator */
+      if (!had_err && gff3_parser_is_tree_end(parser, *line_number))
+        had_err = process_complete_nodes(parser, genome_nodes, err);
       if (had_err || (!parser->incomplete_node && gt_queue_size(genome_nodes)))
         break;
     }
@@ -2213,6 +2386,8 @@ void gt_gff3_parser_reset(GtGFF3Parser *parser)
   gt_hashmap_reset(parser->source_to_str_mapping);
   gt_orphanage_reset(parser->orphanage);
   parser->last_terminator = 0;
+  gt_array_delete(parser->tree_ends);
+  parser->tree_ends = NULL;
 }
 
 void gt_gff3_parser_delete(GtGFF3Parser *parser)
@@ -2225,5 +2400,6 @@ void gt_gff3_parser_delete(GtGFF3Parser *parser)
   gt_orphanage_delete(parser->orphanage);
   gt_type_checker_delete(parser->type_checker);
   gt_xrf_checker_delete(parser->xrf_checker);
+  gt_array_delete(parser->tree_ends);
   gt_free(parser);
 }
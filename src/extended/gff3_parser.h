@@ -36,6 +36,14 @@ int  gt_gff3_parser_parse_all_target_attributes(const char *values, bool tidy,
                                                 const char *filename,
                                                 unsigned int line_number,
                                                 GtError *err);
+/* Scan the GFF3 file <filename> in advance and record the lines after which
+   all feature trees are complete (determined from the ID and Parent
+   attributes). When <filename> is parsed afterwards with <parser>, these lines
+   are treated like ### terminators, so that complete trees are emitted early
+   even in unsorted files. The recorded lines are discarded by
+   gt_gff3_parser_reset(). */
+int  gt_gff3_parser_index_trees(GtGFF3Parser *parser, const char *filename,
+                                GtError *err);
 void gt_gff3_parser_build_target_str(GtStr *target, GtStrArray *target_ids,
                                      GtArray *target_ranges,
                                      GtArray *target_strands);
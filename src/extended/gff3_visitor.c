@@ -46,6 +46,8 @@ struct GtGFF3Visitor {
   GtUword fasta_width;
   GtFile *outfp;
   GtStr *outstr;
+  bool outstr_is_buffer;
+  GtUword blocksize;
   GtCstrTable *used_ids;
 };
 
@@ -56,27 +58,36 @@ typedef struct {
 
 typedef struct {
   bool *attribute_shown;
-  GtFile *outfp;
   GtStr *outstr;
 } ShowAttributeInfo;
 
 #define gff3_visitor_cast(GV)\
         gt_node_visitor_cast(gt_gff3_visitor_class(), GV)
 
+/* All output is formatted into <outstr>. If the visitor writes to a <GtFile>,
+   <outstr> is an internal buffer which is written out in a single block as
+   soon as it holds at least <blocksize> bytes (or if <force> is set). */
+static void gff3_visitor_flush_buffer(GtGFF3Visitor *gff3_visitor, bool force)
+{
+  gt_assert(gff3_visitor);
+  if (gff3_visitor->outstr_is_buffer && gt_str_length(gff3_visitor->outstr) &&
+      (force || gt_str_length(gff3_visitor->outstr) >=
+                gff3_visitor->blocksize)) {
+    gt_file_xwrite(gff3_visitor->outfp, gt_str_get_mem(gff3_visitor->outstr),
+                   gt_str_length(gff3_visitor->outstr));
+    gt_str_reset(gff3_visitor->outstr);
+  }
+}
+
 static void gff3_version_string(GtNodeVisitor *nv)
 {
   GtGFF3Visitor *gff3_visitor = gff3_visitor_cast(nv);
   gt_assert(gff3_visitor);
   if (!gff3_visitor->version_string_shown) {
-    if (!gff3_visitor->outstr) {
-      gt_file_xprintf(gff3_visitor->outfp, "%s %u\n", GT_GFF_VERSION_PREFIX,
-                      GT_GFF_VERSION);
-    } else {
-      gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_VERSION_PREFIX);
-      gt_str_append_cstr(gff3_visitor->outstr, " ");
-      gt_str_append_uint(gff3_visitor->outstr, GT_GFF_VERSION);
-      gt_str_append_char(gff3_visitor->outstr, '\n');
-    }
+    gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_VERSION_PREFIX);
+    gt_str_append_char(gff3_visitor->outstr, ' ');
+    gt_str_append_uword(gff3_visitor->outstr, GT_GFF_VERSION);
+    gt_str_append_char(gff3_visitor->outstr, '\n');
     gff3_visitor->version_string_shown = true;
   }
 }
@@ -89,6 +100,7 @@ static void gff3_visitor_free(GtNodeVisitor *nv)
   gt_hashmap_delete(gff3_visitor->feature_node_to_id_array);
   gt_hashmap_delete(gff3_visitor->feature_node_to_unique_id_str);
   gt_cstr_table_delete(gff3_visitor->used_ids);
+  gff3_visitor_flush_buffer(gff3_visitor, true);
   gt_str_delete(gff3_visitor->outstr);
   gt_file_delete(gff3_visitor->outfp);
 }
@@ -101,14 +113,10 @@ static int gff3_visitor_comment_node(GtNodeVisitor *nv, GtCommentNode *cn,
   gff3_visitor = gff3_visitor_cast(nv);
   gt_assert(nv && cn);
   gff3_version_string(nv);
-  if (!gff3_visitor->outstr) {
-    gt_file_xprintf(gff3_visitor->outfp, "#%s\n",
-                    gt_comment_node_get_comment(cn));
-  } else  {
-    gt_str_append_char(gff3_visitor->outstr, '#');
-    gt_str_append_cstr(gff3_visitor->outstr, gt_comment_node_get_comment(cn));
-    gt_str_append_char(gff3_visitor->outstr, '\n');
-  }
+  gt_str_append_char(gff3_visitor->outstr, '#');
+  gt_str_append_cstr(gff3_visitor->outstr, gt_comment_node_get_comment(cn));
+  gt_str_append_char(gff3_visitor->outstr, '\n');
+  gff3_visitor_flush_buffer(gff3_visitor, false);
   return 0;
 }
 
@@ -133,20 +141,13 @@ static void show_attribute(const char *attr_name, const char *attr_value,
   ShowAttributeInfo *info = (ShowAttributeInfo*) data;
   gt_assert(attr_name && attr_value && info);
   if (strcmp(attr_name, GT_GFF_ID) && strcmp(attr_name, GT_GFF_PARENT)) {
-    if (*info->attribute_shown) {
-      if (!info->outstr)
-        gt_file_xfputc(';', info->outfp);
-      else
-        gt_str_append_char(info->outstr, ';');
-    } else
+    if (*info->attribute_shown)
+      gt_str_append_char(info->outstr, ';');
+    else
       *info->attribute_shown = true;
-    if (!info->outstr)
-      gt_file_xprintf(info->outfp, "%s=%s", attr_name, attr_value);
-    else {
-      gt_str_append_cstr(info->outstr, attr_name);
-      gt_str_append_char(info->outstr, '=');
-      gt_str_append_cstr(info->outstr, attr_value);
-    }
+    gt_str_append_cstr(info->outstr, attr_name);
+    gt_str_append_char(info->outstr, '=');
+    gt_str_append_cstr(info->outstr, attr_value);
   }
 }
 
@@ -164,76 +165,43 @@ static int gff3_show_feature_node(GtFeatureNode *fn, void *data,
   gt_assert(fn && gff3_visitor);
 
   /* output leading part */
-  if (!gff3_visitor->outstr) {
-    gt_gff3_output_leading(fn, gff3_visitor->outfp);
-  } else {
-    gt_gff3_output_leading_str(fn, gff3_visitor->outstr);
-  }
+  gt_gff3_output_leading_str(fn, gff3_visitor->outstr);
 
   /* show unique id part of attributes */
   if ((id = gt_hashmap_get(gff3_visitor->feature_node_to_unique_id_str, fn))) {
-    if (!gff3_visitor->outstr)
-      gt_file_xprintf(gff3_visitor->outfp, "%s=%s", GT_GFF_ID, gt_str_get(id));
-    else {
-      gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_ID);
-      gt_str_append_char(gff3_visitor->outstr, '=');
-      gt_str_append_cstr(gff3_visitor->outstr, gt_str_get(id));
-    }
+    gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_ID);
+    gt_str_append_char(gff3_visitor->outstr, '=');
+    gt_str_append_str(gff3_visitor->outstr, id);
     part_shown = true;
   }
 
   /* show parent part of attributes */
   parent_features = gt_hashmap_get(gff3_visitor->feature_node_to_id_array, fn);
   if (gt_array_size(parent_features)) {
-    if (part_shown) {
-      if (!gff3_visitor->outstr)
-        gt_file_xfputc(';', gff3_visitor->outfp);
-      else
-        gt_str_append_char(gff3_visitor->outstr, ';');
-    }
-    if (!gff3_visitor->outstr)
-      gt_file_xprintf(gff3_visitor->outfp, "%s=", GT_GFF_PARENT);
-    else {
-      gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_PARENT);
-      gt_str_append_char(gff3_visitor->outstr, '=');
-    }
+    if (part_shown)
+      gt_str_append_char(gff3_visitor->outstr, ';');
+    gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_PARENT);
+    gt_str_append_char(gff3_visitor->outstr, '=');
     for (i = 0; i < gt_array_size(parent_features); i++) {
-      if (i) {
-        if (!gff3_visitor->outstr)
-          gt_file_xfputc(',', gff3_visitor->outfp);
-        else
-          gt_str_append_char(gff3_visitor->outstr, ',');
-      }
-      if (!gff3_visitor->outstr) {
-        gt_file_xprintf(gff3_visitor->outfp, "%s",
-                        *(char**) gt_array_get(parent_features, i));
-      } else {
-        gt_str_append_cstr(gff3_visitor->outstr,
-                           *(char**) gt_array_get(parent_features, i));
-      }
+      if (i)
+        gt_str_append_char(gff3_visitor->outstr, ',');
+      gt_str_append_cstr(gff3_visitor->outstr,
+                         *(char**) gt_array_get(parent_features, i));
     }
     part_shown = true;
   }
 
   /* show missing part of attributes */
   info.attribute_shown = &part_shown;
-  info.outfp = gff3_visitor->outfp;
   info.outstr = gff3_visitor->outstr;
   gt_feature_node_foreach_attribute(fn, show_attribute, &info);
 
   /* show dot if no attributes have been shown */
-  if (!part_shown) {
-    if (!gff3_visitor->outstr)
-      gt_file_xfputc('.', gff3_visitor->outfp);
-    else
-      gt_str_append_char(gff3_visitor->outstr, '.');
-  }
+  if (!part_shown)
+    gt_str_append_char(gff3_visitor->outstr, '.');
 
   /* show terminal newline */
-  if (!gff3_visitor->outstr)
-    gt_file_xfputc('\n', gff3_visitor->outfp);
-  else
-    gt_str_append_char(gff3_visitor->outstr, '\n');
+  gt_str_append_char(gff3_visitor->outstr, '\n');
 
   return 0;
 }
@@ -381,13 +349,10 @@ static int gff3_visitor_feature_node(GtNodeVisitor *nv, GtFeatureNode *fn,
      the feature is complete, because no ID attribute has been shown) */
   if (gt_feature_node_has_children(fn) ||
       (gff3_visitor->retain_ids && gt_feature_node_get_attribute(fn, "ID"))) {
-    if (!gff3_visitor->outstr)
-      gt_file_xprintf(gff3_visitor->outfp, "%s\n", GT_GFF_TERMINATOR);
-    else {
-      gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_TERMINATOR);
-      gt_str_append_char(gff3_visitor->outstr, '\n');
-    }
+    gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_TERMINATOR);
+    gt_str_append_char(gff3_visitor->outstr, '\n');
   }
+  gff3_visitor_flush_buffer(gff3_visitor, false);
 
   return had_err;
 }
@@ -411,23 +376,14 @@ static int gff3_visitor_meta_node(GtNodeVisitor *nv, GtMetaNode *mn,
     }
   }
   data = gt_meta_node_get_data(mn);
-  if (!gff3_visitor->outstr) {
-    if (data) {
-      gt_file_xprintf(gff3_visitor->outfp, "##%s %s\n",
-                      gt_meta_node_get_directive(mn), data);
-    } else {
-      gt_file_xprintf(gff3_visitor->outfp, "##%s\n",
-                      gt_meta_node_get_directive(mn));
-    }
-  } else {
-    gt_str_append_cstr(gff3_visitor->outstr, "##");
-    gt_str_append_cstr(gff3_visitor->outstr, gt_meta_node_get_directive(mn));
-    if (data) {
-      gt_str_append_char(gff3_visitor->outstr, ' ');
-      gt_str_append_cstr(gff3_visitor->outstr, data);
-    }
-    gt_str_append_char(gff3_visitor->outstr, '\n');
+  gt_str_append_cstr(gff3_visitor->outstr, "##");
+  gt_str_append_cstr(gff3_visitor->outstr, gt_meta_node_get_directive(mn));
+  if (data) {
+    gt_str_append_char(gff3_visitor->outstr, ' ');
+    gt_str_append_cstr(gff3_visitor->outstr, data);
   }
+  gt_str_append_char(gff3_visitor->outstr, '\n');
+  gff3_visitor_flush_buffer(gff3_visitor, false);
   return 0;
 }
 
@@ -439,25 +395,18 @@ static int gff3_visitor_region_node(GtNodeVisitor *nv, GtRegionNode *rn,
   gff3_visitor = gff3_visitor_cast(nv);
   gt_assert(nv && rn);
   gff3_version_string(nv);
-  if (!gff3_visitor->outstr) {
-    gt_file_xprintf(gff3_visitor->outfp, "%s   %s "GT_WU" "GT_WU"\n",
-                    GT_GFF_SEQUENCE_REGION,
-                    gt_str_get(gt_genome_node_get_seqid((GtGenomeNode*) rn)),
-                    gt_genome_node_get_start((GtGenomeNode*) rn),
-                    gt_genome_node_get_end((GtGenomeNode*) rn));
-  } else {
-    gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_SEQUENCE_REGION);
-    gt_str_append_cstr(gff3_visitor->outstr, "   ");
-    gt_str_append_cstr(gff3_visitor->outstr,
-                      gt_str_get(gt_genome_node_get_seqid((GtGenomeNode*) rn)));
-    gt_str_append_char(gff3_visitor->outstr, ' ');
-    gt_str_append_uword(gff3_visitor->outstr,
-                                  gt_genome_node_get_start((GtGenomeNode*) rn));
-    gt_str_append_char(gff3_visitor->outstr, ' ');
-    gt_str_append_uword(gff3_visitor->outstr,
-                                  gt_genome_node_get_end((GtGenomeNode*) rn));
-    gt_str_append_char(gff3_visitor->outstr, '\n');
-  }
+  gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_SEQUENCE_REGION);
+  gt_str_append_cstr(gff3_visitor->outstr, "   ");
+  gt_str_append_str(gff3_visitor->outstr,
+                    gt_genome_node_get_seqid((GtGenomeNode*) rn));
+  gt_str_append_char(gff3_visitor->outstr, ' ');
+  gt_str_append_uword(gff3_visitor->outstr,
+                      gt_genome_node_get_start((GtGenomeNode*) rn));
+  gt_str_append_char(gff3_visitor->outstr, ' ');
+  gt_str_append_uword(gff3_visitor->outstr,
+                      gt_genome_node_get_end((GtGenomeNode*) rn));
+  gt_str_append_char(gff3_visitor->outstr, '\n');
+  gff3_visitor_flush_buffer(gff3_visitor, false);
   return 0;
 }
 
@@ -470,15 +419,13 @@ static int gff3_visitor_sequence_node(GtNodeVisitor *nv, GtSequenceNode *sn,
   gt_assert(nv && sn);
   gff3_version_string(nv);
   if (!gff3_visitor->fasta_directive_shown) {
-    if (!gff3_visitor->outstr)
-      gt_file_xprintf(gff3_visitor->outfp, "%s\n", GT_GFF_FASTA_DIRECTIVE);
-    else {
-      gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_FASTA_DIRECTIVE);
-      gt_str_append_char(gff3_visitor->outstr, '\n');
-    }
+    gt_str_append_cstr(gff3_visitor->outstr, GT_GFF_FASTA_DIRECTIVE);
+    gt_str_append_char(gff3_visitor->outstr, '\n');
     gff3_visitor->fasta_directive_shown = true;
   }
-  if (!gff3_visitor->outstr) {
+  if (gff3_visitor->outstr_is_buffer) {
+    /* sequences can be large, do not copy them into the buffer */
+    gff3_visitor_flush_buffer(gff3_visitor, true);
     gt_fasta_show_entry(gt_sequence_node_get_description(sn),
                         gt_sequence_node_get_sequence(sn),
                         gt_sequence_node_get_sequence_length(sn),
@@ -498,6 +445,7 @@ static int gff3_visitor_eof_node(GtNodeVisitor *nv, GT_UNUSED GtEOFNode *en,
   gt_error_check(err);
   gt_assert(nv && en);
   gff3_version_string(nv);
+  gff3_visitor_flush_buffer(gff3_visitor_cast(nv), true);
   return 0;
 }
 
@@ -531,6 +479,7 @@ static void gt_gff3_visitor_init(GtGFF3Visitor *gff3_visitor)
   /* XXX */
   gff3_visitor->retain_ids = getenv("GT_RETAINIDS") ? true : false;
   gff3_visitor->allow_nonunique_ids = false;
+  gff3_visitor->blocksize = 0;
 }
 
 GtNodeVisitor* gt_gff3_visitor_new(GtFile *outfp)
@@ -539,7 +488,8 @@ GtNodeVisitor* gt_gff3_visitor_new(GtFile *outfp)
   GtGFF3Visitor *gff3_visitor = gff3_visitor_cast(nv);
   gt_gff3_visitor_init(gff3_visitor);
   gff3_visitor->outfp = gt_file_ref(outfp);
-  gff3_visitor->outstr = NULL;
+  gff3_visitor->outstr = gt_str_new();
+  gff3_visitor->outstr_is_buffer = true;
   return nv;
 }
 
@@ -550,6 +500,7 @@ GtNodeVisitor* gt_gff3_visitor_new_to_str(GtStr *outstr)
   gt_gff3_visitor_init(gff3_visitor);
   gff3_visitor->outfp = NULL;
   gff3_visitor->outstr = gt_str_ref(outstr);
+  gff3_visitor->outstr_is_buffer = false;
   return nv;
 }
 
@@ -571,3 +522,16 @@ void gt_gff3_visitor_set_fasta_width(GtGFF3Visitor *gff3_visitor,
   gt_assert(gff3_visitor);
   gff3_visitor->fasta_width = fasta_width;
 }
+
+void gt_gff3_visitor_set_blocksize(GtGFF3Visitor *gff3_visitor,
+                                   GtUword blocksize)
+{
+  gt_assert(gff3_visitor);
+  gff3_visitor->blocksize = blocksize;
+}
+
+void gt_gff3_visitor_flush(GtGFF3Visitor *gff3_visitor)
+{
+  gt_assert(gff3_visitor);
+  gff3_visitor_flush_buffer(gff3_visitor, true);
+}
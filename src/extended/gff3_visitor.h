@@ -22,9 +22,20 @@
 #include "extended/gff3_visitor_api.h"
 #include "extended/node_visitor.h"
 
+/* default block size used for buffered GFF3 output */
+#define GT_GFF3_VISITOR_BLOCKSIZE (1UL << 18)
+
 const GtNodeVisitorClass* gt_gff3_visitor_class(void);
 
 GtNodeVisitor*            gt_gff3_visitor_new_to_str(GtStr *outstr);
 void                      gt_gff3_visitor_allow_nonunique_ids(GtGFF3Visitor*);
+/* Let <gff3_visitor> collect its output in an internal buffer which is only
+   written to the output file once it holds at least <blocksize> bytes.
+   The default <blocksize> of 0 writes out the output of every node directly. */
+void                      gt_gff3_visitor_set_blocksize(GtGFF3Visitor
+                                                        *gff3_visitor,
+                                                        GtUword blocksize);
+/* Write all output buffered in <gff3_visitor> to the output file. */
+void                      gt_gff3_visitor_flush(GtGFF3Visitor *gff3_visitor);
 
 #endif
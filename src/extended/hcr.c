@@ -19,8 +19,10 @@
 #include <ctype.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -30,18 +32,20 @@
 #include "core/assert_api.h"
 #include "core/chardef_api.h"
 #include "core/compat_api.h"
+#include "core/divmodmul_api.h"
 #include "core/fa_api.h"
 #include "core/fileutils_api.h"
 #include "core/intbits.h"
 #include "core/log_api.h"
 #include "core/ma_api.h"
+#include "core/multithread_api.h"
 #include "core/safearith_api.h"
 #include "core/seq_iterator_fastq_api.h"
 #include "core/str_array.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
-#include "extended/bitoutstream.h"
 #include "extended/cstr_iterator.h"
 #include "extended/encdesc.h"
 #include "extended/fasta_header_iterator.h"
@@ -127,7 +131,8 @@ typedef struct GtHcrSeqDecoder {
                        cur_read,
                        num_of_reads,
                        num_of_files;
-  GtWord               start_of_encoding;
+  GtWord               start_of_encoding,
+                       end_of_encoding;
   unsigned int         alphabet_size,
                        qual_offset;
 } GtHcrSeqDecoder;
@@ -299,74 +304,365 @@ static int hcr_cmp_FastqFileInfo(const void *node1, const void *node2,
   return 0;
 }
 
-static GtUword hcr_write_seq(GtHcrSeqEncoder *seq_encoder,
-                                   const GtUchar *seq,
-                                   const GtUchar *qual,
-                                   GtUword len,
-                                   GtBitOutStream *bitstream,
-                                   bool dry)
+/* the reads are encoded in batches of about this many symbols */
+#define HCR_BATCH_SYMBOLS (1UL << 22)
+/* a thread takes consecutive reads of about this many symbols */
+#define HCR_JOB_SYMBOLS   (1UL << 16)
+
+typedef struct {
+  GtBitsequence code;
+  unsigned int  length;
+} HcrSymbolCode;
+
+/* The reads <from> to <to>-1 of a batch. The first and the last word of the
+   bits of the reads may be shared with neighbouring jobs, so these are
+   collected in <firstword> and <lastword>. */
+typedef struct {
+  GtUword       from,
+                to,
+                firstwordnum,
+                lastwordnum;
+  GtBitsequence firstword,
+                lastword;
+} HcrWriteJob;
+
+/* A batch of reads, the bits of the reads are counted and written by
+   <gt_jobs> many threads. <words> holds the words of the file from
+   <firstwordnum> on. */
+typedef struct {
+  GtHcrSeqEncoder *seq_encoder;
+  HcrSymbolCode   *codes;
+  GtUchar         *seqs,
+                  *quals;
+  GtUword         *readstarts,
+                  *readbits,
+                  *readbitpos;
+  HcrWriteJob     *jobs;
+  GtBitsequence   *words;
+  GtMutex         *mutex;
+  GtUword          numofcodes,
+                   numofreads,
+                   allocatedreads,
+                   numofsymbols,
+                   allocatedsymbols,
+                   numofjobs,
+                   allocatedjobs,
+                   nextjob,
+                   firstwordnum,
+                   numofwords,
+                   allocatedwords;
+  unsigned int     alphabet_size;
+  bool             packing;
+} HcrWriteBatch;
+
+static HcrWriteBatch* hcr_write_batch_new(GtHcrSeqEncoder *seq_encoder)
+{
+  HcrWriteBatch *batch = gt_calloc((size_t) 1, sizeof (*batch));
+  GtUword symbol;
+
+  batch->seq_encoder = seq_encoder;
+  batch->alphabet_size = gt_alphabet_size(seq_encoder->alpha);
+  /* the code of each symbol is looked up once */
+  batch->numofcodes = gt_huffman_totalnumofsymbols(seq_encoder->huffman);
+  batch->codes = gt_malloc(sizeof (*batch->codes) * batch->numofcodes);
+  for (symbol = 0; symbol < batch->numofcodes; symbol++)
+    gt_huffman_encode(seq_encoder->huffman, symbol,
+                      &batch->codes[symbol].code,
+                      &batch->codes[symbol].length);
+  batch->allocatedreads = 1024UL;
+  batch->readstarts = gt_malloc(sizeof (*batch->readstarts) *
+                                (batch->allocatedreads + 1));
+  batch->readstarts[0] = 0;
+  batch->readbits = gt_malloc(sizeof (*batch->readbits) *
+                              batch->allocatedreads);
+  batch->readbitpos = gt_malloc(sizeof (*batch->readbitpos) *
+                                batch->allocatedreads);
+  batch->mutex = gt_mutex_new();
+  return batch;
+}
+
+static void hcr_write_batch_delete(HcrWriteBatch *batch)
+{
+  if (batch == NULL)
+    return;
+  gt_free(batch->codes);
+  gt_free(batch->seqs);
+  gt_free(batch->quals);
+  gt_free(batch->readstarts);
+  gt_free(batch->readbits);
+  gt_free(batch->readbitpos);
+  gt_free(batch->jobs);
+  gt_free(batch->words);
+  gt_mutex_delete(batch->mutex);
+  gt_free(batch);
+}
+
+static void hcr_write_batch_add(HcrWriteBatch *batch, const GtUchar *seq,
+                                const GtUchar *qual, GtUword len)
 {
-  unsigned bits_to_write,
-           cur_char_code,
-           cur_qual,
+  if (batch->numofsymbols + len > batch->allocatedsymbols) {
+    batch->allocatedsymbols = 2 * (batch->numofsymbols + len);
+    batch->seqs = gt_realloc(batch->seqs, sizeof (*batch->seqs) *
+                                          batch->allocatedsymbols);
+    batch->quals = gt_realloc(batch->quals, sizeof (*batch->quals) *
+                                            batch->allocatedsymbols);
+  }
+  if (batch->numofreads == batch->allocatedreads) {
+    batch->allocatedreads *= 2;
+    batch->readstarts = gt_realloc(batch->readstarts,
+                                   sizeof (*batch->readstarts) *
+                                   (batch->allocatedreads + 1));
+    batch->readbits = gt_realloc(batch->readbits,
+                                 sizeof (*batch->readbits) *
+                                 batch->allocatedreads);
+    batch->readbitpos = gt_realloc(batch->readbitpos,
+                                   sizeof (*batch->readbitpos) *
+                                   batch->allocatedreads);
+  }
+  memcpy(batch->seqs + batch->numofsymbols, seq, (size_t) len);
+  memcpy(batch->quals + batch->numofsymbols, qual, (size_t) len);
+  batch->numofsymbols += len;
+  batch->readstarts[++batch->numofreads] = batch->numofsymbols;
+}
+
+/* splits the reads of <batch> into jobs of about <HCR_JOB_SYMBOLS> symbols */
+static void hcr_write_batch_make_jobs(HcrWriteBatch *batch)
+{
+  GtUword from = 0, to;
+
+  batch->numofjobs = 0;
+  while (from < batch->numofreads) {
+    GtUword limit = batch->readstarts[from] + HCR_JOB_SYMBOLS;
+    for (to = from + 1;
+         to < batch->numofreads && batch->readstarts[to + 1] <= limit;
+         to++)
+      /* Nothing */;
+    if (batch->numofjobs == batch->allocatedjobs) {
+      batch->allocatedjobs = 2 * batch->allocatedjobs + 16UL;
+      batch->jobs = gt_realloc(batch->jobs, sizeof (*batch->jobs) *
+                                            batch->allocatedjobs);
+    }
+    batch->jobs[batch->numofjobs].from = from;
+    batch->jobs[batch->numofjobs].to = to;
+    batch->numofjobs++;
+    from = to;
+  }
+}
+
+static inline const HcrSymbolCode* hcr_write_batch_code(
+                                                    const HcrWriteBatch *batch,
+                                                    GtUword pos)
+{
+  const GtHcrSeqEncoder *seq_encoder = batch->seq_encoder;
+  unsigned cur_char_code = (unsigned) batch->seqs[pos],
+           cur_qual = (unsigned) batch->quals[pos],
            symbol;
-  GtUword i,
-                written_bits = 0;
-  GtBitsequence code;
 
-  for (i = 0; i < len; i++) {
-    cur_char_code = (unsigned) seq[i];
+  if (cur_char_code == GT_WILDCARD)
+    cur_char_code = batch->alphabet_size - 1;
 
-    if (cur_char_code == GT_WILDCARD)
-      cur_char_code = gt_alphabet_size(seq_encoder->alpha) - 1;
+  if (seq_encoder->qrange.start != GT_UNDEF_UINT) {
+    if (cur_qual <= seq_encoder->qrange.start)
+      cur_qual = seq_encoder->qrange.start;
+  }
 
-    cur_qual = (unsigned) qual[i];
+  if (seq_encoder->qrange.end != GT_UNDEF_UINT) {
+    if (cur_qual >= seq_encoder->qrange.end)
+      cur_qual = seq_encoder->qrange.end;
+  }
+
+  cur_qual = cur_qual - seq_encoder->qual_offset;
+
+  symbol = batch->alphabet_size * cur_qual + cur_char_code;
+  gt_assert((GtUword) symbol < batch->numofcodes);
+  return batch->codes + symbol;
+}
+
+static void hcr_write_batch_count(HcrWriteBatch *batch, const HcrWriteJob *job)
+{
+  GtUword readnum, pos;
+
+  for (readnum = job->from; readnum < job->to; readnum++) {
+    GtUword bits = 0;
+    for (pos = batch->readstarts[readnum];
+         pos < batch->readstarts[readnum + 1];
+         pos++)
+      bits += (GtUword) hcr_write_batch_code(batch, pos)->length;
+    batch->readbits[readnum] = bits;
+  }
+}
+
+static inline void hcr_write_batch_or_word(HcrWriteBatch *batch,
+                                           HcrWriteJob *job, GtUword wordnum,
+                                           GtBitsequence value)
+{
+  if (wordnum == job->firstwordnum)
+    job->firstword |= value;
+  else if (wordnum == job->lastwordnum)
+    job->lastword |= value;
+  else
+    batch->words[wordnum - batch->firstwordnum] |= value;
+}
 
-    if (seq_encoder->qrange.start != GT_UNDEF_UINT) {
-      if (cur_qual <= seq_encoder->qrange.start)
-        cur_qual = seq_encoder->qrange.start;
+/* writes the codes of the reads of <job> to their bit positions, the most
+   significant bit of a word comes first as in <GtBitOutStream> */
+static void hcr_write_batch_pack(HcrWriteBatch *batch, HcrWriteJob *job)
+{
+  GtUword readnum, pos;
+
+  for (readnum = job->from; readnum < job->to; readnum++) {
+    GtUword bitpos = batch->readbitpos[readnum];
+    for (pos = batch->readstarts[readnum];
+         pos < batch->readstarts[readnum + 1];
+         pos++) {
+      const HcrSymbolCode *code = hcr_write_batch_code(batch, pos);
+      GtUword wordnum = bitpos / GT_INTWORDSIZE;
+      unsigned bits_left = GT_INTWORDSIZE -
+                           (unsigned) (bitpos % GT_INTWORDSIZE);
+
+      if (code->length <= bits_left) {
+        if (code->length > 0)
+          hcr_write_batch_or_word(batch, job, wordnum,
+                                  code->code << (bits_left - code->length));
+      }
+      else {
+        unsigned overhang = code->length - bits_left;
+        hcr_write_batch_or_word(batch, job, wordnum, code->code >> overhang);
+        hcr_write_batch_or_word(batch, job, wordnum + 1,
+                                code->code << (GT_INTWORDSIZE - overhang));
+      }
+      bitpos += (GtUword) code->length;
     }
+  }
+}
+
+static HcrWriteJob* hcr_write_batch_next_job(HcrWriteBatch *batch)
+{
+  HcrWriteJob *job = NULL;
 
-    if (seq_encoder->qrange.end != GT_UNDEF_UINT) {
-      if (cur_qual >= seq_encoder->qrange.end)
-        cur_qual = seq_encoder->qrange.end;
+  gt_mutex_lock(batch->mutex);
+  if (batch->nextjob < batch->numofjobs)
+    job = batch->jobs + batch->nextjob++;
+  gt_mutex_unlock(batch->mutex);
+  return job;
+}
+
+static void* hcr_write_batch_thread(void *data)
+{
+  HcrWriteBatch *batch = data;
+  HcrWriteJob *job;
+
+  while ((job = hcr_write_batch_next_job(batch)) != NULL) {
+    if (batch->packing) {
+      if (job->firstwordnum != GT_UNDEF_UWORD)
+        hcr_write_batch_pack(batch, job);
     }
+    else
+      hcr_write_batch_count(batch, job);
+  }
+  return NULL;
+}
+
+static int hcr_write_batch_run(HcrWriteBatch *batch, bool packing,
+                               GtError *err)
+{
+  int had_err = 0;
 
-    cur_qual = cur_qual - seq_encoder->qual_offset;
+  batch->packing = packing;
+  batch->nextjob = 0;
+  if (gt_jobs > 1U && batch->numofjobs > 1UL)
+    had_err = gt_multithread(hcr_write_batch_thread, batch, err);
+  else
+    (void) hcr_write_batch_thread(batch);
+  return had_err;
+}
 
-    symbol = gt_alphabet_size(seq_encoder->alpha) * cur_qual + cur_char_code;
-    gt_huffman_encode(seq_encoder->huffman, (GtUword) symbol,
-                      &code, &bits_to_write);
-    written_bits += bits_to_write;
-    if (!dry) {
-      gt_bitoutstream_append(bitstream, code, bits_to_write);
+/* writes the bits of the reads in <batch> to the words <firstwordnum> to
+   <nextwordnum>, the last of which is not complete and not written to <fp> but
+   returned, it is the first word of the next batch */
+static int hcr_write_batch_words(HcrWriteBatch *batch, FILE *fp,
+                                 GtUword firstwordnum,
+                                 GtBitsequence *carryword,
+                                 GtUword nextwordnum, GtError *err)
+{
+  int had_err = 0;
+  GtUword jobnum;
+
+  gt_assert(firstwordnum <= nextwordnum);
+  batch->firstwordnum = firstwordnum;
+  batch->numofwords = nextwordnum - firstwordnum + 1;
+  if (batch->numofwords > batch->allocatedwords) {
+    batch->allocatedwords = batch->numofwords;
+    batch->words = gt_realloc(batch->words, sizeof (*batch->words) *
+                                            batch->allocatedwords);
+  }
+  memset(batch->words, 0, sizeof (*batch->words) * batch->numofwords);
+  batch->words[0] = *carryword;
+
+  for (jobnum = 0; jobnum < batch->numofjobs; jobnum++) {
+    HcrWriteJob *job = batch->jobs + jobnum;
+    GtUword firstbit = batch->readbitpos[job->from],
+            endbit = batch->readbitpos[job->to - 1] +
+                     batch->readbits[job->to - 1];
+    job->firstword = job->lastword = 0;
+    if (firstbit < endbit) {
+      job->firstwordnum = firstbit / GT_INTWORDSIZE;
+      job->lastwordnum = (endbit - 1) / GT_INTWORDSIZE;
+    }
+    else
+      job->firstwordnum = job->lastwordnum = GT_UNDEF_UWORD;
+  }
+  had_err = hcr_write_batch_run(batch, true, err);
+
+  if (!had_err) {
+    for (jobnum = 0; jobnum < batch->numofjobs; jobnum++) {
+      const HcrWriteJob *job = batch->jobs + jobnum;
+      if (job->firstwordnum != GT_UNDEF_UWORD) {
+        batch->words[job->firstwordnum - firstwordnum] |= job->firstword;
+        batch->words[job->lastwordnum - firstwordnum] |= job->lastword;
+      }
     }
+    gt_xfwrite(batch->words, sizeof (*batch->words),
+               (size_t) batch->numofwords - 1, fp);
+    *carryword = batch->words[batch->numofwords - 1];
   }
-  return written_bits;
+  return had_err;
 }
 
+/* The reads are encoded batch by batch. For each batch, the threads first
+   count the bits of the reads, then the samples are placed, which fixes the
+   bit position of each read, then the threads write the codes of the reads
+   into a common buffer. The result is the same as writing the reads one by
+   one with a <GtBitOutStream> and <gt_bitoutstream_flush_advance()> at each
+   sample. */
 static int hcr_write_seqs(FILE *fp, GtHcrEncoder *hcr_enc, GtError *err)
 {
-  int had_err = 0, seqit_err;
-  GtUword bits_to_write = 0,
-                len,
-                read_counter = 0,
-                page_counter = 0,
-                bits_left_in_page,
-                cur_read = 0;
-  GtWord filepos;
+  int had_err = 0, seqit_err = 1;
+  GtUword len,
+          read_counter = 0,
+          page_counter = 0,
+          bits_left_in_page,
+          cur_read = 0,
+          segbits = 0,
+          carrywordnum;
+  size_t segstart;
+  GtBitsequence carryword = 0;
   GtSeqIterator *seqit;
+  GtSampling *sampling = hcr_enc->seq_encoder->sampling;
+  HcrWriteBatch *batch = NULL;
   const GtUchar *seq,
                 *qual;
   char *desc;
-  GtBitOutStream *bitstream;
 
   gt_error_check(err);
 
   gt_safe_assign(bits_left_in_page, (hcr_enc->pagesize * 8));
 
   gt_xfseek(fp, hcr_enc->seq_encoder->start_of_encoding, SEEK_SET);
-  bitstream = gt_bitoutstream_new(fp);
+  /* the current segment of bits starts at <segstart> and has <segbits> bits,
+     a new segment starts with each sample */
+  gt_safe_assign(segstart, hcr_enc->seq_encoder->start_of_encoding);
+  carrywordnum = (GtUword) segstart / sizeof (GtBitsequence);
 
   seqit = gt_seq_iterator_fastq_new(hcr_enc->files, err);
   if (!seqit) {
@@ -379,16 +675,26 @@ static int hcr_write_seqs(FILE *fp, GtHcrEncoder *hcr_enc, GtError *err)
     gt_seq_iterator_set_symbolmap(seqit,
                             gt_alphabet_symbolmap(hcr_enc->seq_encoder->alpha));
     hcr_enc->seq_encoder->total_num_of_symbols = 0;
-    while (!had_err &&
-           (seqit_err = gt_seq_iterator_next(seqit,
-                                            &seq,
-                                            &len,
-                                            &desc, err)) == 1) {
-      GtSampling *sampling = hcr_enc->seq_encoder->sampling;
-
-      /* count the bits */
-      bits_to_write = hcr_write_seq(hcr_enc->seq_encoder, seq, qual, len,
-                                    bitstream, true);
+    batch = hcr_write_batch_new(hcr_enc->seq_encoder);
+  }
+  while (!had_err && seqit_err == 1) {
+    GtUword i;
+
+    batch->numofreads = batch->numofsymbols = 0;
+    while (batch->numofsymbols < HCR_BATCH_SYMBOLS &&
+           (seqit_err = gt_seq_iterator_next(seqit, &seq, &len, &desc,
+                                             err)) == 1)
+      hcr_write_batch_add(batch, seq, qual, len);
+    if (seqit_err == -1) {
+      had_err = -1;
+      gt_assert(gt_error_is_set(err));
+    }
+    if (!had_err && batch->numofreads > 0) {
+      hcr_write_batch_make_jobs(batch);
+      had_err = hcr_write_batch_run(batch, false, err);
+    }
+    for (i = 0; !had_err && i < batch->numofreads; i++) {
+      GtUword bits_to_write = batch->readbits[i];
 
       /* check if a new sample has to be added */
       if (sampling != NULL &&
@@ -397,29 +703,28 @@ static int hcr_write_seqs(FILE *fp, GtHcrEncoder *hcr_enc, GtError *err)
                                              read_counter,
                                              bits_to_write,
                                              bits_left_in_page)) {
+        /* the complete words of the segment are followed by the flushed
+           last word, the next segment starts at the following page border
+           unless the flushed word itself started at a page border */
+        size_t flushpos = segstart + (segbits == 0
+                                      ? 0
+                                      : (segbits - 1) / GT_INTWORDSIZE) *
+                                     sizeof (GtBitsequence);
         gt_log_log("sampling read " GT_WU, cur_read);
-        gt_bitoutstream_flush_advance(bitstream);
-
-        filepos = gt_bitoutstream_pos(bitstream);
-        if (filepos < 0) {
-          had_err = -1;
-          gt_error_set(err, "error by ftell: %s", strerror(errno));
-        }
-        else {
-        gt_sampling_add_sample(sampling,
-                               (size_t) filepos,
-                               cur_read);
+        if (flushpos % hcr_enc->pagesize == 0)
+          segstart = flushpos + sizeof (GtBitsequence);
+        else
+          segstart = ((flushpos + sizeof (GtBitsequence)) /
+                      hcr_enc->pagesize + 1) * hcr_enc->pagesize;
+        segbits = 0;
+        gt_sampling_add_sample(sampling, segstart, cur_read);
 
         read_counter = 0;
         page_counter = 0;
         gt_safe_assign(bits_left_in_page, (hcr_enc->pagesize * 8));
-        }
       }
-
-      if (!had_err) {
-      /* do the writing */
-      bits_to_write = hcr_write_seq(hcr_enc->seq_encoder,
-                                    seq, qual, len, bitstream, false);
+      batch->readbitpos[i] = (GtUword) segstart * CHAR_BIT + segbits;
+      segbits += bits_to_write;
 
       /* update counter for sampling */
       while (bits_left_in_page < bits_to_write) {
@@ -432,20 +737,27 @@ static int hcr_write_seqs(FILE *fp, GtHcrEncoder *hcr_enc, GtError *err)
       if (page_counter == 0)
         page_counter++;
       read_counter++;
-      hcr_enc->seq_encoder->total_num_of_symbols += len;
+      hcr_enc->seq_encoder->total_num_of_symbols +=
+        batch->readstarts[i + 1] - batch->readstarts[i];
       cur_read++;
-      }
     }
-    gt_assert(hcr_enc->num_of_reads == cur_read);
-    if (!had_err && seqit_err) {
-      had_err = seqit_err;
-      gt_assert(gt_error_is_set(err));
+    if (!had_err && batch->numofreads > 0) {
+      GtUword nextwordnum = ((GtUword) segstart * CHAR_BIT + segbits) /
+                            GT_INTWORDSIZE;
+      had_err = hcr_write_batch_words(batch, fp, carrywordnum, &carryword,
+                                      nextwordnum, err);
+      carrywordnum = nextwordnum;
     }
   }
+  if (!had_err) {
+    gt_assert(hcr_enc->num_of_reads == cur_read);
+    /* the last word of the segment is always written */
+    if (segbits % GT_INTWORDSIZE != 0 || segbits == 0)
+      gt_xfwrite_one(&carryword, fp);
+  }
 
   if (!had_err) {
-    gt_bitoutstream_flush(bitstream);
-    filepos = gt_bitoutstream_pos(bitstream);
+    GtWord filepos = ftell(fp);
     if (filepos < 0) {
       had_err = -1;
       gt_error_set(err, "error by ftell: %s", strerror(errno));
@@ -459,7 +771,7 @@ static int hcr_write_seqs(FILE *fp, GtHcrEncoder *hcr_enc, GtError *err)
       }
     }
   }
-  gt_bitoutstream_delete(bitstream);
+  hcr_write_batch_delete(batch);
   gt_seq_iterator_delete(seqit);
   return had_err;
 }
@@ -792,6 +1104,7 @@ static GtHcrSeqDecoder *hcr_seq_decoder_new(GtAlphabet *alpha, const char *name,
     gt_assert(read == one);
 
     seq_dec->start_of_encoding = decoder_calc_start_of_encoded_data(fp);
+    seq_dec->end_of_encoding = end_enc_start_sampling;
 
     had_err = seq_decoder_init_huffman(seq_dec,
                                        end_enc_start_sampling, bqd, err);
@@ -876,6 +1189,28 @@ static unsigned char get_base_from_symbol(GtHcrSeqDecoder *seq_dec,
   return base;
 }
 
+/* writes the bases and qualities of the decoded <symbols> to <seq> and <qual>
+   (if not <NULL>), without terminating them */
+static void hcr_seq_decoder_symbols2read(GtHcrSeqDecoder *seq_dec,
+                                         const GtArray *symbols,
+                                         char *seq, char *qual)
+{
+  unsigned char base;
+  GtUword i,
+          *symbol;
+
+  for (i = 0; i < gt_array_size(symbols); i++) {
+    symbol = (GtUword*) gt_array_get(symbols, i);
+    if (qual != NULL)
+      qual[i] = get_qual_from_symbol(seq_dec, *symbol);
+    if (seq != NULL) {
+      base = get_base_from_symbol(seq_dec, *symbol);
+      seq[i] = (char)toupper(gt_alphabet_decode(seq_dec->alpha,
+                                                (GtUchar) base));
+    }
+  }
+}
+
 static int hcr_next_seq_qual(GtHcrSeqDecoder *seq_dec, char *seq, char *qual,
                              GtError *err)
 {
@@ -884,10 +1219,7 @@ static int hcr_next_seq_qual(GtHcrSeqDecoder *seq_dec, char *seq, char *qual,
     END,
     SUCCESS
   };
-  unsigned char base;
-  GtUword i,
-                nearestsample,
-                *symbol;
+  GtUword nearestsample;
   size_t startofnearestsample = 0;
   enum state status = END;
   FastqFileInfo cur_read;
@@ -930,16 +1262,7 @@ static int hcr_next_seq_qual(GtHcrSeqDecoder *seq_dec, char *seq, char *qual,
         gt_error_set(err, "reached end of file");
     }
     if (qual || seq) {
-      for (i = 0; i < gt_array_size(seq_dec->symbols); i++) {
-        symbol = (GtUword*) gt_array_get(seq_dec->symbols, i);
-        if (qual != NULL)
-          qual[i] = get_qual_from_symbol(seq_dec, *symbol);
-        if (seq != NULL) {
-          base = get_base_from_symbol(seq_dec, *symbol);
-          seq[i] = (char)toupper(gt_alphabet_decode(seq_dec->alpha,
-                                                    (GtUchar) base));
-        }
-      }
+      hcr_seq_decoder_symbols2read(seq_dec, seq_dec->symbols, seq, qual);
       if (qual != NULL)
         qual[gt_array_size(seq_dec->symbols)] = '\0';
       if (seq != NULL)
@@ -1024,6 +1347,257 @@ int gt_hcr_decoder_decode(GtHcrDecoder *hcr_dec, GtUword readnum,
   return had_err;
 }
 
+static void hcr_write_fastq_entry(FILE *output, GtUword readnum,
+                                  const GtStr *desc, const char *seq,
+                                  const char *qual, GtUword length,
+                                  GtUword width)
+{
+  GtUword cur_width, i;
+
+  gt_xfputc(HCR_DESCSEPSEQ, output);
+  if (desc != NULL)
+    gt_xfputs(gt_str_get(desc), output);
+  else
+    fprintf(output, ""GT_WU"", readnum);
+  gt_xfputc('\n', output);
+  for (i = 0, cur_width = 0; i < length; i++, cur_width++) {
+    if (width != 0 && cur_width == width) {
+      cur_width = 0;
+      gt_xfputc('\n', output);
+    }
+    gt_xfputc(seq[i], output);
+  }
+  gt_xfputc('\n', output);
+  gt_xfputc(HCR_DESCSEPQUAL, output);
+  gt_xfputc('\n', output);
+  for (i = 0, cur_width = 0; i < length; i++, cur_width++) {
+    if (width != 0 && cur_width == width) {
+      cur_width = 0;
+      gt_xfputc('\n', output);
+    }
+    gt_xfputc(qual[i], output);
+  }
+  gt_xfputc('\n', output);
+}
+
+/* returns the length of read <readnum>, which is the read length of the file
+   it belongs to */
+static GtUword hcr_seq_decoder_readlength(const GtHcrSeqDecoder *seq_dec,
+                                          GtUword readnum)
+{
+  GtUword left = 0,
+          right = seq_dec->num_of_files - 1;
+
+  gt_assert(readnum < seq_dec->num_of_reads);
+  while (left < right) {
+    GtUword mid = left + GT_DIV2(right - left);
+    if (seq_dec->fileinfos[mid].readnum <= readnum)
+      left = mid + 1;
+    else
+      right = mid;
+  }
+  return seq_dec->fileinfos[left].readlength;
+}
+
+/* The reads <from> to <to>-1 of the block of reads starting with the sampled
+   read <startread> at file offset <position>. Each block is decoded by one
+   thread with its own <GtHuffmanDecoder>. */
+typedef struct {
+  GtUword  startread,
+           from,
+           to,
+           length,
+           allocated;
+  size_t   position;
+  char    *seqs,
+          *quals;
+  GtError *err;
+  int      had_err;
+} HcrDecodeUnit;
+
+typedef struct {
+  GtHcrSeqDecoder *seq_dec;
+  HcrDecodeUnit   *units;
+  GtMutex         *mutex;
+  GtUword          numofunits,
+                   nextunit;
+} HcrDecodeRound;
+
+static int hcr_decode_unit(GtHcrSeqDecoder *seq_dec, HcrDecodeUnit *unit)
+{
+  HcrHuffDataIterator *data_iter;
+  GtHuffmanDecoder *huff_dec;
+  GtArray *symbols = gt_array_new(sizeof (GtUword));
+  GtUword readnum,
+          offset = 0;
+  int had_err = 0;
+
+  data_iter = decoder_init_data_iterator(seq_dec->start_of_encoding,
+                                         seq_dec->end_of_encoding,
+                                         seq_dec->filename);
+  reset_data_iterator_to_pos(data_iter, unit->position);
+  huff_dec = gt_huffman_decoder_new_from_memory(seq_dec->huffman,
+                                                get_next_file_chunk_for_huffman,
+                                                data_iter, unit->err);
+  if (huff_dec == NULL)
+    had_err = -1;
+  /* the reads of the block before <from> are decoded and skipped */
+  for (readnum = unit->startread; !had_err && readnum < unit->to; readnum++) {
+    GtUword readlength = hcr_seq_decoder_readlength(seq_dec, readnum);
+    int ret;
+
+    gt_array_reset(symbols);
+    ret = gt_huffman_decoder_next(huff_dec, symbols, readlength, unit->err);
+    if (ret != 1) {
+      had_err = -1;
+      if (ret == 0)
+        gt_error_set(unit->err, "reached end of file");
+    }
+    else if (readnum >= unit->from) {
+      hcr_seq_decoder_symbols2read(seq_dec, symbols, unit->seqs + offset,
+                                   unit->quals + offset);
+      offset += readlength;
+    }
+  }
+  gt_huffman_decoder_delete(huff_dec);
+  data_iterator_delete(data_iter);
+  gt_array_delete(symbols);
+  return had_err;
+}
+
+static HcrDecodeUnit* hcr_decode_round_next_unit(HcrDecodeRound *round)
+{
+  HcrDecodeUnit *unit = NULL;
+
+  gt_mutex_lock(round->mutex);
+  if (round->nextunit < round->numofunits)
+    unit = round->units + round->nextunit++;
+  gt_mutex_unlock(round->mutex);
+  return unit;
+}
+
+static void* hcr_decode_round_thread(void *data)
+{
+  HcrDecodeRound *round = data;
+  HcrDecodeUnit *unit;
+
+  while ((unit = hcr_decode_round_next_unit(round)) != NULL)
+    unit->had_err = hcr_decode_unit(round->seq_dec, unit);
+  return NULL;
+}
+
+/* returns the number of the last sample whose element is <= <readnum> */
+static GtUword hcr_find_sample(const GtSampling *sampling, GtUword readnum)
+{
+  GtUword left = 0,
+          right = gt_sampling_num_of_samples(sampling) - 1,
+          element;
+  size_t position;
+
+  while (left < right) {
+    GtUword mid = left + GT_DIV2(right - left + 1);
+    gt_sampling_get_sample(sampling, mid, &element, &position);
+    if (element <= readnum)
+      left = mid;
+    else
+      right = mid - 1;
+  }
+  return left;
+}
+
+/* decodes the reads <start> to <end> block by block, <gt_jobs> many blocks in
+   parallel, and writes them in order to <output> */
+static int hcr_decode_range_blocks(GtHcrDecoder *hcr_dec, FILE *output,
+                                   GtUword start, GtUword end, GtUword width,
+                                   GtError *err)
+{
+  GtHcrSeqDecoder *seq_dec = hcr_dec->seq_dec;
+  const GtSampling *sampling = seq_dec->sampling;
+  HcrDecodeRound round;
+  GtStr *desc = gt_str_new();
+  GtUword samplenum,
+          numofsamples = gt_sampling_num_of_samples(sampling),
+          maxunits = (GtUword) gt_jobs,
+          cur_read = start,
+          idx;
+  int had_err = 0;
+
+  round.seq_dec = seq_dec;
+  round.units = gt_calloc((size_t) maxunits, sizeof (*round.units));
+  round.mutex = gt_mutex_new();
+  for (idx = 0; idx < maxunits; idx++)
+    round.units[idx].err = gt_error_new();
+  samplenum = hcr_find_sample(sampling, start);
+
+  while (!had_err && cur_read <= end) {
+    round.numofunits = round.nextunit = 0;
+    while (round.numofunits < maxunits && cur_read <= end) {
+      HcrDecodeUnit *unit = round.units + round.numofunits++;
+      GtUword readnum;
+      size_t position;
+
+      gt_sampling_get_sample(sampling, samplenum++, &unit->startread,
+                             &unit->position);
+      if (samplenum < numofsamples)
+        gt_sampling_get_sample(sampling, samplenum, &unit->to, &position);
+      else
+        unit->to = seq_dec->num_of_reads;
+      if (unit->to > end + 1)
+        unit->to = end + 1;
+      gt_assert(unit->startread <= cur_read && cur_read < unit->to);
+      unit->from = cur_read;
+      cur_read = unit->to;
+
+      unit->length = 0;
+      for (readnum = unit->from; readnum < unit->to; readnum++)
+        unit->length += hcr_seq_decoder_readlength(seq_dec, readnum);
+      if (unit->length > unit->allocated) {
+        unit->allocated = unit->length;
+        unit->seqs = gt_realloc(unit->seqs, (size_t) unit->allocated);
+        unit->quals = gt_realloc(unit->quals, (size_t) unit->allocated);
+      }
+      unit->had_err = 0;
+      gt_error_unset(unit->err);
+    }
+    if (gt_jobs > 1U && round.numofunits > 1UL)
+      had_err = gt_multithread(hcr_decode_round_thread, &round, err);
+    else
+      (void) hcr_decode_round_thread(&round);
+
+    for (idx = 0; !had_err && idx < round.numofunits; idx++) {
+      HcrDecodeUnit *unit = round.units + idx;
+      GtUword readnum,
+              offset = 0;
+
+      if (unit->had_err) {
+        gt_error_set(err, "%s", gt_error_get(unit->err));
+        had_err = -1;
+      }
+      for (readnum = unit->from; !had_err && readnum < unit->to; readnum++) {
+        GtUword readlength = hcr_seq_decoder_readlength(seq_dec, readnum);
+        if (hcr_dec->encdesc != NULL)
+          had_err = gt_encdesc_decode(hcr_dec->encdesc, readnum, desc, err);
+        if (!had_err)
+          hcr_write_fastq_entry(output, readnum,
+                                hcr_dec->encdesc != NULL ? desc : NULL,
+                                unit->seqs + offset, unit->quals + offset,
+                                readlength, width);
+        offset += readlength;
+      }
+    }
+  }
+
+  for (idx = 0; idx < maxunits; idx++) {
+    gt_free(round.units[idx].seqs);
+    gt_free(round.units[idx].quals);
+    gt_error_delete(round.units[idx].err);
+  }
+  gt_free(round.units);
+  gt_mutex_delete(round.mutex);
+  gt_str_delete(desc);
+  return had_err;
+}
+
 int gt_hcr_decoder_decode_range(GtHcrDecoder *hcr_dec, const char *name,
                                 GtUword start, GtUword end, GtUword width,
                                 GtTimer *timer, GtError *err)
@@ -1032,11 +1606,9 @@ int gt_hcr_decoder_decode_range(GtHcrDecoder *hcr_dec, const char *name,
        seq[BUFSIZ] = {0};
   GtStr *desc = gt_str_new();
   int had_err = 0;
-  GtUword cur_width,
-                cur_read;
-  size_t i;
+  GtUword cur_read;
   FILE *output;
-  GT_UNUSED GtHcrSeqDecoder *seq_dec;
+  GtHcrSeqDecoder *seq_dec;
 
   gt_error_check(err);
   gt_assert(hcr_dec && name);
@@ -1049,34 +1621,17 @@ int gt_hcr_decoder_decode_range(GtHcrDecoder *hcr_dec, const char *name,
   if (output == NULL)
     had_err = -1;
 
-  for (cur_read = start; had_err == 0 && cur_read <= end; cur_read++) {
-    if (gt_hcr_decoder_decode(hcr_dec, cur_read, seq, qual, desc, err) != 0)
-      had_err = -1;
-    else {
-      gt_xfputc(HCR_DESCSEPSEQ, output);
-      if (hcr_dec->encdesc != NULL)
-        gt_xfputs(gt_str_get(desc), output);
+  /* the samples separate independently decodable blocks of reads */
+  if (!had_err && seq_dec->sampling != NULL)
+    had_err = hcr_decode_range_blocks(hcr_dec, output, start, end, width, err);
+  else {
+    for (cur_read = start; had_err == 0 && cur_read <= end; cur_read++) {
+      if (gt_hcr_decoder_decode(hcr_dec, cur_read, seq, qual, desc, err) != 0)
+        had_err = -1;
       else
-        fprintf(output, ""GT_WU"", cur_read);
-      gt_xfputc('\n', output);
-      for (i = 0, cur_width = 0; i < strlen(seq); i++, cur_width++) {
-        if (width != 0 && cur_width == width) {
-          cur_width = 0;
-          gt_xfputc('\n', output);
-        }
-        gt_xfputc(seq[i], output);
-      }
-      gt_xfputc('\n', output);
-      gt_xfputc(HCR_DESCSEPQUAL, output);
-      gt_xfputc('\n', output);
-      for (i = 0, cur_width = 0; i < strlen(qual); i++, cur_width++) {
-        if (width != 0 && cur_width == width) {
-          cur_width = 0;
-          gt_xfputc('\n', output);
-        }
-        gt_xfputc(qual[i], output);
-      }
-      gt_xfputc('\n', output);
+        hcr_write_fastq_entry(output, cur_read,
+                              hcr_dec->encdesc != NULL ? desc : NULL,
+                              seq, qual, (GtUword) strlen(seq), width);
     }
   }
   gt_fa_xfclose(output);
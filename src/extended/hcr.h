@@ -70,7 +70,8 @@ void          gt_hcr_encoder_set_sampling_rate(GtHcrEncoder *hcr_enc,
 /* Returns the sampling rate of the object <hcr_enc>. */
 GtUword       gt_hcr_encoder_get_sampling_rate(const GtHcrEncoder *hcr_enc);
 
-/* Encodes <hcr_enc> and writes the encoding to a file with base name <name>. */
+/* Encodes <hcr_enc> and writes the encoding to a file with base name <name>.
+   The reads are encoded by <gt_jobs> many threads. */
 int           gt_hcr_encoder_encode(GtHcrEncoder *hcr_enc, const char *name,
                                     GtTimer *timer, GtError *err);
 
@@ -93,7 +94,9 @@ int           gt_hcr_decoder_decode(GtHcrDecoder *hcr_dec,
 /* Decodes the hcr encoded file starting at record number <start> until record
    number <end> and writes the decoding to a file with base name <name>. If
    <width> is not 0 output of sequences and qualities will have that width. Be
-   advised to not use this if the data should be machine readable. */
+   advised to not use this if the data should be machine readable. If the
+   encoding is sampled, only the blocks of reads between the samples
+   overlapping the range are decoded, <gt_jobs> many blocks in parallel. */
 int           gt_hcr_decoder_decode_range(GtHcrDecoder *hcr_dec,
                                           const char *name, GtUword start,
                                           GtUword end, GtUword width,
@@ -20,7 +20,6 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
-#include <ctype.h>
 #include <string.h>
 #include "core/ma_api.h"
 #include "core/minmax_api.h"
@@ -34,8 +33,10 @@
 #include "match/squarededist.h"
 #include "extended/alignment.h"
 #include "extended/maxcoordvalue.h"
+#include "extended/myersedist.h"
 #include "extended/reconstructalignment.h"
 #include "extended/squarealign.h"
+#include "extended/stripedalign.h"
 
 #include "extended/linearalign.h"
 #define LINEAR_EDIST_GAP          ((GtUchar) UCHAR_MAX)
@@ -297,11 +298,16 @@ static GtUword evaluatelinearcrosspoints(GtLinspaceManagement *spacemanager,
     Rtabcolumn = Rtabcolumn + rowoffset + threadidx;
     EDtabcolumn = EDtabcolumn + rowoffset + threadidx;
 
-    distance = evaluateallEDtabRtabcolumns(EDtabcolumn, Rtabcolumn,
-                                           scorehandler, midcol,
-                                           useq, ustart, ulen,
-                                           vseq, vstart, vlen);
-    midrow = Rtabcolumn[ulen];
+    if (!gt_stripedalign_linear(scorehandler, useq, ustart, ulen,
+                                vseq, vstart, vlen, midcol,
+                                &distance, &midrow))
+    {
+      distance = evaluateallEDtabRtabcolumns(EDtabcolumn, Rtabcolumn,
+                                             scorehandler, midcol,
+                                             useq, ustart, ulen,
+                                             vseq, vstart, vlen);
+      midrow = Rtabcolumn[ulen];
+    }
     Ctab[midcol] = rowoffset + midrow;
 
 #ifdef GT_THREADS_ENABLED
@@ -477,54 +483,13 @@ GtUword gt_linearalign_compute(GtLinspaceManagement *spacemanager,
   return distance;
 }
 
-/* just calculate distance, no alignment */
-static void fillDPtable_unitcost(bool downcase,GtUword *dpcolumn,
-                                 const GtUchar *u, GtUword ulen,
-                                 const GtUchar *v, GtUword vlen)
-{
-  GtUword i, j , nw, we;
-
-  for (i = 0; i <= ulen; i++)
-  {
-    dpcolumn[i] = i;
-  }
-  for (j = 1UL; j <= vlen; j++) {
-    GtUchar b = downcase ? tolower((int) v[j-1]) : v[j-1];
-    nw = dpcolumn[0];
-    dpcolumn[0] = j;
-    for (i = 1UL; i <= ulen; i++) {
-      GtUchar a = downcase ? tolower((int) u[i-1]) : u[i-1];
-      we = dpcolumn[i];
-       /* replacement */
-      dpcolumn[i] = (a == b) ? nw : (nw + 1);
-      if (dpcolumn[i-1] + 1 < dpcolumn[i]) /* deletion */
-      {
-        dpcolumn[i] = dpcolumn[i-1] + 1;
-      }
-      if (we + 1 < dpcolumn[i]) /* insertion */
-      {
-        dpcolumn[i] = we + 1;
-      }
-      nw = we;
-    }
-  }
-}
-
-static GtUword gt_calc_linearedist(bool downcase,
+/* just calculate distance, no alignment, with the buffers of <myersedist> */
+static GtUword gt_calc_linearedist(GtMyersEdist *myersedist,
                                    const GtUchar *useq, GtUword ulen,
                                    const GtUchar *vseq, GtUword vlen)
 {
-  GtUword *dpcolumn, edist;
-
-  printf("%s(%*.*s,%*.*s)\n",__func__,(int) ulen,(int) ulen,(char *) useq,
-                             (int) vlen,(int) vlen,(char *) vseq);
-  dpcolumn = gt_malloc(sizeof *dpcolumn * (GT_MIN(ulen,vlen) + 1));
-  fillDPtable_unitcost(downcase,dpcolumn,
-                       ulen <= vlen ? useq : vseq, GT_MIN(ulen,vlen),
-                       ulen <= vlen ? vseq : useq, GT_MAX(ulen,vlen));
-  edist = dpcolumn[GT_MIN(ulen,vlen)];
-  gt_free(dpcolumn);
-  return edist;
+  gt_assert(myersedist != NULL);
+  return gt_myersedist_global(myersedist, useq, ulen, vseq, vlen);
 }
 
 /*-------------------------------local linear---------------------------------*/
@@ -752,7 +717,7 @@ void gt_linearalign_check(GT_UNUSED bool forward,
           matchcost = 0, mismatchcost = 1, gapcost = 1;
   GtLinspaceManagement *spacemanager;
   GtScoreHandler *scorehandler;
-  const bool downcase = true;
+  GtMyersEdist *myersedist;
 
   if (memchr(useq, LINEAR_EDIST_GAP,ulen) != NULL)
   {
@@ -793,13 +758,15 @@ void gt_linearalign_check(GT_UNUSED bool forward,
     exit(GT_EXIT_PROGRAMMING_ERROR);
   }
 
-  edist4 = gt_calc_linearedist(downcase,useq, ulen, vseq, vlen);
+  myersedist = gt_myersedist_new(scorehandler);
+  edist4 = gt_calc_linearedist(myersedist, useq, ulen, vseq, vlen);
   if (edist3 != edist4)
   {
     fprintf(stderr,"gt_alignment_eval_with_score = "GT_WU" != "GT_WU
             " = gt_calc_linearedist\n", edist3, edist4);
     exit(GT_EXIT_PROGRAMMING_ERROR);
   }
+  gt_myersedist_delete(myersedist);
   gt_linspace_management_delete(spacemanager);
   gt_scorehandler_delete(scorehandler);
   gt_alignment_delete(align);
@@ -29,6 +29,7 @@
 #include "extended/affinealign.h"
 #include "extended/maxcoordvalue.h"
 #include "extended/reconstructalignment.h"
+#include "extended/stripedalign.h"
 
 #include "extended/linearalign_affinegapcost.h"
 #define LINEAR_EDIST_GAP          ((GtUchar) UCHAR_MAX)
@@ -436,11 +437,19 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
     Rtabcolumn = Rtabcolumn + rowoffset;
     Atabcolumn = Atabcolumn + rowoffset;
 
-    distance = evaluateallAtabRtabcolumns(Atabcolumn,Rtabcolumn,
-                                          scorehandler,
-                                          useq, ustart, ulen,
-                                          vseq, vstart, vlen,
-                                          midcol, from_edge);
+    if (gt_stripedalign_affine(scorehandler, useq, ustart, ulen,
+                               vseq, vstart, vlen, midcol, from_edge,
+                               Atabcolumn + ulen, Rtabcolumn + ulen))
+    {
+      distance = Atabcolumn[ulen].totalvalue;
+    } else
+    {
+      distance = evaluateallAtabRtabcolumns(Atabcolumn,Rtabcolumn,
+                                            scorehandler,
+                                            useq, ustart, ulen,
+                                            vseq, vstart, vlen,
+                                            midcol, from_edge);
+    }
 
     bottomtype = gt_linearalign_affinegapcost_minAdditionalCosts(
                                  &Atabcolumn[ulen], to_edge,
@@ -20,6 +20,8 @@
 #include "core/assert_api.h"
 #include "core/class_alloc_lock.h"
 #include "core/ma_api.h"
+#include "core/multithread_api.h"
+#include "core/queue_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "extended/eof_node_api.h"
@@ -29,18 +31,37 @@
 #include "extended/priority_queue.h"
 #include "extended/region_node.h"
 
+/* number of nodes read ahead from each input stream if the input streams are
+   parsed in parallel */
+#define GT_MERGE_STREAM_BATCHSIZE  256
+
 typedef struct {
   GtGenomeNode *gn;
   GtUword input_index;
 } GtMergeStreamItem;
 
+/* nodes read ahead from an input stream */
+typedef struct {
+  GtQueue *nodes;
+  bool exhausted;
+} GtMergeStreamBuffer;
+
 struct GtMergeStream {
   const GtNodeStream parent_instance;
   GtArray *node_streams;
   GtGenomeNode *first_node, *second_node;
   GtMergeStreamItem *items;
+  GtMergeStreamBuffer *buffers;
+  GtUword batchsize;
   GtPriorityQueue *pq;
-  bool filled;
+  bool filled,
+       parallel;
+  /* state shared by the threads refilling the buffers */
+  GtMutex *mutex;
+  GtUword next_input,
+          end_input;
+  GtError *refill_err;
+  bool refill_failed;
 };
 
 #define gt_merge_stream_cast(GS)\
@@ -56,6 +77,104 @@ static int gt_merge_stream_item_compare(const void *a, const void *b)
   return gt_genome_node_compare(&item1->gn, &item2->gn);
 }
 
+/* the threads fetch the index of the next input stream to refill */
+static bool merge_stream_next_refill_job(GtMergeStream *ms, GtUword *input)
+{
+  bool has_job = false;
+  gt_mutex_lock(ms->mutex);
+  while (!ms->refill_failed && ms->next_input < ms->end_input) {
+    GtMergeStreamBuffer *buffer = ms->buffers + ms->next_input++;
+    if (!buffer->exhausted &&
+        gt_queue_size(buffer->nodes) < ms->batchsize) {
+      *input = ms->next_input - 1;
+      has_job = true;
+      break;
+    }
+  }
+  gt_mutex_unlock(ms->mutex);
+  return has_job;
+}
+
+static void* merge_stream_refill_thread(void *data)
+{
+  GtMergeStream *ms = data;
+  GtMergeStreamBuffer *buffer;
+  GtNodeStream *in_stream;
+  GtGenomeNode *gn;
+  GtError *err = gt_error_new();
+  GtUword input;
+  int had_err = 0;
+  while (!had_err && merge_stream_next_refill_job(ms, &input)) {
+    buffer = ms->buffers + input;
+    in_stream = *(GtNodeStream**) gt_array_get(ms->node_streams, input);
+    while (!had_err && gt_queue_size(buffer->nodes) < ms->batchsize) {
+      gn = NULL;
+      had_err = gt_node_stream_next(in_stream, &gn, err);
+      if (!had_err && gn && !gt_eof_node_try_cast(gn))
+        gt_queue_add(buffer->nodes, gn);
+      else {
+        /* only the start of non-empty input streams is used */
+        gt_genome_node_delete(gn);
+        buffer->exhausted = true;
+        break;
+      }
+    }
+  }
+  if (had_err) {
+    gt_mutex_lock(ms->mutex);
+    if (!ms->refill_failed) {
+      gt_error_set(ms->refill_err, "%s", gt_error_get(err));
+      ms->refill_failed = true;
+    }
+    gt_mutex_unlock(ms->mutex);
+  }
+  gt_error_delete(err);
+  return NULL;
+}
+
+/* Read ahead up to <ms->batchsize> nodes from all input streams whose buffers
+   are not full. If enabled by <gt_merge_stream_set_parallel()>, the input
+   streams are parsed in parallel. Otherwise, only the buffer of <input> is
+   refilled. */
+static int merge_stream_refill(GtMergeStream *ms, GtUword input, GtError *err)
+{
+  int had_err = 0;
+  gt_error_check(err);
+  ms->refill_failed = false;
+  if (!ms->parallel) {
+    ms->next_input = input;
+    ms->end_input = input + 1;
+    (void) merge_stream_refill_thread(ms);
+  }
+  else {
+    ms->next_input = 0;
+    ms->end_input = gt_array_size(ms->node_streams);
+    had_err = gt_multithread(merge_stream_refill_thread, ms, err);
+  }
+  if (!had_err && ms->refill_failed) {
+    gt_error_set(err, "%s", gt_error_get(ms->refill_err));
+    had_err = -1;
+  }
+  return had_err;
+}
+
+/* get the next node of input stream <input>, <*gn> is set to NULL if the
+   stream has been read completely */
+static int merge_stream_next_input_node(GtMergeStream *ms, GtUword input,
+                                        GtGenomeNode **gn, GtError *err)
+{
+  GtMergeStreamBuffer *buffer = ms->buffers + input;
+  int had_err = 0;
+  gt_error_check(err);
+  if (!gt_queue_size(buffer->nodes) && !buffer->exhausted)
+    had_err = merge_stream_refill(ms, input, err);
+  if (!had_err && gt_queue_size(buffer->nodes))
+    *gn = gt_queue_get(buffer->nodes);
+  else
+    *gn = NULL;
+  return had_err;
+}
+
 static int merge_stream_next_in_order(GtNodeStream *ns, GtGenomeNode **gn,
                                       GtError *err)
 {
@@ -71,18 +190,11 @@ static int merge_stream_next_in_order(GtNodeStream *ns, GtGenomeNode **gn,
     for (i = 0; !had_err && i < gt_array_size(ms->node_streams); i++) {
       GtGenomeNode *firstnode = NULL;
       ms->items[i].input_index = i;
-      had_err = gt_node_stream_next(*(GtNodeStream**)
-                                      gt_array_get(ms->node_streams, i),
-                                    &firstnode, err);
+      had_err = merge_stream_next_input_node(ms, i, &firstnode, err);
       /* only add start of non-empty input streams */
       if (!had_err && firstnode) {
-        if (!gt_eof_node_try_cast(firstnode)) {
-          ms->items[i].gn = firstnode;
-          ms->items[i].input_index = i;
-          gt_priority_queue_add(ms->pq, ms->items+i);
-        } else {
-          gt_genome_node_delete(firstnode);
-        }
+        ms->items[i].gn = firstnode;
+        gt_priority_queue_add(ms->pq, ms->items+i);
       }
     }
     ms->filled = true;
@@ -95,20 +207,12 @@ static int merge_stream_next_in_order(GtNodeStream *ns, GtGenomeNode **gn,
     gt_assert(min_item && min_item->gn);
     min_node = min_item->gn;
     /* get next element from the last stream queried */
-    had_err = gt_node_stream_next(*(GtNodeStream**)
-                                    gt_array_get(ms->node_streams,
-                                                 min_item->input_index),
-                                  &nextnode, err);
+    had_err = merge_stream_next_input_node(ms, min_item->input_index,
+                                           &nextnode, err);
     /* add node to queue if still non-EOF nodes left in that stream */
-    if (!had_err && nextnode) {
-      if (!gt_eof_node_try_cast(nextnode)) {
-        min_item->gn = nextnode;
-        gt_priority_queue_add(ms->pq, min_item);
-      } else {
-        min_item->gn = NULL;
-        gt_genome_node_delete(nextnode);
-      }
-    }
+    min_item->gn = nextnode;
+    if (!had_err && nextnode)
+      gt_priority_queue_add(ms->pq, min_item);
   }
 
   *gn = min_node;
@@ -181,11 +285,17 @@ static void merge_stream_free(GtNodeStream *ns)
   for (i = 0; i < gt_array_size(ms->node_streams); i++) {
     if (ms->items[i].gn)
       gt_genome_node_delete(ms->items[i].gn);
+    while (gt_queue_size(ms->buffers[i].nodes))
+      gt_genome_node_delete(gt_queue_get(ms->buffers[i].nodes));
+    gt_queue_delete(ms->buffers[i].nodes);
     gt_node_stream_delete(*(GtNodeStream**) gt_array_get(ms->node_streams, i));
   }
   gt_array_delete(ms->node_streams);
   gt_free(ms->items);
+  gt_free(ms->buffers);
   gt_priority_queue_delete(ms->pq);
+  gt_mutex_delete(ms->mutex);
+  gt_error_delete(ms->refill_err);
 }
 
 const GtNodeStreamClass* gt_merge_stream_class(void)
@@ -217,15 +327,33 @@ GtNodeStream* gt_merge_stream_new(const GtArray *node_streams)
 #endif
   ms->items = gt_calloc(gt_array_size(node_streams),
                         sizeof (GtMergeStreamItem));
+  ms->buffers = gt_calloc(gt_array_size(node_streams),
+                          sizeof (GtMergeStreamBuffer));
   ms->node_streams = gt_array_new(sizeof (GtNodeStream*));
   for (i = 0; i < gt_array_size(node_streams); i++) {
     in_stream = gt_node_stream_ref(*(GtNodeStream**)
                                    gt_array_get(node_streams, i));
     gt_array_add(ms->node_streams, in_stream);
+    ms->buffers[i].nodes = gt_queue_new();
+    ms->buffers[i].exhausted = false;
   }
+  /* by default, nodes are read one at a time from the input streams */
+  ms->batchsize = 1;
+  ms->parallel = false;
+  ms->mutex = gt_mutex_new();
+  ms->refill_err = gt_error_new();
   ms->pq = gt_priority_queue_new(gt_merge_stream_item_compare,
                                  gt_array_size(node_streams));
   ms->filled = false;
   ms->first_node = ms->second_node = NULL;
   return ns;
 }
+
+void gt_merge_stream_set_parallel(GtMergeStream *ms)
+{
+  gt_assert(ms && !ms->filled);
+  if (gt_jobs > 1U) {
+    ms->batchsize = GT_MERGE_STREAM_BATCHSIZE;
+    ms->parallel = true;
+  }
+}
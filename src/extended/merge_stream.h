@@ -22,4 +22,10 @@
 
 const GtNodeStreamClass* gt_merge_stream_class(void);
 
+/* Read ahead from the input streams of <merge_stream> and parse them in
+   <gt_jobs> threads in parallel. This requires that the input streams do not
+   share any state, e.g. GFF3 input streams reading different files. Must be
+   called before the first node is requested. */
+void gt_merge_stream_set_parallel(GtMergeStream *merge_stream);
+
 #endif
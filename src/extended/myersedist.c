@@ -0,0 +1,482 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <limits.h>
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/chardef_api.h"
+#include "core/ensure_api.h"
+#include "core/intbits.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/minmax_api.h"
+#include "extended/myersedist.h"
+
+struct GtMyersEdist
+{
+  /* class of each character, -1 for characters which never match */
+  GtWord charclass[UCHAR_MAX+1];
+  /* index of the match vectors of each class occurring in u, 0 for the
+     other classes, whose match vector is empty */
+  GtUword classindex[UCHAR_MAX+1];
+  GtBitsequence *eqvectors, *pv, *mv;
+  GtUword eqvectors_alloc, vectors_alloc;
+};
+
+GtMyersEdist *gt_myersedist_new(const GtScoreHandler *scorehandler)
+{
+  GtMyersEdist *myersedist = gt_malloc(sizeof *myersedist);
+  GtUword cc;
+
+  gt_assert(scorehandler != NULL &&
+            !gt_scorehandler_has_scorematrix(scorehandler));
+  for (cc = 0; cc <= UCHAR_MAX; cc++)
+  {
+    myersedist->charclass[cc]
+      = gt_scorehandler_get_charclass(scorehandler, (GtUchar) cc);
+  }
+  myersedist->eqvectors = myersedist->pv = myersedist->mv = NULL;
+  myersedist->eqvectors_alloc = myersedist->vectors_alloc = 0;
+  return myersedist;
+}
+
+void gt_myersedist_delete(GtMyersEdist *myersedist)
+{
+  if (myersedist != NULL)
+  {
+    gt_free(myersedist->eqvectors);
+    gt_free(myersedist->pv);
+    gt_free(myersedist->mv);
+    gt_free(myersedist);
+  }
+}
+
+bool gt_myersedist_unitcost(const GtScoreHandler *scorehandler)
+{
+  gt_assert(scorehandler != NULL);
+  return !gt_scorehandler_has_scorematrix(scorehandler) &&
+         gt_scorehandler_get_matchscore(scorehandler) == 0 &&
+         gt_scorehandler_get_mismatchscore(scorehandler) == 1 &&
+         gt_scorehandler_get_gapscore(scorehandler) == 1 ? true : false;
+}
+
+/* assigns consecutive indices, starting with 1, to the character classes
+   occurring in <useq> and returns the number of match vectors required,
+   including the empty vector with index 0 */
+static GtUword gt_myersedist_classes(GtMyersEdist *myersedist,
+                                     const GtUchar *useq, GtUword ulen)
+{
+  GtUword idx, numofvectors = 1UL;
+
+  memset(myersedist->classindex, 0, sizeof myersedist->classindex);
+  for (idx = 0; idx < ulen; idx++)
+  {
+    const GtWord cc = myersedist->charclass[useq[idx]];
+
+    if (cc >= 0 && myersedist->classindex[cc] == 0)
+    {
+      myersedist->classindex[cc] = numofvectors++;
+    }
+  }
+  return numofvectors;
+}
+
+static GtUword gt_myersedist_index(const GtMyersEdist *myersedist, GtUchar cc)
+{
+  const GtWord cl = myersedist->charclass[cc];
+
+  return cl < 0 ? 0 : myersedist->classindex[cl];
+}
+
+/* clears <numofvectors> match vectors of <vectorwords> words each and returns
+   them */
+static GtBitsequence *gt_myersedist_eqvectors(GtMyersEdist *myersedist,
+                                              GtUword numofvectors,
+                                              GtUword vectorwords)
+{
+  const GtUword words = numofvectors * vectorwords;
+
+  if (words > myersedist->eqvectors_alloc)
+  {
+    myersedist->eqvectors_alloc = words;
+    myersedist->eqvectors = gt_realloc(myersedist->eqvectors,
+                                       sizeof *myersedist->eqvectors * words);
+  }
+  memset(myersedist->eqvectors, 0, sizeof *myersedist->eqvectors * words);
+  return myersedist->eqvectors;
+}
+
+static void gt_myersedist_vectors(GtMyersEdist *myersedist, GtUword words)
+{
+  if (words > myersedist->vectors_alloc)
+  {
+    myersedist->vectors_alloc = words;
+    myersedist->pv = gt_realloc(myersedist->pv,
+                                sizeof *myersedist->pv * words);
+    myersedist->mv = gt_realloc(myersedist->mv,
+                                sizeof *myersedist->mv * words);
+  }
+}
+
+/* advances the block of vertical differences <*pv> and <*mv> by one column
+   with match vector <eq> and horizontal difference <hin> above the block.
+   Returns the horizontal difference of the row given by <outmask> and stores
+   that of the first row of the block in <h0>, if not NULL. */
+static inline int gt_myersedist_block(GtBitsequence *pv, GtBitsequence *mv,
+                                      GtBitsequence eq, int hin,
+                                      GtBitsequence outmask, int *h0)
+{
+  GtBitsequence xv, xh, ph, mh;
+  int hout;
+
+  xv = eq | *mv;
+  if (hin < 0)
+  {
+    eq |= (GtBitsequence) 1;
+  }
+  xh = (((eq & *pv) + *pv) ^ *pv) | eq;
+  ph = *mv | ~(xh | *pv);
+  mh = *pv & xh;
+  hout = (ph & outmask) ? 1 : ((mh & outmask) ? -1 : 0);
+  if (h0 != NULL)
+  {
+    *h0 = (int) (ph & 1) - (int) (mh & 1);
+  }
+  ph <<= 1;
+  mh <<= 1;
+  if (hin < 0)
+  {
+    mh |= (GtBitsequence) 1;
+  } else
+  {
+    if (hin > 0)
+    {
+      ph |= (GtBitsequence) 1;
+    }
+  }
+  *pv = mh | ~(xv | ph);
+  *mv = ph & xv;
+  return hout;
+}
+
+GtUword gt_myersedist_global(GtMyersEdist *myersedist,
+                             const GtUchar *useq, GtUword ulen,
+                             const GtUchar *vseq, GtUword vlen)
+{
+  GtUword idx, jdx, words, numofvectors, score;
+  GtBitsequence *eqvectors, lastmask;
+
+  gt_assert(myersedist != NULL);
+  if (ulen == 0 || vlen == 0)
+  {
+    return ulen + vlen;
+  }
+  /* the columns are processed with u as the pattern, the match vector of
+     class c has bit i set if and only if u[i] belongs to c */
+  words = GT_NUMOFINTSFORBITS(ulen);
+  numofvectors = gt_myersedist_classes(myersedist, useq, ulen);
+  eqvectors = gt_myersedist_eqvectors(myersedist, numofvectors, words);
+  for (idx = 0; idx < ulen; idx++)
+  {
+    const GtUword vectoridx = gt_myersedist_index(myersedist, useq[idx]);
+
+    if (vectoridx > 0)
+    {
+      eqvectors[vectoridx * words + GT_DIVWORDSIZE(idx)]
+        |= (GtBitsequence) 1 << GT_MODWORDSIZE(idx);
+    }
+  }
+  gt_myersedist_vectors(myersedist, words);
+  for (idx = 0; idx < words; idx++)
+  {
+    myersedist->pv[idx] = ~(GtBitsequence) 0;
+    myersedist->mv[idx] = 0;
+  }
+  lastmask = (GtBitsequence) 1 << GT_MODWORDSIZE(ulen - 1);
+  score = ulen;
+  for (jdx = 0; jdx < vlen; jdx++)
+  {
+    const GtBitsequence *eq
+      = eqvectors + gt_myersedist_index(myersedist, vseq[jdx]) * words;
+    int hin = 1;
+
+    for (idx = 0; idx < words; idx++)
+    {
+      hin = gt_myersedist_block(myersedist->pv + idx, myersedist->mv + idx,
+                                eq[idx], hin,
+                                idx + 1 < words ? GT_FIRSTBIT : lastmask,
+                                NULL);
+    }
+    score += hin;
+  }
+  return score;
+}
+
+/* returns the bits <offset>...<offset>+w-1 of <vector> */
+static inline GtBitsequence gt_myersedist_window(const GtBitsequence *vector,
+                                                 GtUword offset)
+{
+  const GtUword wordidx = GT_DIVWORDSIZE(offset),
+                shift = GT_MODWORDSIZE(offset);
+
+  if (shift == 0)
+  {
+    return vector[wordidx];
+  }
+  return (vector[wordidx] >> shift) |
+         (vector[wordidx + 1] << (GT_INTWORDSIZE - shift));
+}
+
+/* The banded variant stores the vertical differences of the w entries of the
+   band in the current column j, bit k referring to row j - right_dist + k, so
+   that the vectors are shifted by one bit before each column. Rows outside of
+   the DP matrix are extended with mismatching characters and with entries
+   D(i,0) = |i| above row 0, which do not change the entries inside. The
+   entries left and above of the band are set to one more than their
+   neighbour inside the band, such that they are never minimal, like the
+   undefined entries of the banded DP. */
+GtUword gt_myersedist_banded(GtMyersEdist *myersedist,
+                             const GtUchar *useq, GtUword ulen,
+                             const GtUchar *vseq, GtUword vlen,
+                             GtWord left_dist, GtWord right_dist)
+{
+  GtUword idx, jdx, width, words, extwords, numofvectors, lastrow;
+  GtBitsequence *eqvectors, *pv, *mv, lastbit;
+  GtWord topvalue;
+
+  gt_assert(myersedist != NULL);
+  if (left_dist > GT_MIN(0, (GtWord) vlen - (GtWord) ulen) ||
+      right_dist < GT_MAX(0, (GtWord) vlen - (GtWord) ulen))
+  {
+    return GT_UWORD_MAX;
+  }
+  if (ulen == 0 || vlen == 0)
+  {
+    return ulen + vlen;
+  }
+  left_dist = GT_MAX(left_dist, -(GtWord) ulen);
+  right_dist = GT_MIN(right_dist, (GtWord) vlen);
+  width = (GtUword) (right_dist - left_dist + 1);
+  words = GT_NUMOFINTSFORBITS(width);
+  /* the match vectors extend over all windows, row i has bit i + right_dist,
+     such that the window of column j starts at bit j */
+  extwords = GT_DIVWORDSIZE(vlen) + words + 1;
+  numofvectors = gt_myersedist_classes(myersedist, useq, ulen);
+  eqvectors = gt_myersedist_eqvectors(myersedist, numofvectors, extwords);
+  for (idx = 0; idx < ulen; idx++)
+  {
+    const GtUword vectoridx = gt_myersedist_index(myersedist, useq[idx]),
+                  bit = idx + 1 + (GtUword) right_dist;
+
+    if (vectoridx > 0)
+    {
+      eqvectors[vectoridx * extwords + GT_DIVWORDSIZE(bit)]
+        |= (GtBitsequence) 1 << GT_MODWORDSIZE(bit);
+    }
+  }
+  gt_myersedist_vectors(myersedist, words);
+  pv = myersedist->pv;
+  mv = myersedist->mv;
+  memset(pv, 0, sizeof *pv * words);
+  memset(mv, 0, sizeof *mv * words);
+  /* column 0, bit 0 is shifted out before it is used */
+  for (idx = 0; idx < width; idx++)
+  {
+    if (idx > 0 && (GtWord) idx <= right_dist)
+    {
+      mv[GT_DIVWORDSIZE(idx)] |= (GtBitsequence) 1 << GT_MODWORDSIZE(idx);
+    } else
+    {
+      pv[GT_DIVWORDSIZE(idx)] |= (GtBitsequence) 1 << GT_MODWORDSIZE(idx);
+    }
+  }
+  topvalue = right_dist;
+  lastbit = (GtBitsequence) 1 << GT_MODWORDSIZE(width - 1);
+  for (jdx = 1; jdx <= vlen; jdx++)
+  {
+    const GtBitsequence *eq
+      = eqvectors + gt_myersedist_index(myersedist, vseq[jdx-1]) * extwords;
+    int hin = 1, h0 = 0, dv0;
+
+    for (idx = 0; idx + 1 < words; idx++)
+    {
+      pv[idx] = (pv[idx] >> 1) | (pv[idx+1] << (GT_INTWORDSIZE - 1));
+      mv[idx] = (mv[idx] >> 1) | (mv[idx+1] << (GT_INTWORDSIZE - 1));
+    }
+    pv[words-1] = (pv[words-1] >> 1) | lastbit;
+    mv[words-1] = (mv[words-1] >> 1) & ~lastbit;
+    dv0 = (int) (pv[0] & 1) - (int) (mv[0] & 1);
+    for (idx = 0; idx < words; idx++)
+    {
+      hin = gt_myersedist_block(pv + idx, mv + idx,
+                                gt_myersedist_window(eq,
+                                                     jdx + GT_MULWORDSIZE(idx)),
+                                hin, GT_FIRSTBIT, idx == 0 ? &h0 : NULL);
+    }
+    topvalue += dv0 + h0;
+  }
+  /* add the vertical differences down to row ulen */
+  lastrow = (GtUword) ((GtWord) ulen - (GtWord) vlen + right_dist);
+  for (idx = 1; idx <= lastrow; idx++)
+  {
+    const GtBitsequence mask = (GtBitsequence) 1 << GT_MODWORDSIZE(idx);
+
+    if (pv[GT_DIVWORDSIZE(idx)] & mask)
+    {
+      topvalue++;
+    } else
+    {
+      if (mv[GT_DIVWORDSIZE(idx)] & mask)
+      {
+        topvalue--;
+      }
+    }
+  }
+  gt_assert(topvalue >= 0);
+  return (GtUword) topvalue;
+}
+
+/* the scalar DP, restricted to the band from <left_dist> to <right_dist>, as
+   reference for the unit test */
+static GtUword gt_myersedist_reference(const GtScoreHandler *scorehandler,
+                                       const GtUchar *useq, GtUword ulen,
+                                       const GtUchar *vseq, GtUword vlen,
+                                       GtWord left_dist, GtWord right_dist)
+{
+  GtUword *column, idx, jdx, nw, distance;
+
+  column = gt_malloc(sizeof *column * (ulen + 1));
+  for (idx = 0; idx <= ulen; idx++)
+  {
+    column[idx] = -(GtWord) idx >= left_dist ? idx : GT_UWORD_MAX;
+  }
+  for (jdx = 1; jdx <= vlen; jdx++)
+  {
+    nw = column[0];
+    column[0] = (GtWord) jdx <= right_dist ? jdx : GT_UWORD_MAX;
+    for (idx = 1; idx <= ulen; idx++)
+    {
+      const GtWord diag = (GtWord) jdx - (GtWord) idx;
+      GtUword value = GT_UWORD_MAX, west = column[idx];
+
+      if (diag >= left_dist && diag <= right_dist)
+      {
+        if (nw != GT_UWORD_MAX)
+        {
+          value = nw + (GtUword) gt_scorehandler_get_replacement(scorehandler,
+                                                                useq[idx-1],
+                                                                vseq[jdx-1]);
+        }
+        if (west != GT_UWORD_MAX)
+        {
+          value = GT_MIN(value, west + 1);
+        }
+        if (column[idx-1] != GT_UWORD_MAX)
+        {
+          value = GT_MIN(value, column[idx-1] + 1);
+        }
+      }
+      column[idx] = value;
+      nw = west;
+    }
+  }
+  distance = column[ulen];
+  gt_free(column);
+  return distance;
+}
+
+int gt_myersedist_unit_test(GtError *err)
+{
+  const GtUword maxlen = 200UL;
+  const GtUchar plainchars[] = "acgtACGTn";
+  GtScoreHandler *mapped, *plain;
+  GtMyersEdist *myersedist_mapped, *myersedist_plain;
+  GtUchar *useq, *vseq;
+  GtUword trial, idx;
+  int had_err = 0;
+
+  gt_error_check(err);
+  mapped = gt_scorehandler_new(0, 1, 0, 1);
+  plain = gt_scorehandler_new(0, 1, 0, 1);
+  gt_scorehandler_plain(plain);
+  gt_scorehandler_downcase(plain);
+  gt_ensure(gt_myersedist_unitcost(mapped));
+  myersedist_mapped = gt_myersedist_new(mapped);
+  myersedist_plain = gt_myersedist_new(plain);
+  useq = gt_malloc(sizeof (*useq) * 2 * maxlen);
+  vseq = useq + maxlen;
+  for (trial = 0; !had_err && trial < 500UL; trial++)
+  {
+    const bool use_plain = gt_rand_max(1UL) == 1 ? true : false;
+    const GtScoreHandler *scorehandler = use_plain ? plain : mapped;
+    GtMyersEdist *myersedist = use_plain ? myersedist_plain
+                                         : myersedist_mapped;
+    GtUword ulen = gt_rand_max(maxlen),
+            vlen = gt_rand_max(maxlen),
+            alphasize = 2UL + gt_rand_max(18UL);
+    GtWord left_dist, right_dist;
+
+    /* some wildcards, which never match */
+    for (idx = 0; idx < ulen; idx++)
+    {
+      useq[idx] = use_plain
+                    ? plainchars[gt_rand_max(sizeof plainchars - 2)]
+                    : (gt_rand_max(50UL) == 0
+                         ? (GtUchar) GT_WILDCARD
+                         : (GtUchar) gt_rand_max(alphasize-1));
+    }
+    for (idx = 0; idx < vlen; idx++)
+    {
+      /* similar sequences have distances below the band widths */
+      if (idx < ulen && gt_rand_max(3UL) > 0)
+      {
+        vseq[idx] = useq[idx];
+      } else
+      {
+        vseq[idx] = use_plain
+                      ? plainchars[gt_rand_max(sizeof plainchars - 2)]
+                      : (gt_rand_max(50UL) == 0
+                           ? (GtUchar) GT_WILDCARD
+                           : (GtUchar) gt_rand_max(alphasize-1));
+      }
+    }
+    gt_ensure(gt_myersedist_global(myersedist, useq, ulen, vseq, vlen) ==
+              gt_myersedist_reference(scorehandler, useq, ulen, vseq, vlen,
+                                      -(GtWord) ulen, (GtWord) vlen));
+    left_dist = GT_MIN(0, (GtWord) vlen - (GtWord) ulen)
+                - (GtWord) gt_rand_max(100UL);
+    right_dist = GT_MAX(0, (GtWord) vlen - (GtWord) ulen)
+                 + (GtWord) gt_rand_max(100UL);
+    gt_ensure(gt_myersedist_banded(myersedist, useq, ulen, vseq, vlen,
+                                   left_dist, right_dist) ==
+              gt_myersedist_reference(scorehandler, useq, ulen, vseq, vlen,
+                                      left_dist, right_dist));
+    gt_ensure(gt_myersedist_banded(myersedist, useq, ulen, vseq, vlen,
+                                   -(GtWord) ulen - 1, (GtWord) vlen + 1) ==
+              gt_myersedist_global(myersedist, useq, ulen, vseq, vlen));
+    if (ulen != vlen)
+    {
+      gt_ensure(gt_myersedist_banded(myersedist, useq, ulen, vseq, vlen,
+                                     0, 0) == GT_UWORD_MAX);
+    }
+  }
+  gt_free(useq);
+  gt_myersedist_delete(myersedist_mapped);
+  gt_myersedist_delete(myersedist_plain);
+  gt_scorehandler_delete(mapped);
+  gt_scorehandler_delete(plain);
+  return had_err;
+}
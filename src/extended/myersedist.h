@@ -0,0 +1,67 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef MYERSEDIST_H
+#define MYERSEDIST_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+#include "extended/scorehandler.h"
+
+/* The <GtMyersEdist> class computes unit edit distances of two sequences with
+   the bit-parallel algorithm of Myers, in the block-based formulation of
+   Hyyrö for patterns longer than a machine word. Besides the global distance,
+   the distance restricted to a diagonal band is computed by Hyyrö's banded
+   variant, which stores the vertical differences along the band instead of
+   the column. Both need O(n * ceil(m/w)) time for a pattern of length m, a
+   text of length n and word size w, where m is the length of u for the global
+   and the width of the band for the banded distance. Two characters match if
+   the <GtScoreHandler> given to the constructor compares them with the match
+   cost, a special character in a mapped sequence never matches. The internal
+   buffers are reused, so that one object should be used for many sequence
+   pairs. */
+typedef struct GtMyersEdist GtMyersEdist;
+
+/* Returns a new <GtMyersEdist> comparing characters like <scorehandler>,
+   which must not have a score matrix. */
+GtMyersEdist* gt_myersedist_new(const GtScoreHandler *scorehandler);
+
+void          gt_myersedist_delete(GtMyersEdist *myersedist);
+
+/* Returns true if and only if the linear gap costs of <scorehandler> are unit
+   costs, i.e. 0 for matches and 1 for mismatches and indels, such that the
+   distances of the linear aligners are edit distances. */
+bool          gt_myersedist_unitcost(const GtScoreHandler *scorehandler);
+
+/* Returns the unit edit distance of <useq> of length <ulen> and <vseq> of
+   length <vlen>. */
+GtUword       gt_myersedist_global(GtMyersEdist *myersedist,
+                                   const GtUchar *useq, GtUword ulen,
+                                   const GtUchar *vseq, GtUword vlen);
+
+/* Returns the unit edit distance of <useq> of length <ulen> and <vseq> of
+   length <vlen> over all alignments, which stay in the diagonal band from
+   <left_dist> to <right_dist>, where diagonal d consists of the entries (i,j)
+   with j - i = d. Returns <GT_UWORD_MAX>, if the band does not contain the
+   diagonals 0 and <vlen> - <ulen>. */
+GtUword       gt_myersedist_banded(GtMyersEdist *myersedist,
+                                   const GtUchar *useq, GtUword ulen,
+                                   const GtUchar *vseq, GtUword vlen,
+                                   GtWord left_dist, GtWord right_dist);
+
+int           gt_myersedist_unit_test(GtError *err);
+
+#endif
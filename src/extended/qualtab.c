@@ -0,0 +1,576 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <limits.h>
+#include <string.h>
+#include "core/array_api.h"
+#include "core/assert_api.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/intbits.h"
+#include "core/ma_api.h"
+#include "core/str_api.h"
+#include "core/undef_api.h"
+#include "core/xansi_api.h"
+#include "core/xposix_api.h"
+#include "extended/bitoutstream.h"
+#include "extended/huffcode.h"
+#include "extended/qualtab.h"
+
+/* The quality table consists of a sequence of blocks, followed by the block
+   index and a trailer. All entries are of type GtUword. A block stores
+
+     number of sequences
+     common length of the sequences or GT_UNDEF_UWORD
+     number of different quality values
+     (quality value, frequency) for each different quality value
+     length of each sequence, if the lengths differ
+     number of bits of the Huffman coded qualities
+     the Huffman coded qualities, most significant bits first
+
+   The coded qualities are omitted if the block contains less than two
+   different quality values. The block index stores the number of the first
+   sequence and the offset of each block, the trailer the number of blocks,
+   the number of sequences and the offset of the block index. */
+
+/* a block is completed as soon as it contains at least this many quality
+   values or sequences */
+#define GT_QUALTAB_BLOCKSIZE    (1UL << 18)
+#define GT_QUALTAB_BLOCKSEQS    (1UL << 16)
+#define GT_QUALTAB_NUMOFCHARS   (UCHAR_MAX + 1)
+#define GT_QUALTAB_TRAILERSIZE  3UL
+
+struct GtQualTabWriter {
+  FILE *fp;
+  GtStr *path;
+  GtBitOutStream *bitstream;
+  GtUchar *qualities;
+  GtUword numofqualities,
+          allocatedqualities,
+          equallength,
+          numofsequences,
+          firstseqnum,
+          offset;
+  GtArray *seqlengths,
+          *blockindex;
+  GtUint64 distribution[GT_QUALTAB_NUMOFCHARS];
+};
+
+static GtUint64 gt_qualtab_distr_func(const void *distribution,
+                                      GtUword symbol)
+{
+  return ((const GtUint64 *) distribution)[symbol];
+}
+
+GtQualTabWriter* gt_qualtab_writer_new(const char *indexname, GtError *err)
+{
+  GtQualTabWriter *qtw;
+  FILE *fp;
+
+  gt_error_check(err);
+  gt_assert(indexname != NULL);
+  fp = gt_fa_fopen_with_suffix(indexname, GT_QUALTABFILESUFFIX, "wb", err);
+  if (fp == NULL)
+    return NULL;
+  qtw = gt_calloc((size_t) 1, sizeof (*qtw));
+  qtw->fp = fp;
+  qtw->path = gt_str_new_cstr(indexname);
+  gt_str_append_cstr(qtw->path, GT_QUALTABFILESUFFIX);
+  qtw->bitstream = gt_bitoutstream_new(fp);
+  qtw->seqlengths = gt_array_new(sizeof (GtUword));
+  qtw->blockindex = gt_array_new(sizeof (GtUword));
+  return qtw;
+}
+
+static void gt_qualtab_writer_put(GtQualTabWriter *qtw, GtUword value)
+{
+  gt_xfwrite(&value, sizeof (value), (size_t) 1, qtw->fp);
+  qtw->offset++;
+}
+
+static void gt_qualtab_writer_write_block(GtQualTabWriter *qtw)
+{
+  GtUword idx, numofseqs, numofsymbols = 0, numofbits = 0;
+  GtBitsequence codes[GT_QUALTAB_NUMOFCHARS];
+  unsigned int codelengths[GT_QUALTAB_NUMOFCHARS];
+
+  numofseqs = gt_array_size(qtw->seqlengths);
+  if (numofseqs == 0)
+    return;
+  gt_array_add(qtw->blockindex, qtw->firstseqnum);
+  gt_array_add(qtw->blockindex, qtw->offset);
+  for (idx = 0; idx < (GtUword) GT_QUALTAB_NUMOFCHARS; idx++) {
+    if (qtw->distribution[idx] > 0)
+      numofsymbols++;
+  }
+  if (numofsymbols > 1UL) {
+    GtHuffman *huffman = gt_huffman_new(qtw->distribution,
+                                        gt_qualtab_distr_func,
+                                        (GtUword) GT_QUALTAB_NUMOFCHARS);
+    for (idx = 0; idx < (GtUword) GT_QUALTAB_NUMOFCHARS; idx++) {
+      if (qtw->distribution[idx] > 0) {
+        gt_huffman_encode(huffman, idx, codes + idx, codelengths + idx);
+        numofbits += (GtUword) qtw->distribution[idx] * codelengths[idx];
+      }
+    }
+    gt_huffman_delete(huffman);
+  }
+  gt_qualtab_writer_put(qtw, numofseqs);
+  gt_qualtab_writer_put(qtw, qtw->equallength);
+  gt_qualtab_writer_put(qtw, numofsymbols);
+  for (idx = 0; idx < (GtUword) GT_QUALTAB_NUMOFCHARS; idx++) {
+    if (qtw->distribution[idx] > 0) {
+      gt_qualtab_writer_put(qtw, idx);
+      gt_qualtab_writer_put(qtw, (GtUword) qtw->distribution[idx]);
+    }
+  }
+  if (qtw->equallength == GT_UNDEF_UWORD) {
+    for (idx = 0; idx < numofseqs; idx++)
+      gt_qualtab_writer_put(qtw,
+                            *(GtUword *) gt_array_get(qtw->seqlengths, idx));
+  }
+  gt_qualtab_writer_put(qtw, numofbits);
+  if (numofbits > 0) {
+    for (idx = 0; idx < qtw->numofqualities; idx++) {
+      GtUchar cc = qtw->qualities[idx];
+      gt_bitoutstream_append(qtw->bitstream, codes[cc], codelengths[cc]);
+    }
+    gt_bitoutstream_flush(qtw->bitstream);
+    qtw->offset += (numofbits + GT_INTWORDSIZE - 1) / GT_INTWORDSIZE;
+  }
+  qtw->firstseqnum += numofseqs;
+  qtw->numofqualities = 0;
+  gt_array_reset(qtw->seqlengths);
+  memset(qtw->distribution, 0, sizeof (qtw->distribution));
+}
+
+int gt_qualtab_writer_add(GtQualTabWriter *qtw, const GtUchar *qualities,
+                          GtUword length, GtError *err)
+{
+  GtUword idx;
+
+  gt_error_check(err);
+  gt_assert(qtw != NULL && (qualities != NULL || length == 0));
+  if (qtw->fp == NULL) {
+    gt_error_set(err, "quality table has already been finished");
+    return -1;
+  }
+  if (qtw->numofqualities + length > qtw->allocatedqualities) {
+    qtw->allocatedqualities = qtw->numofqualities + length
+                              + GT_QUALTAB_BLOCKSIZE / 4;
+    qtw->qualities = gt_realloc(qtw->qualities,
+                                sizeof (*qtw->qualities)
+                                * qtw->allocatedqualities);
+  }
+  for (idx = 0; idx < length; idx++)
+    qtw->distribution[qualities[idx]]++;
+  memcpy(qtw->qualities + qtw->numofqualities, qualities,
+         sizeof (*qualities) * length);
+  qtw->numofqualities += length;
+  if (gt_array_size(qtw->seqlengths) == 0)
+    qtw->equallength = length;
+  else if (qtw->equallength != length)
+    qtw->equallength = GT_UNDEF_UWORD;
+  gt_array_add(qtw->seqlengths, length);
+  qtw->numofsequences++;
+  if (qtw->numofqualities >= GT_QUALTAB_BLOCKSIZE
+      || gt_array_size(qtw->seqlengths) >= GT_QUALTAB_BLOCKSEQS)
+    gt_qualtab_writer_write_block(qtw);
+  return 0;
+}
+
+int gt_qualtab_writer_finish(GtQualTabWriter *qtw, GtError *err)
+{
+  GtUword idx, indexoffset;
+
+  gt_error_check(err);
+  gt_assert(qtw != NULL);
+  if (qtw->fp == NULL) {
+    gt_error_set(err, "quality table has already been finished");
+    return -1;
+  }
+  gt_qualtab_writer_write_block(qtw);
+  indexoffset = qtw->offset;
+  for (idx = 0; idx < gt_array_size(qtw->blockindex); idx++)
+    gt_qualtab_writer_put(qtw,
+                          *(GtUword *) gt_array_get(qtw->blockindex, idx));
+  gt_qualtab_writer_put(qtw, gt_array_size(qtw->blockindex) / 2);
+  gt_qualtab_writer_put(qtw, qtw->numofsequences);
+  gt_qualtab_writer_put(qtw, indexoffset);
+  gt_bitoutstream_delete(qtw->bitstream);
+  qtw->bitstream = NULL;
+  gt_fa_fclose(qtw->fp);
+  qtw->fp = NULL;
+  return 0;
+}
+
+void gt_qualtab_writer_delete(GtQualTabWriter *qtw)
+{
+  if (qtw == NULL) return;
+  gt_bitoutstream_delete(qtw->bitstream);
+  if (qtw->fp != NULL) {
+    gt_fa_fclose(qtw->fp);
+    gt_xunlink(gt_str_get(qtw->path));
+  }
+  gt_str_delete(qtw->path);
+  gt_free(qtw->qualities);
+  gt_array_delete(qtw->seqlengths);
+  gt_array_delete(qtw->blockindex);
+  gt_free(qtw);
+}
+
+typedef struct {
+  GtUword numofseqs,
+          equallength,
+          numofsymbols,
+          numofbits,
+          numofwords;
+  const GtUword *symbols,
+                *seqlengths;
+  const GtBitsequence *bits;
+} GtQualTabBlock;
+
+struct GtQualTab {
+  void *map;
+  const GtUword *words,
+                *blockindex;
+  GtUword numofwords,
+          numofblocks,
+          numofsequences;
+};
+
+GtQualTab* gt_qualtab_new(const char *indexname, GtError *err)
+{
+  GtQualTab *qualtab;
+  size_t numofbytes = 0;
+  void *map;
+  GtUword indexoffset;
+  bool haserr = false;
+
+  gt_error_check(err);
+  gt_assert(indexname != NULL);
+  map = gt_fa_mmap_read_with_suffix(indexname, GT_QUALTABFILESUFFIX,
+                                    &numofbytes, err);
+  if (map == NULL)
+    return NULL;
+  qualtab = gt_calloc((size_t) 1, sizeof (*qualtab));
+  qualtab->map = map;
+  qualtab->words = map;
+  qualtab->numofwords = (GtUword) (numofbytes / sizeof (GtUword));
+  if (numofbytes % sizeof (GtUword) != 0
+      || qualtab->numofwords < GT_QUALTAB_TRAILERSIZE) {
+    haserr = true;
+  }
+  else {
+    const GtUword *trailer = qualtab->words + qualtab->numofwords
+                             - GT_QUALTAB_TRAILERSIZE;
+    qualtab->numofblocks = trailer[0];
+    qualtab->numofsequences = trailer[1];
+    indexoffset = trailer[2];
+    if (indexoffset > qualtab->numofwords
+        || qualtab->numofblocks > qualtab->numofwords
+        || indexoffset + 2 * qualtab->numofblocks + GT_QUALTAB_TRAILERSIZE
+           != qualtab->numofwords) {
+      haserr = true;
+    }
+    else
+      qualtab->blockindex = qualtab->words + indexoffset;
+  }
+  if (haserr) {
+    gt_error_set(err, "file %s%s is not a valid quality table", indexname,
+                 GT_QUALTABFILESUFFIX);
+    gt_qualtab_delete(qualtab);
+    return NULL;
+  }
+  return qualtab;
+}
+
+GtUword gt_qualtab_num_of_sequences(const GtQualTab *qualtab)
+{
+  gt_assert(qualtab != NULL);
+  return qualtab->numofsequences;
+}
+
+static GtUword gt_qualtab_blocknum(const GtQualTab *qualtab, GtUword seqnum)
+{
+  GtUword left = 0, right = qualtab->numofblocks - 1;
+
+  gt_assert(seqnum < qualtab->numofsequences && qualtab->numofblocks > 0);
+  while (left < right) {
+    GtUword mid = left + (right - left + 1) / 2;
+    if (qualtab->blockindex[2 * mid] <= seqnum)
+      left = mid;
+    else
+      right = mid - 1;
+  }
+  return left;
+}
+
+static void gt_qualtab_block(GtQualTabBlock *block, const GtQualTab *qualtab,
+                             GtUword blocknum)
+{
+  const GtUword *ptr = qualtab->words + qualtab->blockindex[2 * blocknum + 1];
+
+  block->numofseqs = *ptr++;
+  block->equallength = *ptr++;
+  block->numofsymbols = *ptr++;
+  block->symbols = ptr;
+  ptr += 2 * block->numofsymbols;
+  if (block->equallength == GT_UNDEF_UWORD) {
+    block->seqlengths = ptr;
+    ptr += block->numofseqs;
+  }
+  else
+    block->seqlengths = NULL;
+  block->numofbits = *ptr++;
+  block->numofwords = (block->numofbits + GT_INTWORDSIZE - 1)
+                      / GT_INTWORDSIZE;
+  block->bits = (const GtBitsequence *) ptr;
+}
+
+GtUword gt_qualtab_seqlength(const GtQualTab *qualtab, GtUword seqnum)
+{
+  GtUword blocknum;
+  GtQualTabBlock block;
+
+  gt_assert(qualtab != NULL);
+  blocknum = gt_qualtab_blocknum(qualtab, seqnum);
+  gt_qualtab_block(&block, qualtab, blocknum);
+  if (block.seqlengths == NULL)
+    return block.equallength;
+  return block.seqlengths[seqnum - qualtab->blockindex[2 * blocknum]];
+}
+
+void gt_qualtab_delete(GtQualTab *qualtab)
+{
+  if (qualtab == NULL) return;
+  gt_fa_xmunmap(qualtab->map);
+  gt_free(qualtab);
+}
+
+struct GtQualTabReader {
+  const GtQualTab *qualtab;
+  GtUword blocknum,
+          firstseqnum,
+          numofblockseqs,
+          allocatedqualities,
+          allocatedseqs;
+  GtUchar *qualities;
+  GtUword *seqstarts;
+  GtArray *symbols;
+};
+
+GtQualTabReader* gt_qualtab_reader_new(const GtQualTab *qualtab)
+{
+  GtQualTabReader *qtr;
+
+  gt_assert(qualtab != NULL);
+  qtr = gt_calloc((size_t) 1, sizeof (*qtr));
+  qtr->qualtab = qualtab;
+  qtr->blocknum = GT_UNDEF_UWORD;
+  qtr->symbols = gt_array_new(sizeof (GtUword));
+  return qtr;
+}
+
+/* decodes all qualities of block <blocknum> into the buffer of <qtr> */
+static int gt_qualtab_reader_decode_block(GtQualTabReader *qtr,
+                                          GtUword blocknum, GtError *err)
+{
+  GtQualTabBlock block;
+  GtUword idx, total = 0;
+  int had_err = 0;
+
+  gt_qualtab_block(&block, qtr->qualtab, blocknum);
+  if (block.numofseqs + 1 > qtr->allocatedseqs) {
+    qtr->allocatedseqs = block.numofseqs + 1;
+    qtr->seqstarts = gt_realloc(qtr->seqstarts,
+                                sizeof (*qtr->seqstarts) * qtr->allocatedseqs);
+  }
+  for (idx = 0; idx < block.numofseqs; idx++) {
+    qtr->seqstarts[idx] = total;
+    total += block.seqlengths == NULL ? block.equallength
+                                      : block.seqlengths[idx];
+  }
+  qtr->seqstarts[block.numofseqs] = total;
+  if (total > qtr->allocatedqualities) {
+    qtr->allocatedqualities = total;
+    qtr->qualities = gt_realloc(qtr->qualities,
+                                sizeof (*qtr->qualities) * total);
+  }
+  if (block.numofsymbols == 1UL) {
+    memset(qtr->qualities, (int) block.symbols[0], (size_t) total);
+  }
+  else if (block.numofsymbols > 1UL && total > 0) {
+    GtUint64 distribution[GT_QUALTAB_NUMOFCHARS];
+    GtHuffman *huffman;
+    GtHuffmanDecoder *decoder;
+
+    memset(distribution, 0, sizeof (distribution));
+    for (idx = 0; idx < block.numofsymbols; idx++)
+      distribution[block.symbols[2 * idx]] =
+        (GtUint64) block.symbols[2 * idx + 1];
+    huffman = gt_huffman_new(distribution, gt_qualtab_distr_func,
+                             (GtUword) GT_QUALTAB_NUMOFCHARS);
+    decoder = gt_huffman_decoder_new(huffman,
+                                     (GtBitsequence *) block.bits,
+                                     block.numofwords, 0,
+                                     block.numofwords * GT_INTWORDSIZE
+                                       - block.numofbits);
+    gt_array_reset(qtr->symbols);
+    if (gt_huffman_decoder_next(decoder, qtr->symbols, total, err) < 0)
+      had_err = -1;
+    else if (gt_array_size(qtr->symbols) != total) {
+      gt_error_set(err, "quality table is truncated: decoded " GT_WU
+                   " instead of " GT_WU " quality values",
+                   gt_array_size(qtr->symbols), total);
+      had_err = -1;
+    }
+    if (!had_err) {
+      const GtUword *symbols = gt_array_get_space(qtr->symbols);
+      for (idx = 0; idx < total; idx++)
+        qtr->qualities[idx] = (GtUchar) symbols[idx];
+    }
+    gt_huffman_decoder_delete(decoder);
+    gt_huffman_delete(huffman);
+  }
+  if (!had_err) {
+    qtr->blocknum = blocknum;
+    qtr->firstseqnum = qtr->qualtab->blockindex[2 * blocknum];
+    qtr->numofblockseqs = block.numofseqs;
+  }
+  else
+    qtr->blocknum = GT_UNDEF_UWORD;
+  return had_err;
+}
+
+int gt_qualtab_reader_extract(GtQualTabReader *qtr, GtUchar *buffer,
+                              GtUword seqnum, GtError *err)
+{
+  GtUword blocknum, relseqnum;
+
+  gt_error_check(err);
+  gt_assert(qtr != NULL && buffer != NULL);
+  if (seqnum >= qtr->qualtab->numofsequences) {
+    gt_error_set(err, "sequence number " GT_WU " exceeds number of sequences "
+                 "in quality table (" GT_WU ")", seqnum,
+                 qtr->qualtab->numofsequences);
+    return -1;
+  }
+  if (qtr->blocknum == GT_UNDEF_UWORD || seqnum < qtr->firstseqnum
+      || seqnum >= qtr->firstseqnum + qtr->numofblockseqs) {
+    blocknum = gt_qualtab_blocknum(qtr->qualtab, seqnum);
+    if (gt_qualtab_reader_decode_block(qtr, blocknum, err) != 0)
+      return -1;
+  }
+  relseqnum = seqnum - qtr->firstseqnum;
+  memcpy(buffer, qtr->qualities + qtr->seqstarts[relseqnum],
+         (size_t) (qtr->seqstarts[relseqnum + 1]
+                   - qtr->seqstarts[relseqnum]));
+  return 0;
+}
+
+void gt_qualtab_reader_delete(GtQualTabReader *qtr)
+{
+  if (qtr == NULL) return;
+  gt_free(qtr->qualities);
+  gt_free(qtr->seqstarts);
+  gt_array_delete(qtr->symbols);
+  gt_free(qtr);
+}
+
+int gt_qualtab_unit_test(GtError *err)
+{
+  const GtUword numofseqs = 4000UL, maxlength = 200UL;
+  GtStr *indexname;
+  GtQualTabWriter *qtw;
+  GtQualTab *qualtab = NULL;
+  GtQualTabReader *qtr;
+  GtUchar *qualities, *buffer;
+  GtUword *lengths, *starts, seqnum, idx, total = 0;
+  FILE *fp;
+  char path[BUFSIZ];
+  int had_err = 0;
+
+  gt_error_check(err);
+  lengths = gt_malloc(sizeof (*lengths) * numofseqs);
+  starts = gt_malloc(sizeof (*starts) * numofseqs);
+  /* sequences of varying length, a run of sequences of equal length, empty
+     sequences and sequences with a single quality value */
+  for (seqnum = 0; seqnum < numofseqs; seqnum++) {
+    starts[seqnum] = total;
+    if (seqnum < 1500UL || seqnum >= 3000UL)
+      lengths[seqnum] = seqnum % 7 == 0 ? 0 : (seqnum * 37) % maxlength;
+    else
+      lengths[seqnum] = maxlength;
+    total += lengths[seqnum];
+  }
+  qualities = gt_malloc(sizeof (*qualities) * total);
+  for (seqnum = 0; seqnum < numofseqs; seqnum++) {
+    for (idx = 0; idx < lengths[seqnum]; idx++) {
+      qualities[starts[seqnum] + idx]
+        = seqnum >= 3500UL ? (GtUchar) 'I'
+                           : (GtUchar) ('!' + (idx * idx + seqnum) % 41);
+    }
+  }
+  buffer = gt_malloc(sizeof (*buffer) * maxlength);
+
+  indexname = gt_str_new();
+  fp = gt_xtmpfp(indexname);
+  gt_fa_xfclose(fp);
+  qtw = gt_qualtab_writer_new(gt_str_get(indexname), err);
+  gt_ensure(qtw != NULL);
+  for (seqnum = 0; !had_err && seqnum < numofseqs; seqnum++)
+    had_err = gt_qualtab_writer_add(qtw, qualities + starts[seqnum],
+                                    lengths[seqnum], err);
+  if (!had_err)
+    had_err = gt_qualtab_writer_finish(qtw, err);
+  gt_qualtab_writer_delete(qtw);
+  if (!had_err) {
+    qualtab = gt_qualtab_new(gt_str_get(indexname), err);
+    gt_ensure(qualtab != NULL);
+  }
+  if (!had_err) {
+    gt_ensure(gt_qualtab_num_of_sequences(qualtab) == numofseqs);
+    gt_ensure(qualtab->numofblocks > 1UL);
+    for (seqnum = 0; !had_err && seqnum < numofseqs; seqnum++)
+      gt_ensure(gt_qualtab_seqlength(qualtab, seqnum) == lengths[seqnum]);
+  }
+  /* extract in ascending order and in an order jumping between blocks */
+  if (!had_err) {
+    qtr = gt_qualtab_reader_new(qualtab);
+    for (idx = 0; !had_err && idx < 2 * numofseqs; idx++) {
+      seqnum = idx < numofseqs ? idx : ((idx - numofseqs) * 1117) % numofseqs;
+      had_err = gt_qualtab_reader_extract(qtr, buffer, seqnum, err);
+      gt_ensure(memcmp(buffer, qualities + starts[seqnum],
+                       (size_t) lengths[seqnum]) == 0);
+    }
+    if (!had_err)
+      gt_ensure(gt_qualtab_reader_extract(qtr, buffer, numofseqs, err) != 0);
+    gt_error_unset(err);
+    gt_qualtab_reader_delete(qtr);
+  }
+  gt_qualtab_delete(qualtab);
+  (void) snprintf(path, sizeof (path), "%s%s", gt_str_get(indexname),
+                  GT_QUALTABFILESUFFIX);
+  gt_xunlink(path);
+  gt_xunlink(gt_str_get(indexname));
+  gt_str_delete(indexname);
+  gt_free(buffer);
+  gt_free(qualities);
+  gt_free(starts);
+  gt_free(lengths);
+  return had_err;
+}
@@ -0,0 +1,92 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef QUALTAB_H
+#define QUALTAB_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+#define GT_QUALTABFILESUFFIX ".qlt"
+
+/* The <GtQualTabWriter> class writes the quality strings of a stream of
+   sequences, for example read from FASTQ files while encoding them as a
+   <GtEncseq>, to a compressed side table with suffix <GT_QUALTABFILESUFFIX>.
+   The qualities are Huffman coded in blocks of consecutive sequences, each
+   block with a code for its own distribution of quality values. Thus the
+   qualities can be written in a single pass and are accessible block by
+   block. */
+typedef struct GtQualTabWriter GtQualTabWriter;
+
+/* The <GtQualTab> class gives access to a quality table written by a
+   <GtQualTabWriter>. It is not changed after creation and can be shared by
+   several threads, each extracting qualities with its own <GtQualTabReader>. */
+typedef struct GtQualTab GtQualTab;
+
+/* The <GtQualTabReader> class extracts the qualities of single sequences from
+   a <GtQualTab>. The decoded block of the last extraction is kept, so that
+   sequences should be extracted in ascending order. */
+typedef struct GtQualTabReader GtQualTabReader;
+
+/* Returns a new <GtQualTabWriter> writing to the quality table of the index
+   <indexname>. Returns NULL and sets <err> if the file cannot be created. */
+GtQualTabWriter* gt_qualtab_writer_new(const char *indexname, GtError *err);
+
+/* Appends the <length> quality values in <qualities> as those of the next
+   sequence to <qtw>. Returns 0 on success and -1 on error, in which case <err>
+   is set. */
+int              gt_qualtab_writer_add(GtQualTabWriter *qtw,
+                                       const GtUchar *qualities,
+                                       GtUword length,
+                                       GtError *err);
+
+/* Writes the remaining qualities and the block index of <qtw> and closes the
+   quality table. Returns 0 on success and -1 on error, in which case <err> is
+   set. */
+int              gt_qualtab_writer_finish(GtQualTabWriter *qtw, GtError *err);
+
+/* Deletes <qtw>. If <gt_qualtab_writer_finish()> was not called, the
+   incomplete quality table is removed. */
+void             gt_qualtab_writer_delete(GtQualTabWriter *qtw);
+
+/* Returns a new <GtQualTab> for the quality table of the index <indexname>,
+   which is mapped into memory. Returns NULL and sets <err> on error. */
+GtQualTab*       gt_qualtab_new(const char *indexname, GtError *err);
+
+/* Returns the number of sequences in <qualtab>. */
+GtUword          gt_qualtab_num_of_sequences(const GtQualTab *qualtab);
+
+/* Returns the number of quality values of sequence <seqnum> in <qualtab>. */
+GtUword          gt_qualtab_seqlength(const GtQualTab *qualtab, GtUword seqnum);
+
+void             gt_qualtab_delete(GtQualTab *qualtab);
+
+/* Returns a new <GtQualTabReader> for <qualtab>. */
+GtQualTabReader* gt_qualtab_reader_new(const GtQualTab *qualtab);
+
+/* Writes the quality values of sequence <seqnum> to <buffer>, which must
+   provide space for <gt_qualtab_seqlength()> characters. Returns 0 on success
+   and -1 on error, in which case <err> is set. */
+int              gt_qualtab_reader_extract(GtQualTabReader *qtr,
+                                           GtUchar *buffer,
+                                           GtUword seqnum,
+                                           GtError *err);
+
+void             gt_qualtab_reader_delete(GtQualTabReader *qtr);
+
+int              gt_qualtab_unit_test(GtError *err);
+
+#endif
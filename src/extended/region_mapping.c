@@ -21,6 +21,7 @@
 #include "lauxlib.h"
 #include "lualib.h"
 #include "core/assert_api.h"
+#include "core/bgzf_seq_col.h"
 #include "core/bioseq_api.h"
 #include "core/bioseq_col.h"
 #include "core/encseq.h"
@@ -146,6 +147,22 @@ static GtStr* region_mapping_map(GtRegionMapping *rm,
     return gt_mapping_map_string(rm->mapping, sequence_region, err);
 }
 
+/* BGZF compressed sequence files are accessed via their block index, all other
+   files are loaded as <GtBioseq>. So are BGZF compressed files which cannot be
+   indexed, e.g. because their lines are of different length. */
+static GtSeqCol* region_mapping_seq_col_new(GtStrArray *sequence_filenames,
+                                            GtError *err)
+{
+  GtSeqCol *seq_col;
+  gt_error_check(err);
+  if (gt_bgzf_seq_col_applicable(sequence_filenames)) {
+    if ((seq_col = gt_bgzf_seq_col_new(sequence_filenames, err)))
+      return seq_col;
+    gt_error_unset(err);
+  }
+  return gt_bioseq_col_new(sequence_filenames, err);
+}
+
 static int update_seq_col_if_necessary(GtRegionMapping *rm, GtStr *seqid,
                                        GtError *err)
 {
@@ -179,7 +196,7 @@ static int update_seq_col_if_necessary(GtRegionMapping *rm, GtStr *seqid,
           gt_str_reset(rm->sequence_name);
         gt_str_append_str(rm->sequence_name, seqid);
         gt_seq_col_delete(rm->seq_col);
-        rm->seq_col = gt_bioseq_col_new(rm->sequence_filenames, err);
+        rm->seq_col = region_mapping_seq_col_new(rm->sequence_filenames, err);
         if (!rm->seq_col)
           had_err = -1;
       }
@@ -192,7 +209,8 @@ static int update_seq_col_if_necessary(GtRegionMapping *rm, GtStr *seqid,
           had_err = -1;
       } else {
         gt_assert(rm->sequence_filenames);
-        if (!(rm->seq_col = gt_bioseq_col_new(rm->sequence_filenames, err)))
+        if (!(rm->seq_col = region_mapping_seq_col_new(rm->sequence_filenames,
+                                                       err)))
           had_err = -1;
       }
       /* handle -matchdescstart, i.e. load seqids into cache */
@@ -271,9 +289,11 @@ int gt_region_mapping_get_sequence(GtRegionMapping *rm, char **seq,
           had_err = -1;
         }
       }
-      if (!had_err) {
-        *seq = gt_seq_col_get_sequence(rm->seq_col, filenum, seqnum,
-                                       start - offset, end - offset);
+      if (!had_err &&
+          !(*seq = gt_seq_col_get_sequence(rm->seq_col, filenum, seqnum,
+                                           start - offset, end - offset,
+                                           err))) {
+        had_err = -1;
       }
     } else if (rm->matchdesc) {
       gt_assert(!rm->seqid2seqnum_mapping);
@@ -334,9 +354,10 @@ int gt_region_mapping_get_sequence(GtRegionMapping *rm, char **seq,
                        "correctly?",
                        start, end, gt_str_get(seqid), seqlength);
         }
-        if (!had_err) {
-          *seq = gt_seq_col_get_sequence(rm->seq_col, 0, 0, start - offset,
-                                         end - offset);
+        if (!had_err &&
+            !(*seq = gt_seq_col_get_sequence(rm->seq_col, 0, 0, start - offset,
+                                             end - offset, err))) {
+          had_err = -1;
         }
       }
     } else {
@@ -435,10 +456,13 @@ int gt_region_mapping_get_description(GtRegionMapping *rm, GtStr *desc,
                                             &filenum, NULL, err);
       if (!had_err) {
         char *cdesc;
-        cdesc = gt_seq_col_get_description(rm->seq_col, filenum, seqnum);
-        gt_assert(cdesc);
-        gt_str_append_cstr(desc, cdesc);
-        gt_free(cdesc);
+        if ((cdesc = gt_seq_col_get_description(rm->seq_col, filenum, seqnum,
+                                                err))) {
+          gt_str_append_cstr(desc, cdesc);
+          gt_free(cdesc);
+        }
+        else
+          had_err = -1;
       }
     } else if (rm->useseqno) {
       GtUword seqno = GT_UNDEF_UWORD;
@@ -467,10 +491,12 @@ int gt_region_mapping_get_description(GtRegionMapping *rm, GtStr *desc,
                                                  seqid, err);
     } else if (rm->mapping) {
       char *cdesc;
-      cdesc = gt_seq_col_get_description(rm->seq_col, 0, 0);
-      gt_assert(cdesc);
-      gt_str_append_cstr(desc, cdesc);
-      gt_free(cdesc);
+      if ((cdesc = gt_seq_col_get_description(rm->seq_col, 0, 0, err))) {
+        gt_str_append_cstr(desc, cdesc);
+        gt_free(cdesc);
+      }
+      else
+        had_err = -1;
     } else {
       gt_assert(!rm->usedesc && !rm->matchdesc);
       if (!had_err) {
@@ -505,7 +531,8 @@ const char* gt_region_mapping_get_md5_fingerprint(GtRegionMapping *rm,
                                             gt_str_get(seqid), range, &seqnum,
                                             &filenum, offset, err);
       if (!had_err)
-        md5 = gt_seq_col_get_md5_fingerprint(rm->seq_col, filenum, seqnum);
+        md5 = gt_seq_col_get_md5_fingerprint(rm->seq_col, filenum, seqnum,
+                                             err);
     }
     else if (rm->matchdesc) {
       if (!rm->seq_col) {
@@ -513,7 +540,8 @@ const char* gt_region_mapping_get_md5_fingerprint(GtRegionMapping *rm,
           if (!(rm->seq_col = gt_encseq_col_new(rm->encseq, err)))
             had_err = -1;
         } else {
-          if (!(rm->seq_col = gt_bioseq_col_new(rm->sequence_filenames, err)))
+          if (!(rm->seq_col =
+                       region_mapping_seq_col_new(rm->sequence_filenames, err)))
             had_err = -1;
         }
       }
@@ -550,7 +578,7 @@ const char* gt_region_mapping_get_md5_fingerprint(GtRegionMapping *rm,
         return NULL;
     } else if (rm->mapping) {
       if (!had_err)
-        md5 = gt_seq_col_get_md5_fingerprint(rm->seq_col, 0, 0);
+        md5 = gt_seq_col_get_md5_fingerprint(rm->seq_col, 0, 0, err);
       *offset = 1;
     } else {
       if (!had_err) {
@@ -229,10 +229,10 @@ static void get_pagewise_page(GtSampling *sampling,
   middle = GT_DIV2(end);
   while (end - start > (GtWord) 1) {
     if (element_num < sampling->page_sampling[middle]) {
-      start = middle;
+      end = middle;
     }
     else {
-      end = middle;
+      start = middle;
     }
     middle = start + GT_DIV2(end - start);
   }
@@ -326,6 +326,29 @@ int gt_sampling_get_next_sample(GtSampling *sampling,
   return (int) status;
 }
 
+GtUword gt_sampling_num_of_samples(const GtSampling *sampling)
+{
+  gt_assert(sampling);
+  return sampling->numofsamples;
+}
+
+void gt_sampling_get_sample(const GtSampling *sampling,
+                            GtUword samplenum,
+                            GtUword *sampled_element,
+                            size_t *position)
+{
+  gt_assert(sampling != NULL);
+  gt_assert(sampled_element != NULL);
+  gt_assert(position != NULL);
+  gt_assert(samplenum < sampling->numofsamples);
+
+  if (sampling->method == GT_SAMPLING_REGULAR)
+    *sampled_element = samplenum * sampling->sampling_rate;
+  else
+    *sampled_element = sampling->page_sampling[samplenum];
+  *position = sampling->samplingtab[samplenum];
+}
+
 bool gt_sampling_is_regular(GtSampling *sampling)
 {
   gt_assert(sampling);
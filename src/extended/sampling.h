@@ -76,6 +76,18 @@ int           gt_sampling_get_next_sample(GtSampling *sampling,
                                           GtUword *sampled_element,
                                           size_t *position);
 
+/* Returns the number of samples stored in <sampling>. */
+GtUword       gt_sampling_num_of_samples(const GtSampling *sampling);
+
+/* Sets <*sampled_element> to the element number of sample <samplenum> and
+   <*position> to its offset in the file. Unlike the functions above this does
+   not change the current sample of <sampling>, so it can be called by several
+   threads at once. */
+void          gt_sampling_get_sample(const GtSampling *sampling,
+                                     GtUword samplenum,
+                                     GtUword *sampled_element,
+                                     size_t *position);
+
 /* Returns the sampling rate of <sampling>. */
 GtUword gt_sampling_get_rate(GtSampling *sampling);
 
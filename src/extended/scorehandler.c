@@ -126,6 +126,23 @@ GtWord gt_scorehandler_get_replacement(const GtScoreHandler *scorehandler,
   return gt_score_matrix_get_score(scorehandler->scorematrix,a,b);
 }
 
+bool gt_scorehandler_has_scorematrix(const GtScoreHandler *scorehandler)
+{
+  gt_assert(scorehandler != NULL);
+  return scorehandler->scorematrix != NULL ? true : false;
+}
+
+GtWord gt_scorehandler_get_charclass(const GtScoreHandler *scorehandler,
+                                     GtUchar a)
+{
+  gt_assert(scorehandler != NULL && scorehandler->scorematrix == NULL);
+  if (scorehandler->mappedsequence)
+  {
+    return GT_ISSPECIAL(a) ? -1 : (GtWord) a;
+  }
+  return (GtWord) (scorehandler->downcase ? tolower((int) a) : a);
+}
+
 GtScoreHandler *gt_scorehandler2costhandler(const GtScoreHandler *scorehandler)
 {
   GtScoreHandler *costhandler;
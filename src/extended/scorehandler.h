@@ -57,6 +57,17 @@ GtWord          gt_scorehandler_get_replacement(const GtScoreHandler
                                                 *scorehandler,
                                                 GtUchar a,
                                                 GtUchar b);
+/* Return true if a score matrix was added to the given <scorehandler>. */
+bool            gt_scorehandler_has_scorematrix(const GtScoreHandler
+                                                *scorehandler);
+/* Return the class of character <a> for the given <scorehandler> without
+   score matrix: two characters get the match score if and only if they belong
+   to the same class. Returns -1 for characters which get the mismatch score
+   when compared to any character, i.e. for wildcards and separators of
+   mapped sequences. */
+GtWord          gt_scorehandler_get_charclass(const GtScoreHandler
+                                              *scorehandler,
+                                              GtUchar a);
 /* Return a <GtScoreHandler> object, which is generated by transforming score
    values of the given <scorehandler> to cost values. */
 GtScoreHandler *gt_scorehandler2costhandler(const GtScoreHandler *scorehandler);
@@ -178,8 +178,10 @@ static int fill_mapping(GtSeqid2SeqnumMapping *mapping, GtBioseq *bioseq,
       char *desc;
       if (bioseq)
         desc = gt_cstr_dup(gt_bioseq_get_description(bioseq, i));
-      else
-        desc = gt_seq_col_get_description(seqcol, j, i);
+      else if (!(desc = gt_seq_col_get_description(seqcol, j, i, err))) {
+        had_err = -1;
+        break;
+      }
       had_err = handle_description(mapping, desc, i, j, err);
       gt_free(desc);
     }
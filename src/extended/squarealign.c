@@ -18,6 +18,7 @@
 #include "core/array2dim_api.h"
 #include "extended/maxcoordvalue.h"
 #include "core/minmax_api.h"
+#include "extended/myersedist.h"
 #include "extended/reconstructalignment.h"
 
 #include "extended/squarealign.h"
@@ -114,6 +115,15 @@ GtUword gt_squarealign_global_distance_only(const GtUchar *useq,
 
   gt_assert(scorehandler);
 
+  if (gt_myersedist_unitcost(scorehandler))
+  {
+    GtMyersEdist *myersedist = gt_myersedist_new(scorehandler);
+
+    distance = gt_myersedist_global(myersedist, useq + ustart, ulen,
+                                    vseq + vstart, vlen);
+    gt_myersedist_delete(myersedist);
+    return distance;
+  }
   gt_array2dim_malloc(E, (ulen+1), (vlen+1));
   fillDPtab_in_square_space(E, useq, ustart, ulen,
                             vseq, vstart, vlen, scorehandler);
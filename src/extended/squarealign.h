@@ -64,7 +64,8 @@ GtUword gt_squarealign_calculate(GtLinspaceManagement *spacemanager,
    square space. Use of this function requires an initialised <scorehandler>
    with cost values and input sequences <useq> and <vseq>, with the regions to
    align given by their start positions <ustart> and <vstart> and lengths <ulen>
-   and <vlen>. */
+   and <vlen>. For unit costs, the distance is computed by the bit-parallel
+   <GtMyersEdist> without a DP table. */
 GtUword gt_squarealign_global_distance_only(const GtUchar *useq,
                                             GtUword ustart,
                                             GtUword ulen,
@@ -0,0 +1,757 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <stdint.h>
+#include "core/assert_api.h"
+#include "core/chardef_api.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/minmax_api.h"
+#include "extended/stripedalign.h"
+
+/* the kernels are compiled with function specific target options and chosen
+   at runtime, which requires gcc 4.9 or clang on x86 */
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__)) && \
+    (defined (__clang__) || __GNUC__ > 4 || \
+     (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define GT_STRIPEDALIGN_X86
+#include <immintrin.h>
+#endif
+
+/* all finite values are below GT_STRIPEDALIGN_MAXVALUE, such that adding a
+   cost to GT_STRIPEDALIGN_INF does not overflow */
+#define GT_STRIPEDALIGN_INF      ((int32_t) 1 << 30)
+#define GT_STRIPEDALIGN_MAXVALUE ((GtUword) 1 << 28)
+/* shorter sequences u are aligned faster by the scalar column functions */
+#define GT_STRIPEDALIGN_MINULEN  32UL
+#define GT_STRIPEDALIGN_MAXLANES 8UL
+
+/* crosspoints of the affine kernel store the row and the edge */
+#define GT_STRIPEDALIGN_CROSS(ROW,EDGE) ((int32_t) (((ROW) << 2) | (EDGE)))
+#define GT_STRIPEDALIGN_CROSSROW(C)     ((C) >> 2)
+#define GT_STRIPEDALIGN_CROSSEDGE(C)    ((GtAffineAlignEdge) ((C) & 3))
+
+typedef struct {
+  GtUword segments, ulen, vlen, midcol;
+  int32_t *ucodes, *vcodes, *valuetab, *rtab,
+          matchcost, mismatchcost, gap_opening, gap_extension,
+          /* row 0 of the affine kernel */
+          top_R, top_D, top_I, top_Rcross, top_Dcross, top_Icross;
+} GtStripedalignProblem;
+
+#ifdef GT_STRIPEDALIGN_X86
+
+#define GT_SA_VEC             __m128i
+#define GT_SA_LANES           4UL
+#define GT_SA_TARGET          __attribute__ ((target ("sse4.1")))
+#define GT_SA_NAME(X)         gt_stripedalign_##X##_sse41
+#define GT_SA_LOAD(P)         _mm_loadu_si128((const __m128i *) (P))
+#define GT_SA_STORE(P,V)      _mm_storeu_si128((__m128i *) (P), V)
+#define GT_SA_SET1(X)         _mm_set1_epi32(X)
+#define GT_SA_ADD(A,B)        _mm_add_epi32(A, B)
+#define GT_SA_SUB(A,B)        _mm_sub_epi32(A, B)
+#define GT_SA_MIN(A,B)        _mm_min_epi32(A, B)
+#define GT_SA_CMPEQ(A,B)      _mm_cmpeq_epi32(A, B)
+#define GT_SA_CMPGT(A,B)      _mm_cmpgt_epi32(A, B)
+#define GT_SA_BLEND(A,B,M)    _mm_blendv_epi8(A, B, M)
+#define GT_SA_ANY(M)          (_mm_movemask_epi8(M) != 0)
+#define GT_SA_SHIFT(V,X)      _mm_insert_epi32(_mm_slli_si128(V, 4), X, 0)
+#include "extended/stripedalign-kernel.inc"
+#undef GT_SA_VEC
+#undef GT_SA_LANES
+#undef GT_SA_TARGET
+#undef GT_SA_NAME
+#undef GT_SA_LOAD
+#undef GT_SA_STORE
+#undef GT_SA_SET1
+#undef GT_SA_ADD
+#undef GT_SA_SUB
+#undef GT_SA_MIN
+#undef GT_SA_CMPEQ
+#undef GT_SA_CMPGT
+#undef GT_SA_BLEND
+#undef GT_SA_ANY
+#undef GT_SA_SHIFT
+
+#define GT_SA_VEC             __m256i
+#define GT_SA_LANES           8UL
+#define GT_SA_TARGET          __attribute__ ((target ("avx2")))
+#define GT_SA_NAME(X)         gt_stripedalign_##X##_avx2
+#define GT_SA_LOAD(P)         _mm256_loadu_si256((const __m256i *) (P))
+#define GT_SA_STORE(P,V)      _mm256_storeu_si256((__m256i *) (P), V)
+#define GT_SA_SET1(X)         _mm256_set1_epi32(X)
+#define GT_SA_ADD(A,B)        _mm256_add_epi32(A, B)
+#define GT_SA_SUB(A,B)        _mm256_sub_epi32(A, B)
+#define GT_SA_MIN(A,B)        _mm256_min_epi32(A, B)
+#define GT_SA_CMPEQ(A,B)      _mm256_cmpeq_epi32(A, B)
+#define GT_SA_CMPGT(A,B)      _mm256_cmpgt_epi32(A, B)
+#define GT_SA_BLEND(A,B,M)    _mm256_blendv_epi8(A, B, M)
+#define GT_SA_ANY(M)          (_mm256_movemask_epi8(M) != 0)
+#define GT_SA_SHIFT(V,X)      _mm256_blend_epi32(\
+                                _mm256_permutevar8x32_epi32(V,\
+                                  _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6)),\
+                                _mm256_set1_epi32(X), 1)
+#include "extended/stripedalign-kernel.inc"
+#undef GT_SA_VEC
+#undef GT_SA_LANES
+#undef GT_SA_TARGET
+#undef GT_SA_NAME
+#undef GT_SA_LOAD
+#undef GT_SA_STORE
+#undef GT_SA_SET1
+#undef GT_SA_ADD
+#undef GT_SA_SUB
+#undef GT_SA_MIN
+#undef GT_SA_CMPEQ
+#undef GT_SA_CMPGT
+#undef GT_SA_BLEND
+#undef GT_SA_ANY
+#undef GT_SA_SHIFT
+
+#endif
+
+static GtStripedalignKernel gt_stripedalign_maxkernel = GT_STRIPEDALIGN_AVX2;
+
+GtStripedalignKernel gt_stripedalign_supported_kernel(void)
+{
+#ifdef GT_STRIPEDALIGN_X86
+  if (__builtin_cpu_supports("avx2"))
+  {
+    return GT_STRIPEDALIGN_AVX2;
+  }
+  if (__builtin_cpu_supports("sse4.1"))
+  {
+    return GT_STRIPEDALIGN_SSE41;
+  }
+#endif
+  return GT_STRIPEDALIGN_SCALAR;
+}
+
+void gt_stripedalign_set_kernel(GtStripedalignKernel kernel)
+{
+  gt_stripedalign_maxkernel = kernel;
+}
+
+GtStripedalignKernel gt_stripedalign_get_kernel(void)
+{
+  return GT_MIN(gt_stripedalign_maxkernel, gt_stripedalign_supported_kernel());
+}
+
+const char *gt_stripedalign_kernel_name(GtStripedalignKernel kernel)
+{
+  switch (kernel)
+  {
+    case GT_STRIPEDALIGN_AVX2:
+      return "avx2";
+    case GT_STRIPEDALIGN_SSE41:
+      return "sse4.1";
+    default:
+      return "scalar";
+  }
+}
+
+#ifdef GT_STRIPEDALIGN_X86
+static GtUword gt_stripedalign_lanes(GtStripedalignKernel kernel)
+{
+  gt_assert(kernel != GT_STRIPEDALIGN_SCALAR);
+  return kernel == GT_STRIPEDALIGN_AVX2 ? 8UL : 4UL;
+}
+
+/* index of row <rowindex> > 0 in the striped layout */
+static GtUword gt_stripedalign_pos(const GtStripedalignProblem *problem,
+                                   GtUword lanes, GtUword rowindex)
+{
+  gt_assert(rowindex > 0);
+  return ((rowindex - 1) % problem->segments) * lanes +
+         (rowindex - 1) / problem->segments;
+}
+
+/* returns false if the costs of <scorehandler> are not constant or if the
+   values of the DP matrix do not fit into 32 bit lanes */
+static bool gt_stripedalign_problem_init(GtStripedalignProblem *problem,
+                                         GtUword lanes,
+                                         bool affine,
+                                         const GtScoreHandler *scorehandler,
+                                         const GtUchar *useq,
+                                         GtUword ustart,
+                                         GtUword ulen,
+                                         const GtUchar *vseq,
+                                         GtUword vstart,
+                                         GtUword vlen,
+                                         GtUword midcol)
+{
+  GtWord matchcost, mismatchcost, gap_opening, gap_extension;
+  GtUword idx, maxstepcost, numofvalues;
+
+  gt_assert(scorehandler != NULL && ulen > 0);
+  if (gt_scorehandler_has_scorematrix(scorehandler))
+  {
+    return false;
+  }
+  matchcost = gt_scorehandler_get_matchscore(scorehandler);
+  mismatchcost = gt_scorehandler_get_mismatchscore(scorehandler);
+  gap_opening = affine ? gt_scorehandler_get_gap_opening(scorehandler) : 0;
+  gap_extension = gt_scorehandler_get_gapscore(scorehandler);
+  if (matchcost < 0 || mismatchcost < 0 || gap_opening < 0 ||
+      gap_extension < 0 ||
+      ulen + vlen >= GT_STRIPEDALIGN_MAXVALUE)
+  {
+    return false;
+  }
+  maxstepcost = (GtUword) (GT_MAX(matchcost, mismatchcost) + gap_opening +
+                           gap_extension);
+  if (maxstepcost >= GT_STRIPEDALIGN_MAXVALUE ||
+      (maxstepcost > 0 &&
+       ulen + vlen + lanes >= GT_STRIPEDALIGN_MAXVALUE / maxstepcost))
+  {
+    return false;
+  }
+  problem->segments = (ulen + lanes - 1) / lanes;
+  problem->ulen = ulen;
+  problem->vlen = vlen;
+  problem->midcol = midcol;
+  problem->matchcost = (int32_t) matchcost;
+  problem->mismatchcost = (int32_t) mismatchcost;
+  problem->gap_opening = (int32_t) gap_opening;
+  problem->gap_extension = (int32_t) gap_extension;
+  numofvalues = problem->segments * lanes;
+  problem->ucodes = gt_malloc(sizeof (*problem->ucodes) *
+                              (numofvalues * (affine ? 8UL : 3UL) + vlen));
+  problem->valuetab = problem->ucodes + numofvalues;
+  problem->rtab = problem->valuetab + numofvalues * (affine ? 4UL : 1UL);
+  problem->vcodes = problem->rtab + numofvalues * (affine ? 3UL : 1UL);
+  /* characters which never match get different codes in u and v */
+  for (idx = 1UL; idx <= numofvalues; idx++)
+  {
+    GtWord charclass = idx <= ulen
+                       ? gt_scorehandler_get_charclass(scorehandler,
+                                                       useq[ustart + idx - 1])
+                       : -1;
+    problem->ucodes[gt_stripedalign_pos(problem, lanes, idx)]
+      = (int32_t) charclass;
+  }
+  for (idx = 0; idx < vlen; idx++)
+  {
+    GtWord charclass = gt_scorehandler_get_charclass(scorehandler,
+                                                     vseq[vstart + idx]);
+    problem->vcodes[idx] = charclass < 0 ? -2 : (int32_t) charclass;
+  }
+  return true;
+}
+
+static void gt_stripedalign_problem_delete(GtStripedalignProblem *problem)
+{
+  gt_free(problem->ucodes);
+}
+
+#endif
+
+static bool gt_stripedalign_linear_with_kernel(GtStripedalignKernel kernel,
+                                            const GtScoreHandler *scorehandler,
+                                            const GtUchar *useq,
+                                            GtUword ustart,
+                                            GtUword ulen,
+                                            const GtUchar *vseq,
+                                            GtUword vstart,
+                                            GtUword vlen,
+                                            GtUword midcol,
+                                            GtUword *distance,
+                                            GtUword *midrow)
+{
+#ifdef GT_STRIPEDALIGN_X86
+  GtStripedalignProblem problem;
+  GtUword lanes, rowindex, pos;
+
+  if (kernel == GT_STRIPEDALIGN_SCALAR || ulen == 0 ||
+      !gt_stripedalign_problem_init(&problem, lanes = gt_stripedalign_lanes(
+                                                                       kernel),
+                                    false, scorehandler, useq, ustart, ulen,
+                                    vseq, vstart, vlen, midcol))
+  {
+    return false;
+  }
+  /* first column */
+  for (rowindex = 1UL; rowindex <= problem.segments * lanes; rowindex++)
+  {
+    pos = gt_stripedalign_pos(&problem, lanes, rowindex);
+    problem.valuetab[pos] = (int32_t) rowindex * problem.gap_extension;
+    problem.rtab[pos] = (int32_t) rowindex;
+  }
+  if (kernel == GT_STRIPEDALIGN_AVX2)
+  {
+    gt_stripedalign_linear_avx2(&problem);
+  } else
+  {
+    gt_stripedalign_linear_sse41(&problem);
+  }
+  pos = gt_stripedalign_pos(&problem, lanes, ulen);
+  *distance = (GtUword) problem.valuetab[pos];
+  *midrow = (GtUword) problem.rtab[pos];
+  gt_stripedalign_problem_delete(&problem);
+  return true;
+#else
+  (void) kernel;
+  (void) scorehandler;
+  (void) useq;
+  (void) ustart;
+  (void) ulen;
+  (void) vseq;
+  (void) vstart;
+  (void) vlen;
+  (void) midcol;
+  (void) distance;
+  (void) midrow;
+  return false;
+#endif
+}
+
+bool gt_stripedalign_linear(const GtScoreHandler *scorehandler,
+                            const GtUchar *useq,
+                            GtUword ustart,
+                            GtUword ulen,
+                            const GtUchar *vseq,
+                            GtUword vstart,
+                            GtUword vlen,
+                            GtUword midcol,
+                            GtUword *distance,
+                            GtUword *midrow)
+{
+  if (ulen < GT_STRIPEDALIGN_MINULEN)
+  {
+    return false;
+  }
+  return gt_stripedalign_linear_with_kernel(gt_stripedalign_get_kernel(),
+                                            scorehandler, useq, ustart, ulen,
+                                            vseq, vstart, vlen, midcol,
+                                            distance, midrow);
+}
+
+#ifdef GT_STRIPEDALIGN_X86
+static GtWord gt_stripedalign_value(int32_t value)
+{
+  return value >= GT_STRIPEDALIGN_INF ? GT_WORD_MAX : (GtWord) value;
+}
+
+static GtAffineAlignRnode gt_stripedalign_rnode(int32_t cross)
+{
+  GtAffineAlignRnode rnode;
+
+  rnode.idx = (GtUword) GT_STRIPEDALIGN_CROSSROW(cross);
+  rnode.edge = GT_STRIPEDALIGN_CROSSEDGE(cross);
+  return rnode;
+}
+
+#endif
+
+static bool gt_stripedalign_affine_with_kernel(GtStripedalignKernel kernel,
+                                            const GtScoreHandler *scorehandler,
+                                            const GtUchar *useq,
+                                            GtUword ustart,
+                                            GtUword ulen,
+                                            const GtUchar *vseq,
+                                            GtUword vstart,
+                                            GtUword vlen,
+                                            GtUword midcol,
+                                            GtAffineAlignEdge from_edge,
+                                            GtAffinealignDPentry *lastentry,
+                                            GtAffineAlignRtabentry *lastrtab)
+{
+#ifdef GT_STRIPEDALIGN_X86
+  GtStripedalignProblem problem;
+  GtUword lanes, rowindex, pos, numofvalues;
+  int32_t Dvalue;
+
+  if (kernel == GT_STRIPEDALIGN_SCALAR || ulen == 0 ||
+      !gt_stripedalign_problem_init(&problem, lanes = gt_stripedalign_lanes(
+                                                                       kernel),
+                                    true, scorehandler, useq, ustart, ulen,
+                                    vseq, vstart, vlen, midcol))
+  {
+    return false;
+  }
+  /* first column as in firstAtabRtabcolumn */
+  switch (from_edge)
+  {
+    case Affine_R:
+      problem.top_R = 0;
+      problem.top_D = problem.top_I = GT_STRIPEDALIGN_INF;
+      break;
+    case Affine_D:
+      problem.top_D = 0;
+      problem.top_R = problem.top_I = GT_STRIPEDALIGN_INF;
+      break;
+    case Affine_I:
+      problem.top_I = 0;
+      problem.top_R = problem.top_D = GT_STRIPEDALIGN_INF;
+      break;
+    default:
+      problem.top_R = 0;
+      problem.top_D = problem.top_I = problem.gap_opening;
+  }
+  problem.top_Rcross = GT_STRIPEDALIGN_CROSS(0, Affine_R);
+  problem.top_Dcross = GT_STRIPEDALIGN_CROSS(0, Affine_D);
+  problem.top_Icross = GT_STRIPEDALIGN_CROSS(0, Affine_I);
+  numofvalues = problem.segments * lanes;
+  Dvalue = GT_MIN(GT_MIN(problem.top_R + problem.gap_opening +
+                         problem.gap_extension,
+                         problem.top_D + problem.gap_extension),
+                  GT_STRIPEDALIGN_INF);
+  for (rowindex = 1UL; rowindex <= numofvalues; rowindex++)
+  {
+    pos = gt_stripedalign_pos(&problem, lanes, rowindex);
+    problem.valuetab[pos] = GT_STRIPEDALIGN_INF;
+    problem.valuetab[numofvalues + pos] = Dvalue;
+    problem.valuetab[2 * numofvalues + pos] = GT_STRIPEDALIGN_INF;
+    problem.rtab[pos] = GT_STRIPEDALIGN_CROSS(rowindex, Affine_R);
+    problem.rtab[numofvalues + pos] = GT_STRIPEDALIGN_CROSS(rowindex,
+                                                            Affine_D);
+    problem.rtab[2 * numofvalues + pos] = GT_STRIPEDALIGN_CROSS(rowindex,
+                                                                Affine_I);
+    Dvalue = GT_MIN(Dvalue + problem.gap_extension, GT_STRIPEDALIGN_INF);
+  }
+  if (kernel == GT_STRIPEDALIGN_AVX2)
+  {
+    gt_stripedalign_affine_avx2(&problem);
+  } else
+  {
+    gt_stripedalign_affine_sse41(&problem);
+  }
+  pos = gt_stripedalign_pos(&problem, lanes, ulen);
+  lastentry->Rvalue = gt_stripedalign_value(problem.valuetab[pos]);
+  lastentry->Dvalue = gt_stripedalign_value(problem.valuetab[numofvalues +
+                                                             pos]);
+  lastentry->Ivalue = gt_stripedalign_value(problem.valuetab[2 * numofvalues +
+                                                             pos]);
+  lastentry->totalvalue = GT_MIN3(lastentry->Rvalue, lastentry->Dvalue,
+                                  lastentry->Ivalue);
+  lastentry->Redge = lastentry->Dedge = lastentry->Iedge = Affine_X;
+  lastrtab->val_R = gt_stripedalign_rnode(problem.rtab[pos]);
+  lastrtab->val_D = gt_stripedalign_rnode(problem.rtab[numofvalues + pos]);
+  lastrtab->val_I = gt_stripedalign_rnode(problem.rtab[2 * numofvalues +
+                                                       pos]);
+  gt_stripedalign_problem_delete(&problem);
+  return true;
+#else
+  (void) kernel;
+  (void) scorehandler;
+  (void) useq;
+  (void) ustart;
+  (void) ulen;
+  (void) vseq;
+  (void) vstart;
+  (void) vlen;
+  (void) midcol;
+  (void) from_edge;
+  (void) lastentry;
+  (void) lastrtab;
+  return false;
+#endif
+}
+
+bool gt_stripedalign_affine(const GtScoreHandler *scorehandler,
+                            const GtUchar *useq,
+                            GtUword ustart,
+                            GtUword ulen,
+                            const GtUchar *vseq,
+                            GtUword vstart,
+                            GtUword vlen,
+                            GtUword midcol,
+                            GtAffineAlignEdge from_edge,
+                            GtAffinealignDPentry *lastentry,
+                            GtAffineAlignRtabentry *lastrtab)
+{
+  if (ulen < GT_STRIPEDALIGN_MINULEN)
+  {
+    return false;
+  }
+  return gt_stripedalign_affine_with_kernel(gt_stripedalign_get_kernel(),
+                                            scorehandler, useq, ustart, ulen,
+                                            vseq, vstart, vlen, midcol,
+                                            from_edge, lastentry, lastrtab);
+}
+
+/* the reference implementations for the unit test follow the scalar column
+   functions of linearalign.c and linearalign_affinegapcost.c */
+static void gt_stripedalign_linear_reference(const GtScoreHandler
+                                                               *scorehandler,
+                                             const GtUchar *useq,
+                                             GtUword ulen,
+                                             const GtUchar *vseq,
+                                             GtUword vlen,
+                                             GtUword midcol,
+                                             GtUword *distance,
+                                             GtUword *midrow)
+{
+  GtUword *value = gt_malloc(sizeof (*value) * 2 * (ulen + 1)),
+          *rtab = value + ulen + 1,
+          gapcost = (GtUword) gt_scorehandler_get_gapscore(scorehandler),
+          rowindex, colindex;
+
+  for (rowindex = 0; rowindex <= ulen; rowindex++)
+  {
+    value[rowindex] = rowindex * gapcost;
+    rtab[rowindex] = rowindex;
+  }
+  for (colindex = 1UL; colindex <= vlen; colindex++)
+  {
+    GtUword nw = value[0], nwR = rtab[0], val;
+
+    value[0] += gapcost;
+    if (colindex > midcol)
+    {
+      rtab[0] = 0;
+    }
+    for (rowindex = 1UL; rowindex <= ulen; rowindex++)
+    {
+      GtUword west = value[rowindex], westR = rtab[rowindex];
+
+      value[rowindex] += gapcost;
+      val = nw + gt_scorehandler_get_replacement(scorehandler,
+                                                 useq[rowindex-1],
+                                                 vseq[colindex-1]);
+      if (val <= value[rowindex])
+      {
+        value[rowindex] = val;
+        if (colindex > midcol)
+        {
+          rtab[rowindex] = nwR;
+        }
+      }
+      if ((val = value[rowindex-1] + gapcost) < value[rowindex])
+      {
+        value[rowindex] = val;
+        if (colindex > midcol)
+        {
+          rtab[rowindex] = rtab[rowindex-1];
+        }
+      }
+      nw = west;
+      nwR = westR;
+    }
+  }
+  *distance = value[ulen];
+  *midrow = rtab[ulen];
+  gt_free(value);
+}
+
+static GtWord gt_stripedalign_add(GtWord value, GtWord cost)
+{
+  return value == GT_WORD_MAX ? GT_WORD_MAX : value + cost;
+}
+
+static GtAffineAlignEdge gt_stripedalign_min3(GtWord *minvalue, GtWord rdist,
+                                              GtWord ddist, GtWord idist)
+{
+  *minvalue = GT_MIN3(rdist, ddist, idist);
+  return gt_linearalign_affinegapcost_set_edge(rdist, ddist, idist);
+}
+
+static GtAffineAlignRnode gt_stripedalign_select(
+                                           const GtAffineAlignRtabentry *rtab,
+                                           GtAffineAlignEdge edge)
+{
+  return edge == Affine_R ? rtab->val_R
+                          : (edge == Affine_D ? rtab->val_D : rtab->val_I);
+}
+
+static void gt_stripedalign_rtabentry(GtAffineAlignRtabentry *rtab,
+                                      GtUword rowindex)
+{
+  rtab->val_R.idx = rtab->val_D.idx = rtab->val_I.idx = rowindex;
+  rtab->val_R.edge = Affine_R;
+  rtab->val_D.edge = Affine_D;
+  rtab->val_I.edge = Affine_I;
+}
+
+static void gt_stripedalign_affine_reference(const GtScoreHandler
+                                                               *scorehandler,
+                                             const GtUchar *useq,
+                                             GtUword ulen,
+                                             const GtUchar *vseq,
+                                             GtUword vlen,
+                                             GtUword midcol,
+                                             GtAffineAlignEdge from_edge,
+                                             GtAffinealignDPentry *lastentry,
+                                             GtAffineAlignRtabentry *lastrtab)
+{
+  GtAffinealignDPentry *atab = gt_malloc(sizeof (*atab) * (ulen + 1));
+  GtAffineAlignRtabentry *rtab = gt_malloc(sizeof (*rtab) * (ulen + 1));
+  GtWord go = gt_scorehandler_get_gap_opening(scorehandler),
+         ge = gt_scorehandler_get_gapscore(scorehandler), minvalue;
+  GtUword rowindex, colindex;
+
+  atab[0].Rvalue = from_edge == Affine_R || from_edge == Affine_X
+                   ? 0 : GT_WORD_MAX;
+  atab[0].Dvalue = from_edge == Affine_D ? 0 : (from_edge == Affine_X
+                                                ? go : GT_WORD_MAX);
+  atab[0].Ivalue = from_edge == Affine_I ? 0 : (from_edge == Affine_X
+                                                ? go : GT_WORD_MAX);
+  gt_stripedalign_rtabentry(rtab, 0);
+  for (rowindex = 1UL; rowindex <= ulen; rowindex++)
+  {
+    atab[rowindex].Rvalue = atab[rowindex].Ivalue = GT_WORD_MAX;
+    (void) gt_stripedalign_min3(&atab[rowindex].Dvalue,
+                                gt_stripedalign_add(atab[rowindex-1].Rvalue,
+                                                    go + ge),
+                                gt_stripedalign_add(atab[rowindex-1].Dvalue,
+                                                    ge),
+                                gt_stripedalign_add(atab[rowindex-1].Dvalue,
+                                                    go + ge));
+    gt_stripedalign_rtabentry(rtab + rowindex, rowindex);
+  }
+  for (colindex = 1UL; colindex <= vlen; colindex++)
+  {
+    GtAffinealignDPentry nw = atab[0], west;
+    GtAffineAlignRtabentry nwR = rtab[0], westR;
+    GtAffineAlignEdge edge;
+
+    (void) gt_stripedalign_min3(&atab[0].Ivalue,
+                                gt_stripedalign_add(atab[0].Rvalue, go + ge),
+                                gt_stripedalign_add(atab[0].Dvalue, go + ge),
+                                gt_stripedalign_add(atab[0].Ivalue, ge));
+    atab[0].Rvalue = atab[0].Dvalue = GT_WORD_MAX;
+    if (colindex > midcol)
+    {
+      rtab[0].val_R.idx = rtab[0].val_D.idx = rtab[0].val_I.idx;
+      rtab[0].val_R.edge = rtab[0].val_D.edge = Affine_X;
+    }
+    for (rowindex = 1UL; rowindex <= ulen; rowindex++)
+    {
+      GtWord rcost = gt_scorehandler_get_replacement(scorehandler,
+                                                     useq[rowindex-1],
+                                                     vseq[colindex-1]);
+
+      west = atab[rowindex];
+      westR = rtab[rowindex];
+      edge = gt_stripedalign_min3(&minvalue,
+                                  gt_stripedalign_add(nw.Rvalue, rcost),
+                                  gt_stripedalign_add(nw.Dvalue, rcost),
+                                  gt_stripedalign_add(nw.Ivalue, rcost));
+      atab[rowindex].Rvalue = minvalue;
+      if (colindex > midcol)
+      {
+        rtab[rowindex].val_R = gt_stripedalign_select(&nwR, edge);
+      }
+      edge = gt_stripedalign_min3(&minvalue,
+                                  gt_stripedalign_add(atab[rowindex-1].Rvalue,
+                                                      go + ge),
+                                  gt_stripedalign_add(atab[rowindex-1].Dvalue,
+                                                      ge),
+                                  gt_stripedalign_add(atab[rowindex-1].Ivalue,
+                                                      go + ge));
+      atab[rowindex].Dvalue = minvalue;
+      if (colindex > midcol)
+      {
+        rtab[rowindex].val_D = gt_stripedalign_select(rtab + rowindex - 1,
+                                                      edge);
+      }
+      edge = gt_stripedalign_min3(&minvalue,
+                                  gt_stripedalign_add(west.Rvalue, go + ge),
+                                  gt_stripedalign_add(west.Dvalue, go + ge),
+                                  gt_stripedalign_add(west.Ivalue, ge));
+      atab[rowindex].Ivalue = minvalue;
+      if (colindex > midcol)
+      {
+        rtab[rowindex].val_I = gt_stripedalign_select(&westR, edge);
+      }
+      nw = west;
+      nwR = westR;
+    }
+  }
+  *lastentry = atab[ulen];
+  *lastrtab = rtab[ulen];
+  gt_free(atab);
+  gt_free(rtab);
+}
+
+static bool gt_stripedalign_rnode_equal(GtAffineAlignRnode a,
+                                        GtAffineAlignRnode b)
+{
+  return a.idx == b.idx && a.edge == b.edge ? true : false;
+}
+
+int gt_stripedalign_unit_test(GtError *err)
+{
+  const GtUword maxlen = 150UL;
+  GtStripedalignKernel kernel;
+  GtUchar *useq, *vseq;
+  GtUword trial, idx;
+  int had_err = 0;
+
+  gt_error_check(err);
+  useq = gt_malloc(sizeof (*useq) * 2 * maxlen);
+  vseq = useq + maxlen;
+  for (trial = 0; !had_err && trial < 300UL; trial++)
+  {
+    GtUword ulen = 1UL + gt_rand_max(maxlen - 1),
+            vlen = 1UL + gt_rand_max(maxlen - 1),
+            midcol = gt_rand_max(vlen + 1),
+            alphasize = 2UL + gt_rand_max(3UL);
+    GtAffineAlignEdge from_edge = (GtAffineAlignEdge) gt_rand_max(3UL);
+    GtScoreHandler *scorehandler
+      = gt_scorehandler_new((GtWord) gt_rand_max(1UL),
+                            (GtWord) (1UL + gt_rand_max(4UL)),
+                            (GtWord) gt_rand_max(5UL),
+                            (GtWord) (1UL + gt_rand_max(3UL)));
+    GtUword distance, midrow, refdistance, refmidrow;
+    GtAffinealignDPentry lastentry, reflastentry;
+    GtAffineAlignRtabentry lastrtab, reflastrtab;
+
+    /* some wildcards, which never match */
+    for (idx = 0; idx < ulen; idx++)
+    {
+      useq[idx] = gt_rand_max(50UL) == 0 ? (GtUchar) GT_WILDCARD
+                                         : (GtUchar) gt_rand_max(alphasize-1);
+    }
+    for (idx = 0; idx < vlen; idx++)
+    {
+      vseq[idx] = gt_rand_max(50UL) == 0 ? (GtUchar) GT_WILDCARD
+                                         : (GtUchar) gt_rand_max(alphasize-1);
+    }
+    gt_stripedalign_linear_reference(scorehandler, useq, ulen, vseq, vlen,
+                                     midcol, &refdistance, &refmidrow);
+    gt_stripedalign_affine_reference(scorehandler, useq, ulen, vseq, vlen,
+                                     midcol, from_edge, &reflastentry,
+                                     &reflastrtab);
+    for (kernel = GT_STRIPEDALIGN_SSE41;
+         !had_err && kernel <= gt_stripedalign_supported_kernel(); kernel++)
+    {
+      gt_ensure(gt_stripedalign_linear_with_kernel(kernel, scorehandler,
+                                                   useq, 0, ulen, vseq, 0,
+                                                   vlen, midcol, &distance,
+                                                   &midrow));
+      gt_ensure(distance == refdistance);
+      gt_ensure(midrow == refmidrow);
+      gt_ensure(gt_stripedalign_affine_with_kernel(kernel, scorehandler,
+                                                   useq, 0, ulen, vseq, 0,
+                                                   vlen, midcol, from_edge,
+                                                   &lastentry, &lastrtab));
+      gt_ensure(lastentry.Rvalue == reflastentry.Rvalue);
+      gt_ensure(lastentry.Dvalue == reflastentry.Dvalue);
+      gt_ensure(lastentry.Ivalue == reflastentry.Ivalue);
+      gt_ensure(gt_stripedalign_rnode_equal(lastrtab.val_R,
+                                            reflastrtab.val_R));
+      gt_ensure(gt_stripedalign_rnode_equal(lastrtab.val_D,
+                                            reflastrtab.val_D));
+      gt_ensure(gt_stripedalign_rnode_equal(lastrtab.val_I,
+                                            reflastrtab.val_I));
+    }
+    gt_scorehandler_delete(scorehandler);
+  }
+  gt_free(useq);
+  return had_err;
+}
@@ -0,0 +1,98 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef STRIPEDALIGN_H
+#define STRIPEDALIGN_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+#include "extended/affinealign.h"
+#include "extended/linearalign_affinegapcost.h"
+#include "extended/scorehandler.h"
+
+/* The striped alignment kernels compute the last column of the DP matrix of
+   a global alignment with linear or affine gap costs, together with the
+   crosspoints needed by the linear space aligners, for cost handlers with
+   constant match and mismatch costs. Following Farrar's striped layout, the
+   rows of a column are distributed over the lanes of SSE4.1 or AVX2 vectors,
+   such that only the deletions, which propagate along the column, need a
+   correction loop. The kernel is chosen at runtime, according to the
+   instruction sets supported by the processor. The results are identical to
+   those of the scalar column functions, including the choice between
+   equally good edges. */
+
+typedef enum {
+  GT_STRIPEDALIGN_SCALAR,
+  GT_STRIPEDALIGN_SSE41,
+  GT_STRIPEDALIGN_AVX2
+} GtStripedalignKernel;
+
+/* Returns the most powerful kernel supported by the processor and the
+   compiler used to build the library. */
+GtStripedalignKernel gt_stripedalign_supported_kernel(void);
+
+/* Restricts the kernels used by the linear space aligners to <kernel> and
+   less powerful ones. With <GT_STRIPEDALIGN_SCALAR>, the scalar column
+   functions are used throughout. Not thread-safe, call before aligning. */
+void                 gt_stripedalign_set_kernel(GtStripedalignKernel kernel);
+
+/* Returns the kernel used by the linear space aligners. */
+GtStripedalignKernel gt_stripedalign_get_kernel(void);
+
+/* Returns the name of <kernel>. */
+const char*          gt_stripedalign_kernel_name(GtStripedalignKernel kernel);
+
+/* Evaluates all columns of the global alignment of <useq>[<ustart>..] of
+   length <ulen> and <vseq>[<vstart>..] of length <vlen> with linear gap costs
+   given by <scorehandler>. Stores the distance in <distance> and the row in
+   which the optimal path ending in the last row crosses column <midcol> in
+   <midrow>. If <midcol> >= <vlen>, only the distance is computed and <midrow>
+   is set to <ulen>. Returns false without computing anything, if no striped
+   kernel can be used for the given costs or sequence lengths, in which case
+   the caller has to use the scalar column functions. */
+bool                 gt_stripedalign_linear(const GtScoreHandler *scorehandler,
+                                            const GtUchar *useq,
+                                            GtUword ustart,
+                                            GtUword ulen,
+                                            const GtUchar *vseq,
+                                            GtUword vstart,
+                                            GtUword vlen,
+                                            GtUword midcol,
+                                            GtUword *distance,
+                                            GtUword *midrow);
+
+/* Evaluates all columns of the global alignment of <useq>[<ustart>..] of
+   length <ulen> and <vseq>[<vstart>..] of length <vlen> with affine gap costs
+   given by <scorehandler>, starting with edge <from_edge>. Stores the three
+   distance values of the last row of the last column in <lastentry> and the
+   crosspoints with column <midcol> of the three optimal paths ending there in
+   <lastrtab>. Returns false without computing anything, if no striped kernel
+   can be used for the given costs or sequence lengths. */
+bool                 gt_stripedalign_affine(const GtScoreHandler *scorehandler,
+                                            const GtUchar *useq,
+                                            GtUword ustart,
+                                            GtUword ulen,
+                                            const GtUchar *vseq,
+                                            GtUword vstart,
+                                            GtUword vlen,
+                                            GtUword midcol,
+                                            GtAffineAlignEdge from_edge,
+                                            GtAffinealignDPentry *lastentry,
+                                            GtAffineAlignRtabentry *lastrtab);
+
+int                  gt_stripedalign_unit_test(GtError *err);
+
+#endif
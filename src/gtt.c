@@ -22,6 +22,7 @@
 #include "core/array2dim_sparse_api.h"
 #include "core/array3dim_api.h"
 #include "core/basename_api.h"
+#include "core/bgzf.h"
 #include "core/bitpackarray.h"
 #include "core/bitpackstring.h"
 #include "core/bittab.h"
@@ -39,22 +40,27 @@
 #include "core/dlist.h"
 #include "core/dyn_bittab.h"
 #include "core/encseq.h"
+#include "core/encseq_parallel.h"
 #include "core/grep_api.h"
 #include "core/hashmap_api.h"
 #include "core/hashtable.h"
 #include "core/interval_tree.h"
 #include "core/mathsupport_api.h"
 #include "core/md5_seqid_api.h"
+#include "core/md5_tab_writer.h"
 #include "core/quality.h"
 #include "core/queue.h"
+#include "core/seqnum_index.h"
 #include "core/sequence_buffer.h"
 #include "core/splitter.h"
 #include "core/symbol.h"
 #include "core/tokenizer.h"
 #include "core/trans_table.h"
 #include "core/translator.h"
+#include "core/xxhash.h"
 #include "extended/alignment.h"
 #include "extended/anno_db_gfflike_api.h"
+#include "extended/batchalign.h"
 #include "extended/compressed_bitsequence.h"
 #include "extended/editscript.h"
 #include "extended/elias_gamma.h"
@@ -74,13 +80,16 @@
 #include "extended/kmer_database.h"
 #include "extended/luaserialize.h"
 #include "extended/multieoplist.h"
+#include "extended/myersedist.h"
 #include "extended/popcount_tab.h"
 #include "extended/priority_queue.h"
+#include "extended/qualtab.h"
 #include "extended/ranked_list.h"
 #include "extended/rbtree_api.h"
 #include "extended/rmq.h"
 #include "extended/splicedseq.h"
 #include "extended/string_matching.h"
+#include "extended/stripedalign.h"
 #include "extended/tag_value_map.h"
 #include "extended/uint64hashtable.h"
 #include "ltr/gt_ltrclustering.h"
@@ -289,6 +298,9 @@ GtHashmap* gtt_unit_tests(void)
                                                    gt_array2dim_sparse_example);
   gt_hashmap_add(unit_tests, "array3dim example", gt_array3dim_example);
   gt_hashmap_add(unit_tests, "basename module", gt_basename_unit_test);
+  gt_hashmap_add(unit_tests, "batch alignment kernels",
+                             gt_batchalign_unit_test);
+  gt_hashmap_add(unit_tests, "BGZF class", gt_bgzf_unit_test);
   gt_hashmap_add(unit_tests, "bit pack array class", gt_bitpackarray_unit_test);
   gt_hashmap_add(unit_tests, "bit pack string module",
                                                     gt_bitPackString_unit_test);
@@ -320,6 +332,8 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "encseq builder class",
                                                    gt_encseq_builder_unit_test);
   gt_hashmap_add(unit_tests, "encseq gc module", gt_encseq_gc_unit_test);
+  gt_hashmap_add(unit_tests, "encseq parallel module",
+                                                 gt_encseq_parallel_unit_test);
   gt_hashmap_add(unit_tests, "evaluator class", gt_evaluator_unit_test);
   gt_hashmap_add(unit_tests, "evalue module", gt_evalue_unit_test);
   gt_hashmap_add(unit_tests, "feature node iterator example",
@@ -346,23 +360,31 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "mathsupport module", gt_mathsupport_unit_test);
   gt_hashmap_add(unit_tests, "memory allocator module", gt_ma_unit_test);
   gt_hashmap_add(unit_tests, "multieoplist", gt_multieoplist_unit_test);
+  gt_hashmap_add(unit_tests, "Myers edit distance class",
+                             gt_myersedist_unit_test);
   gt_hashmap_add(unit_tests, "MD5 seqid module", gt_md5_seqid_unit_test);
+  gt_hashmap_add(unit_tests, "MD5 table writer class",
+                                                  gt_md5_tab_writer_unit_test);
   gt_hashmap_add(unit_tests, "rdj: suffix-prefix matches list module",
                                                           gt_spmlist_unit_test);
   gt_hashmap_add(unit_tests, "PBS finder module",
                                             gt_ltrdigest_pbs_visitor_unit_test);
   gt_hashmap_add(unit_tests, "popcount sorted tab", gt_popcount_tab_unit_test);
   gt_hashmap_add(unit_tests, "quality module", gt_quality_unit_test);
+  gt_hashmap_add(unit_tests, "quality table class", gt_qualtab_unit_test);
   gt_hashmap_add(unit_tests, "queue class", gt_queue_unit_test);
   gt_hashmap_add(unit_tests, "range class", gt_range_unit_test);
   gt_hashmap_add(unit_tests, "ranked list class", gt_ranked_list_unit_test);
   gt_hashmap_add(unit_tests, "red-black tree class", gt_rbtree_unit_test);
   gt_hashmap_add(unit_tests, "range minimum query class", gt_rmq_unit_test);
   gt_hashmap_add(unit_tests, "rdj: string graph class", gt_strgraph_unit_test);
+  gt_hashmap_add(unit_tests, "striped alignment kernels",
+                             gt_stripedalign_unit_test);
   gt_hashmap_add(unit_tests, "priority queue class",
                              gt_priority_queue_unit_test);
   gt_hashmap_add(unit_tests, "safearith example", gt_safearith_example);
   gt_hashmap_add(unit_tests, "safearith module", gt_safearith_unit_test);
+  gt_hashmap_add(unit_tests, "seqnum index class", gt_seqnum_index_unit_test);
   gt_hashmap_add(unit_tests, "sequence buffer class",
                                                   gt_sequence_buffer_unit_test);
   gt_hashmap_add(unit_tests, "splicedseq class", gt_splicedseq_unit_test);
@@ -378,6 +400,7 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "transtable class", gt_trans_table_unit_test);
   gt_hashmap_add(unit_tests, "uint64hashtable", gt_uint64hashtable_unit_test);
   gt_hashmap_add(unit_tests, "xdrop", gt_xdrop_unit_test);
+  gt_hashmap_add(unit_tests, "xxhash class", gt_xxhash64_unit_test);
 #ifndef WITHOUT_CAIRO
   gt_hashmap_add(unit_tests, "block class", gt_block_unit_test);
   gt_hashmap_add(unit_tests, "diagram class", gt_diagram_unit_test);
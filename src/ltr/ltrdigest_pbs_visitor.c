@@ -17,6 +17,7 @@
 
 #include <string.h>
 #include "core/array_api.h"
+#include "core/chardef_api.h"
 #include "core/ensure_api.h"
 #include "core/fa_api.h"
 #include "core/fileutils_api.h"
@@ -32,12 +33,14 @@
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "extended/alignment.h"
+#include "extended/batchalign.h"
 #include "extended/extract_feature_sequence.h"
 #include "extended/feature_node.h"
 #include "extended/feature_node_iterator_api.h"
 #include "extended/feature_type_api.h"
 #include "extended/node_visitor_api.h"
 #include "extended/reverse_api.h"
+#include "extended/scorehandler.h"
 #include "extended/swalign.h"
 #include "ltr/ltrdigest_def.h"
 #include "ltr/ltrdigest_pbs_visitor.h"
@@ -278,15 +281,103 @@ static int gt_pbs_hit_compare(const void *h1, const void *h2)
   return (gt_double_compare(hp2->score, hp1->score));
 }
 
+/* Returns the encoding of <seq> with all wildcards mapped to one regular
+   character, such that equal wildcards match in the batch aligner. */
+static GtUchar* gt_pbs_encode_with_wildcards(GtSeq *seq, const GtAlphabet *a)
+{
+  const GtUchar *encoded = gt_seq_get_encoded(seq);
+  GtUword i, seqlen = gt_seq_length(seq);
+  GtUchar *mapped = gt_malloc(sizeof (GtUchar) * (seqlen + 1));
+
+  for (i = 0; i < seqlen; i++)
+  {
+    mapped[i] = encoded[i] == (GtUchar) GT_WILDCARD
+                  ? (GtUchar) gt_alphabet_num_of_chars(a)
+                  : encoded[i];
+  }
+  return mapped;
+}
+
+/* Computes with the batch aligner an upper bound of the Smith-Waterman score
+   of each pair of a tRNA and a PBS search region: equal wildcards match and
+   both gap scores are replaced by the larger one. Any alignment with at most
+   <max_edist> edit operations and at least <alilen.start> aligned region
+   characters scores at least <threshold>, so the pairs with a smaller
+   bound cannot yield a hit and are not aligned with traceback. */
+static void gt_pbs_prefilter(GtLTRdigestPBSVisitor *lv, GtSeq **trna_from3,
+                             GtUword numoftrnas, GtSeq *seq_forward,
+                             GtSeq *seq_rev, const GtAlphabet *a,
+                             bool *align)
+{
+  GtScoreHandler *scorehandler;
+  GtUchar *forward_enc, *rev_enc, **trna_enc;
+  const GtUchar **useqs, **vseqs;
+  GtUword j, *ulens, *vlens, mincommon;
+  GtWord *scores, threshold;
+  int minscore;
+
+  scorehandler = gt_scorehandler_new(lv->ali_score_match,
+                                     lv->ali_score_mismatch, 0,
+                                     GT_MAX(lv->ali_score_insertion,
+                                            lv->ali_score_deletion));
+  forward_enc = gt_pbs_encode_with_wildcards(seq_forward, a);
+  rev_enc = gt_pbs_encode_with_wildcards(seq_rev, a);
+  trna_enc = gt_malloc(sizeof (*trna_enc) * numoftrnas);
+  useqs = gt_malloc(sizeof (*useqs) * 2 * numoftrnas);
+  vseqs = gt_malloc(sizeof (*vseqs) * 2 * numoftrnas);
+  ulens = gt_malloc(sizeof (*ulens) * 2 * numoftrnas);
+  vlens = gt_malloc(sizeof (*vlens) * 2 * numoftrnas);
+  scores = gt_malloc(sizeof (*scores) * 2 * numoftrnas);
+  for (j = 0; j < numoftrnas; j++)
+  {
+    trna_enc[j] = gt_pbs_encode_with_wildcards(trna_from3[j], a);
+    useqs[2 * j] = forward_enc;
+    ulens[2 * j] = gt_seq_length(seq_forward);
+    useqs[2 * j + 1] = rev_enc;
+    ulens[2 * j + 1] = gt_seq_length(seq_rev);
+    vseqs[2 * j] = vseqs[2 * j + 1] = trna_enc[j];
+    vlens[2 * j] = vlens[2 * j + 1] = gt_seq_length(trna_from3[j]);
+  }
+  gt_batchalign_local(scorehandler, 2 * numoftrnas,
+                      (const GtUchar * const *) useqs, ulens,
+                      (const GtUchar * const *) vseqs, vlens, scores);
+
+  minscore = GT_MIN(lv->ali_score_mismatch,
+                    GT_MIN(lv->ali_score_insertion, lv->ali_score_deletion));
+  mincommon = lv->alilen.start > (GtUword) lv->max_edist
+                ? lv->alilen.start - (GtUword) lv->max_edist
+                : 0;
+  threshold = (GtWord) lv->ali_score_match * (GtWord) mincommon
+              + (GtWord) minscore * (GtWord) lv->max_edist;
+  for (j = 0; j < 2 * numoftrnas; j++)
+  {
+    /* gt_swalign() does not report alignments with score 0 */
+    align[j] = scores[j] > 0 && scores[j] >= threshold ? true : false;
+  }
+
+  for (j = 0; j < numoftrnas; j++)
+    gt_free(trna_enc[j]);
+  gt_free(trna_enc);
+  gt_free(forward_enc);
+  gt_free(rev_enc);
+  gt_free(useqs);
+  gt_free(vseqs);
+  gt_free(ulens);
+  gt_free(vlens);
+  gt_free(scores);
+  gt_scorehandler_delete(scorehandler);
+}
+
 static GtPBSResults* gt_pbs_find(GtLTRdigestPBSVisitor *lv, const char *seq,
                           const char *rev_seq, GtError *err)
 {
-  GtSeq *seq_forward, *seq_rev;
+  GtSeq *seq_forward, *seq_rev, **trna_from3;
   GtPBSResults *results;
-  GtUword j;
+  GtUword j, numoftrnas;
   GtAlignment *ali;
   GtAlphabet *a = gt_alphabet_new_dna();
   GtScoreFunction *sf;
+  bool *align;
   gt_assert(lv && seq && rev_seq);
 
   sf = gt_dna_scorefunc_new(a, lv->ali_score_match, lv->ali_score_mismatch,
@@ -304,36 +395,54 @@ static GtPBSResults* gt_pbs_find(GtLTRdigestPBSVisitor *lv, const char *seq,
                            (GtUword) (2 * lv->radius + 1),
                            a);
 
-  for (j = 0; j < gt_bioseq_number_of_sequences(lv->trna_lib); j++)
+  numoftrnas = gt_bioseq_number_of_sequences(lv->trna_lib);
+  trna_from3 = gt_malloc(sizeof (*trna_from3) * numoftrnas);
+  align = gt_malloc(sizeof (*align) * 2 * numoftrnas);
+  for (j = 0; j < numoftrnas; j++)
   {
-    GtSeq *trna_seq, *trna_from3;
     char *trna_from3_full;
-    GtUword trna_seqlen;
+    GtUword trna_seqlen = gt_bioseq_get_sequence_length(lv->trna_lib, j);
 
-    trna_seq = gt_bioseq_get_seq(lv->trna_lib, j);
-    trna_seqlen = gt_seq_length(trna_seq);
-
-    trna_from3_full = gt_calloc((size_t) trna_seqlen, sizeof (char));
-    memcpy(trna_from3_full, gt_seq_get_orig(trna_seq),
-           sizeof (char) * trna_seqlen);
+    trna_from3_full = gt_bioseq_get_sequence(lv->trna_lib, j);
     (void) gt_reverse_complement(trna_from3_full, trna_seqlen, err);
-    trna_from3 = gt_seq_new_own(trna_from3_full, trna_seqlen, a);
-
-    ali = gt_swalign(seq_forward, trna_from3, sf);
-    gt_pbs_add_hit(lv, results->hits, ali, trna_seqlen,
-                   gt_seq_get_description(trna_seq), GT_STRAND_FORWARD,
-                   results);
-    gt_alignment_delete(ali);
-
-    ali = gt_swalign(seq_rev, trna_from3, sf);
-    gt_pbs_add_hit(lv, results->hits, ali, trna_seqlen,
-                   gt_seq_get_description(trna_seq), GT_STRAND_REVERSE,
-                   results);
-    gt_alignment_delete(ali);
-
-    gt_seq_delete(trna_seq);
-    gt_seq_delete(trna_from3);
+    trna_from3[j] = gt_seq_new_own(trna_from3_full, trna_seqlen, a);
+    align[2 * j] = align[2 * j + 1] = true;
+  }
+
+  /* the bound of the prefilter requires positive match scores only */
+  if (numoftrnas > 0 && lv->ali_score_match > 0
+        && lv->ali_score_mismatch <= 0 && lv->ali_score_insertion <= 0
+        && lv->ali_score_deletion <= 0)
+  {
+    gt_pbs_prefilter(lv, trna_from3, numoftrnas, seq_forward, seq_rev, a,
+                     align);
+  }
+
+  for (j = 0; j < numoftrnas; j++)
+  {
+    const char *desc = gt_bioseq_get_description(lv->trna_lib, j);
+    GtUword trna_seqlen = gt_seq_length(trna_from3[j]);
+
+    if (align[2 * j])
+    {
+      ali = gt_swalign(seq_forward, trna_from3[j], sf);
+      gt_pbs_add_hit(lv, results->hits, ali, trna_seqlen, desc,
+                     GT_STRAND_FORWARD, results);
+      gt_alignment_delete(ali);
+    }
+
+    if (align[2 * j + 1])
+    {
+      ali = gt_swalign(seq_rev, trna_from3[j], sf);
+      gt_pbs_add_hit(lv, results->hits, ali, trna_seqlen, desc,
+                     GT_STRAND_REVERSE, results);
+      gt_alignment_delete(ali);
+    }
+
+    gt_seq_delete(trna_from3[j]);
   }
+  gt_free(trna_from3);
+  gt_free(align);
   gt_seq_delete(seq_forward);
   gt_seq_delete(seq_rev);
   gt_score_function_delete(sf);
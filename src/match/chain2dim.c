@@ -24,7 +24,9 @@
 #include "core/ma_api.h"
 #include "core/arraydef_api.h"
 #include "core/logger.h"
-#include "extended/rbtree_api.h"
+#include "core/multithread_api.h"
+#include "core/qsort_r_api.h"
+#include "core/radix_sort.h"
 #include "extended/ranked_list.h"
 #include "chain2dim.h"
 #include "prsqualint.h"
@@ -221,9 +223,6 @@ void gt_chain_applyweight(double weightfactor,
   }
 }
 
-#define MAKEENDPOINT(FID)       (FID)
-#define FRAGIDENT(FRAG)         ((FRAG)->fpident)
-
 #define GT_CHAIN2DIM_UNDEFPREVIOUS           matchtable->nextfree
 
 #define GT_CHAIN2DIM_GETSTOREDSTARTPOINT(DIM,IDX)\
@@ -240,18 +239,6 @@ typedef GtChain2Dimscoretype (*GtChain2Dimgapcostfunction)(
                                                   GtUword,
                                                   GtUword);
 
-typedef struct
-{
-  GtUword fpident;
-  GtChain2Dimpostype fpposition;
-} GtChain2DimMatchpoint;
-
-typedef struct
-{
-  GtRBTree *dictroot;
-  GtUword *endpointperm;
-} GtChain2DimMatchstore;
-
 typedef struct
 {
   GtChain2Dimscoretype maxscore;
@@ -789,37 +776,34 @@ static void gt_chain2dim_ndbfchainscores(GtChain2Dimmatchtable *matchtable)
 }
 
 /*
-  The following function compares match points. These are
-  end points of matches in dimension 2.
-  If the match points are identical, then the order is undefined.
+  The matches are processed in the order of their start points in dimension
+  presortdim. Before a match is evaluated, all matches ending left of its
+  start point in this dimension are activated, i.e. their priority is stored
+  in a range maximum structure over the ranks of the end points in the
+  other dimension. This is a Fenwick tree, in which each node stores the
+  maximum of a range of ranks. The predecessor of a match in the chain is
+  the activated match of maximal priority, whose end point in the other
+  dimension is smaller than the start point of the match in this dimension.
+  Of several such matches, the one activated first is chosen.
 */
 
-static int gt_chain2dim_cmpendMatchpoint2(const void* keya,
-                                          const void* keyb,
-                                          GT_UNUSED void *info)
+typedef struct
 {
-  if (((GtChain2DimMatchpoint *) keya)->fpposition <
-      ((GtChain2DimMatchpoint *) keyb)->fpposition)
-  {
-    return -1;
-  }
-  if (((GtChain2DimMatchpoint *) keya)->fpposition >
-      ((GtChain2DimMatchpoint *) keyb)->fpposition)
-  {
-    return 1;
-  }
-  if (FRAGIDENT((GtChain2DimMatchpoint *) keya) <
-      FRAGIDENT((GtChain2DimMatchpoint *) keyb))
-  {
-    return -1;
-  }
-  if (FRAGIDENT((GtChain2DimMatchpoint *) keya) >
-      FRAGIDENT((GtChain2DimMatchpoint *) keyb))
-  {
-    return 1;
-  }
-  return 0;
-}
+  GtChain2Dimscoretype priority;
+  GtUword activation; /* rank in the order of activation */
+} GtChain2DimRangemaxentry;
+
+#define GT_CHAIN2DIM_UNDEFACTIVATION GT_UWORD_MAX
+
+typedef struct
+{
+  GtUword *endpointperm, /* matches in the order of activation */
+          numofendpositions;
+  GtChain2Dimpostype *endpositions; /* the sorted distinct end positions in
+                                       dimension postsortdim */
+  GtChain2DimRangemaxentry *rangemax; /* Fenwick tree over the ranks of
+                                         endpositions, starting at 1 */
+} GtChain2DimMatchstore;
 
 static GtChain2Dimscoretype gt_chain2dim_evalpriority(bool addterminal,
                                      const GtChain2Dimmatchtable *matchtable,
@@ -833,115 +817,132 @@ static GtChain2Dimscoretype gt_chain2dim_evalpriority(bool addterminal,
   return matchtable->matches[matchnum].score;
 }
 
-static void gt_chain2dim_insertintodict(bool addterminal,
-                                        const GtChain2Dimmatchtable *matchtable,
-                                        GtChain2DimMatchstore *matchstore,
-                                        GtChain2DimMatchpoint *qmatch2)
+static bool gt_chain2dim_rangemax_better(const GtChain2DimRangemaxentry *a,
+                                         const GtChain2DimRangemaxentry *b)
+{
+  if (a->activation == GT_CHAIN2DIM_UNDEFACTIVATION)
+  {
+    return false;
+  }
+  if (b->activation == GT_CHAIN2DIM_UNDEFACTIVATION ||
+      a->priority > b->priority)
+  {
+    return true;
+  }
+  return (a->priority == b->priority && a->activation < b->activation)
+           ? true : false;
+}
+
+/* returns the number of end positions smaller than or equal to <position> */
+
+static GtUword gt_chain2dim_endposition_rank(
+                                      const GtChain2DimMatchstore *matchstore,
+                                      GtChain2Dimpostype position)
 {
-  GtChain2DimMatchpoint *retval2;
-  bool nodecreated;
+  GtUword left = 0, right = matchstore->numofendpositions;
 
-  retval2 = (GtChain2DimMatchpoint *) gt_rbtree_search(matchstore->dictroot,
-                                                       qmatch2,
-                                                       &nodecreated);
-  gt_assert(retval2 != NULL);
-  if (!nodecreated)
+  while (left < right)
   {
-    if (gt_chain2dim_evalpriority(addterminal,matchtable,FRAGIDENT(retval2)) <
-        gt_chain2dim_evalpriority(addterminal,matchtable,FRAGIDENT(qmatch2)))
+    const GtUword mid = left + (right - left) / 2;
+
+    if (matchstore->endpositions[mid] <= position)
     {
-      gt_assert(retval2->fpposition == qmatch2->fpposition);
-      retval2->fpident = qmatch2->fpident;
+      left = mid + 1;
+    } else
+    {
+      right = mid;
     }
   }
+  return left;
 }
 
 static void gt_chain2dim_activatematchpoint(bool addterminal,
-                               const GtChain2Dimmatchtable *matchtable,
-                               GtChain2DimMatchstore *matchstore,
-                               GtChain2DimMatchpoint *qmatch2)
-{
-  GtChain2DimMatchpoint *tmp2;
-  GtChain2Dimscoretype qpriority;
-
-  qpriority = gt_chain2dim_evalpriority(addterminal,matchtable,
-                                        FRAGIDENT(qmatch2));
-  tmp2 = (GtChain2DimMatchpoint *) gt_rbtree_previous_equal_key(
-                                     matchstore->dictroot,
-                                     qmatch2,
-                                     gt_chain2dim_cmpendMatchpoint2,
-                                     NULL);
-  if (tmp2 == NULL ||
-      qpriority > gt_chain2dim_evalpriority(addterminal,matchtable,
-                                            FRAGIDENT(tmp2)))
-  {
-    gt_chain2dim_insertintodict(addterminal,matchtable,matchstore,qmatch2);
-    while (true)
+                                       const GtChain2Dimmatchtable *matchtable,
+                                       GtChain2DimMatchstore *matchstore,
+                                       GtUword activation,
+                                       unsigned int postsortdim)
+{
+  GtChain2DimRangemaxentry entry;
+  const GtUword matchnum = matchstore->endpointperm[activation];
+  GtUword rank;
+
+  entry.priority = gt_chain2dim_evalpriority(addterminal,matchtable,matchnum);
+  entry.activation = activation;
+  rank = gt_chain2dim_endposition_rank(matchstore,
+                                       GT_CHAIN2DIM_GETSTOREDENDPOINT(
+                                                         postsortdim,
+                                                         matchnum));
+  gt_assert(rank > 0);
+  while (rank <= matchstore->numofendpositions)
+  {
+    if (gt_chain2dim_rangemax_better(&entry,matchstore->rangemax + rank))
     {
-      tmp2 = (GtChain2DimMatchpoint *) gt_rbtree_next_key(
-                                               matchstore->dictroot,
-                                               qmatch2,
-                                               gt_chain2dim_cmpendMatchpoint2,
-                                               NULL);
-      if (tmp2 == NULL ||
-          qpriority <= gt_chain2dim_evalpriority(addterminal,matchtable,
-                                                 FRAGIDENT(tmp2)))
-      {
-        break;
-      }
-      if (gt_rbtree_erase(matchstore->dictroot, tmp2) != 0)
-      {
-        fprintf(stderr,"cannot delete successor node\n");
-        exit(GT_EXIT_PROGRAMMING_ERROR);
-      }
+      matchstore->rangemax[rank] = entry;
     }
-  } else
+    rank += rank & (~rank + 1);
+  }
+}
+
+/* returns the match with maximal priority among the activated matches
+   whose end position in dimension postsortdim has a rank <= <rank>, or
+   <undefprevious> if there is none */
+
+static GtUword gt_chain2dim_rangemax_query(
+                                       const GtChain2DimMatchstore *matchstore,
+                                       GtUword rank,
+                                       GtUword undefprevious)
+{
+  GtChain2DimRangemaxentry best;
+
+  best.priority = 0;
+  best.activation = GT_CHAIN2DIM_UNDEFACTIVATION;
+  while (rank > 0)
   {
-    gt_free(qmatch2);
+    if (gt_chain2dim_rangemax_better(matchstore->rangemax + rank,&best))
+    {
+      best = matchstore->rangemax[rank];
+    }
+    rank &= rank - 1;
   }
+  return best.activation == GT_CHAIN2DIM_UNDEFACTIVATION
+           ? undefprevious
+           : matchstore->endpointperm[best.activation];
 }
 
 static void gt_chain2dim_evalmatchscore(const GtChain2Dimmode *chainmode,
                                         GtChain2Dimmatchtable *matchtable,
-                                        GtChain2DimMatchstore *matchstore,
+                                        const GtChain2DimMatchstore *matchstore,
                                         bool gapsL1,
                                         GtUword matchpointident,
                                         unsigned int presortdim)
 {
-  GtUword previous;
+  GtUword previous, qmatch2;
   GtChain2Dimpostype startpos2;
-  GtChain2DimMatchpoint *qmatch2;
   GtChain2Dimscoretype score;
 
   startpos2 = GT_CHAIN2DIM_GETSTOREDSTARTPOINT(1-presortdim,matchpointident);
   if (startpos2 == 0)
   {
-    qmatch2 = NULL;
+    qmatch2 = GT_CHAIN2DIM_UNDEFPREVIOUS;
   } else
   {
-    GtChain2DimMatchpoint keymatch2;
-
-    keymatch2.fpposition = startpos2 - 1;  /* it is a start position */
-    keymatch2.fpident = MAKEENDPOINT(matchpointident);
-                       /* but considered as endpoint */
-    qmatch2 = (GtChain2DimMatchpoint *) gt_rbtree_previous_equal_key(
-                                                 matchstore->dictroot,
-                                                 &keymatch2,
-                                                 gt_chain2dim_cmpendMatchpoint2,
-                                                 NULL);
-    if (qmatch2 != NULL)
+    qmatch2 = gt_chain2dim_rangemax_query(matchstore,
+                                          gt_chain2dim_endposition_rank(
+                                                  matchstore,startpos2 - 1),
+                                          GT_CHAIN2DIM_UNDEFPREVIOUS);
+    if (qmatch2 != GT_CHAIN2DIM_UNDEFPREVIOUS)
     {
       if (chainmode->maxgapwidth != 0 &&
           !gt_chain2dim_checkmaxgapwidth(matchtable,
                                          chainmode->maxgapwidth,
-                                         FRAGIDENT(qmatch2),
+                                         qmatch2,
                                          matchpointident))
       {
-        qmatch2 = NULL;
+        qmatch2 = GT_CHAIN2DIM_UNDEFPREVIOUS;
       }
     }
   }
-  if (qmatch2 == NULL)
+  if (qmatch2 == GT_CHAIN2DIM_UNDEFPREVIOUS)
   {
     score = matchtable->matches[matchpointident].weight;
     if (chainmode->chainkind == GLOBALCHAININGWITHGAPCOST)
@@ -951,26 +952,26 @@ static void gt_chain2dim_evalmatchscore(const GtChain2Dimmode *chainmode,
     previous = GT_CHAIN2DIM_UNDEFPREVIOUS;
   } else
   {
-    score = matchtable->matches[FRAGIDENT(qmatch2)].score;
+    score = matchtable->matches[qmatch2].score;
     if (chainmode->chainkind == GLOBALCHAINING)
     {
       score += matchtable->matches[matchpointident].weight;
-      previous = FRAGIDENT(qmatch2);
+      previous = qmatch2;
     } else
     {
       GtChain2Dimscoretype tmpgc;
 
       if (gapsL1)
       {
-        tmpgc = gapcostL1(matchtable,FRAGIDENT(qmatch2),matchpointident);
+        tmpgc = gapcostL1(matchtable,qmatch2,matchpointident);
       } else
       {
-        tmpgc = gapcostCc(matchtable,FRAGIDENT(qmatch2),matchpointident);
+        tmpgc = gapcostCc(matchtable,qmatch2,matchpointident);
       }
       if (chainmode->chainkind == GLOBALCHAININGWITHGAPCOST || score > tmpgc)
       {
         score += (matchtable->matches[matchpointident].weight - tmpgc);
-        previous = FRAGIDENT(qmatch2);
+        previous = qmatch2;
       } else
       {
         score = matchtable->matches[matchpointident].weight;
@@ -1221,36 +1222,20 @@ static int comparestartandend(const Matchchaininfo *sortedstartpoints,
   return -1;
 }
 
-static GtChain2DimMatchpoint *makeactivationpoint(
-                                       const GtChain2Dimmatchtable *matchtable,
-                                       GtUword fpident,
-                                       unsigned int postsortdim)
-{
-  GtChain2DimMatchpoint *fpptr;
-
-  fpptr = gt_malloc(sizeof (*fpptr));
-  gt_assert(fpptr != NULL);
-  fpptr->fpident = MAKEENDPOINT(fpident);
-  fpptr->fpposition = GT_CHAIN2DIM_GETSTOREDENDPOINT(postsortdim,fpident);
-  return fpptr;
-}
-
 static void mergestartandendpoints(const GtChain2Dimmode *chainmode,
                                    GtChain2Dimmatchtable *matchtable,
                                    GtChain2DimMatchstore *matchstore,
                                    bool gapsL1,
                                    unsigned int presortdim)
 {
-  GtUword xidx, startcount, endcount;
+  GtUword startcount, endcount;
   const unsigned int postsortdim = 1U - presortdim;
   bool addterminal = (chainmode->chainkind == GLOBALCHAINING) ? false : true;
 
-  matchstore->dictroot = gt_rbtree_new(gt_chain2dim_cmpendMatchpoint2,
-                                       gt_free_func, NULL);
-  for (xidx = 0, startcount = 0, endcount = 0;
+  for (startcount = 0, endcount = 0;
        startcount < matchtable->nextfree &&
        endcount < matchtable->nextfree;
-       xidx++)
+       /* Nothing */)
   {
     if (comparestartandend(matchtable->matches + startcount,
                            matchtable->matches +
@@ -1267,10 +1252,7 @@ static void mergestartandendpoints(const GtChain2Dimmode *chainmode,
     } else
     {
       gt_chain2dim_activatematchpoint(addterminal,matchtable,matchstore,
-                        makeactivationpoint(matchtable,
-                                            matchstore->
-                                            endpointperm[endcount],
-                                            postsortdim));
+                                      endcount,postsortdim);
       endcount++;
     }
   }
@@ -1283,33 +1265,40 @@ static void mergestartandendpoints(const GtChain2Dimmode *chainmode,
                    startcount,
                    presortdim);
     startcount++;
-    xidx++;
   }
-  while (endcount < matchtable->nextfree)
+  /* the remaining end points cannot be predecessors of any match, so they
+     are not activated */
+}
+
+/* returns the maximal score of all matches for global chaining without gap
+   costs. */
+
+static GtChain2Dimscoretype gt_chain2dim_globalmaximalscore(
+                                       const GtChain2Dimmatchtable *matchtable)
+{
+  GtUword matchnum;
+  GtChain2Dimscoretype maxscore = matchtable->matches[0].score;
+
+  for (matchnum = 1UL; matchnum < matchtable->nextfree; matchnum++)
   {
-    gt_chain2dim_activatematchpoint(addterminal,matchtable,matchstore,
-                      makeactivationpoint(matchtable,
-                                          matchstore->
-                                          endpointperm[endcount],
-                                          postsortdim));
-    endcount++;
-    xidx++;
+    if (maxscore < matchtable->matches[matchnum].score)
+    {
+      maxscore = matchtable->matches[matchnum].score;
+    }
   }
+  return maxscore;
 }
 
 static unsigned int gt_chain2dim_findmaximalscores(
                                             const GtChain2Dimmode *chainmode,
                                             GtChain2Dim *chain,
                                             GtChain2Dimmatchtable *matchtable,
-                                            GtChain2DimMatchstore *matchstore,
                                             GtChain2Dimprocessor chainprocessor,
                                             bool withequivclasses,
                                             void *cpinfo,
                                             GtLogger *logger)
 {
-  GtUword matchnum;
   GtChain2Dimscoretype minscore = 0;
-  GtChain2DimMatchpoint *maxpoint;
   GtChain2DimBestofclass *chainequivalenceclasses;
   unsigned int retval;
   bool minscoredefined = false;
@@ -1326,10 +1315,7 @@ static unsigned int gt_chain2dim_findmaximalscores(
   switch (chainmode->chainkind)
   {
     case GLOBALCHAINING:
-      maxpoint = gt_rbtree_maximum_key(matchstore->dictroot);
-      gt_assert(maxpoint != NULL);
-      matchnum = FRAGIDENT(maxpoint);
-      minscore = matchtable->matches[matchnum].score;
+      minscore = gt_chain2dim_globalmaximalscore(matchtable);
       minscoredefined = true;
       break;
     case GLOBALCHAININGWITHGAPCOST:
@@ -1391,51 +1377,118 @@ static unsigned int gt_chain2dim_findmaximalscores(
   return retval;
 }
 
+typedef struct
+{
+  const GtChain2Dimmatchtable *matchtable;
+  unsigned int presortdim;
+} GtChain2DimEndpointorder;
+
+/* orders the matches by their end points in dimension presortdim and, for
+   equal end points, by their index */
+
+static int gt_chain2dim_cmpendpoints(const void *keya,const void *keyb,
+                                     void *data)
+{
+  const GtChain2DimEndpointorder *order
+    = (const GtChain2DimEndpointorder *) data;
+  const GtChain2Dimmatchtable *matchtable = order->matchtable;
+  const GtUword a = *(const GtUword *) keya, b = *(const GtUword *) keyb;
+
+  if (GT_CHAIN2DIM_GETSTOREDENDPOINT(order->presortdim,a) <
+      GT_CHAIN2DIM_GETSTOREDENDPOINT(order->presortdim,b))
+  {
+    return -1;
+  }
+  if (GT_CHAIN2DIM_GETSTOREDENDPOINT(order->presortdim,a) >
+      GT_CHAIN2DIM_GETSTOREDENDPOINT(order->presortdim,b))
+  {
+    return 1;
+  }
+  return a < b ? -1 : (a > b ? 1 : 0);
+}
+
 static void makesortedendpointpermutation(GtUword *perm,
                                           GtChain2Dimmatchtable *matchtable,
                                           unsigned int presortdim)
 {
-  GtUword temp, *iptr, *jptr, i, moves = 0;
+  GtUword i;
+  bool sorted = true;
 
   for (i = 0; i < matchtable->nextfree; i++)
   {
     perm[i] = i;
+    if (i > 0 && GT_CHAIN2DIM_GETSTOREDENDPOINT(presortdim,i-1) >
+                 GT_CHAIN2DIM_GETSTOREDENDPOINT(presortdim,i))
+    {
+      sorted = false;
+    }
   }
-  for (iptr = perm + 1UL; iptr < perm + matchtable->nextfree; iptr++)
+  if (!sorted)
   {
-    for (jptr = iptr; jptr > perm; jptr--)
+    GtChain2DimEndpointorder order;
+
+    order.matchtable = matchtable;
+    order.presortdim = presortdim;
+    gt_qsort_r(perm,(size_t) matchtable->nextfree,sizeof *perm,&order,
+               gt_chain2dim_cmpendpoints);
+  }
+}
+
+static void makesortedendpositions(GtChain2DimMatchstore *matchstore,
+                                   const GtChain2Dimmatchtable *matchtable,
+                                   unsigned int postsortdim)
+{
+  GtUword i, numofendpositions = 0;
+
+  matchstore->endpositions
+    = gt_malloc(sizeof (*matchstore->endpositions) * matchtable->nextfree);
+  for (i = 0; i < matchtable->nextfree; i++)
+  {
+    matchstore->endpositions[i] = GT_CHAIN2DIM_GETSTOREDENDPOINT(postsortdim,i);
+  }
+  gt_radixsort_inplace_ulong(matchstore->endpositions,matchtable->nextfree);
+  for (i = 0; i < matchtable->nextfree; i++)
+  {
+    if (numofendpositions == 0 ||
+        matchstore->endpositions[numofendpositions-1] <
+        matchstore->endpositions[i])
     {
-      if (GT_CHAIN2DIM_GETSTOREDENDPOINT(presortdim,*(jptr-1)) <=
-          GT_CHAIN2DIM_GETSTOREDENDPOINT(presortdim,*jptr))
-      {
-        break;
-      }
-      temp = *(jptr-1);
-      *(jptr-1) = *jptr;
-      *jptr = temp;
-      moves++;
+      matchstore->endpositions[numofendpositions++]
+        = matchstore->endpositions[i];
     }
   }
+  matchstore->numofendpositions = numofendpositions;
 }
 
 static void fastchainingscores(const GtChain2Dimmode *chainmode,
                                GtChain2Dimmatchtable *matchtable,
-                               GtChain2DimMatchstore *matchstore,
                                unsigned int presortdim,
                                bool gapsL1)
 {
-  matchstore->endpointperm
-    = gt_malloc(sizeof (*matchstore->endpointperm) *
-                matchtable->nextfree);
-  makesortedendpointpermutation(matchstore->endpointperm,
+  GtChain2DimMatchstore matchstore;
+  GtUword rank;
+
+  matchstore.endpointperm
+    = gt_malloc(sizeof (*matchstore.endpointperm) * matchtable->nextfree);
+  makesortedendpointpermutation(matchstore.endpointperm,
                                 matchtable,
                                 presortdim);
+  makesortedendpositions(&matchstore,matchtable,1U - presortdim);
+  matchstore.rangemax = gt_malloc(sizeof (*matchstore.rangemax) *
+                                  (matchstore.numofendpositions + 1));
+  for (rank = 0; rank <= matchstore.numofendpositions; rank++)
+  {
+    matchstore.rangemax[rank].priority = 0;
+    matchstore.rangemax[rank].activation = GT_CHAIN2DIM_UNDEFACTIVATION;
+  }
   mergestartandendpoints(chainmode,
                          matchtable,
-                         matchstore,
+                         &matchstore,
                          gapsL1,
                          presortdim);
-  gt_free(matchstore->endpointperm);
+  gt_free(matchstore.rangemax);
+  gt_free(matchstore.endpositions);
+  gt_free(matchstore.endpointperm);
 }
 
 static GtChain2Dimgapcostfunction assignchaingapcostfunction(
@@ -1457,6 +1510,64 @@ static GtChain2Dimgapcostfunction assignchaingapcostfunction(
   return NULL;
 }
 
+static void gt_chain2dim_chainingscores(const GtChain2Dimmode *chainmode,
+                                        GtChain2Dimmatchtable *matchtable,
+                                        bool gapsL1,
+                                        unsigned int presortdim)
+{
+  gt_assert(matchtable->nextfree > 1UL);
+  if (chainmode->chainkind == GLOBALCHAININGWITHOVERLAPS)
+  {
+    gt_chain2dim_bruteforcechainingscores(chainmode,matchtable,
+                                          assignchaingapcostfunction(
+                                                  chainmode->chainkind,
+                                                  gapsL1));
+  } else
+  {
+    if (chainmode->chainkind == GLOBALCHAININGALLCHAINS)
+    {
+      gt_chain2dim_ndbfchainscores(matchtable);
+    } else
+    {
+      fastchainingscores(chainmode,
+                         matchtable,
+                         presortdim,
+                         gapsL1);
+    }
+  }
+}
+
+static void gt_chain2dim_retrievechains(const GtChain2Dimmode *chainmode,
+                                        GtChain2Dim *chain,
+                                        GtChain2Dimmatchtable *matchtable,
+                                        bool withequivclasses,
+                                        GtChain2Dimprocessor chainprocessor,
+                                        void *cpinfo,
+                                        GtLogger *logger)
+{
+  if (matchtable->nextfree > 1UL)
+  {
+    GT_UNUSED unsigned int retval;
+
+    retval = gt_chain2dim_findmaximalscores(chainmode,
+                               chain,
+                               matchtable,
+                               chainprocessor,
+                               withequivclasses,
+                               cpinfo,
+                               logger);
+    /* retval is not reported. */
+  } else
+  {
+    gt_chain2dim_chainingboundarycases(chainmode, chain, matchtable);
+    if (chainmode->chainkind != LOCALCHAININGTHRESHOLD ||
+        matchtable->matches[0].weight >= chainmode->minimumscore)
+    {
+      chainprocessor(cpinfo,matchtable,chain);
+    }
+  }
+}
+
 /*EE
   The following function implements the different kinds of chaining
   algorithms for global and local chaining. The mode is specified
@@ -1486,61 +1597,110 @@ void gt_chain_fastchaining(const GtChain2Dimmode *chainmode,
                            void *cpinfo,
                            GtLogger *logger)
 {
-  GT_UNUSED unsigned int retval;
-  GtChain2Dimgapcostfunction chaingapcostfunction;
-
   gt_assert(presortdim <= 1U);
-  chaingapcostfunction
-    = assignchaingapcostfunction(chainmode->chainkind,gapsL1);
   if (matchtable->nextfree > 1UL)
   {
-    GtChain2DimMatchstore matchstore;
-
     gt_logger_log(logger,"compute chain scores");
-    matchstore.dictroot = NULL;
-    if (chainmode->chainkind == GLOBALCHAININGWITHOVERLAPS)
+    gt_chain2dim_chainingscores(chainmode,matchtable,gapsL1,presortdim);
+    gt_logger_log(logger,"retrieve optimal chains");
+  }
+  gt_chain2dim_retrievechains(chainmode,
+                              chain,
+                              matchtable,
+                              withequivclasses,
+                              chainprocessor,
+                              cpinfo,
+                              logger);
+}
+
+typedef struct
+{
+  const GtChain2Dimmode *chainmode;
+  GtChain2Dimmatchtable **matchtables;
+  GtUword numofmatchtables,
+          nextmatchtable;
+  bool gapsL1;
+  unsigned int presortdim;
+  GtMutex *mutex;
+} GtChain2DimMultiinfo;
+
+static void *gt_chain2dim_multi_thread(void *data)
+{
+  GtChain2DimMultiinfo *multiinfo = (GtChain2DimMultiinfo *) data;
+
+  while (true)
+  {
+    GtChain2Dimmatchtable *matchtable = NULL;
+
+    gt_mutex_lock(multiinfo->mutex);
+    if (multiinfo->nextmatchtable < multiinfo->numofmatchtables)
     {
-      gt_chain2dim_bruteforcechainingscores(chainmode,matchtable,
-                                            chaingapcostfunction);
-    } else
+      matchtable = multiinfo->matchtables[multiinfo->nextmatchtable++];
+    }
+    gt_mutex_unlock(multiinfo->mutex);
+    if (matchtable == NULL)
     {
-      if (chainmode->chainkind == GLOBALCHAININGALLCHAINS)
-      {
-        gt_chain2dim_ndbfchainscores(matchtable);
-      } else
-      {
-        fastchainingscores(chainmode,
-                           matchtable,
-                           &matchstore,
-                           presortdim,
-                           gapsL1);
-      }
+      break;
     }
-    gt_logger_log(logger,"retrieve optimal chains");
-    retval = gt_chain2dim_findmaximalscores(chainmode,
-                               chain,
-                               matchtable,
-                               &matchstore,
-                               chainprocessor,
-                               withequivclasses,
-                               cpinfo,
-                               logger);
-    if (chainmode->chainkind != GLOBALCHAININGWITHOVERLAPS
-        && chainmode->chainkind != GLOBALCHAININGALLCHAINS)
+    if (matchtable->nextfree > 1UL)
     {
-      gt_rbtree_delete(matchstore.dictroot);
+      gt_chain2dim_chainingscores(multiinfo->chainmode,matchtable,
+                                  multiinfo->gapsL1,multiinfo->presortdim);
     }
+  }
+  return NULL;
+}
+
+int gt_chain_fastchaining_multi(const GtChain2Dimmode *chainmode,
+                                GtChain2Dim *chain,
+                                GtChain2Dimmatchtable **matchtables,
+                                GtUword numofmatchtables,
+                                bool gapsL1,
+                                unsigned int presortdim,
+                                bool withequivclasses,
+                                GtChain2Dimprocessor chainprocessor,
+                                void **cpinfos,
+                                GtLogger *logger,
+                                GtError *err)
+{
+  GtChain2DimMultiinfo multiinfo;
+  GtUword idx;
+  int had_err = 0;
+
+  gt_error_check(err);
+  gt_assert(presortdim <= 1U);
+  multiinfo.chainmode = chainmode;
+  multiinfo.matchtables = matchtables;
+  multiinfo.numofmatchtables = numofmatchtables;
+  multiinfo.nextmatchtable = 0;
+  multiinfo.gapsL1 = gapsL1;
+  multiinfo.presortdim = presortdim;
+  multiinfo.mutex = gt_mutex_new();
+  gt_logger_log(logger,"compute chain scores of " GT_WU " match tables",
+                numofmatchtables);
+  if (gt_jobs > 1U && numofmatchtables > 1UL)
+  {
+    had_err = gt_multithread(gt_chain2dim_multi_thread, &multiinfo, err);
   } else
   {
-    gt_chain2dim_chainingboundarycases(chainmode, chain, matchtable);
-    if (chainmode->chainkind != LOCALCHAININGTHRESHOLD ||
-        matchtable->matches[0].weight >= chainmode->minimumscore)
+    (void) gt_chain2dim_multi_thread(&multiinfo);
+  }
+  gt_mutex_delete(multiinfo.mutex);
+  if (!had_err)
+  {
+    gt_logger_log(logger,"retrieve optimal chains");
+    for (idx = 0; idx < numofmatchtables; idx++)
     {
-      chainprocessor(cpinfo,matchtable,chain);
+      gt_chain2dim_retrievechains(chainmode,
+                                  chain,
+                                  matchtables[idx],
+                                  withequivclasses,
+                                  chainprocessor,
+                                  cpinfos[idx],
+                                  logger);
     }
-    retval = 0;
   }
-  /* retval is not reported. */
+  return had_err;
 }
 
 static int cmpMatchchaininfo0(const void *keya,const void *keyb)
@@ -1787,6 +1947,12 @@ void gt_chain_extractchainelem(GtChain2Dimmatchvalues *value,
   value->weight = fiptr->weight;
 }
 
+GtUword gt_chain_chainelem_index(const GtChain2Dim *chain,GtUword idx)
+{
+  gt_assert(idx < gt_chain_chainlength(chain));
+  return chain->chainedmatches.spaceGtChain2Dimref[idx];
+}
+
 void gt_chain_printchainelem(FILE *outfp,const GtChain2Dimmatchvalues *value)
 {
   fprintf(outfp,GT_WU " " GT_WU " " GT_WU " " GT_WU " " GT_WD "\n",
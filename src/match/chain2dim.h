@@ -151,6 +151,27 @@ void gt_chain_fastchaining(const GtChain2Dimmode *chainmode,
                            void *cpinfo,
                            GtLogger *logger);
 
+/* the function to perform the fast chaining algorithms on <numofmatchtables>
+   independent tables of matches <matchtables>, for example the matches of
+   different pairs of sequences. The chain scores of the tables are computed
+   with <gt_jobs> many threads in parallel. Afterwards the chains of the
+   tables are processed in the order of the tables, such that
+   <chainprocessor> is called with <cpinfos>[i] for the chains of
+   <matchtables>[i], exactly as by <gt_chain_fastchaining>. Returns 0 on
+   success and -1 if the threads could not be started. */
+
+int gt_chain_fastchaining_multi(const GtChain2Dimmode *chainmode,
+                                GtChain2Dim *chain,
+                                GtChain2Dimmatchtable **matchtables,
+                                GtUword numofmatchtables,
+                                bool gapsL1,
+                                unsigned int presortdim,
+                                bool withequivclasses,
+                                GtChain2Dimprocessor chainprocessor,
+                                void **cpinfos,
+                                GtLogger *logger,
+                                GtError *err);
+
 /* obtain the score of a chain */
 
 GtChain2Dimscoretype gt_chain_chainscore(const GtChain2Dim *chain);
@@ -170,6 +191,13 @@ void gt_chain_extractchainelem(GtChain2Dimmatchvalues *value,
                                const GtChain2Dim *chain,
                                GtUword idx);
 
+/* obtain the index of element idx in given chain with respect to the
+   table of matches. As the table is sorted before chaining, this is
+   the index of the match in the order of insertion only if the matches
+   were inserted in sorted order */
+
+GtUword gt_chain_chainelem_index(const GtChain2Dim *chain,GtUword idx);
+
 /* print a chain element to the given file pointer */
 
 void gt_chain_printchainelem(FILE *outfp,const GtChain2Dimmatchvalues *value);
@@ -92,6 +92,14 @@ void gt_diagband_struct_reset_counts(const GtDiagbandStruct *diagband_struct,
   fprintf(stream,"\n");
 }
 
+void gt_diagband_struct_add_reset_counts(GtDiagbandStruct *diagband_struct,
+                                         const GtDiagbandStruct *other)
+{
+  gt_assert(diagband_struct != NULL && other != NULL);
+  diagband_struct->reset_with_memset += other->reset_with_memset;
+  diagband_struct->reset_from_matches += other->reset_from_matches;
+}
+
 void gt_diagband_struct_delete(GtDiagbandStruct *diagband_struct)
 {
   if (diagband_struct != NULL)
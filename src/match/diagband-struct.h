@@ -118,6 +118,13 @@ void gt_diagband_struct_reset(GtDiagbandStruct *diagband_struct,
 void gt_diagband_struct_reset_counts(const GtDiagbandStruct *diagband_struct,
                                      FILE *stream);
 
+/* The following function adds the reset counts of <other> to those of
+   <diagband_struct>, for example to report the resets performed with one
+   <GtDiagbandStruct> per thread. */
+
+void gt_diagband_struct_add_reset_counts(GtDiagbandStruct *diagband_struct,
+                                         const GtDiagbandStruct *other);
+
 /* We want to compute statistics on diagonal bands and we use the
    following type for the corresponding state. */
 
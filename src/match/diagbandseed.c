@@ -155,6 +155,8 @@ struct GtDiagbandseedExtendParams
   double matchscore_bias;
   GtUword use_apos;
   GtAniAccumulate *ani_accumulate;
+  GtDiagbandseedProcessmatch processmatch;
+  void *processmatch_data;
   bool extendgreedy,
        extendxdrop,
        weakends,
@@ -360,9 +362,21 @@ GtDiagbandseedExtendParams *gt_diagbandseed_extend_params_new(
   extp->verify_alignment = verify_alignment;
   extp->only_selected_seqpairs = only_selected_seqpairs;
   extp->ani_accumulate = ani_accumulate;
+  extp->processmatch = NULL;
+  extp->processmatch_data = NULL;
   return extp;
 }
 
+void gt_diagbandseed_extend_params_set_processmatch(
+                                GtDiagbandseedExtendParams *extp,
+                                GtDiagbandseedProcessmatch processmatch,
+                                void *processmatch_data)
+{
+  gt_assert(extp != NULL);
+  extp->processmatch = processmatch;
+  extp->processmatch_data = processmatch_data;
+}
+
 void gt_diagbandseed_extend_params_delete(GtDiagbandseedExtendParams *extp)
 {
   if (extp != NULL) {
@@ -2653,6 +2667,8 @@ typedef struct
   const GtSeedExtendDisplayFlag *out_display_flag;
   bool benchmark;
   GtAniAccumulate *ani_accumulate;
+  GtDiagbandseedProcessmatch processmatch;
+  void *processmatch_data;
   GtDiagbandseedState *dbs_state;
 } GtDiagbandseedExtendSegmentInfo;
 
@@ -2779,7 +2795,11 @@ static int gt_diagbandseed_possibly_extend(const GtArrayGtDiagbandseedRectangle
                                       esi->errorpercentage,
                                       esi->evalue_threshold))
         {
-          if (!esi->benchmark) {
+          if (esi->processmatch != NULL)
+          {
+            esi->processmatch(esi->processmatch_data,querymatch,evalue,
+                              bit_score);
+          } else if (!esi->benchmark) {
             if (gt_querymatch_gfa2_display(esi->out_display_flag))
             {
               gt_assert(esi->dbs_state != NULL);
@@ -2801,7 +2821,7 @@ static int gt_diagbandseed_possibly_extend(const GtArrayGtDiagbandseedRectangle
           ret = 3; /* output match */
         } else
         {
-          if (!esi->benchmark) {
+          if (esi->processmatch == NULL && !esi->benchmark) {
             gt_querymatch_show_failed_seed(esi->out_display_flag,querymatch);
           }
           ret = 2; /* found match, which does not satisfy length or similarity
@@ -3123,6 +3143,7 @@ static void gt_diagbandseed_segment2maxmatches(
         previous_start_b = inmatch.startpos[1];
 #endif
       }
+      gt_chain_fillthegapvalues(chainmatchtable);
       gt_chain_fastchaining(chainmode,
                             localchain,
                             chainmatchtable,
@@ -3291,6 +3312,18 @@ static void gt_diagbandseed_segment2matches(
 }
 
 #define GT_DIAGBANDSEED_PROCESS_SEGMENT\
+        if (collect_segments)\
+        {\
+          GtDiagbandseedSegment *collected;\
+          GT_GETNEXTFREEINARRAY(collected,&segments,GtDiagbandseedSegment,\
+                                segments.allocatedGtDiagbandseedSegment\
+                                  / 5 + 128);\
+          collected->aseqnum = currsegm_aseqnum;\
+          collected->bseqnum = currsegm_bseqnum;\
+          collected->length = segment_length;\
+          collected->positions = segment_positions;\
+        } else\
+        {\
         if (segment_reject_func == NULL ||\
             !segment_reject_func(segment_reject_info,currsegm_bseqnum))\
         {\
@@ -3352,6 +3385,7 @@ static void gt_diagbandseed_segment2matches(
                                      : memstore->\
                                            spaceGtDiagbandseedMaximalmatch,\
                                    segment_length);\
+        }\
         }
 
 static void gt_diagbandseed_match_header(FILE *stream,
@@ -3534,6 +3568,8 @@ static GtDiagbandseedExtendSegmentInfo *gt_diagbandseed_extendSI_new(
   esi->karlin_altschul_stat = karlin_altschul_stat;
   esi->out_display_flag = extp->out_display_flag;
   esi->benchmark = extp->benchmark;
+  esi->processmatch = extp->processmatch;
+  esi->processmatch_data = extp->processmatch_data;
   if (extp->ani_accumulate != NULL)
   {
     if (GT_ISDIRREVERSE(query_readmode))
@@ -3561,6 +3597,388 @@ static void gt_diagbandseed_extendSI_delete(
   }
 }
 
+/* returns the object holding the workspace of the greedy or xdrop extension
+   as chosen by <extp>, or NULL if no extension is performed */
+static void *gt_diagbandseed_processinfo_new(
+                                   const GtDiagbandseedExtendParams *extp,
+                                   const GtFtPolishing_info *pol_info)
+{
+  if (extp->extendgreedy)
+  {
+    return (void *) gt_greedy_extend_matchinfo_new(
+                                                 extp->maxalignedlendifference,
+                                                 extp->history_size,
+                                                 extp->perc_mat_history,
+                                                 extp->userdefinedleastlength,
+                                                 extp->errorpercentage,
+                                                 extp->evalue_threshold,
+                                                 extp->a_extend_char_access,
+                                                 extp->b_extend_char_access,
+                                                 extp->cam_generic,
+                                                 extp->sensitivity,
+                                                 pol_info);
+  }
+  if (extp->extendxdrop)
+  {
+    return (void *) gt_xdrop_matchinfo_new(extp->userdefinedleastlength,
+                                           extp->errorpercentage,
+                                           extp->evalue_threshold,
+                                           extp->xdropbelowscore,
+                                           extp->sensitivity);
+  }
+  return NULL;
+}
+
+static void gt_diagbandseed_processinfo_delete(
+                                   const GtDiagbandseedExtendParams *extp,
+                                   void *processinfo)
+{
+  if (extp->extendgreedy)
+  {
+    gt_greedy_extend_matchinfo_delete((GtGreedyextendmatchinfo *) processinfo);
+  } else
+  {
+    if (extp->extendxdrop)
+    {
+      gt_xdrop_matchinfo_delete((GtXdropmatchinfo *) processinfo);
+    }
+  }
+}
+
+/* returns the output options for the alignments of the matches, or NULL if
+   these are not required by <extp> */
+static GtQuerymatchoutoptions *gt_diagbandseed_querymoutopt_new(
+                                   const GtDiagbandseedExtendParams *extp)
+{
+  GtQuerymatchoutoptions *querymoutopt = NULL;
+
+  if (extp->extendxdrop || extp->verify_alignment ||
+      gt_querymatch_alignment_display(extp->out_display_flag) ||
+      gt_querymatch_trace_display(extp->out_display_flag) ||
+      gt_querymatch_dtrace_display(extp->out_display_flag) ||
+      gt_querymatch_cigar_display(extp->out_display_flag) ||
+      gt_querymatch_cigarX_display(extp->out_display_flag))
+  {
+    querymoutopt = gt_querymatchoutoptions_new(extp->out_display_flag,
+                                               NULL,
+                                               NULL);
+    gt_assert(querymoutopt != NULL);
+    if (extp->extendxdrop || extp->extendgreedy) {
+      const GtUword sensitivity = extp->extendxdrop ? 100UL
+                                                    : extp->sensitivity;
+      gt_querymatchoutoptions_extend(querymoutopt,
+                                     extp->errorpercentage,
+                                     extp->evalue_threshold,
+                                     extp->maxalignedlendifference,
+                                     extp->history_size,
+                                     extp->perc_mat_history,
+                                     extp->a_extend_char_access,
+                                     extp->b_extend_char_access,
+                                     extp->cam_generic,
+                                     extp->weakends,
+                                     sensitivity,
+                                     extp->matchscore_bias,
+                                     extp->always_polished_ends,
+                                     extp->out_display_flag);
+    }
+  }
+  return querymoutopt;
+}
+
+/* A segment of seeds with the same pair of sequences, whose positions have
+   already been extracted, collected for the extension in parallel. */
+typedef struct
+{
+  GtUword aseqnum,
+          bseqnum,
+          length;
+  const GtSeedpairPositions *positions;
+} GtDiagbandseedSegment;
+
+GT_DECLAREARRAYSTRUCT(GtDiagbandseedSegment);
+
+#ifdef GT_THREADS_ENABLED
+typedef struct
+{
+  const GtDiagbandseedSegment *segments;
+  GtUword numofsegments;
+  const GtSequencePartsInfo *aseqranges,
+                            *bseqranges;
+  unsigned int seedlength;
+  GtDiagbandStruct *diagband_struct;
+  GtDiagbandseedExtendSegmentInfo esi;
+  GtDiagbandseedState dbs_state;
+  void *processinfo;
+  GtQuerymatchoutoptions *querymoutopt;
+  FILE *stream;
+} GtDiagbandseedExtendThreadInfo;
+
+/* extends the seeds of a range of segments, as done for each segment in
+   <gt_diagbandseed_process_seeds>, with the workspace of the thread */
+static void *gt_diagbandseed_extend_thread(void *thread_info)
+{
+  GtDiagbandseedExtendThreadInfo *ti
+    = (GtDiagbandseedExtendThreadInfo *) thread_info;
+  const GtDiagbandseedSegment *segment;
+
+  for (segment = ti->segments; segment < ti->segments + ti->numofsegments;
+       segment++)
+  {
+    GtUword idx;
+
+    for (idx = 0; idx < segment->length; idx++)
+    {
+      gt_diagband_struct_single_update(ti->diagband_struct,
+                                       segment->positions[idx].apos,
+                                       segment->positions[idx].bpos,
+                                       (GtDiagbandseedPosition)
+                                         ti->seedlength);
+    }
+    gt_diagbandseed_plainsequence_next_segment(&ti->esi.plainsequence_info,
+                                               ti->aseqranges,
+                                               segment->aseqnum,
+                                               ti->bseqranges,
+                                               segment->bseqnum);
+    gt_diagbandseed_segment2matches(&ti->esi,
+                                    NULL,
+                                    NULL,
+                                    segment->aseqnum,
+                                    segment->bseqnum,
+                                    ti->diagband_struct,
+                                    NULL,
+                                    ti->seedlength,
+                                    segment->positions,
+                                    segment->length);
+    if (!gt_diagband_struct_empty(ti->diagband_struct))
+    {
+      gt_diagband_struct_reset(ti->diagband_struct,segment->positions,NULL,
+                               segment->length);
+    }
+  }
+  return NULL;
+}
+
+/* maps the description tables of a lazily loaded <encseq>, so that the
+   threads only read them */
+static void gt_diagbandseed_map_descriptions(const GtEncseq *encseq)
+{
+  if (gt_encseq_has_description_support(encseq))
+  {
+    GtUword desclen;
+
+    (void) gt_encseq_description(encseq,&desclen,0);
+  }
+}
+
+static void gt_diagbandseed_extend_thread_info_delete(
+                                         GtDiagbandseedExtendThreadInfo *ti,
+                                         const GtDiagbandseedExtendParams *extp)
+{
+  gt_querymatch_delete(ti->esi.info_querymatch.querymatchspaceptr);
+  gt_fa_xfclose(ti->stream);
+  gt_diagband_struct_delete(ti->diagband_struct);
+  gt_querymatchoutoptions_delete(ti->querymoutopt);
+  gt_diagbandseed_processinfo_delete(extp,ti->processinfo);
+}
+
+/* Extends the seeds of the collected <segments> with up to <threads> many
+   threads. Each thread processes a contiguous range of segments with about
+   the same number of seeds, using its own diagonal band scores, extension
+   workspace and querymatch, and writes to a temporary file. These files are
+   appended to <stream> in the order of the ranges, so that the matches are
+   output in the same order as without threads. The sequences extracted for
+   <esi> are shared. If the temporary files cannot be created, all segments
+   are extended by the main thread. */
+static void gt_diagbandseed_extend_segments_parallel(
+                              const GtArrayGtDiagbandseedSegment *segments,
+                              unsigned int threads,
+                              const GtEncseq *aencseq,
+                              const GtEncseq *bencseq,
+                              GtDiagbandseedExtendSegmentInfo *esi,
+                              GtDiagbandStruct *diagband_struct,
+                              const GtDiagbandseedExtendParams *extp,
+                              const GtFtPolishing_info *pol_info,
+                              const GtSequencePartsInfo *aseqranges,
+                              const GtSequencePartsInfo *bseqranges,
+                              GtUword amaxlen,
+                              GtUword bmaxlen,
+                              unsigned int seedlength,
+                              const GtKarlinAltschulStat
+                                *karlin_altschul_stat,
+                              GtReadmode query_readmode,
+                              FILE *stream)
+{
+  const GtUword numofsegments = segments->nextfreeGtDiagbandseedSegment;
+  const GtDiagbandseedSegment *segment,
+                              *first = segments->spaceGtDiagbandseedSegment;
+  GtDiagbandseedExtendThreadInfo *tinfo;
+  GtArray *thread_tab = gt_array_new(sizeof (GtThread *));
+  GtUword totalseeds = 0, seeds = 0, extension_time_usec = 0, tidx,
+          numofthreads;
+  GtError *err = gt_error_new();
+
+  gt_assert(threads > 1U && numofsegments > 0);
+  numofthreads = GT_MIN((GtUword) threads, numofsegments);
+  tinfo = gt_calloc((size_t) numofthreads, sizeof *tinfo);
+  for (segment = first; segment < first + numofsegments; segment++)
+  {
+    totalseeds += segment->length;
+  }
+  /* split the segments into ranges with about the same number of seeds */
+  tidx = 0;
+  tinfo[0].segments = first;
+  for (segment = first; segment < first + numofsegments; segment++)
+  {
+    if (tidx + 1 < numofthreads &&
+        seeds >= (tidx + 1) * (totalseeds / numofthreads) &&
+        segment > tinfo[tidx].segments)
+    {
+      tidx++;
+      tinfo[tidx].segments = segment;
+    }
+    tinfo[tidx].numofsegments++;
+    seeds += segment->length;
+  }
+  numofthreads = tidx + 1;
+  for (tidx = 0; tidx < numofthreads; tidx++)
+  {
+    GtDiagbandseedExtendThreadInfo *ti = tinfo + tidx;
+
+    ti->aseqranges = aseqranges;
+    ti->bseqranges = bseqranges;
+    ti->seedlength = seedlength;
+    ti->esi = *esi;
+    if (esi->dbs_state != NULL)
+    {
+      ti->dbs_state.withtiming = esi->dbs_state->withtiming;
+      ti->esi.dbs_state = &ti->dbs_state;
+    }
+    if (tidx == 0)
+    {
+      ti->diagband_struct = diagband_struct;
+      ti->stream = stream;
+    } else
+    {
+      ti->stream = gt_tmpfp_generic(NULL, GT_TMPFP_OPENBINARY |
+                                          GT_TMPFP_AUTOREMOVE, err);
+      if (ti->stream == NULL)
+      {
+        break;
+      }
+      ti->diagband_struct = gt_diagband_struct_new(amaxlen,bmaxlen,
+                                                   extp->logdiagbandwidth);
+      ti->processinfo = gt_diagbandseed_processinfo_new(extp,pol_info);
+      ti->querymoutopt = gt_diagbandseed_querymoutopt_new(extp);
+      gt_diagbandseed_info_qm_set(&ti->esi.info_querymatch,
+                                  extp,
+                                  ti->querymoutopt,
+                                  query_readmode,
+                                  ti->stream,
+                                  karlin_altschul_stat,
+                                  ti->processinfo);
+      /* nothing else is written to the temporary file */
+      gt_querymatch_background_output_set(
+                                  ti->esi.info_querymatch.querymatchspaceptr);
+    }
+  }
+  if (tidx < numofthreads)
+  {
+    GtUword idx;
+
+    gt_warning("%s, extending seeds without threads",gt_error_get(err));
+    for (idx = 1; idx < tidx; idx++)
+    {
+      gt_diagbandseed_extend_thread_info_delete(tinfo + idx,extp);
+    }
+    numofthreads = 1;
+    tinfo[0].numofsegments = numofsegments;
+  } else
+  {
+    /* the threads only read the description tables */
+    if (gt_querymatch_subjectid_display(extp->out_display_flag))
+    {
+      gt_diagbandseed_map_descriptions(aencseq);
+    }
+    if (gt_querymatch_queryid_display(extp->out_display_flag))
+    {
+      gt_diagbandseed_map_descriptions(bencseq);
+    }
+  }
+  gt_error_delete(err);
+
+  /* start additional threads, a range whose thread cannot be started is
+     processed by the main thread */
+  for (tidx = 1; tidx < numofthreads; tidx++)
+  {
+    GtThread *thread;
+    GtError *err = gt_error_new();
+
+    if ((thread = gt_thread_new(gt_diagbandseed_extend_thread,
+                                tinfo + tidx, err)) != NULL)
+    {
+      gt_array_add(thread_tab, thread);
+    } else
+    {
+      (void) gt_diagbandseed_extend_thread(tinfo + tidx);
+    }
+    gt_error_delete(err);
+  }
+  /* the main thread processes the first range */
+  (void) gt_diagbandseed_extend_thread(tinfo);
+  for (tidx = 0; tidx < gt_array_size(thread_tab); tidx++)
+  {
+    GtThread *thread = *(GtThread**) gt_array_get(thread_tab, tidx);
+    gt_thread_join(thread);
+    gt_thread_delete(thread);
+  }
+  gt_array_delete(thread_tab);
+  gt_querymatch_output_flush(esi->info_querymatch.querymatchspaceptr);
+
+  /* merge the states and output of the threads in the order of the ranges */
+  for (tidx = 0; tidx < numofthreads; tidx++)
+  {
+    GtDiagbandseedExtendThreadInfo *ti = tinfo + tidx;
+
+    if (esi->dbs_state != NULL)
+    {
+      GtDiagbandseedState *dbs_state = esi->dbs_state;
+
+      dbs_state->extended_seeds += ti->dbs_state.extended_seeds;
+      dbs_state->selected_seeds += ti->dbs_state.selected_seeds;
+      dbs_state->countmatches += ti->dbs_state.countmatches;
+      dbs_state->failedmatches += ti->dbs_state.failedmatches;
+      dbs_state->seqpairs_with_minsegment
+        += ti->dbs_state.seqpairs_with_minsegment;
+      dbs_state->filteredbydiagonalscore
+        += ti->dbs_state.filteredbydiagonalscore;
+      /* the extensions ran in parallel, so the longest running range
+         determines the time spent */
+      extension_time_usec = GT_MAX(extension_time_usec,
+                                   ti->dbs_state.total_extension_time_usec);
+    }
+    if (tidx > 0)
+    {
+      char buffer[BUFSIZ];
+      size_t len;
+
+      gt_querymatch_output_flush(ti->esi.info_querymatch.querymatchspaceptr);
+      rewind(ti->stream);
+      while ((len = fread(buffer,sizeof (char),sizeof buffer,ti->stream)) > 0)
+      {
+        gt_xfwrite(buffer,sizeof (char),len,stream);
+      }
+      gt_diagband_struct_add_reset_counts(diagband_struct,ti->diagband_struct);
+      gt_diagbandseed_extend_thread_info_delete(ti,extp);
+    }
+  }
+  if (esi->dbs_state != NULL)
+  {
+    esi->dbs_state->total_extension_time_usec += extension_time_usec;
+  }
+  gt_free(tinfo);
+}
+#endif
+
 typedef void (*GtDiagbandseedProcessSegmentFunc)(
                         void *v_process_segment_info,
                         const GtEncseq *aencseq,
@@ -3600,7 +4018,11 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
                                           GtSegmentRejectFunc
                                             segment_reject_func,
                                           GtSegmentRejectInfo
-                                            *segment_reject_info)
+                                            *segment_reject_info,
+                                          GT_UNUSED const GtFtPolishing_info
+                                            *pol_info,
+                                          GT_UNUSED unsigned int
+                                            extension_threads)
 {
   const bool forward = query_readmode == GT_READMODE_REVCOMPL ? false : true;
   /* Although the sequences of the parts processed are shorter, we need to
@@ -3615,6 +4037,8 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
   GtDiagbandStatistics *diagband_statistics = NULL;
   GtDiagbandseedProcessSegmentFunc segment_proc_func = NULL;
   void *segment_proc_info = NULL;
+  GtArrayGtDiagbandseedSegment segments;
+  bool collect_segments = false;
 
   gt_assert(extp->mincoverage >= seedlength && minsegmentlen >= 1);
   if (mlistlen == 0 || mlistlen < minsegmentlen ||
@@ -3663,6 +4087,14 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
                                          dbs_state,
                                          segment_reject_func,
                                          segment_reject_info);
+      /* unless verbose or debug information is written to <stream> between
+         the matches, the matches are written by a separate thread */
+      if (!verbose && !esi->debug &&
+          esi->info_querymatch.querymatchspaceptr != NULL)
+      {
+        gt_querymatch_background_output_set(
+                                    esi->info_querymatch.querymatchspaceptr);
+      }
       if (verbose)
       {
         if (esi->plainsequence_info.a_byte_sequence != NULL ||
@@ -3675,6 +4107,22 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
       }
       segment_proc_func = gt_diagbandseed_segment2matches;
       segment_proc_info = esi;
+#ifdef GT_THREADS_ENABLED
+      /* The segments are independent of each other, unless matches of
+         earlier segments are used for the following ones or the output
+         is not written to <stream>. In all other cases the segments are
+         collected and their seeds are extended in parallel. */
+      if (extension_threads > 1U &&
+          !seedpairlist->maxmat_compute &&
+          segment_reject_func == NULL &&
+          esi->ani_accumulate == NULL &&
+          !esi->only_selected_seqpairs &&
+          !esi->debug &&
+          !gt_querymatch_gfa2_display(extp->out_display_flag))
+      {
+        collect_segments = true;
+      }
+#endif
     } else
     {
       diagband_statistics = gt_diagband_statistics_new(diagband_statistics_arg,
@@ -3683,6 +4131,7 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
       segment_proc_info = diagband_statistics;
     }
   }
+  GT_INITARRAY(&segments,GtDiagbandseedSegment);
   if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_STRUCT)
   {
     const GtDiagbandseedSeedPair
@@ -3718,7 +4167,7 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
       spp_ptr = segment_positions = (GtSeedpairPositions *) currsegm;
       do
       {
-        if (!seedpairlist->maxmat_compute)
+        if (!seedpairlist->maxmat_compute && !collect_segments)
         {
           gt_diagband_struct_single_update(diagband_struct,
                                            GT_DIAGBANDSEED_GETPOS_A(nextsegm),
@@ -3733,7 +4182,7 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
                currsegm_aseqnum == nextsegm->aseqnum &&
                currsegm_bseqnum == nextsegm->bseqnum);
 
-      if (esi != NULL)
+      if (esi != NULL && !collect_segments)
       {
         gt_diagbandseed_plainsequence_next_segment(&esi->plainsequence_info,
                                                    aseqranges,
@@ -3801,7 +4250,7 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
           spp_ptr->bpos
             = gt_seedpairlist_extract_ulong(seedpairlist,*nextsegm,idx_bpos);
           spp_ptr->apos = apos;
-          if (!seedpairlist->maxmat_compute)
+          if (!seedpairlist->maxmat_compute && !collect_segments)
           {
             gt_diagband_struct_single_update(diagband_struct,
                                              spp_ptr->apos,
@@ -3816,7 +4265,7 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
                  (nextsegm_a_bseqnum =
                  gt_seedpairlist_a_bseqnum_ulong (seedpairlist,*nextsegm)));
 
-        if (esi != NULL)
+        if (esi != NULL && !collect_segments)
         {
           gt_diagbandseed_plainsequence_next_segment(&esi->plainsequence_info,
                                                      aseqranges,
@@ -3883,7 +4332,7 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
                    nextsegment_offset);
         do
         {
-          if (!seedpairlist->maxmat_compute)
+          if (!seedpairlist->maxmat_compute && !collect_segments)
           {
             gt_diagband_struct_single_update(
                                          diagband_struct,
@@ -3910,7 +4359,7 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
            based on apos and bpos values. */
         currsegm_aseqnum += seedpairlist->aseqrange_start;
         currsegm_bseqnum += seedpairlist->bseqrange_start;
-        if (esi != NULL)
+        if (esi != NULL && !collect_segments)
         {
           gt_diagbandseed_plainsequence_next_segment(&esi->plainsequence_info,
                                                      aseqranges,
@@ -3923,6 +4372,28 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
       }
     }
   }
+#ifdef GT_THREADS_ENABLED
+  if (segments.nextfreeGtDiagbandseedSegment > 0)
+  {
+    gt_diagbandseed_extend_segments_parallel(&segments,
+                                             extension_threads,
+                                             aencseq,
+                                             bencseq,
+                                             esi,
+                                             diagband_struct,
+                                             extp,
+                                             pol_info,
+                                             aseqranges,
+                                             bseqranges,
+                                             seedpairlist->amaxlen,
+                                             gt_encseq_max_seq_length(bencseq),
+                                             seedlength,
+                                             karlin_altschul_stat,
+                                             query_readmode,
+                                             stream);
+  }
+#endif
+  GT_FREEARRAY(&segments,GtDiagbandseedSegment);
   if (diagband_struct != NULL)
   {
     if (verbose)
@@ -4026,6 +4497,7 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
                                      GtDiagbandseedState
                                        *dbs_state,
                                      GtFtTrimstat *trimstat,
+                                     unsigned int extension_threads,
                                      GtError *err)
 {
   GtKmerPosList *blist = NULL;
@@ -4271,7 +4743,6 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
   if (!had_err)
   {
     if (extp->extendgreedy) {
-      GtGreedyextendmatchinfo *grextinfo = NULL;
       const double weak_errorperc = (double)(extp->weakends
                                              ? GT_MAX(extp->errorpercentage, 20)
                                              : extp->errorpercentage);
@@ -4279,62 +4750,17 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
       pol_info = polishing_info_new_with_bias(weak_errorperc,
                                               extp->matchscore_bias,
                                               extp->history_size);
-      grextinfo = gt_greedy_extend_matchinfo_new(extp->maxalignedlendifference,
-                                                 extp->history_size,
-                                                 extp->perc_mat_history,
-                                                 extp->userdefinedleastlength,
-                                                 extp->errorpercentage,
-                                                 extp->evalue_threshold,
-                                                 extp->a_extend_char_access,
-                                                 extp->b_extend_char_access,
-                                                 extp->cam_generic,
-                                                 extp->sensitivity,
-                                                 pol_info);
-      if (trimstat != NULL)
-      {
-        gt_greedy_extend_matchinfo_trimstat_set(grextinfo,trimstat);
-      }
-      processinfo = (void *) grextinfo;
-    } else if (extp->extendxdrop) {
-      GtXdropmatchinfo *xdropinfo = NULL;
-      gt_assert(extp->extendgreedy == false);
-      xdropinfo = gt_xdrop_matchinfo_new(extp->userdefinedleastlength,
-                                         extp->errorpercentage,
-                                         extp->evalue_threshold,
-                                         extp->xdropbelowscore,
-                                         extp->sensitivity);
-      processinfo = (void *) xdropinfo;
     }
-    if (extp->extendxdrop || extp->verify_alignment ||
-        gt_querymatch_alignment_display(extp->out_display_flag) ||
-        gt_querymatch_trace_display(extp->out_display_flag) ||
-        gt_querymatch_dtrace_display(extp->out_display_flag) ||
-        gt_querymatch_cigar_display(extp->out_display_flag) ||
-        gt_querymatch_cigarX_display(extp->out_display_flag))
+    processinfo = gt_diagbandseed_processinfo_new(extp,pol_info);
+    if (extp->extendgreedy && trimstat != NULL)
     {
-      querymoutopt = gt_querymatchoutoptions_new(extp->out_display_flag,
-                                                 NULL,
-                                                 NULL);
-      gt_assert(querymoutopt != NULL);
-      if (extp->extendxdrop || extp->extendgreedy) {
-        const GtUword sensitivity = extp->extendxdrop ? 100UL
-                                                      : extp->sensitivity;
-        gt_querymatchoutoptions_extend(querymoutopt,
-                                       extp->errorpercentage,
-                                       extp->evalue_threshold,
-                                       extp->maxalignedlendifference,
-                                       extp->history_size,
-                                       extp->perc_mat_history,
-                                       extp->a_extend_char_access,
-                                       extp->b_extend_char_access,
-                                       extp->cam_generic,
-                                       extp->weakends,
-                                       sensitivity,
-                                       extp->matchscore_bias,
-                                       extp->always_polished_ends,
-                                       extp->out_display_flag);
-      }
+      gt_greedy_extend_matchinfo_trimstat_set(
+                               (GtGreedyextendmatchinfo *) processinfo,
+                               trimstat);
+      /* the trimming statistics are not thread safe */
+      extension_threads = 1U;
     }
+    querymoutopt = gt_diagbandseed_querymoutopt_new(extp);
     /* process first mlist */
     gt_assert(seedpairlist != NULL);
     gt_diagbandseed_process_seeds(seedpairlist,
@@ -4355,7 +4781,9 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
                                   arg->diagband_statistics_arg,
                                   dbs_state,
                                   segment_reject_func,
-                                  segment_reject_info);
+                                  segment_reject_info,
+                                  pol_info,
+                                  extension_threads);
     gt_seedpairlist_reset(seedpairlist);
     gt_querymatchoutoptions_reset(querymoutopt);
 
@@ -4484,7 +4912,9 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
                                   arg->diagband_statistics_arg,
                                   dbs_state,
                                   segment_reject_func,
-                                  segment_reject_info);
+                                  segment_reject_info,
+                                  pol_info,
+                                  extension_threads);
   }
   /* Clean up */
   gt_seedpairlist_delete(seedpairlist);
@@ -4497,17 +4927,8 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
     }
     gt_free(memstore);
   }
-  if (extp->extendgreedy)
-  {
-    polishing_info_delete(pol_info);
-    gt_greedy_extend_matchinfo_delete((GtGreedyextendmatchinfo *) processinfo);
-  } else
-  {
-    if (extp->extendxdrop)
-    {
-      gt_xdrop_matchinfo_delete((GtXdropmatchinfo *) processinfo);
-    }
-  }
+  gt_diagbandseed_processinfo_delete(extp,processinfo);
+  polishing_info_delete(pol_info);
   gt_querymatchoutoptions_delete(querymoutopt);
   if (segment_reject_info != NULL)
   {
@@ -4532,6 +4953,7 @@ typedef struct
                             *bseqranges;
   GtSegmentRejectFunc segment_reject_func;
   GtArray *combinations;
+  unsigned int extension_threads;
   int had_err;
   GtError *err;
   const GtKarlinAltschulStat *karlin_altschul_stat;
@@ -4548,6 +4970,7 @@ static void gt_diagbandseed_thread_info_set(GtDiagbandseedThreadInfo *ti,
                                      const GtKarlinAltschulStat
                                        *karlin_altschul_stat,
                                      GtArray *combinations,
+                                     unsigned int extension_threads,
                                      GtError *err)
 {
   gt_assert(ti != NULL);
@@ -4560,6 +4983,7 @@ static void gt_diagbandseed_thread_info_set(GtDiagbandseedThreadInfo *ti,
   ti->bseqranges = bseqranges;
   ti->karlin_altschul_stat = karlin_altschul_stat;
   ti->combinations = gt_array_clone(combinations);
+  ti->extension_threads = extension_threads;
   ti->had_err = 0;
   ti->err = err;
 }
@@ -4585,6 +5009,7 @@ static void *gt_diagbandseed_thread_algorithm(void *thread_info)
                            info->karlin_altschul_stat,
                            NULL,
                            NULL,
+                           info->extension_threads,
                            info->err);
       if (info->had_err) break;
     }
@@ -4698,6 +5123,7 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
   GtKarlinAltschulStat *karlin_altschul_stat = NULL;
   GtDiagbandseedState *dbs_state = NULL;
 #ifdef GT_THREADS_ENABLED
+  const unsigned int num_jobs = gt_jobs;
   GtDiagbandseedThreadInfo *tinfo = gt_malloc(gt_jobs * sizeof *tinfo);
   FILE **stream_tab;
   unsigned int tidx;
@@ -4709,6 +5135,8 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
     stream_tab[tidx]
       = gt_xtmpfp_generic(NULL, GT_TMPFP_OPENBINARY | GT_TMPFP_AUTOREMOVE);
   }
+#else
+  const unsigned int num_jobs = 1U;
 #endif
   if (arg->verbose || gt_querymatch_gfa2_display(arg->extp->out_display_flag))
   {
@@ -4793,7 +5221,8 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
   }
   if (gt_querymatch_evalue_display(arg->extp->out_display_flag) ||
       gt_querymatch_bitscore_display(arg->extp->out_display_flag) ||
-      arg->extp->evalue_threshold != DBL_MAX)
+      arg->extp->evalue_threshold != DBL_MAX ||
+      arg->extp->processmatch != NULL)
   {
     GtTimer *timer = NULL;
 
@@ -4869,7 +5298,9 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
     bidx = self ? aidx : 0;
 
 #ifdef GT_THREADS_ENABLED
-    if (gt_jobs <= 1) {
+    /* with a single run all threads are used for extending the seeds */
+    if (gt_jobs <= 1 ||
+        (!arg->use_kmerfile && (bpick || bidx + 1 == bnumseqranges))) {
 #endif
       while (!had_err && bidx < bnumseqranges) {
         if (!bpick || pick->b == bidx) {
@@ -4883,6 +5314,7 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
                            karlin_altschul_stat,
                            dbs_state,
                            trimstat,
+                           num_jobs,
                            err);
         }
         bidx++;
@@ -4892,6 +5324,9 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
       const GtUword num_runs = bpick ? 1 : bnumseqranges - bidx;
       const GtUword num_runs_per_thread = (num_runs - 1) / gt_jobs + 1;
       const GtUword num_threads = (num_runs - 1) / num_runs_per_thread + 1;
+      /* the threads not needed for the runs extend the seeds */
+      const unsigned int extension_threads
+        = GT_MAX(1U, gt_jobs / (unsigned int) num_threads);
       GtArray *combinations = gt_array_new(sizeof (GtUwordPair));
       GtArray *threads = gt_array_new(sizeof (GtThread *));
 
@@ -4920,6 +5355,7 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
                                         bseqranges,
                                         karlin_altschul_stat,
                                         combinations,
+                                        extension_threads,
                                         err);
         gt_array_reset(combinations);
         if ((thread = gt_thread_new(gt_diagbandseed_thread_algorithm,
@@ -4952,6 +5388,7 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
                                         bseqranges,
                                         karlin_altschul_stat,
                                         combinations,
+                                        extension_threads,
                                         err);
         gt_diagbandseed_thread_algorithm(tinfo);
       }
@@ -4981,6 +5418,7 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
     GtArray *combinations[gt_jobs];
     GtArray *threads = gt_array_new(sizeof (GtThread *));
     GtUword counter = 0;
+    unsigned int extension_threads;
     for (tidx = 0; tidx < gt_jobs; tidx++) {
       combinations[tidx] = gt_array_new(sizeof (GtUwordPair));
     }
@@ -4996,6 +5434,9 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
         }
       }
     }
+    /* the threads not needed for the runs extend the seeds */
+    extension_threads = GT_MAX(1U, gt_jobs / (unsigned int)
+                                   GT_MAX(1UL, GT_MIN(counter, gt_jobs)));
 
     for (tidx = 1; !had_err && tidx < gt_jobs; tidx++) {
       GtThread *thread;
@@ -5009,6 +5450,7 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
                                       bseqranges,
                                       karlin_altschul_stat,
                                       combinations[tidx],
+                                      extension_threads,
                                       err);
       if ((thread = gt_thread_new(gt_diagbandseed_thread_algorithm,
                                   tinfo + tidx, err)) != NULL) {
@@ -5029,6 +5471,7 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
                                       bseqranges,
                                       karlin_altschul_stat,
                                       combinations[0],
+                                      extension_threads,
                                       err);
       gt_diagbandseed_thread_algorithm(tinfo);
     }
@@ -24,6 +24,7 @@
 #include "core/range_api.h"
 #include "core/types_api.h"
 #include "match/ft-front-prune.h"
+#include "match/querymatch.h"
 #include "match/seed_extend_parts.h"
 #include "match/querymatch-display.h"
 #include "match/xdrop.h"
@@ -112,6 +113,20 @@ GtDiagbandseedExtendParams *gt_diagbandseed_extend_params_new(
                                 bool only_selected_seqpairs,
                                 GtAniAccumulate *ani_accumulate);
 
+/* Function called with each match satisfying the length, similarity and
+   E-value constraints. When threads are used, it is called concurrently by
+   the threads performing the extensions. */
+typedef void (*GtDiagbandseedProcessmatch)(void *data,
+                                           const GtQuerymatch *querymatch,
+                                           double evalue,
+                                           double bit_score);
+
+/* Let <extp> hand the matches to <processmatch> instead of printing them. */
+void gt_diagbandseed_extend_params_set_processmatch(
+                                GtDiagbandseedExtendParams *extp,
+                                GtDiagbandseedProcessmatch processmatch,
+                                void *processmatch_data);
+
 /* The destructors */
 void gt_diagbandseed_info_delete(GtDiagbandseedInfo *info);
 
@@ -10,6 +10,8 @@
 #include "core/chardef_api.h"
 #include "core/divmodmul_api.h"
 #include "core/readmode.h"
+#include "extended/myersedist.h"
+#include "extended/scorehandler.h"
 #include "match/ft-polish.h"
 #include "match/ft-eoplist.h"
 #include "match/ft-front-prune.h"
@@ -240,6 +242,34 @@ GtUword gt_eoplist_length(const GtEoplist *eoplist)
   return eoplist->nextfreeuint8_t;
 }
 
+const uint8_t *gt_eoplist_packed(const GtEoplist *eoplist)
+{
+  gt_assert(eoplist != NULL);
+  return eoplist->spaceuint8_t;
+}
+
+void gt_eoplist_packed_add(GtEoplist *eoplist,const uint8_t *packed,
+                           GtUword len)
+{
+  const uint8_t *ptr;
+
+  gt_assert(eoplist != NULL && (len == 0 || packed != NULL));
+  for (ptr = packed; ptr < packed + len; ptr++)
+  {
+    GT_EOPLIST_PUSH(eoplist,*ptr);
+    if (*ptr == FT_EOPCODE_DELETION)
+    {
+      eoplist->countdeletions++;
+    } else
+    {
+      if (*ptr == FT_EOPCODE_INSERTION)
+      {
+        eoplist->countinsertions++;
+      }
+    }
+  }
+}
+
 void gt_eoplist_reverse_end(GtEoplist *eoplist,GtUword firstindex)
 {
   uint8_t *fwd, *bck;
@@ -1321,6 +1351,31 @@ void gt_eoplist_verify(const GtEoplist *eoplist,
             edist,sumdist);
     exit(GT_EXIT_PROGRAMMING_ERROR);
   }
+  if (eoplist->useq != NULL)
+  {
+    /* the alignment need not be optimal, but no alignment with fewer
+       differences can leave the band of those with at most edist
+       differences */
+    const GtWord lendiff = (GtWord) eoplist->vlen - (GtWord) eoplist->ulen,
+                 slack = GT_DIV2((GtWord) edist -
+                                 (lendiff < 0 ? -lendiff : lendiff));
+    GtScoreHandler *scorehandler = gt_scorehandler_new(0,1,0,1);
+    GtMyersEdist *myersedist = gt_myersedist_new(scorehandler);
+    const GtUword banded_edist
+      = gt_myersedist_banded(myersedist,eoplist->useq,eoplist->ulen,
+                             eoplist->vseq,eoplist->vlen,
+                             GT_MIN(0,lendiff) - slack,
+                             GT_MAX(0,lendiff) + slack);
+
+    gt_myersedist_delete(myersedist);
+    gt_scorehandler_delete(scorehandler);
+    if (banded_edist > edist)
+    {
+      fprintf(stderr,"edist = " GT_WU " < " GT_WU " = minimal edist\n",
+              edist,banded_edist);
+      exit(GT_EXIT_PROGRAMMING_ERROR);
+    }
+  }
 }
 
 void gt_eoplist_display_seed_in_alignment_set(GtEoplist *eoplist)
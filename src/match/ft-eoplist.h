@@ -1,6 +1,7 @@
 #ifndef FT_EOPLIST_H
 #define FT_EOPLIST_H
 #include <stdbool.h>
+#include <inttypes.h>
 #include "core/unused_api.h"
 #include "core/chardef_api.h"
 #include "core/readmode.h"
@@ -38,6 +39,16 @@ void gt_eoplist_reverse_end(GtEoplist *eoplist,GtUword firstindex);
 /* obtain length of eoplist */
 GtUword gt_eoplist_length(const GtEoplist *eoplist);
 
+/* obtain the edit operations in their packed form, i.e. one byte per
+   operation or run of matches; the number of bytes is
+   <gt_eoplist_length(eoplist)> */
+const uint8_t *gt_eoplist_packed(const GtEoplist *eoplist);
+
+/* append <len> edit operations in packed form, as delivered by
+   <gt_eoplist_packed>, to <eoplist> */
+void gt_eoplist_packed_add(GtEoplist *eoplist,const uint8_t *packed,
+                           GtUword len);
+
 /* return number of matches in eoplist */
 GtUword gt_eoplist_matches_count(const GtEoplist *eoplist);
 
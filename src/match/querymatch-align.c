@@ -602,20 +602,28 @@ void gt_querymatchoutoptions_extract_seq(GtQuerymatchoutoptions
 void gt_querymatchoutoptions_cigar_show(const GtQuerymatchoutoptions
                                               *querymatchoutoptions,
                                         bool distinguish_mismatch_match,
-                                        FILE *fp)
+                                        GtQuerymatchWriter *writer)
 {
+  GtCigarOp co;
+
   gt_assert(querymatchoutoptions != NULL &&
             querymatchoutoptions->eoplist != NULL);
   gt_eoplist_reader_reset(querymatchoutoptions->eoplist_reader,
                           querymatchoutoptions->eoplist,true);
-  gt_eoplist_show_cigar(querymatchoutoptions->eoplist_reader,
-                        distinguish_mismatch_match,fp);
+  while (gt_eoplist_reader_next_cigar(&co,querymatchoutoptions->eoplist_reader,
+                                      distinguish_mismatch_match))
+  {
+    gt_querymatch_writer_uword(writer,co.iteration);
+    gt_querymatch_writer_char(writer,
+                              gt_eoplist_pretty_print(co.eoptype,
+                                                  distinguish_mismatch_match));
+  }
 }
 
 void gt_querymatchoutoptions_trace_show(const GtQuerymatchoutoptions
                                               *querymatchoutoptions,
                                         bool dtrace,
-                                        FILE *fp)
+                                        GtQuerymatchWriter *writer)
 {
   GtEoplistSegment segment;
   bool first = true;
@@ -629,14 +637,16 @@ void gt_querymatchoutoptions_trace_show(const GtQuerymatchoutoptions
   {
     if (!first)
     {
-      fputc(',',fp);
+      gt_querymatch_writer_char(writer,',');
     } else
     {
       first = false;
     }
-    fprintf(fp,"%d",dtrace ? ((int) querymatchoutoptions->trace_delta -
-                              (int) segment.aligned_v)
-                           : (int) segment.aligned_v);
+    gt_querymatch_writer_word(writer,
+                              dtrace ? ((GtWord) querymatchoutoptions->
+                                                 trace_delta -
+                                        (GtWord) segment.aligned_v)
+                                     : (GtWord) segment.aligned_v);
   }
 }
 
@@ -23,6 +23,7 @@
 #include "match/ft-front-prune.h"
 #include "match/seq_or_encseq.h"
 #include "match/querymatch-display.h"
+#include "match/querymatch-writer.h"
 
 typedef struct GtQuerymatchoutoptions GtQuerymatchoutoptions;
 
@@ -79,12 +80,12 @@ void gt_frontprune2eoplist(GtQuerymatchoutoptions *querymatchoutoptions,
 void gt_querymatchoutoptions_cigar_show(const GtQuerymatchoutoptions
                                               *querymatchoutoptions,
                                         bool distinguish_mismatch_match,
-                                        FILE *fp);
+                                        GtQuerymatchWriter *writer);
 
 void gt_querymatchoutoptions_trace_show(const GtQuerymatchoutoptions
                                               *querymatchoutoptions,
                                         bool dtrace,
-                                        FILE *fp);
+                                        GtQuerymatchWriter *writer);
 
 void gt_querymatchoutoptions_alignment_show(const GtQuerymatchoutoptions
                                               *querymatchoutoptions,
@@ -207,7 +207,13 @@ static int gt_querymatch_display_flag_set(char *copyspace,
                                 "gfa2","alignment",
                                 "gfa2","custom",
                                 "gfa2","failed_seed",
-                                "gfa2","seed_in_algn"};
+                                "gfa2","seed_in_algn",
+                                "binary","alignment",
+                                "binary","blast",
+                                "binary","gfa2",
+                                "binary","custom",
+                                "binary","tabsep",
+                                "binary","failed_seed"};
   size_t ex_idx, numexcl = sizeof exclude_list/sizeof exclude_list[0];
   const GtSEdisplayStruct *dstruct;
   const char *ptr;
@@ -517,14 +523,15 @@ GtSeedExtendDisplayFlag *gt_querymatch_display_flag_new(
   return display_flag;
 }
 
-void gt_querymatch_Options_output(FILE *stream,int argc,const char **argv,
-                                  bool idhistout,GtUword minidentity,
-                                  GtUword historysize)
+size_t gt_querymatch_Options_output(FILE *stream,int argc,const char **argv,
+                                    bool idhistout,GtUword minidentity,
+                                    GtUword historysize)
 {
   int idx;
   bool minid_out = false, history_out = false;
+  size_t linelength = 0;
 
-  fprintf(stream,"# Options:");
+  linelength += (size_t) fprintf(stream,"# Options:");
   for (idx = 1; idx < argc; idx++) {
     if (strcmp(argv[idx],"-minidentity") == 0) {
       minid_out = true;
@@ -532,20 +539,23 @@ void gt_querymatch_Options_output(FILE *stream,int argc,const char **argv,
     if (strcmp(argv[idx],"-history") == 0) {
       history_out = true;
     }
-    fprintf(stream," %s", argv[idx]);
+    linelength += (size_t) fprintf(stream," %s", argv[idx]);
   }
   if (idhistout)
   {
     if (!minid_out)
     {
-      fprintf(stream," -minidentity " GT_WU,minidentity);
+      linelength += (size_t) fprintf(stream," -minidentity " GT_WU,
+                                     minidentity);
     }
     if (!history_out)
     {
-      fprintf(stream," -history " GT_WU,historysize);
+      linelength += (size_t) fprintf(stream," -history " GT_WU,
+                                     historysize);
     }
   }
   fputc('\n',stream);
+  return linelength + 1;
 }
 
 static void gt_querymatch_display_keyword_out(FILE *stream,const char *s)
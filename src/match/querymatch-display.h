@@ -40,9 +40,11 @@ void gt_querymatch_display_flag_delete(GtSeedExtendDisplayFlag *display_flag);
 void gt_querymatch_Fields_output(FILE *stream,
                                  const GtSeedExtendDisplayFlag *display_flag);
 
-void gt_querymatch_Options_output(FILE *stream,int argc,const char **argv,
-                                  bool idhistout,GtUword minidentity,
-                                  GtUword historysize);
+/* outputs the line with the options and returns its length, including the
+   final newline */
+size_t gt_querymatch_Options_output(FILE *stream,int argc,const char **argv,
+                                    bool idhistout,GtUword minidentity,
+                                    GtUword historysize);
 
 const unsigned int *gt_querymatch_display_order(GtUword *numcolumns,
                                                 const GtSeedExtendDisplayFlag
@@ -0,0 +1,242 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/thread_api.h"
+#include "core/xansi_api.h"
+#include "querymatch-writer.h"
+
+#define GT_QUERYMATCH_WRITER_BUFSIZE ((size_t) 1 << 20)
+
+typedef struct
+{
+  char *space;
+  size_t nextfree, allocated;
+} GtQuerymatchWriterBuffer;
+
+struct GtQuerymatchWriter
+{
+  FILE *fp;
+  GtQuerymatchWriterBuffer buffers[2],
+                           *current, /* the buffer to append to */
+                           *pending; /* the buffer written by <thread> */
+  bool background;
+#ifdef GT_THREADS_ENABLED
+  GtThread *thread;
+#endif
+};
+
+GtQuerymatchWriter *gt_querymatch_writer_new(FILE *fp)
+{
+  GtQuerymatchWriter *writer = gt_calloc((size_t) 1,sizeof *writer);
+
+  writer->fp = fp;
+  writer->current = writer->buffers;
+  writer->pending = writer->buffers + 1;
+  writer->background = false;
+#ifdef GT_THREADS_ENABLED
+  writer->thread = NULL;
+#endif
+  return writer;
+}
+
+static void gt_querymatch_writer_buffer_out(GtQuerymatchWriterBuffer *buffer,
+                                            FILE *fp)
+{
+  if (buffer->nextfree > 0)
+  {
+    gt_xfwrite(buffer->space,sizeof *buffer->space,buffer->nextfree,fp);
+    buffer->nextfree = 0;
+  }
+}
+
+#ifdef GT_THREADS_ENABLED
+static void *gt_querymatch_writer_thread(void *data)
+{
+  GtQuerymatchWriter *writer = (GtQuerymatchWriter *) data;
+
+  gt_querymatch_writer_buffer_out(writer->pending,writer->fp);
+  return NULL;
+}
+
+static void gt_querymatch_writer_wait(GtQuerymatchWriter *writer)
+{
+  if (writer->thread != NULL)
+  {
+    gt_thread_join(writer->thread);
+    gt_thread_delete(writer->thread);
+    writer->thread = NULL;
+  }
+}
+
+/* hands the current buffer over to a new writer thread, after the previous
+   one has finished, and continues with the other buffer. If the thread
+   cannot be started, the buffer is written directly. */
+static void gt_querymatch_writer_handover(GtQuerymatchWriter *writer)
+{
+  GtQuerymatchWriterBuffer *tmp;
+  GtError *err = gt_error_new();
+
+  gt_querymatch_writer_wait(writer);
+  tmp = writer->pending;
+  writer->pending = writer->current;
+  writer->current = tmp;
+  writer->thread = gt_thread_new(gt_querymatch_writer_thread,writer,err);
+  if (writer->thread == NULL)
+  {
+    gt_querymatch_writer_buffer_out(writer->pending,writer->fp);
+  }
+  gt_error_delete(err);
+}
+#endif
+
+void gt_querymatch_writer_sync(GtQuerymatchWriter *writer)
+{
+  gt_assert(writer != NULL);
+#ifdef GT_THREADS_ENABLED
+  gt_querymatch_writer_wait(writer);
+#endif
+  gt_querymatch_writer_buffer_out(writer->current,writer->fp);
+}
+
+void gt_querymatch_writer_delete(GtQuerymatchWriter *writer)
+{
+  if (writer != NULL)
+  {
+    gt_querymatch_writer_sync(writer);
+    gt_free(writer->buffers[0].space);
+    gt_free(writer->buffers[1].space);
+    gt_free(writer);
+  }
+}
+
+void gt_querymatch_writer_file_set(GtQuerymatchWriter *writer,FILE *fp)
+{
+  gt_querymatch_writer_sync(writer);
+  writer->fp = fp;
+}
+
+FILE *gt_querymatch_writer_file(const GtQuerymatchWriter *writer)
+{
+  gt_assert(writer != NULL);
+  return writer->fp;
+}
+
+void gt_querymatch_writer_background_set(GtQuerymatchWriter *writer)
+{
+  gt_assert(writer != NULL);
+#ifdef GT_THREADS_ENABLED
+  writer->background = true;
+#endif
+}
+
+static char *gt_querymatch_writer_reserve(GtQuerymatchWriter *writer,
+                                          size_t len)
+{
+  GtQuerymatchWriterBuffer *buffer = writer->current;
+
+  if (buffer->nextfree + len > buffer->allocated)
+  {
+    buffer->allocated = GT_MAX(GT_MAX(2 * buffer->allocated,
+                                      buffer->nextfree + len),(size_t) 256);
+    buffer->space = gt_realloc(buffer->space,
+                               sizeof *buffer->space * buffer->allocated);
+  }
+  return buffer->space + buffer->nextfree;
+}
+
+void gt_querymatch_writer_char(GtQuerymatchWriter *writer,char cc)
+{
+  *gt_querymatch_writer_reserve(writer,(size_t) 1) = cc;
+  writer->current->nextfree++;
+}
+
+void gt_querymatch_writer_string(GtQuerymatchWriter *writer,
+                                 const char *string,GtUword len)
+{
+  memcpy(gt_querymatch_writer_reserve(writer,(size_t) len),string,
+         (size_t) len);
+  writer->current->nextfree += (size_t) len;
+}
+
+void gt_querymatch_writer_uword(GtQuerymatchWriter *writer,GtUword value)
+{
+  char digits[3 * sizeof value];
+  size_t idx = sizeof digits;
+
+  do
+  {
+    digits[--idx] = (char) ('0' + value % 10);
+    value /= 10;
+  } while (value > 0);
+  gt_querymatch_writer_string(writer,digits + idx,
+                              (GtUword) (sizeof digits - idx));
+}
+
+void gt_querymatch_writer_word(GtQuerymatchWriter *writer,GtWord value)
+{
+  if (value < 0)
+  {
+    gt_querymatch_writer_char(writer,'-');
+    /* avoid the overflow of -value for the smallest value */
+    gt_querymatch_writer_uword(writer,(GtUword) -(value + 1) + 1);
+  } else
+  {
+    gt_querymatch_writer_uword(writer,(GtUword) value);
+  }
+}
+
+void gt_querymatch_writer_double(GtQuerymatchWriter *writer,
+                                 const char *format,double value)
+{
+  size_t maxlen = 32;
+
+  while (true)
+  {
+    const int len = snprintf(gt_querymatch_writer_reserve(writer,maxlen),
+                             maxlen,format,value);
+
+    gt_assert(len >= 0);
+    if ((size_t) len < maxlen)
+    {
+      writer->current->nextfree += (size_t) len;
+      break;
+    }
+    maxlen = (size_t) len + 1;
+  }
+}
+
+void gt_querymatch_writer_record_end(GtQuerymatchWriter *writer)
+{
+  gt_assert(writer != NULL);
+  if (!writer->background)
+  {
+    gt_querymatch_writer_buffer_out(writer->current,writer->fp);
+  }
+#ifdef GT_THREADS_ENABLED
+  else
+  {
+    if (writer->current->nextfree >= GT_QUERYMATCH_WRITER_BUFSIZE)
+    {
+      gt_querymatch_writer_handover(writer);
+    }
+  }
+#endif
+}
@@ -0,0 +1,69 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef QUERYMATCH_WRITER_H
+#define QUERYMATCH_WRITER_H
+#include <stdbool.h>
+#include <stdio.h>
+#include "core/types_api.h"
+
+/* A <GtQuerymatchWriter> collects the formatted match output in a buffer.
+   Integers are converted without <printf>. In synchronous mode each record
+   is written to the output file as soon as it is complete, so that the
+   output can be mixed with other output to the same file. In background
+   mode, the records are collected in a buffer of about one megabyte which
+   is written by a separate thread while the next buffer is filled. In this
+   mode nothing else must be written to the output file, unless
+   <gt_querymatch_writer_sync> was called before. */
+typedef struct GtQuerymatchWriter GtQuerymatchWriter;
+
+GtQuerymatchWriter *gt_querymatch_writer_new(FILE *fp);
+
+void gt_querymatch_writer_delete(GtQuerymatchWriter *writer);
+
+/* writes all buffered output, waits for the writer thread and then
+   directs all following output to <fp>. */
+void gt_querymatch_writer_file_set(GtQuerymatchWriter *writer,FILE *fp);
+
+FILE *gt_querymatch_writer_file(const GtQuerymatchWriter *writer);
+
+/* switches to background mode, if threads are enabled. */
+void gt_querymatch_writer_background_set(GtQuerymatchWriter *writer);
+
+void gt_querymatch_writer_char(GtQuerymatchWriter *writer,char cc);
+
+void gt_querymatch_writer_string(GtQuerymatchWriter *writer,
+                                 const char *string,GtUword len);
+
+void gt_querymatch_writer_uword(GtQuerymatchWriter *writer,GtUword value);
+
+void gt_querymatch_writer_word(GtQuerymatchWriter *writer,GtWord value);
+
+/* appends <value> formatted according to <format>, which must be a
+   <printf> format for a single double value, e.g. "%.2f". */
+void gt_querymatch_writer_double(GtQuerymatchWriter *writer,
+                                 const char *format,double value);
+
+/* marks the end of a record, i.e. a line or a group of lines belonging
+   to one match, which are never separated by output from other sources. */
+void gt_querymatch_writer_record_end(GtQuerymatchWriter *writer);
+
+/* writes all buffered output to the output file and waits until the
+   writer thread has finished. */
+void gt_querymatch_writer_sync(GtQuerymatchWriter *writer);
+
+#endif
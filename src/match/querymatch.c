@@ -16,6 +16,7 @@
 */
 
 #include <ctype.h>
+#include <string.h>
 #include <float.h>
 #include "core/ma_api.h"
 #include "core/types_api.h"
@@ -23,6 +24,7 @@
 #include "core/format64.h"
 #include "querymatch.h"
 #include "querymatch-align.h"
+#include "querymatch-writer.h"
 #include "karlin_altschul_stat.h"
 #include "ft-eoplist.h"
 #include "revcompl.h"
@@ -53,7 +55,7 @@ struct GtQuerymatch
   bool selfmatch, verify_alignment;
   GtQuerymatchoutoptions *ref_querymatchoutoptions; /* reference to
       resources needed for alignment output */
-  FILE *fp;
+  GtQuerymatchWriter *writer;
   const char *db_desc, *query_desc;
   GtEoplist *ref_eoplist;
 };
@@ -64,9 +66,10 @@ GtQuerymatch *gt_querymatch_new(void)
 
   gt_assert(querymatch != NULL);
   querymatch->ref_querymatchoutoptions = NULL;
+  querymatch->ref_eoplist = NULL;
   querymatch->verify_alignment = false;
   querymatch->query_readmode = GT_READMODE_FORWARD;
-  querymatch->fp = stdout;
+  querymatch->writer = gt_querymatch_writer_new(stdout);
   querymatch->queryseqnum = GT_UWORD_MAX;
   querymatch->db_desc = NULL;
   querymatch->query_desc = NULL;
@@ -94,7 +97,19 @@ void gt_querymatch_outoptions_set(GtQuerymatch *querymatch,
 void gt_querymatch_file_set(GtQuerymatch *querymatch, FILE *fp)
 {
   gt_assert(querymatch != NULL);
-  querymatch->fp = fp;
+  gt_querymatch_writer_file_set(querymatch->writer,fp);
+}
+
+void gt_querymatch_background_output_set(GtQuerymatch *querymatch)
+{
+  gt_assert(querymatch != NULL);
+  gt_querymatch_writer_background_set(querymatch->writer);
+}
+
+void gt_querymatch_output_flush(GtQuerymatch *querymatch)
+{
+  gt_assert(querymatch != NULL);
+  gt_querymatch_writer_sync(querymatch->writer);
 }
 
 GtUword gt_querymatch_querylen(const GtQuerymatch *querymatch)
@@ -127,6 +142,11 @@ GtUword gt_querymatch_querystart(const GtQuerymatch *querymatch)
   return querymatch->querystart;
 }
 
+GtUword gt_querymatch_querystart_fwdstrand(const GtQuerymatch *querymatch)
+{
+  return querymatch->querystart_fwdstrand;
+}
+
 static GtUword gt_querymatch_queryend_relative(const GtQuerymatch *querymatch)
 {
   return querymatch->querystart + querymatch->querylen - 1;
@@ -177,6 +197,11 @@ GtUword gt_querymatch_distance(const GtQuerymatch *querymatch)
   return querymatch->distance;
 }
 
+GtWord gt_querymatch_score(const GtQuerymatch *querymatch)
+{
+  return querymatch->score;
+}
+
 GtWord gt_querymatch_distance2score(GtUword distance,GtUword alignedlen)
 {
   return ((GtWord) alignedlen) - (GtWord) (3 * distance);
@@ -242,7 +267,7 @@ static GtUword gt_querymatch_indels(const GtQuerymatch *querymatch)
                   = (aligned_len - indels)/2
 */
 
-static GtUword gt_querymatch_alignment_length(const GtQuerymatch *querymatch)
+GtUword gt_querymatch_alignment_length(const GtQuerymatch *querymatch)
 {
   return (gt_querymatch_aligned_len(querymatch) -
           gt_querymatch_indels(querymatch))/2;
@@ -338,6 +363,7 @@ void gt_querymatch_delete(GtQuerymatch *querymatch)
 {
   if (querymatch != NULL)
   {
+    gt_querymatch_writer_delete(querymatch->writer);
     gt_free(querymatch);
   }
 }
@@ -372,14 +398,15 @@ static int gt_non_white_space_prefix_length(const char *s)
 
 static const char *gt_seed_extend_outflag = "FRCP";
 
-static void gt_querymatch_description_out(FILE *fp,const char *description)
+static void gt_querymatch_description_out(GtQuerymatchWriter *writer,
+                                          const char *description)
 {
   const int nwspl = gt_non_white_space_prefix_length(description);
 
-  fwrite(description,sizeof *description,nwspl,fp);
+  gt_querymatch_writer_string(writer,description,(GtUword) nwspl);
 }
 
-static void gt_querymatch_exact_match_trace_show(FILE *fp,
+static void gt_querymatch_exact_match_trace_show(GtQuerymatchWriter *writer,
                                                  bool dtrace,
                                                  GtUword remaining,
                                                  GtUword trace_delta)
@@ -390,19 +417,21 @@ static void gt_querymatch_exact_match_trace_show(FILE *fp,
   {
     if (!first)
     {
-      fputc(',',fp);
+      gt_querymatch_writer_char(writer,',');
     } else
     {
       first = false;
     }
     if (remaining > trace_delta)
     {
-      fprintf(fp,GT_WU,dtrace ? 0 : trace_delta);
+      gt_querymatch_writer_uword(writer,dtrace ? 0 : trace_delta);
       remaining -= trace_delta;
     } else
     {
-      fprintf(fp,"%d",dtrace ? ((int) trace_delta - (int) remaining)
-                             : (int) remaining);
+      gt_querymatch_writer_word(writer,
+                                dtrace ? ((GtWord) trace_delta -
+                                          (GtWord) remaining)
+                                       : (GtWord) remaining);
       break;
     }
   }
@@ -410,7 +439,68 @@ static void gt_querymatch_exact_match_trace_show(FILE *fp,
 
 void gt_querymatch_gfa2_edge(const GtQuerymatch *querymatch,GtUword edgenum)
 {
-  fprintf(querymatch->fp,"E\t" GT_WU "\t",edgenum);
+  gt_querymatch_writer_string(querymatch->writer,"E\t",(GtUword) 2);
+  gt_querymatch_writer_uword(querymatch->writer,edgenum);
+  gt_querymatch_writer_char(querymatch->writer,'\t');
+}
+
+bool gt_querymatch_binary_eops(const GtSeedExtendDisplayFlag *display_flag)
+{
+  return gt_querymatch_cigar_display(display_flag) ||
+         gt_querymatch_cigarX_display(display_flag) ||
+         gt_querymatch_trace_display(display_flag) ||
+         gt_querymatch_dtrace_display(display_flag);
+}
+
+static void gt_querymatch_binary_out(double evalue,double bit_score,
+                                     const GtSeedExtendDisplayFlag
+                                       *out_display_flag,
+                                     const GtQuerymatch *querymatch)
+{
+  static const char zeros[8] = {0};
+  GtQuerymatchBinaryRecord record;
+  GtUword eopbytes = 0;
+
+  if (querymatch->distance > 0 && gt_querymatch_binary_eops(out_display_flag))
+  {
+    gt_assert(querymatch->ref_eoplist != NULL);
+    eopbytes = gt_eoplist_length(querymatch->ref_eoplist);
+    gt_assert(eopbytes <= (GtUword) UINT32_MAX);
+  }
+  /* clear padding bytes, so that equal matches give equal records */
+  memset(&record,0,sizeof record);
+  record.dbseqnum = (uint64_t) querymatch->dbseqnum;
+  record.dbstart_relative = (uint64_t) querymatch->dbstart_relative;
+  record.dblen = (uint64_t) querymatch->dblen;
+  record.queryseqnum = (uint64_t) querymatch->queryseqnum;
+  record.querystart_fwdstrand = (uint64_t) querymatch->querystart_fwdstrand;
+  record.querylen = (uint64_t) querymatch->querylen;
+  record.distance = (uint64_t) querymatch->distance;
+  record.mismatches = (uint64_t) querymatch->mismatches;
+  record.db_seedpos_rel = (uint64_t) querymatch->db_seedpos_rel;
+  record.query_seedpos_rel = (uint64_t) querymatch->query_seedpos_rel;
+  record.seedlen = (uint64_t) querymatch->seedlen;
+  record.score = (int64_t) querymatch->score;
+  /* evalue and bit score are only computed if they are displayed */
+  record.evalue = gt_querymatch_evalue_display(out_display_flag) ? evalue
+                                                                 : DBL_MAX;
+  record.bit_score = gt_querymatch_bitscore_display(out_display_flag)
+                       ? bit_score : DBL_MAX;
+  record.query_readmode = (uint32_t) querymatch->query_readmode;
+  record.eopbytes = (uint32_t) eopbytes;
+  gt_querymatch_writer_string(querymatch->writer,(const char *) &record,
+                              (GtUword) sizeof record);
+  if (eopbytes > 0)
+  {
+    gt_querymatch_writer_string(querymatch->writer,
+                                (const char *)
+                                gt_eoplist_packed(querymatch->ref_eoplist),
+                                eopbytes);
+    gt_querymatch_writer_string(querymatch->writer,zeros,
+                                GT_QUERYMATCH_BINARY_PADDED(eopbytes) -
+                                eopbytes);
+  }
+  gt_querymatch_writer_record_end(querymatch->writer);
 }
 
 void gt_querymatch_prettyprint(double evalue,double bit_score,
@@ -418,12 +508,19 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
                                const GtQuerymatch *querymatch)
 {
   const unsigned int *column_order;
+  GtQuerymatchWriter *writer;
   GtUword numcolumns, idx, one_off;
   char separator;
   bool gfa2_display;
 
-  gt_assert(querymatch != NULL && querymatch->fp != NULL &&
+  gt_assert(querymatch != NULL && querymatch->writer != NULL &&
             out_display_flag != NULL);
+  if (gt_querymatch_binary_display(out_display_flag))
+  {
+    gt_querymatch_binary_out(evalue,bit_score,out_display_flag,querymatch);
+    return;
+  }
+  writer = querymatch->writer;
   gfa2_display = gt_querymatch_gfa2_display(out_display_flag);
   column_order = gt_querymatch_display_order(&numcolumns,out_display_flag);
   gt_assert(numcolumns > 0);
@@ -441,7 +538,7 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
                     co != Gt_Editdist_display &&
                     co != Gt_Identity_display)))
     {
-      fputc(separator,querymatch->fp);
+      gt_querymatch_writer_char(writer,separator);
     }
     switch (co)
     {
@@ -452,11 +549,11 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
           gt_querymatchoutoptions_cigar_show(
                                      querymatch->ref_querymatchoutoptions,
                                      co == Gt_Cigar_display ? false : true,
-                                     querymatch->fp);
+                                     writer);
         } else
         {
-          fprintf(querymatch->fp,GT_WU "%c",gt_querymatch_dblen(querymatch),
-                                            co == Gt_Cigar_display ? 'M' : '=');
+          gt_querymatch_writer_uword(writer,gt_querymatch_dblen(querymatch));
+          gt_querymatch_writer_char(writer,co == Gt_Cigar_display ? 'M' : '=');
         }
         break;
       case Gt_Trace_display:
@@ -467,10 +564,10 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
           gt_querymatchoutoptions_trace_show(
                                 querymatch->ref_querymatchoutoptions,
                                 dtrace,
-                                querymatch->fp);
+                                writer);
         } else
         {
-          gt_querymatch_exact_match_trace_show(querymatch->fp,
+          gt_querymatch_exact_match_trace_show(writer,
                                                dtrace,
                                                gt_querymatch_dblen(querymatch),
                                                gt_querymatch_trace_delta_display
@@ -478,30 +575,31 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
         }
         break;
       case Gt_S_len_display:
-        fprintf(querymatch->fp,GT_WU,gt_querymatch_dblen(querymatch));
+        gt_querymatch_writer_uword(writer,gt_querymatch_dblen(querymatch));
         break;
       case Gt_S_seqnum_display:
         if (gfa2_display)
         {
-          fputc('S',querymatch->fp);
+          gt_querymatch_writer_char(writer,'S');
         }
-        fprintf(querymatch->fp,GT_WU,querymatch->dbseqnum);
+        gt_querymatch_writer_uword(writer,querymatch->dbseqnum);
         if (gfa2_display)
         {
-          fputc('+',querymatch->fp);
+          gt_querymatch_writer_char(writer,'+');
         }
         break;
       case Gt_Subjectid_display:
-        gt_querymatch_description_out(querymatch->fp,querymatch->db_desc);
+        gt_querymatch_description_out(writer,querymatch->db_desc);
         break;
       case Gt_S_start_display:
         if (!GT_ISDIRREVERSE(querymatch->query_readmode) ||
             !gt_querymatch_blast_display(out_display_flag))
         {
-          fprintf(querymatch->fp,GT_WU,querymatch->dbstart_relative + one_off);
+          gt_querymatch_writer_uword(writer,querymatch->dbstart_relative +
+                                            one_off);
         } else
         {
-          fprintf(querymatch->fp,GT_WU,querymatch->db_seqlen - 1 -
+          gt_querymatch_writer_uword(writer,querymatch->db_seqlen - 1 -
                                        querymatch->dbstart_relative + one_off);
         }
         break;
@@ -509,41 +607,42 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
         if (!GT_ISDIRREVERSE(querymatch->query_readmode) ||
             !gt_querymatch_blast_display(out_display_flag))
         {
-          fprintf(querymatch->fp,GT_WU,
+          gt_querymatch_writer_uword(writer,
                   gt_querymatch_dbend_relative(querymatch) + one_off);
         } else
         {
           gt_assert(querymatch->db_seqlen >= querymatch->dbstart_relative +
                                              querymatch->dblen);
-          fprintf(querymatch->fp,GT_WU,querymatch->db_seqlen -
+          gt_querymatch_writer_uword(writer,querymatch->db_seqlen -
                                        querymatch->dbstart_relative -
                                        querymatch->dblen + one_off);
         }
         break;
       case Gt_Strand_display:
-        fprintf(querymatch->fp,"%c",
-                gt_seed_extend_outflag[querymatch->query_readmode]);
+        gt_querymatch_writer_char(writer,
+                        gt_seed_extend_outflag[querymatch->query_readmode]);
         break;
       case Gt_Q_len_display:
-        fprintf(querymatch->fp,GT_WU,gt_querymatch_querylen(querymatch));
+        gt_querymatch_writer_uword(writer,gt_querymatch_querylen(querymatch));
         break;
       case Gt_Q_seqnum_display:
         if (gfa2_display)
         {
-          fputc(querymatch->selfmatch ? 'S' : 'Q',querymatch->fp);
+          gt_querymatch_writer_char(writer,querymatch->selfmatch ? 'S' : 'Q');
         }
-        fprintf(querymatch->fp,GT_WU,querymatch->queryseqnum);
+        gt_querymatch_writer_uword(writer,querymatch->queryseqnum);
         if (gfa2_display)
         {
-          fputc(GT_ISDIRREVERSE(querymatch->query_readmode) ? '-' : '+',
-                querymatch->fp);
+          gt_querymatch_writer_char(writer,
+                          GT_ISDIRREVERSE(querymatch->query_readmode) ? '-'
+                                                                      : '+');
         }
         break;
       case Gt_Queryid_display:
-        gt_querymatch_description_out(querymatch->fp,querymatch->query_desc);
+        gt_querymatch_description_out(writer,querymatch->query_desc);
         break;
       case Gt_Q_start_display:
-        fprintf(querymatch->fp,GT_WU,querymatch->querystart_fwdstrand
+        gt_querymatch_writer_uword(writer,querymatch->querystart_fwdstrand
                                      + one_off);
         break;
       case Gt_Q_end_display:
@@ -551,48 +650,48 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
             (!GT_ISDIRREVERSE(querymatch->query_readmode) ||
              !gt_querymatch_blast_display(out_display_flag)))
         {
-          fprintf(querymatch->fp,GT_WU,
+          gt_querymatch_writer_uword(writer,
                   gt_querymatch_queryend_relative(querymatch) + one_off);
         } else
         {
-          fprintf(querymatch->fp,GT_WU,
+          gt_querymatch_writer_uword(writer,
                   querymatch->querystart_fwdstrand + querymatch->querylen - 1
                                                    + one_off);
         }
         break;
       case Gt_Alignmentlength_display:
-        fprintf(querymatch->fp,GT_WU,
+        gt_querymatch_writer_uword(writer,
                 gt_querymatch_alignment_length(querymatch));
         break;
       case Gt_Mismatches_display:
         if (gfa2_display)
         {
-          fprintf(querymatch->fp,"MM:i:");
+          gt_querymatch_writer_string(writer,"MM:i:",(GtUword) 5);
         }
-        fprintf(querymatch->fp,GT_WU,querymatch->mismatches);
+        gt_querymatch_writer_uword(writer,querymatch->mismatches);
         break;
       case Gt_Indels_display:
       case Gt_Gapopens_display:
         if (gfa2_display)
         {
-          fprintf(querymatch->fp,"IN:i:");
+          gt_querymatch_writer_string(writer,"IN:i:",(GtUword) 5);
         }
-        fprintf(querymatch->fp,GT_WU,gt_querymatch_indels(querymatch));
+        gt_querymatch_writer_uword(writer,gt_querymatch_indels(querymatch));
         break;
       case Gt_Score_display:
         if (querymatch->score > 0)
         {
-          fprintf(querymatch->fp,GT_WD,querymatch->score);
+          gt_querymatch_writer_word(writer,querymatch->score);
         }
         break;
       case Gt_Editdist_display:
         if (gfa2_display)
         {
-          fprintf(querymatch->fp,"ED:i:");
+          gt_querymatch_writer_string(writer,"ED:i:",(GtUword) 5);
         }
         if (querymatch->score > 0)
         {
-          fprintf(querymatch->fp,GT_WU,querymatch->distance);
+          gt_querymatch_writer_uword(writer,querymatch->distance);
         }
         break;
       case Gt_Identity_display:
@@ -600,36 +699,37 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
         {
           if (gfa2_display)
           {
-            fprintf(querymatch->fp,"ID:f:");
+            gt_querymatch_writer_string(writer,"ID:f:",(GtUword) 5);
           }
-          fprintf(querymatch->fp,"%.2f",
+          gt_querymatch_writer_double(writer,"%.2f",
                   gt_querymatch_similarity(
                        querymatch->distance,
                        gt_querymatch_aligned_len(querymatch)));
         }
         break;
       case Gt_Seed_len_display:
-        fprintf(querymatch->fp,GT_WU,querymatch->seedlen);
+        gt_querymatch_writer_uword(writer,querymatch->seedlen);
         break;
       case Gt_Seed_s_display:
-        fprintf(querymatch->fp,GT_WU,querymatch->db_seedpos_rel + one_off);
+        gt_querymatch_writer_uword(writer,querymatch->db_seedpos_rel + one_off);
         break;
       case Gt_Seed_q_display:
-        fprintf(querymatch->fp,GT_WU,querymatch->query_seedpos_rel + one_off);
+        gt_querymatch_writer_uword(writer,querymatch->query_seedpos_rel +
+                                          one_off);
         break;
       case Gt_S_seqlen_display:
-        fprintf(querymatch->fp,GT_WU,querymatch->db_seqlen);
+        gt_querymatch_writer_uword(writer,querymatch->db_seqlen);
         break;
       case Gt_Q_seqlen_display:
-        fprintf(querymatch->fp,GT_WU,querymatch->query_seqlen);
+        gt_querymatch_writer_uword(writer,querymatch->query_seqlen);
         break;
       case Gt_Evalue_display:
         gt_assert(evalue != DBL_MAX);
-        fprintf(querymatch->fp,"%1.0e",evalue);
+        gt_querymatch_writer_double(writer,"%1.0e",evalue);
         break;
       case Gt_Bitscore_display:
         gt_assert(bit_score != DBL_MAX);
-        fprintf(querymatch->fp,"%.1f",bit_score);
+        gt_querymatch_writer_double(writer,"%.1f",bit_score);
         break;
       default: fprintf(stderr,"function %s, file %s, line %d: "
                                "illegal column %u\n",__func__,__FILE__,
@@ -637,7 +737,7 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
                exit(GT_EXIT_PROGRAMMING_ERROR);
     }
   }
-  fputc('\n',querymatch->fp);
+  gt_querymatch_writer_char(writer,'\n');
   if (gt_querymatch_alignment_display(out_display_flag))
   {
     bool subject_first = true,
@@ -646,6 +746,8 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
          distinguish_mismatch_match = true;
     GtUword subject_seqlength = 0, query_reference = 0;
 
+    /* the alignment is written directly to the output file */
+    gt_querymatch_writer_sync(writer);
     if (gt_querymatch_blast_display(out_display_flag))
     {
       subject_first = false;
@@ -674,8 +776,9 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
                                            subject_first,
                                            alignment_show_forward,
                                            show_complement_characters,
-                                           querymatch->fp);
+                                           gt_querymatch_writer_file(writer));
   }
+  gt_querymatch_writer_record_end(writer);
 }
 
 void gt_querymatch_show_failed_seed(const GtSeedExtendDisplayFlag
@@ -687,20 +790,24 @@ void gt_querymatch_show_failed_seed(const GtSeedExtendDisplayFlag
     const char separator
       = (gt_querymatch_blast_display(out_display_flag) ||
          gt_querymatch_tabsep_display(out_display_flag)) ? '\t' : ' ';
-    fprintf(querymatch->fp, "# failed_seed:%c" GT_WU "%c" GT_WU "%c"  GT_WU
-                                   "%c%c%c" GT_WU "%c" GT_WU "\n",
-            separator,
-            querymatch->seedlen,
-            separator,
-            querymatch->dbseqnum,
-            separator,
-            querymatch->db_seedpos_rel,
-            separator,
-            gt_seed_extend_outflag[querymatch->query_readmode],
-            separator,
-            querymatch->queryseqnum,
-            separator,
-            querymatch->query_seedpos_rel);
+    GtQuerymatchWriter *writer = querymatch->writer;
+
+    gt_querymatch_writer_string(writer,"# failed_seed:",(GtUword) 14);
+    gt_querymatch_writer_char(writer,separator);
+    gt_querymatch_writer_uword(writer,querymatch->seedlen);
+    gt_querymatch_writer_char(writer,separator);
+    gt_querymatch_writer_uword(writer,querymatch->dbseqnum);
+    gt_querymatch_writer_char(writer,separator);
+    gt_querymatch_writer_uword(writer,querymatch->db_seedpos_rel);
+    gt_querymatch_writer_char(writer,separator);
+    gt_querymatch_writer_char(writer,
+                      gt_seed_extend_outflag[querymatch->query_readmode]);
+    gt_querymatch_writer_char(writer,separator);
+    gt_querymatch_writer_uword(writer,querymatch->queryseqnum);
+    gt_querymatch_writer_char(writer,separator);
+    gt_querymatch_writer_uword(writer,querymatch->query_seedpos_rel);
+    gt_querymatch_writer_char(writer,'\n');
+    gt_querymatch_writer_record_end(writer);
   }
 }
 
@@ -763,7 +870,7 @@ bool gt_querymatch_check_final_generic(
                                            mismatches,
                                            indels);
 #ifdef SKDEBUG
-    fprintf(querymatch->fp, "# evalue_ptr = %.2e <=? %.2e = evalue_threshold ",
+    fprintf(fp, "# evalue_ptr = %.2e <=? %.2e = evalue_threshold ",
                              *evalue_ptr,evalue_threshold);
 #endif
     if (*evalue_ptr > evalue_threshold)
@@ -796,7 +903,8 @@ bool gt_querymatch_check_final(double *evalue_ptr,
   if (!gt_querymatch_ordered(querymatch))
   {
 #ifdef SKDEBUG
-    fprintf(querymatch->fp, "# !gt_querymatch_ordered => reject\n");
+    fprintf(gt_querymatch_writer_file(querymatch->writer),
+            "# !gt_querymatch_ordered => reject\n");
 #endif
     return false;
   }
@@ -812,7 +920,7 @@ bool gt_querymatch_check_final(double *evalue_ptr,
                                userdefinedleastlength,
                                errorpercentage,
                                evalue_threshold,
-                               querymatch->fp);
+                               gt_querymatch_writer_file(querymatch->writer));
 }
 
 static void gt_querymatch_applycorrection(GtQuerymatch *querymatch)
@@ -1097,6 +1205,112 @@ void gt_querymatch_read_line(GtQuerymatch *querymatch,
   }
 }
 
+void gt_querymatch_Binary_output(FILE *stream,size_t options_line_length,
+                                 const GtSeedExtendDisplayFlag *display_flag)
+{
+  char line[80];
+  int len;
+  size_t headerlen;
+
+  len = snprintf(line,sizeof line,"# Binary: version %d recordsize " GT_WU
+                 " eops %d",GT_QUERYMATCH_BINARY_VERSION,
+                 (GtUword) sizeof (GtQuerymatchBinaryRecord),
+                 gt_querymatch_binary_eops(display_flag) ? 1 : 0);
+  gt_assert(len > 0 && (size_t) len < sizeof line);
+  headerlen = options_line_length + (size_t) len + 1;
+  fprintf(stream,"%s%*s\n",line,
+          (int) (GT_QUERYMATCH_BINARY_PADDED(headerlen) - headerlen),"");
+}
+
+int gt_querymatch_read_Binary_line(bool *with_eops,const char *line_ptr,
+                                   GtError *err)
+{
+  const char *header = "# Binary:";
+  int version, eops;
+  GtUword recordsize;
+
+  if (strncmp(line_ptr,header,strlen(header)) != 0)
+  {
+    return 0;
+  }
+  if (sscanf(line_ptr,"# Binary: version %d recordsize " GT_WU " eops %d",
+             &version,&recordsize,&eops) != 3 ||
+      version != GT_QUERYMATCH_BINARY_VERSION ||
+      recordsize != (GtUword) sizeof (GtQuerymatchBinaryRecord))
+  {
+    gt_error_set(err,"incompatible binary match format: \"%s\", expected "
+                     "version %d with records of size " GT_WU,
+                     line_ptr,GT_QUERYMATCH_BINARY_VERSION,
+                     (GtUword) sizeof (GtQuerymatchBinaryRecord));
+    return -1;
+  }
+  *with_eops = eops == 1 ? true : false;
+  return 1;
+}
+
+void gt_querymatch_read_binary(GtQuerymatch *querymatch,
+                               double *evalue_ptr,
+                               double *bit_score_ptr,
+                               const GtQuerymatchBinaryRecord *record,
+                               const uint8_t *eops,
+                               bool selfmatch,
+                               const GtEncseq *dbencseq,
+                               const GtEncseq *queryencseq)
+{
+  GtUword desclen;
+
+  gt_assert(querymatch != NULL && record != NULL &&
+            record->query_readmode < 4U);
+  querymatch->dbseqnum = (GtUword) record->dbseqnum;
+  querymatch->dbstart_relative = (GtUword) record->dbstart_relative;
+  querymatch->dblen = (GtUword) record->dblen;
+  querymatch->queryseqnum = (GtUword) record->queryseqnum;
+  querymatch->querystart_fwdstrand = (GtUword) record->querystart_fwdstrand;
+  querymatch->querylen = (GtUword) record->querylen;
+  querymatch->distance = (GtUword) record->distance;
+  querymatch->mismatches = (GtUword) record->mismatches;
+  querymatch->db_seedpos_rel = (GtUword) record->db_seedpos_rel;
+  querymatch->query_seedpos_rel = (GtUword) record->query_seedpos_rel;
+  querymatch->seedlen = (GtUword) record->seedlen;
+  querymatch->score = (GtWord) record->score;
+  querymatch->query_readmode = (GtReadmode) record->query_readmode;
+  *evalue_ptr = record->evalue;
+  *bit_score_ptr = record->bit_score;
+  querymatch->selfmatch = selfmatch;
+  querymatch->db_seqlen = gt_encseq_seqlength(dbencseq,querymatch->dbseqnum);
+  querymatch->db_seqstart = gt_encseq_seqstartpos(dbencseq,
+                                                  querymatch->dbseqnum);
+  querymatch->query_seqlen = gt_encseq_seqlength(queryencseq,
+                                                 querymatch->queryseqnum);
+  querymatch->query_seqstart = gt_encseq_seqstartpos(queryencseq,
+                                                     querymatch->queryseqnum);
+  querymatch->querystart
+    = gt_querymatch_position_convert(querymatch->query_readmode,
+                                     querymatch->querylen,
+                                     querymatch->query_seqlen,
+                                     querymatch->querystart_fwdstrand);
+  querymatch->db_desc
+    = gt_encseq_has_description_support(dbencseq)
+        ? gt_encseq_description(dbencseq,&desclen,querymatch->dbseqnum)
+        : NULL;
+  querymatch->query_desc
+    = gt_encseq_has_description_support(queryencseq)
+        ? gt_encseq_description(queryencseq,&desclen,querymatch->queryseqnum)
+        : NULL;
+  if (eops != NULL && querymatch->ref_eoplist != NULL)
+  {
+    gt_eoplist_reset(querymatch->ref_eoplist);
+    if (record->eopbytes > 0)
+    {
+      gt_eoplist_packed_add(querymatch->ref_eoplist,eops,
+                            (GtUword) record->eopbytes);
+    } else
+    {
+      gt_eoplist_match_add(querymatch->ref_eoplist,querymatch->dblen);
+    }
+  }
+}
+
 bool gt_querymatch_complete(GtQuerymatch *querymatch,
                             const GtSeedExtendDisplayFlag *out_display_flag,
                             GtUword dblen,
@@ -35,6 +35,15 @@ GtQuerymatch *gt_querymatch_new(void);
 
 void gt_querymatch_file_set(GtQuerymatch *querymatch, FILE *fp);
 
+/* The matches are formatted into a buffer which is written by a separate
+   thread while the next matches are computed. Nothing else must be written
+   to the output file of <querymatch>, unless <gt_querymatch_output_flush>
+   was called before. */
+void gt_querymatch_background_output_set(GtQuerymatch *querymatch);
+
+/* writes all output of <querymatch> buffered so far. */
+void gt_querymatch_output_flush(GtQuerymatch *querymatch);
+
 void gt_querymatch_db_keyvalues_set(GtQuerymatch *querymatch,
                                     GtUword db_totallength,
                                     GtUword db_numofsequences);
@@ -66,6 +75,67 @@ void gt_querymatch_read_line(GtQuerymatch *querymatch,
                              const GtEncseq *dbencseq,
                              const GtEncseq *queryencseq);
 
+/* In the binary output format (argument binary of option -outfmt) the
+   line with the options is followed by a line beginning with "# Binary:",
+   which is padded with blanks such that the length of both lines is a
+   multiple of 8. Then follows one record of the following type for each
+   match, in the byte order of the machine which has written the file.
+   Each record is followed by <eopbytes> edit operations in the packed form
+   delivered by <gt_eoplist_packed>, padded with 0-bytes to a multiple
+   of 8. So, if the edit operations are included, the records are of
+   different size. To access them randomly in the mapped file, an index of
+   the record offsets is written by gt dev show_seedext -index, see
+   seed-extend-iter.h. */
+
+#define GT_QUERYMATCH_BINARY_VERSION 1
+#define GT_QUERYMATCH_BINARY_PADDED(LEN) (((LEN) + 7) & ~((GtUword) 7))
+
+typedef struct
+{
+  uint64_t dbseqnum,
+           dbstart_relative,
+           dblen,
+           queryseqnum,
+           querystart_fwdstrand,
+           querylen,
+           distance,
+           mismatches,
+           db_seedpos_rel,
+           query_seedpos_rel,
+           seedlen;
+  int64_t score;
+  double evalue, bit_score; /* DBL_MAX if not computed */
+  uint32_t query_readmode,
+           eopbytes;
+} GtQuerymatchBinaryRecord;
+
+/* returns true iff binary records written according to <display_flag>
+   include the edit operations. */
+bool gt_querymatch_binary_eops(const GtSeedExtendDisplayFlag *display_flag);
+
+/* outputs the line beginning with "# Binary:". <options_line_length> is the
+   number of characters of the line with the options, which precedes it. */
+void gt_querymatch_Binary_output(FILE *stream,size_t options_line_length,
+                                 const GtSeedExtendDisplayFlag *display_flag);
+
+/* returns 1 and sets <with_eops> if <line_ptr> is a line beginning with
+   "# Binary:", which is compatible with the current format. Returns 0 for
+   any other line and -1 if the binary format is incompatible. */
+int gt_querymatch_read_Binary_line(bool *with_eops,const char *line_ptr,
+                                   GtError *err);
+
+/* initializes <querymatch> from <record>. If the records of the file include
+   the edit operations, <eops> refers to the <record->eopbytes> edit
+   operations following <record>, otherwise it is <NULL>. */
+void gt_querymatch_read_binary(GtQuerymatch *querymatch,
+                               double *evalue_ptr,
+                               double *bit_score_ptr,
+                               const GtQuerymatchBinaryRecord *record,
+                               const uint8_t *eops,
+                               bool selfmatch,
+                               const GtEncseq *dbencseq,
+                               const GtEncseq *queryencseq);
+
 void gt_querymatch_delete(GtQuerymatch *querymatch);
 
 bool gt_querymatch_complete(GtQuerymatch *querymatch,
@@ -104,6 +174,10 @@ GtUword gt_querymatch_dbstart_relative(const GtQuerymatch *querymatch);
 
 GtUword gt_querymatch_querystart(const GtQuerymatch *querymatch);
 
+GtUword gt_querymatch_querystart_fwdstrand(const GtQuerymatch *querymatch);
+
+GtUword gt_querymatch_alignment_length(const GtQuerymatch *querymatch);
+
 void gt_querymatch_db_coordinates(GtUword *db_seqnum,GtUword *db_seqstart,
                                   GtUword *db_seqlen,
                                   const GtQuerymatch *querymatch);
@@ -117,6 +191,8 @@ double gt_querymatch_error_rate(GtUword distance,GtUword alignedlen);
 
 GtUword gt_querymatch_distance(const GtQuerymatch *querymatch);
 
+GtWord gt_querymatch_score(const GtQuerymatch *querymatch);
+
 void gt_querymatch_gfa2_edge(const GtQuerymatch *querymatch,GtUword edgenum);
 
 void gt_querymatch_prettyprint(double evalue,double bit_score,
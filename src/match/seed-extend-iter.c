@@ -16,8 +16,11 @@
 */
 
 #include <float.h>
+#include <string.h>
+#include "core/fa_api.h"
 #include "core/ma_api.h"
 #include "core/str_api.h"
+#include "core/xansi_api.h"
 #include "core/encseq.h"
 #include "match/querymatch.h"
 #include "match/seed-extend.h"
@@ -41,9 +44,31 @@ struct GtSeedextendMatchIterator
   GtSeedExtendDisplayFlag *in_display_flag;
   GtStr *saved_options_line;
   GtUword trace_delta;
-  bool missing_fields_line;
+  bool missing_fields_line,
+       binary, /* the matches are stored as binary records */
+       binary_eops; /* the binary records include the edit operations */
+  long binary_offset;
+  GtQuerymatchBinaryRecord binary_record;
+  uint8_t *binary_eops_space;
+  GtUword binary_eops_allocated;
+  void *binary_map, /* the mmapped match file and its index */
+       *binary_index_map;
+  size_t binary_mapsize;
+  const uint64_t *binary_index;
+  GtUword binary_numofrecords;
 };
 
+#define GT_SEEDEXTEND_BINARY_INDEX_MAGIC   "SXINDEX"
+#define GT_SEEDEXTEND_BINARY_INDEX_VERSION 1
+
+typedef struct
+{
+  char magic[8];
+  uint64_t version,
+           matchfilesize,
+           numofrecords;
+} GtSeedextendBinaryIndexHeader;
+
 void gt_seedextend_match_iterator_delete(GtSeedextendMatchIterator *semi)
 {
   if (semi == NULL)
@@ -64,6 +89,9 @@ void gt_seedextend_match_iterator_delete(GtSeedextendMatchIterator *semi)
   }
   gt_querymatch_display_flag_delete(semi->in_display_flag);
   gt_str_delete(semi->saved_options_line);
+  gt_free(semi->binary_eops_space);
+  gt_fa_xmunmap(semi->binary_map);
+  gt_fa_xmunmap(semi->binary_index_map);
   gt_free(semi);
 }
 
@@ -114,6 +142,16 @@ GtSeedextendMatchIterator *gt_seedextend_match_iterator_new(
   semi->in_display_flag = NULL;
   semi->trace_delta = GT_SEED_EXTEND_DEFAULT_TRACE_DELTA;
   semi->saved_options_line = NULL;
+  semi->binary = false;
+  semi->binary_eops = false;
+  semi->binary_offset = 0;
+  semi->binary_eops_space = NULL;
+  semi->binary_eops_allocated = 0;
+  semi->binary_map = NULL;
+  semi->binary_index_map = NULL;
+  semi->binary_mapsize = 0;
+  semi->binary_index = NULL;
+  semi->binary_numofrecords = 0;
   GT_INITARRAY(&semi->querymatch_table,GtQuerymatch);
   defline_infp = fopen(semi->matchfilename, "r");
   if (defline_infp == NULL)
@@ -252,12 +290,28 @@ GtSeedextendMatchIterator *gt_seedextend_match_iterator_new(
     GtStr *fieldsline_buffer = gt_str_new();
     GtStrArray *fields = NULL;
 
-    while (gt_str_read_next_line(fieldsline_buffer,defline_infp) != EOF &&
-           fields == NULL)
+    while (!had_err && fields == NULL && !semi->binary &&
+           gt_str_read_next_line(fieldsline_buffer,defline_infp) != EOF)
     {
       char *line_ptr = gt_str_get(fieldsline_buffer);
-      fields = gt_querymatch_read_Fields_line(line_ptr);
+      const int ret = gt_querymatch_read_Binary_line(&semi->binary_eops,
+                                                     line_ptr,err);
 
+      if (ret < 0)
+      {
+        had_err = -1;
+      } else
+      {
+        if (ret == 1)
+        {
+          /* the records start immediately after this line */
+          semi->binary = true;
+          semi->binary_offset = ftell(defline_infp);
+        } else
+        {
+          fields = gt_querymatch_read_Fields_line(line_ptr);
+        }
+      }
       gt_str_reset(fieldsline_buffer);
     }
     gt_str_delete(fieldsline_buffer);
@@ -318,6 +372,13 @@ GtSeedextendMatchIterator *gt_seedextend_match_iterator_new(
       had_err = true;
     }
   }
+  if (!had_err && semi->binary &&
+      fseek(semi->inputfileptr,semi->binary_offset,SEEK_SET) != 0)
+  {
+    gt_error_set(err,"cannot seek to binary records in file %s",
+                 semi->matchfilename);
+    had_err = -1;
+  }
   if (had_err)
   {
     gt_seedextend_match_iterator_delete(semi);
@@ -326,10 +387,61 @@ GtSeedextendMatchIterator *gt_seedextend_match_iterator_new(
   return semi;
 }
 
-GtQuerymatch *gt_seedextend_match_iterator_next(GtSeedextendMatchIterator *semi)
+static GtQuerymatch *gt_seedextend_match_iterator_next_binary(
+                                   GtSeedextendMatchIterator *semi,
+                                   bool selfmatch,
+                                   GtError *err)
+{
+  GtUword eopbytes_padded;
+  const size_t recordbytes
+    = gt_xfread(&semi->binary_record,(size_t) 1,sizeof semi->binary_record,
+                semi->inputfileptr);
+
+  if (recordbytes == 0)
+  {
+    return NULL;
+  }
+  if (recordbytes != sizeof semi->binary_record)
+  {
+    gt_error_set(err,"file %s: incomplete binary match record",
+                 semi->matchfilename);
+    return NULL;
+  }
+  eopbytes_padded = GT_QUERYMATCH_BINARY_PADDED((GtUword)
+                                                semi->binary_record.eopbytes);
+  if (eopbytes_padded > semi->binary_eops_allocated)
+  {
+    semi->binary_eops_allocated = eopbytes_padded;
+    semi->binary_eops_space = gt_realloc(semi->binary_eops_space,
+                                         sizeof *semi->binary_eops_space *
+                                         semi->binary_eops_allocated);
+  }
+  if (eopbytes_padded > 0 &&
+      gt_xfread(semi->binary_eops_space,sizeof *semi->binary_eops_space,
+                (size_t) eopbytes_padded,semi->inputfileptr)
+        != (size_t) eopbytes_padded)
+  {
+    gt_error_set(err,"file %s: incomplete binary match record",
+                 semi->matchfilename);
+    return NULL;
+  }
+  gt_querymatch_read_binary(semi->querymatchptr,
+                            &semi->evalue,
+                            &semi->bitscore,
+                            &semi->binary_record,
+                            semi->binary_eops ? semi->binary_eops_space : NULL,
+                            selfmatch,
+                            semi->aencseq,
+                            semi->bencseq);
+  return semi->querymatchptr;
+}
+
+GtQuerymatch *gt_seedextend_match_iterator_next(GtSeedextendMatchIterator *semi,
+                                                GtError *err)
 {
   bool selfmatch;
 
+  gt_error_check(err);
   gt_assert(semi != NULL);
   if (semi->currentmatchindex < GT_UWORD_MAX)
   {
@@ -344,6 +456,11 @@ GtQuerymatch *gt_seedextend_match_iterator_next(GtSeedextendMatchIterator *semi)
     return semi->currentmatch;
   }
   selfmatch = semi->aencseq == semi->bencseq ? true : false;
+  if (semi->binary)
+  {
+    return gt_seedextend_match_iterator_next_binary(semi,selfmatch,
+                                                    err);
+  }
   while (true)
   {
     const char *line_ptr;
@@ -377,6 +494,203 @@ GtQuerymatch *gt_seedextend_match_iterator_next(GtSeedextendMatchIterator *semi)
   return NULL;
 }
 
+static char *gt_seedextend_binary_index_filename(
+                                    const GtSeedextendMatchIterator *semi)
+{
+  const size_t len = strlen(semi->matchfilename) +
+                     strlen(GT_SEEDEXTEND_BINARY_INDEX_SUFFIX) + 1;
+  char *indexfilename = gt_malloc(sizeof *indexfilename * len);
+
+  (void) snprintf(indexfilename,len,"%s%s",semi->matchfilename,
+                  GT_SEEDEXTEND_BINARY_INDEX_SUFFIX);
+  return indexfilename;
+}
+
+int gt_seedextend_match_iterator_binary_index_write(
+                                    GtSeedextendMatchIterator *semi,
+                                    GtError *err)
+{
+  GtSeedextendBinaryIndexHeader header;
+  char *indexfilename;
+  FILE *indexfp = NULL;
+  int had_err = 0;
+
+  gt_error_check(err);
+  gt_assert(semi != NULL);
+  if (!semi->binary)
+  {
+    gt_error_set(err,"file %s does not contain binary match records",
+                 semi->matchfilename);
+    return -1;
+  }
+  indexfilename = gt_seedextend_binary_index_filename(semi);
+  indexfp = gt_fa_fopen(indexfilename,"wb",err);
+  if (indexfp == NULL)
+  {
+    had_err = -1;
+  }
+  if (!had_err &&
+      fseek(semi->inputfileptr,semi->binary_offset,SEEK_SET) != 0)
+  {
+    gt_error_set(err,"cannot seek to binary records in file %s",
+                 semi->matchfilename);
+    had_err = -1;
+  }
+  if (!had_err)
+  {
+    const bool selfmatch = semi->aencseq == semi->bencseq ? true : false;
+
+    /* the header is completed when all records are counted */
+    memset(&header,0,sizeof header);
+    gt_xfwrite(&header,sizeof header,(size_t) 1,indexfp);
+    while (true)
+    {
+      const uint64_t offset = (uint64_t) ftell(semi->inputfileptr);
+
+      if (gt_seedextend_match_iterator_next_binary(semi,selfmatch,err)
+          == NULL)
+      {
+        if (gt_error_is_set(err))
+        {
+          had_err = -1;
+        }
+        break;
+      }
+      gt_xfwrite(&offset,sizeof offset,(size_t) 1,indexfp);
+      header.numofrecords++;
+    }
+  }
+  if (!had_err)
+  {
+    memcpy(header.magic,GT_SEEDEXTEND_BINARY_INDEX_MAGIC,sizeof header.magic);
+    header.version = (uint64_t) GT_SEEDEXTEND_BINARY_INDEX_VERSION;
+    header.matchfilesize = (uint64_t) ftell(semi->inputfileptr);
+    gt_xfseek(indexfp,0,SEEK_SET);
+    gt_xfwrite(&header,sizeof header,(size_t) 1,indexfp);
+  }
+  gt_fa_fclose(indexfp);
+  if (had_err && indexfp != NULL)
+  {
+    gt_xremove(indexfilename);
+  }
+  gt_free(indexfilename);
+  return had_err;
+}
+
+int gt_seedextend_match_iterator_binary_index_map(
+                                    GtSeedextendMatchIterator *semi,
+                                    GtUword *numofrecords,
+                                    GtError *err)
+{
+  const GtSeedextendBinaryIndexHeader *header = NULL;
+  char *indexfilename;
+  size_t indexsize = 0;
+  int had_err = 0;
+
+  gt_error_check(err);
+  gt_assert(semi != NULL && semi->binary_map == NULL);
+  if (!semi->binary)
+  {
+    gt_error_set(err,"file %s does not contain binary match records",
+                 semi->matchfilename);
+    return -1;
+  }
+  indexfilename = gt_seedextend_binary_index_filename(semi);
+  semi->binary_map = gt_fa_mmap_read(semi->matchfilename,
+                                     &semi->binary_mapsize,err);
+  if (semi->binary_map == NULL)
+  {
+    had_err = -1;
+  }
+  if (!had_err)
+  {
+    semi->binary_index_map = gt_fa_mmap_read(indexfilename,&indexsize,err);
+    if (semi->binary_index_map == NULL)
+    {
+      had_err = -1;
+    }
+  }
+  if (!had_err)
+  {
+    header = (const GtSeedextendBinaryIndexHeader *) semi->binary_index_map;
+    if (indexsize < sizeof *header ||
+        memcmp(header->magic,GT_SEEDEXTEND_BINARY_INDEX_MAGIC,
+               sizeof header->magic) != 0 ||
+        header->version != (uint64_t) GT_SEEDEXTEND_BINARY_INDEX_VERSION ||
+        (indexsize - sizeof *header) / sizeof (uint64_t)
+          != header->numofrecords)
+    {
+      gt_error_set(err,"file %s is not a valid index of binary match records",
+                   indexfilename);
+      had_err = -1;
+    } else
+    {
+      if (header->matchfilesize != (uint64_t) semi->binary_mapsize)
+      {
+        gt_error_set(err,"index %s does not belong to file %s, which was "
+                         "changed after the index was written",
+                     indexfilename,semi->matchfilename);
+        had_err = -1;
+      }
+    }
+  }
+  if (!had_err)
+  {
+    semi->binary_index = (const uint64_t *) (header + 1);
+    semi->binary_numofrecords = (GtUword) header->numofrecords;
+    *numofrecords = semi->binary_numofrecords;
+  } else
+  {
+    gt_fa_xmunmap(semi->binary_map);
+    gt_fa_xmunmap(semi->binary_index_map);
+    semi->binary_map = semi->binary_index_map = NULL;
+  }
+  gt_free(indexfilename);
+  return had_err;
+}
+
+GtQuerymatch *gt_seedextend_match_iterator_binary_at(
+                                    GtSeedextendMatchIterator *semi,
+                                    GtUword idx,
+                                    GtError *err)
+{
+  const uint8_t *record_ptr;
+  GtUword offset;
+
+  gt_error_check(err);
+  gt_assert(semi != NULL && semi->binary_map != NULL &&
+            idx < semi->binary_numofrecords);
+  offset = (GtUword) semi->binary_index[idx];
+  if (offset > (GtUword) semi->binary_mapsize ||
+      (GtUword) semi->binary_mapsize - offset < sizeof semi->binary_record)
+  {
+    gt_error_set(err,"file %s: incomplete binary match record",
+                 semi->matchfilename);
+    return NULL;
+  }
+  record_ptr = (const uint8_t *) semi->binary_map + offset;
+  /* the record is copied, as the map gives no alignment guarantee */
+  memcpy(&semi->binary_record,record_ptr,sizeof semi->binary_record);
+  if ((GtUword) semi->binary_mapsize - offset - sizeof semi->binary_record
+      < GT_QUERYMATCH_BINARY_PADDED((GtUword) semi->binary_record.eopbytes))
+  {
+    gt_error_set(err,"file %s: incomplete binary match record",
+                 semi->matchfilename);
+    return NULL;
+  }
+  gt_querymatch_read_binary(semi->querymatchptr,
+                            &semi->evalue,
+                            &semi->bitscore,
+                            &semi->binary_record,
+                            semi->binary_eops
+                              ? record_ptr + sizeof semi->binary_record
+                              : NULL,
+                            semi->aencseq == semi->bencseq ? true : false,
+                            semi->aencseq,
+                            semi->bencseq);
+  return semi->querymatchptr;
+}
+
 const GtEncseq *gt_seedextend_match_iterator_aencseq(
                         const GtSeedextendMatchIterator *semi)
 {
@@ -416,14 +730,16 @@ bool gt_seedextend_match_iterator_has_seed(
                         const GtSeedextendMatchIterator *semi)
 {
   gt_assert(semi != NULL);
-  return gt_querymatch_has_seed(semi->in_display_flag);
+  /* the binary records always include the seed */
+  return semi->binary || gt_querymatch_has_seed(semi->in_display_flag);
 }
 
 bool gt_seedextend_match_iterator_has_cigar(
                         const GtSeedextendMatchIterator *semi)
 {
   gt_assert(semi != NULL);
-  return gt_querymatch_cigar_display(semi->in_display_flag) ||
+  return semi->binary_eops ||
+         gt_querymatch_cigar_display(semi->in_display_flag) ||
          gt_querymatch_cigarX_display(semi->in_display_flag);
 }
 
@@ -431,6 +747,11 @@ GtUword gt_seedextend_match_iterator_trace_delta(
                         const GtSeedextendMatchIterator *semi)
 {
   gt_assert(semi != NULL);
+  /* binary records contain all edit operations rather than a trace */
+  if (semi->binary)
+  {
+    return 0;
+  }
   return (gt_querymatch_trace_display(semi->in_display_flag) ||
           gt_querymatch_dtrace_display(semi->in_display_flag))
            ? semi->trace_delta : 0;
@@ -462,13 +783,15 @@ void gt_seedextend_match_iterator_verify_alignment_set(
 }
 
 GtUword gt_seedextend_match_iterator_all_sorted(GtSeedextendMatchIterator *semi,
-                                                bool ascending)
+                                                bool ascending,
+                                                GtError *err)
 
 {
   GtQuerymatch *querymatchptr;
   gt_assert(semi != NULL);
 
-  while ((querymatchptr = gt_seedextend_match_iterator_next(semi)) != NULL)
+  while ((querymatchptr = gt_seedextend_match_iterator_next(semi,err))
+         != NULL)
   {
     gt_querymatch_table_add(&semi->querymatch_table,querymatchptr);
   }
@@ -503,7 +826,8 @@ int gt_seedextend_match_iterator_querymatchoutoptions_set(
   {
     return -1;
   }
-  gt_assert(semi->in_display_flag != NULL && out_display_flag != NULL);
+  gt_assert((semi->binary || semi->in_display_flag != NULL) &&
+            out_display_flag != NULL);
   if (gt_querymatch_cigar_display(semi->in_display_flag) &&
       gt_querymatch_cigarX_display(out_display_flag))
   {
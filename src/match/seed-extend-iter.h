@@ -40,19 +40,23 @@ GtSeedextendMatchIterator *gt_seedextend_match_iterator_new(
 void gt_seedextend_match_iterator_delete(GtSeedextendMatchIterator *semi);
 
 /* This function reads the next match and returns a <GtQuerymatch>-object.
-   If there is no match left, then a NULL-ptr is returned. */
+   If there is no match left, then a NULL-ptr is returned. If the match
+   cannot be read, then a NULL-ptr is returned and <err> is set. */
 
 GtQuerymatch *gt_seedextend_match_iterator_next(
-                             GtSeedextendMatchIterator *semi);
+                             GtSeedextendMatchIterator *semi,
+                             GtError *err);
 
 /* The following function reads all matches into an arrays and sorts the,. If
    <ascending is true, then all matches are sorted in ascending order of
    the query position they occur at. Otherwise, all matches are sorted in
-   descending order of the query position they occur at. */
+   descending order of the query position they occur at. If a match cannot
+   be read, then <err> is set. */
 
 GtUword gt_seedextend_match_iterator_all_sorted(
                                          GtSeedextendMatchIterator *semi,
-                                         bool ascending);
+                                         bool ascending,
+                                         GtError *err);
 
 /* If the previous function has been called, the matches are stored in a table
    (in sorted order) and the following function allows to obtain the
@@ -62,6 +66,44 @@ GtQuerymatch *gt_seedextend_match_iterator_get(
                             const GtSeedextendMatchIterator *semi,
                             GtUword idx);
 
+/* The records of a match file in binary format may be followed by edit
+   operations of different length and thus cannot be addressed by their
+   number. The index of such a file is stored in a file with the same name
+   and suffix <GT_SEEDEXTEND_BINARY_INDEX_SUFFIX>. It begins with the
+   8 characters "SXINDEX\0", followed by the version, the size of the match
+   file and the number of records, and then the offset of each record in
+   the match file, all as <uint64_t> in the byte order of the machine. */
+
+#define GT_SEEDEXTEND_BINARY_INDEX_SUFFIX ".sxi"
+
+/* The following function reads all records of the binary match file of
+   <semi> and writes its index. In case of an error, -1 is returned and
+   <err> is set. */
+
+int gt_seedextend_match_iterator_binary_index_write(
+                                    GtSeedextendMatchIterator *semi,
+                                    GtError *err);
+
+/* The following function maps the binary match file of <semi> and its
+   index into memory and stores the number of records in <numofrecords>.
+   In case of an error, for example if the index is missing or does not
+   belong to the match file, -1 is returned and <err> is set. */
+
+int gt_seedextend_match_iterator_binary_index_map(
+                                    GtSeedextendMatchIterator *semi,
+                                    GtUword *numofrecords,
+                                    GtError *err);
+
+/* If the previous function has been called, the following function returns
+   the match stored in record <idx> of the mapped file. The edit operations
+   are read directly from the mapped file. If the record is incomplete,
+   then a NULL-ptr is returned and <err> is set. */
+
+GtQuerymatch *gt_seedextend_match_iterator_binary_at(
+                                    GtSeedextendMatchIterator *semi,
+                                    GtUword idx,
+                                    GtError *err);
+
 /* The following function sets some option related to the output of
    the matches and the corresponding alignments. If only the edit operation
    list is required, then set <generatealignment> to <true>,
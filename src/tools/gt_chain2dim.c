@@ -34,7 +34,7 @@ static void gt_chain2dim_arguments_delete (void *tool_arguments)
   {
     return;
   }
-  gt_str_delete (arguments->matchfile);
+  gt_str_array_delete (arguments->matchfiles);
   gt_str_array_delete (arguments->globalargs);
   gt_str_array_delete (arguments->localargs);
   gt_option_delete (arguments->refoptionmaxgap);
@@ -51,17 +51,21 @@ static GtOptionParser *gt_chain2dim_option_parser_new (void *tool_arguments)
   GtOption *option, *optionglobal, *optionlocal;
 
   gt_assert (arguments != NULL);
-  arguments->matchfile = gt_str_new ();
+  arguments->matchfiles = gt_str_array_new ();
   arguments->globalargs = gt_str_array_new();
   arguments->localargs = gt_str_array_new();
 
-  op = gt_option_parser_new("[options] -m matchfile",
+  op = gt_option_parser_new("[options] -m matchfile [matchfile ...]",
                             "Chain pairwise matches.");
 
   gt_option_parser_set_mail_address(op, "<kurtz@zbh.uni-hamburg.de>");
-  option = gt_option_new_filename("m","Specify file containing the matches\n"
-                                  "mandatory option",
-                                  arguments->matchfile);
+  option = gt_option_new_filename_array("m","Specify file containing the "
+                                        "matches\n"
+                                        "if more than one file is given, the "
+                                        "matches of each file are chained "
+                                        "independently, using -j threads\n"
+                                        "mandatory option",
+                                        arguments->matchfiles);
   gt_option_parser_add_option(op, option);
   gt_option_is_mandatory(option);
 
@@ -194,6 +198,7 @@ static int gt_chain2dim_arguments_check (GT_UNUSED int rest_argc,
 typedef struct
 {
   GtUword chaincounter;
+  const char *matchfile; /* only set if there is more than one matchfile */
 } Counter;
 
 static void gt_outputformatchaingeneric(
@@ -206,6 +211,10 @@ static void gt_outputformatchaingeneric(
   Counter *counter = (Counter *) data;
 
   chainlength = gt_chain_chainlength(chain);
+  if (counter->matchfile != NULL && counter->chaincounter == 0)
+  {
+    printf("# matchfile %s\n",counter->matchfile);
+  }
   printf("# chain "GT_WU": length "GT_WU" score "GT_WD"\n",
          counter->chaincounter,chainlength,gt_chain_chainscore(chain));
   if (!silent)
@@ -252,50 +261,94 @@ static int gt_chain2dim_runner (GT_UNUSED int argc,
                                 GtError * err)
 {
   GtChain2dimoptions *arguments = tool_arguments;
-  GtChain2Dimmatchtable *matchtable;
+  GtChain2Dimmatchtable **matchtables;
+  const GtUword numofmatchfiles = gt_str_array_size(arguments->matchfiles);
+  const unsigned int presortdim = 1U;
+  GtUword idx;
   bool haserr = false;
-  GtLogger *logger = NULL;
+  GtLogger *logger;
 
   gt_error_check (err);
   gt_assert (arguments != NULL);
   gt_assert (parsed_args == argc);
+  gt_assert (numofmatchfiles > 0);
 
-  matchtable = gt_chain_analyzeopenformatfile(arguments->weightfactor,
-                                              gt_str_get(arguments->
-                                                         matchfile),
-                                              err);
-  if (matchtable == NULL)
+  logger = gt_logger_new(arguments->verbose, GT_LOGGER_DEFLT_PREFIX, stdout);
+  matchtables = gt_calloc((size_t) numofmatchfiles, sizeof *matchtables);
+  for (idx = 0; !haserr && idx < numofmatchfiles; idx++)
   {
-    haserr = true;
+    matchtables[idx]
+      = gt_chain_analyzeopenformatfile(arguments->weightfactor,
+                                       gt_str_array_get(arguments->matchfiles,
+                                                        idx),
+                                       err);
+    if (matchtables[idx] == NULL)
+    {
+      haserr = true;
+    } else
+    {
+      gt_chain_possiblysortmatches(logger, matchtables[idx], presortdim);
+    }
   }
   if (!haserr)
   {
-    unsigned int presortdim = 1U;
-    GtChain2Dim *chain;
-    Counter counter;
+    GtChain2Dim *chain = gt_chain_chain_new();
+    GtChain2Dimprocessor chainprocessor = arguments->silent
+                                            ? gt_outputformatchainsilent
+                                            : gt_outputformatchain;
+
+    if (numofmatchfiles == 1UL)
+    {
+      Counter counter;
 
-    logger = gt_logger_new(arguments->verbose, GT_LOGGER_DEFLT_PREFIX, stdout);
-    gt_chain_possiblysortmatches(logger, matchtable, presortdim);
-    chain = gt_chain_chain_new();
-    counter.chaincounter = 0;
-    gt_chain_fastchaining(arguments->gtchainmode,
-                          chain,
-                          matchtable,
-                          true,
-                          presortdim,
-                          true,
-                          arguments->silent ? gt_outputformatchainsilent
-                                            : gt_outputformatchain,
-                          &counter,
-                          logger);
+      counter.chaincounter = 0;
+      counter.matchfile = NULL;
+      gt_chain_fastchaining(arguments->gtchainmode,
+                            chain,
+                            matchtables[0],
+                            true,
+                            presortdim,
+                            true,
+                            chainprocessor,
+                            &counter,
+                            logger);
+    } else
+    {
+      Counter *counters = gt_malloc(sizeof *counters * numofmatchfiles);
+      void **cpinfos = gt_malloc(sizeof *cpinfos * numofmatchfiles);
+
+      for (idx = 0; idx < numofmatchfiles; idx++)
+      {
+        counters[idx].chaincounter = 0;
+        counters[idx].matchfile = gt_str_array_get(arguments->matchfiles,idx);
+        cpinfos[idx] = counters + idx;
+      }
+      if (gt_chain_fastchaining_multi(arguments->gtchainmode,
+                                      chain,
+                                      matchtables,
+                                      numofmatchfiles,
+                                      true,
+                                      presortdim,
+                                      true,
+                                      chainprocessor,
+                                      cpinfos,
+                                      logger,
+                                      err) != 0)
+      {
+        haserr = true;
+      }
+      gt_free(cpinfos);
+      gt_free(counters);
+    }
     gt_chain_chain_delete(chain);
   }
   gt_chain_chainmode_delete(arguments->gtchainmode);
-  gt_chain_matchtable_delete(matchtable);
-  if (logger != NULL)
+  for (idx = 0; idx < numofmatchfiles; idx++)
   {
-    gt_logger_delete(logger);
+    gt_chain_matchtable_delete(matchtables[idx]);
   }
+  gt_free(matchtables);
+  gt_logger_delete(logger);
   return haserr ? -1 : 0;
 }
 
@@ -32,8 +32,8 @@ typedef struct
        verbose;
   double weightfactor;
   GtUword maxgap;
-  GtStr *matchfile;
-  GtStrArray *globalargs,
+  GtStrArray *matchfiles,
+             *globalargs,
              *localargs;
   GtOption *refoptionmaxgap,
            *refoptionweightfactor,
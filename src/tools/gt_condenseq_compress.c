@@ -36,6 +36,7 @@ typedef struct {
   GtStr                 *indexname;
   GtXdropArbitraryscores scores;
   GtUword                minalignlength,
+                         batchsize,
                          cutoff_value,
                          fraction,
                          initsize;
@@ -223,6 +224,15 @@ gt_condenseq_compress_option_parser_new(void *tool_arguments)
   gt_option_is_development_option(option);
   gt_option_parser_add_option(op, option);
 
+  /* -batch */
+  option = gt_option_new_uword("batch", "process the sequences after the "
+                               "initial unique set in batches of given size, "
+                               "using -j many threads. Sequences within one "
+                               "batch are not compressed against each other. "
+                               "0 processes them one after the other.",
+                               &arguments->batchsize, 0);
+  gt_option_parser_add_option(op, option);
+
   /* -verbose */
   option = gt_option_new_bool("verbose", "enable verbose output",
                               &arguments->verbose, false);
@@ -395,6 +405,7 @@ static int gt_condenseq_compress_runner(GT_UNUSED int argc, const char **argv,
       if (arguments->clean_percent != GT_UNDEF_UINT)
         gt_condenseq_creator_set_diags_clean_limit(ces_c,
                                                    arguments->clean_percent);
+      gt_condenseq_creator_set_batchsize(ces_c, arguments->batchsize);
 
       had_err = gt_condenseq_creator_create(ces_c,
                                             arguments->indexname,
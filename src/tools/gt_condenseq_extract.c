@@ -22,9 +22,11 @@
 #include "core/log_api.h"
 #include "core/logger.h"
 #include "core/ma_api.h"
+#include "core/multithread_api.h"
 #include "core/output_file_api.h"
 #include "core/showtime.h"
 #include "core/str_api.h"
+#include "core/thread_api.h"
 #include "core/types_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
@@ -200,6 +202,119 @@ static int gt_condenseq_extract_arguments_check(int rest_argc,
   return had_err;
 }
 
+/* the sequences are extracted by all threads in batches, sequence <i> of a
+   batch to <buffer> at <offsets[i]> */
+typedef struct {
+  const GtCondenseq *condenseq;
+  GtMutex           *mutex;
+  GtUchar           *ubuffer;
+  char              *buffer;
+  GtUword           *offsets,
+                     allocated,
+                     firstseq,
+                     lastseq,
+                     nextseq;
+} GtCondenseqExtractBatch;
+
+#define GT_CONDENSEQ_EXTRACT_BATCHSIZE (((GtUword) 1) << 22)
+
+static void *gt_condenseq_extract_batch_thread(void *data)
+{
+  GtCondenseqExtractBatch *batch = data;
+
+  while (true) {
+    GtRange range;
+    GtUword seqnum, offset;
+    gt_mutex_lock(batch->mutex);
+    seqnum = batch->nextseq;
+    if (seqnum <= batch->lastseq)
+      batch->nextseq++;
+    gt_mutex_unlock(batch->mutex);
+    if (seqnum > batch->lastseq)
+      break;
+    offset = batch->offsets[seqnum - batch->firstseq];
+    if (batch->offsets[seqnum - batch->firstseq + 1] > offset) {
+      range.start = gt_condenseq_seqstartpos(batch->condenseq, seqnum);
+      range.end = range.start +
+        batch->offsets[seqnum - batch->firstseq + 1] - offset - 1;
+      gt_condenseq_extract_decoded_range_to_buffer(batch->condenseq, range,
+                                                   '\0',
+                                                   batch->ubuffer + offset,
+                                                   batch->buffer + offset);
+    }
+  }
+  return NULL;
+}
+
+/* extract sequences <firstseq>..<lastseq> in batches of about
+   GT_CONDENSEQ_EXTRACT_BATCHSIZE characters, using <gt_jobs> many threads, and
+   show them in fasta format */
+static int gt_condenseq_extract_seqs(const GtCondenseq *condenseq,
+                                     GtUword firstseq,
+                                     GtUword lastseq,
+                                     GtUword width,
+                                     GtFile *outfp,
+                                     GtError *err)
+{
+  GtCondenseqExtractBatch batch;
+  GtUword seqnum, buffsize = 0;
+  int had_err = 0;
+
+  batch.condenseq = condenseq;
+  batch.mutex = gt_mutex_new();
+  batch.ubuffer = NULL;
+  batch.buffer = NULL;
+  batch.allocated = 0;
+  batch.offsets = NULL;
+  for (batch.firstseq = firstseq;
+       !had_err && batch.firstseq <= lastseq;
+       batch.firstseq = batch.lastseq + 1) {
+    GtUword totallength = 0;
+    for (seqnum = batch.firstseq;
+         seqnum <= lastseq &&
+         (seqnum == batch.firstseq ||
+          totallength < GT_CONDENSEQ_EXTRACT_BATCHSIZE);
+         seqnum++) {
+      if (seqnum - batch.firstseq + 1 >= batch.allocated) {
+        batch.allocated = batch.allocated * 2 + 16UL;
+        batch.offsets = gt_realloc(batch.offsets,
+                                   sizeof (*batch.offsets) * batch.allocated);
+      }
+      batch.offsets[seqnum - batch.firstseq] = totallength;
+      totallength += gt_condenseq_seqlength(condenseq, seqnum);
+    }
+    batch.lastseq = seqnum - 1;
+    batch.offsets[seqnum - batch.firstseq] = totallength;
+    if (buffsize < totallength) {
+      buffsize = totallength;
+      batch.ubuffer = gt_realloc(batch.ubuffer,
+                                 sizeof (*batch.ubuffer) * buffsize);
+      batch.buffer = gt_realloc(batch.buffer,
+                                sizeof (*batch.buffer) * buffsize);
+    }
+    batch.nextseq = batch.firstseq;
+    if (gt_jobs > 1U && batch.lastseq > batch.firstseq)
+      had_err = gt_multithread(gt_condenseq_extract_batch_thread, &batch,
+                               err);
+    else
+      (void) gt_condenseq_extract_batch_thread(&batch);
+    for (seqnum = batch.firstseq; !had_err && seqnum <= batch.lastseq;
+         seqnum++) {
+      GtUword desclen;
+      const char *desc = gt_condenseq_description(condenseq, &desclen, seqnum);
+      const GtUword offset = batch.offsets[seqnum - batch.firstseq];
+      gt_fasta_show_entry_nt(desc, desclen, batch.buffer + offset,
+                             batch.offsets[seqnum - batch.firstseq + 1] -
+                             offset, width, outfp);
+    }
+  }
+  gt_mutex_delete(batch.mutex);
+  gt_free(batch.offsets);
+  gt_free(batch.ubuffer);
+  gt_free(batch.buffer);
+  return had_err;
+}
+
 static int gt_condenseq_extract_runner(GT_UNUSED int argc,
                                        const char **argv,
                                        int parsed_args,
@@ -231,10 +346,7 @@ static int gt_condenseq_extract_runner(GT_UNUSED int argc,
 
   if (!had_err) {
     const char *buffer = NULL;
-    const char *desc = NULL;
-    GtUword desclen,
-            seqlen,
-            rend = gt_condenseq_total_length(condenseq),
+    GtUword rend = gt_condenseq_total_length(condenseq),
             send = gt_condenseq_num_of_sequences(condenseq);
     bool concat = strcmp(gt_str_get(arguments->mode), "concat") == 0;
     /* single sequence to extract = range of length 1 */
@@ -318,9 +430,6 @@ static int gt_condenseq_extract_runner(GT_UNUSED int argc,
       }
     }
     else if (!had_err) { /* extract seqwise and always fasta */
-      GtUword seqnum,
-              sstart = arguments->seqrange.start;
-
       if (timer)
         gt_timer_show_progress(timer, "extract sequence(s)", stderr);
       if (arguments->seqrange.end >= send) {
@@ -329,17 +438,12 @@ static int gt_condenseq_extract_runner(GT_UNUSED int argc,
                      GT_WU " (ranges are zero based sequence ids)",
                      arguments->seqrange.end, send);
       }
-      send = arguments->seqrange.end;
-      for (seqnum = sstart;
-           !had_err && seqnum <= send;
-           ++seqnum) {
-        buffer = gt_condenseq_extract_decoded(condenseq, &seqlen, seqnum);
-        desc = gt_condenseq_description(condenseq, &desclen, seqnum);
-        gt_fasta_show_entry_nt(desc, desclen,
-                               buffer, seqlen,
-                               arguments->width,
-                               arguments->outfp);
-      }
+      if (!had_err)
+        had_err = gt_condenseq_extract_seqs(condenseq,
+                                            arguments->seqrange.start,
+                                            arguments->seqrange.end,
+                                            arguments->width,
+                                            arguments->outfp, err);
     }
   }
   if (timer)
@@ -33,6 +33,7 @@
 
 #include "tools/gt_condenseq_blast.h"
 #include "tools/gt_condenseq_hmmsearch.h"
+#include "tools/gt_condenseq_seedextend.h"
 
 #include "tools/gt_condenseq_search.h"
 
@@ -43,6 +44,8 @@ static void* gt_condenseq_search_toolbox_new(void)
                       "blast", gt_condenseq_blast());
   gt_toolbox_add_tool(condenseq_search_toolbox,
                       "hmmsearch", gt_condenseq_hmmsearch());
+  gt_toolbox_add_tool(condenseq_search_toolbox,
+                      "seedextend", gt_condenseq_seedextend());
   return condenseq_search_toolbox;
 }
 
@@ -0,0 +1,775 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <limits.h>
+#include <string.h>
+
+#include "core/alphabet_api.h"
+#include "core/arraydef_api.h"
+#include "core/divmodmul_api.h"
+#include "core/encseq_api.h"
+#include "core/log_api.h"
+#include "core/logger.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/minmax_api.h"
+#include "core/multithread_api.h"
+#include "core/output_file_api.h"
+#include "core/qsort_r_api.h"
+#include "core/range_api.h"
+#include "core/seq_iterator_sequence_buffer_api.h"
+#include "core/showtime.h"
+#include "core/str_array_api.h"
+#include "core/thread_api.h"
+#include "core/undef_api.h"
+#include "core/unused_api.h"
+#include "extended/condenseq.h"
+#include "match/diagbandseed.h"
+#include "match/initbasepower.h"
+#include "match/seed-extend.h"
+#include "match/seed_extend_parts.h"
+
+#include "extended/condenseq_search_arguments.h"
+#include "tools/gt_condenseq_seedextend.h"
+
+typedef struct {
+  GtFile                     *outfp;
+  GtOutputFileInfo           *ofi;
+  GtCondenseqSearchArguments *csa;
+  GtStr                      *querypath;
+  GtUword      minidentity,
+               alignlength,
+               cachesize;
+  double       ceval,
+               feval;
+  unsigned int seedlength;
+  bool         norev;
+} GtCondenseqSeedextendArguments;
+
+/* a match of a query, either against a unique sequence (coarse search) or
+   against a range extracted from the original sequences (fine search) */
+typedef struct {
+  GtUword queryseqnum,
+          querystart, /* relative to the query in the direction of the match */
+          querylen,
+          query_seqlen,
+          dbseqnum,
+          dbstart,
+          dblen,
+          alignment_length;
+  double  identity,
+          evalue,
+          bit_score;
+  bool    reverse;
+} GtCondenseqSeedextendHit;
+
+GT_DECLAREARRAYSTRUCT(GtCondenseqSeedextendHit);
+
+/* the matches are reported by all threads extending seeds */
+typedef struct {
+  GtArrayGtCondenseqSeedextendHit hits;
+  GtMutex                        *mutex;
+} GtCondenseqSeedextendHits;
+
+typedef struct {
+  GtRange range;
+  GtUword seqnum;
+} GtCondenseqSeedextendRange;
+
+GT_DECLAREARRAYSTRUCT(GtCondenseqSeedextendRange);
+
+static void* gt_condenseq_seedextend_arguments_new(void)
+{
+  GtCondenseqSeedextendArguments *arguments =
+    gt_calloc((size_t) 1, sizeof *arguments);
+  arguments->csa = gt_condenseq_search_arguments_new();
+  arguments->ofi = gt_output_file_info_new();
+  arguments->querypath = gt_str_new();
+  return arguments;
+}
+
+static void gt_condenseq_seedextend_arguments_delete(void *tool_arguments)
+{
+  GtCondenseqSeedextendArguments *arguments = tool_arguments;
+  if (arguments != NULL) {
+    gt_condenseq_search_arguments_delete(arguments->csa);
+    gt_file_delete(arguments->outfp);
+    gt_output_file_info_delete(arguments->ofi);
+    gt_str_delete(arguments->querypath);
+    gt_free(arguments);
+  }
+}
+
+  static GtOptionParser*
+gt_condenseq_seedextend_option_parser_new(void *tool_arguments)
+{
+  GtCondenseqSeedextendArguments *arguments = tool_arguments;
+  GtOptionParser *op;
+  GtOption *option;
+  gt_assert(arguments);
+
+  /* init */
+  op = gt_option_parser_new("[option ...] -db <archive> -query <query>",
+                            "Search the given compressed database with the "
+                            "seed and extend method of gt seed_extend. "
+                            "Output similar to blast -outfmt 6.");
+
+  gt_condenseq_search_register_options(arguments->csa, op);
+
+  /* -query */
+  option = gt_option_new_filename("query", "path of fasta query file",
+                                  arguments->querypath);
+  gt_option_is_mandatory(option);
+  gt_option_parser_add_option(op, option);
+
+  /* -seedlength */
+  option = gt_option_new_uint_min_max("seedlength",
+                                      "Minimum length of a seed\n"
+                                      "default: logarithm of input length "
+                                      "with alphabet size as log-base",
+                                      &arguments->seedlength,
+                                      UINT_MAX, 2U, 32U);
+  gt_option_hide_default(option);
+  gt_option_parser_add_option(op, option);
+
+  /* -l */
+  option = gt_option_new_uword_min("l", "Minimum length of aligned sequences\n"
+                                   "default: 2.5 x seedlength",
+                                   &arguments->alignlength,
+                                   GT_UWORD_MAX, 1UL);
+  gt_option_hide_default(option);
+  gt_option_parser_add_option(op, option);
+
+  /* -minidentity */
+  option = gt_option_new_uword_min_max("minidentity",
+                                       "Minimum identity of matches",
+                                       &arguments->minidentity,
+                                       80UL, GT_EXTEND_MIN_IDENTITY_PERCENTAGE,
+                                       99UL);
+  gt_option_parser_add_option(op, option);
+
+  /* -ce */
+  option = gt_option_new_double("ce", "E-value threshold for the coarse search "
+                                "on the unique sequences",
+                                &arguments->ceval, 10.0);
+  gt_option_parser_add_option(op, option);
+
+  /* -fe */
+  option = gt_option_new_double("fe", "E-value threshold for the fine search "
+                                "on the ranges extracted from the original "
+                                "sequences",
+                                &arguments->feval, 0.001);
+  gt_option_parser_add_option(op, option);
+
+  /* -no-reverse */
+  option = gt_option_new_bool("no-reverse", "do not compute matches on reverse "
+                              "complemented strand",
+                              &arguments->norev, false);
+  gt_option_parser_add_option(op, option);
+
+  /* -cachesize */
+  option = gt_option_new_uword("cachesize", "size of the cache for decoded "
+                               "links when extracting the ranges for the fine "
+                               "search, in MB",
+                               &arguments->cachesize, 32UL);
+  gt_option_parser_add_option(op, option);
+
+  gt_output_file_info_register_options(arguments->ofi, op, &arguments->outfp);
+
+  return op;
+}
+
+static void gt_condenseq_seedextend_store_hit(void *data,
+                                              const GtQuerymatch *querymatch,
+                                              double evalue,
+                                              double bit_score)
+{
+  GtCondenseqSeedextendHits *hits = data;
+  GtCondenseqSeedextendHit *hit;
+  GtUword db_seqstart, db_seqlen, query_seqstart;
+
+  gt_mutex_lock(hits->mutex);
+  GT_GETNEXTFREEINARRAY(hit, &hits->hits, GtCondenseqSeedextendHit, 256);
+  gt_querymatch_db_coordinates(&hit->dbseqnum, &db_seqstart, &db_seqlen,
+                               querymatch);
+  gt_querymatch_query_coordinates(&hit->queryseqnum, &query_seqstart,
+                                  &hit->query_seqlen, querymatch);
+  hit->dbstart = gt_querymatch_dbstart_relative(querymatch);
+  hit->dblen = gt_querymatch_dblen(querymatch);
+  hit->querystart = gt_querymatch_querystart(querymatch);
+  hit->querylen = gt_querymatch_querylen(querymatch);
+  hit->alignment_length = gt_querymatch_alignment_length(querymatch);
+  hit->identity = 100.0 - gt_querymatch_error_rate(
+                                  gt_querymatch_distance(querymatch),
+                                  hit->dblen + hit->querylen);
+  hit->evalue = evalue;
+  hit->bit_score = bit_score;
+  hit->reverse = GT_ISDIRREVERSE(gt_querymatch_query_readmode(querymatch));
+  gt_mutex_unlock(hits->mutex);
+}
+
+/* start of <hit> relative to the forward strand of the query */
+static GtUword gt_condenseq_seedextend_querystart_fwd(
+                                           const GtCondenseqSeedextendHit *hit)
+{
+  return hit->reverse ? hit->query_seqlen - hit->querystart - hit->querylen
+                      : hit->querystart;
+}
+
+/* the seed length chosen like in gt seed_extend, restricted to what the
+   sequences of <dbencseq> and <queryencseq> allow */
+static unsigned int gt_condenseq_seedextend_seedlength(
+                                                   unsigned int seedlength,
+                                                   const GtEncseq *dbencseq,
+                                                   const GtEncseq *queryencseq)
+{
+  const unsigned int numofchars
+    = gt_alphabet_num_of_chars(gt_encseq_alphabet(dbencseq));
+  const GtUword maxseqlength = GT_MIN(gt_encseq_max_seq_length(dbencseq),
+                                      gt_encseq_max_seq_length(queryencseq));
+  unsigned int maxseedlength;
+
+  if (gt_encseq_has_twobitencoding(dbencseq) &&
+      gt_encseq_wildcards(dbencseq) == 0 &&
+      gt_encseq_has_twobitencoding(queryencseq) &&
+      gt_encseq_wildcards(queryencseq) == 0) {
+    maxseedlength = 32U;
+  } else {
+    maxseedlength = gt_maxbasepower(numofchars) - 1;
+  }
+  if (seedlength == UINT_MAX) {
+    double avg_totallength = 0.5 * (gt_encseq_total_length(dbencseq) +
+                                    gt_encseq_total_length(queryencseq));
+    seedlength = (unsigned int)
+                 gt_round_to_long(gt_log_base(avg_totallength,
+                                              (double) numofchars));
+    seedlength = GT_MAX(seedlength, 2U);
+  }
+  return (unsigned int) GT_MIN3((GtUword) seedlength, (GtUword) maxseedlength,
+                                maxseqlength);
+}
+
+/* find the matches of the sequences in <queryencseq> in <dbencseq> with the
+   diagonal band seed filter and greedy extension of gt seed_extend, using
+   <gt_jobs> threads, and append them to <hits> */
+static int gt_condenseq_seedextend_run(const GtEncseq *dbencseq,
+                                       const GtEncseq *queryencseq,
+                                       const GtCondenseqSeedextendArguments
+                                         *arguments,
+                                       unsigned int seedlength,
+                                       double evalue_threshold,
+                                       GtCondenseqSeedextendHits *hits,
+                                       GtError *err)
+{
+  const GtUword mincoverage = (GtUword) (2.5 * seedlength),
+                alignlength = arguments->alignlength == GT_UWORD_MAX
+                                ? mincoverage
+                                : arguments->alignlength;
+  const GtUwordPair pick = {GT_UWORD_MAX, GT_UWORD_MAX};
+  const bool norev = arguments->norev ||
+                     !gt_alphabet_is_dna(gt_encseq_alphabet(dbencseq));
+  GtRange seedpairdistance;
+  GtStr *chainarguments = gt_str_new(),
+        *diagband_statistics_arg = gt_str_new();
+  GtDiagbandseedExtendParams *extp;
+  GtDiagbandseedInfo *info;
+  GtSequencePartsInfo *dbseqranges, *queryseqranges;
+  int had_err;
+
+  seedpairdistance.start = (GtUword) seedlength;
+  seedpairdistance.end = GT_UWORD_MAX - gt_encseq_max_seq_length(dbencseq);
+  extp = gt_diagbandseed_extend_params_new(alignlength,
+                                           100UL - arguments->minidentity,
+                                           evalue_threshold,
+                                           6UL, /* logdiagbandwidth */
+                                           mincoverage,
+                                           NULL,
+                                           0, /* use_apos */
+                                           0, /* xdropbelowscore */
+                                           true, /* extendgreedy */
+                                           false, /* extendxdrop */
+                                           0, /* maxalignedlendifference */
+                                           60UL, /* history_size */
+                                           0, /* perc_mat_history */
+                                           GT_EXTEND_CHAR_ACCESS_ANY,
+                                           GT_EXTEND_CHAR_ACCESS_ANY,
+                                           false, /* cam_generic */
+                                           97UL, /* sensitivity */
+                                           GT_DEFAULT_MATCHSCORE_BIAS,
+                                           false, /* weakends */
+                                           false, /* benchmark */
+                                           true, /* always_polished_ends */
+                                           false, /* verify_alignment */
+                                           false, /* only_selected_seqpairs */
+                                           NULL);
+  gt_diagbandseed_extend_params_set_processmatch(extp,
+                                             gt_condenseq_seedextend_store_hit,
+                                             hits);
+  dbseqranges
+    = gt_sequence_parts_info_new(dbencseq,
+                                 gt_encseq_num_of_sequences(dbencseq), 1UL);
+  queryseqranges
+    = gt_sequence_parts_info_new(queryencseq,
+                                 gt_encseq_num_of_sequences(queryencseq), 1UL);
+  info = gt_diagbandseed_info_new(dbencseq,
+                                  queryencseq,
+                                  GT_UWORD_MAX, /* maxfreq */
+                                  GT_UWORD_MAX, /* memlimit */
+                                  0, /* spacedseedweight */
+                                  seedlength,
+                                  norev,
+                                  false, /* nofwd */
+                                  &seedpairdistance,
+                                  GT_DIAGBANDSEED_BASE_LIST_UNDEFINED,
+                                  GT_DIAGBANDSEED_BASE_LIST_UNDEFINED,
+                                  false, /* verify */
+                                  false, /* verbose */
+                                  false, /* debug_kmer */
+                                  false, /* debug_seedpair */
+                                  false, /* use_kmerfile */
+                                  false, /* trimstat_on */
+                                  0, /* maxmat */
+                                  chainarguments,
+                                  diagband_statistics_arg,
+                                  extp);
+  had_err = gt_diagbandseed_run(info, dbseqranges, queryseqranges, &pick, err);
+
+  gt_diagbandseed_info_delete(info);
+  gt_sequence_parts_info_delete(queryseqranges);
+  gt_sequence_parts_info_delete(dbseqranges);
+  gt_diagbandseed_extend_params_delete(extp);
+  gt_str_delete(diagband_statistics_arg);
+  gt_str_delete(chainarguments);
+  return had_err;
+}
+
+/* encode the queries in memory over the alphabet of the database, their ids
+   (the descriptions up to the first blank) are appended to <queryids> */
+static GtEncseq *gt_condenseq_seedextend_read_queries(GtStrArray *queryids,
+                                                      const char *querypath,
+                                                      GtAlphabet *alphabet,
+                                                      GtError *err)
+{
+  GtEncseq *queryencseq = NULL;
+  GtEncseqBuilder *eb;
+  GtSeqIterator *seqit;
+  GtStrArray *filenametab = gt_str_array_new();
+  int had_err = 0;
+
+  gt_str_array_add_cstr(filenametab, querypath);
+  seqit = gt_seq_iterator_sequence_buffer_new(filenametab, err);
+  if (seqit == NULL)
+    had_err = -1;
+  if (!had_err) {
+    const GtUchar *sequence;
+    char *description;
+    GtUword len;
+    int ret;
+
+    eb = gt_encseq_builder_new(alphabet);
+    gt_encseq_builder_enable_multiseq_support(eb);
+    gt_seq_iterator_set_symbolmap(seqit, gt_alphabet_symbolmap(alphabet));
+    while ((ret = gt_seq_iterator_next(seqit, &sequence, &len, &description,
+                                       err)) == 1) {
+      gt_str_array_add_cstr_nt(queryids, description,
+                               strcspn(description, " \t"));
+      gt_encseq_builder_add_encoded_own(eb, sequence, len, NULL);
+    }
+    if (ret < 0)
+      had_err = -1;
+    if (!had_err && gt_str_array_size(queryids) == 0) {
+      gt_error_set(err, "query file %s contains no sequences", querypath);
+      had_err = -1;
+    }
+    if (!had_err) {
+      queryencseq = gt_encseq_builder_build(eb, err);
+    }
+    gt_encseq_builder_delete(eb);
+  }
+  gt_seq_iterator_delete(seqit);
+  gt_str_array_delete(filenametab);
+  return queryencseq;
+}
+
+static int gt_condenseq_seedextend_add_range(void *data,
+                                             GtUword seqnum,
+                                             GtRange seqrange,
+                                             GT_UNUSED GtError *err)
+{
+  GtArrayGtCondenseqSeedextendRange *ranges = data;
+  GtCondenseqSeedextendRange *range;
+
+  gt_error_check(err);
+  GT_GETNEXTFREEINARRAY(range, ranges, GtCondenseqSeedextendRange, 256);
+  range->range = seqrange;
+  range->seqnum = seqnum;
+  return 0;
+}
+
+static int gt_condenseq_seedextend_range_compare(const void *a, const void *b,
+                                                 GT_UNUSED void *data)
+{
+  const GtCondenseqSeedextendRange *rangeA = a,
+                                   *rangeB = b;
+
+  if (rangeA->seqnum != rangeB->seqnum)
+    return rangeA->seqnum < rangeB->seqnum ? -1 : 1;
+  return gt_range_compare(&rangeA->range, &rangeB->range);
+}
+
+static int gt_condenseq_seedextend_hit_compare(const void *a, const void *b,
+                                               GT_UNUSED void *data)
+{
+  const GtCondenseqSeedextendHit *hitA = a,
+                                 *hitB = b;
+  GtUword startA, startB;
+
+  if (hitA->queryseqnum != hitB->queryseqnum)
+    return hitA->queryseqnum < hitB->queryseqnum ? -1 : 1;
+  if (hitA->dbseqnum != hitB->dbseqnum)
+    return hitA->dbseqnum < hitB->dbseqnum ? -1 : 1;
+  if (hitA->dbstart != hitB->dbstart)
+    return hitA->dbstart < hitB->dbstart ? -1 : 1;
+  if (hitA->reverse != hitB->reverse)
+    return hitA->reverse ? 1 : -1;
+  startA = gt_condenseq_seedextend_querystart_fwd(hitA);
+  startB = gt_condenseq_seedextend_querystart_fwd(hitB);
+  if (startA != startB)
+    return startA < startB ? -1 : 1;
+  if (hitA->dblen != hitB->dblen)
+    return hitA->dblen < hitB->dblen ? -1 : 1;
+  if (hitA->querylen != hitB->querylen)
+    return hitA->querylen < hitB->querylen ? -1 : 1;
+  return 0;
+}
+
+/* expand the coarse hits on the uniques to all ranges of the original
+   sequences they are part of, by following the edit scripts of the links. The
+   ranges are extended by the parts of the query not covered by the hit plus
+   half of the average query length. Overlapping ranges are joined. */
+static int gt_condenseq_seedextend_expand_hits(
+                                   GtArrayGtCondenseqSeedextendRange *ranges,
+                                   GtCondenseq *ces,
+                                   const GtArrayGtCondenseqSeedextendHit *hits,
+                                   GtUword avg_querylen,
+                                   GtError *err)
+{
+  GtUword idx, joined = 0;
+  int had_err = 0;
+
+  for (idx = 0; !had_err && idx < hits->nextfreeGtCondenseqSeedextendHit;
+       idx++) {
+    const GtCondenseqSeedextendHit *hit
+      = hits->spaceGtCondenseqSeedextendHit + idx;
+    GtRange urange;
+
+    urange.start = hit->dbstart;
+    urange.end = hit->dbstart + hit->dblen - 1;
+    if (gt_condenseq_each_redundant_range(ces, hit->dbseqnum, urange,
+                                          hit->querystart +
+                                            GT_DIV2(avg_querylen),
+                                          hit->query_seqlen - hit->querystart -
+                                            hit->querylen +
+                                            GT_DIV2(avg_querylen),
+                                          gt_condenseq_seedextend_add_range,
+                                          ranges, err) == 0)
+      had_err = -1;
+  }
+  if (!had_err && ranges->nextfreeGtCondenseqSeedextendRange > 0) {
+    GtCondenseqSeedextendRange *space = ranges->spaceGtCondenseqSeedextendRange;
+
+    gt_qsort_r(space, (size_t) ranges->nextfreeGtCondenseqSeedextendRange,
+               sizeof *space, NULL, gt_condenseq_seedextend_range_compare);
+    for (idx = 1; idx < ranges->nextfreeGtCondenseqSeedextendRange; idx++) {
+      GtCondenseqSeedextendRange *last = space + idx - 1 - joined;
+      if (space[idx].seqnum == last->seqnum &&
+          gt_range_overlap(&space[idx].range, &last->range)) {
+        last->range = gt_range_join(&last->range, &space[idx].range);
+        joined++;
+      } else {
+        space[idx - joined] = space[idx];
+      }
+    }
+    ranges->nextfreeGtCondenseqSeedextendRange -= joined;
+  }
+  gt_log_log("joined " GT_WU " ranges", joined);
+  return had_err;
+}
+
+/* the ranges are extracted by all threads, range <i> to <buffer> at
+   <offsets[i]> */
+typedef struct {
+  const GtCondenseq                       *ces;
+  const GtArrayGtCondenseqSeedextendRange *ranges;
+  GtMutex                                 *mutex;
+  GtUchar                                 *buffer;
+  GtUword                                 *offsets,
+                                           nextrange;
+} GtCondenseqSeedextendExtractInfo;
+
+static void *gt_condenseq_seedextend_extract_thread(void *data)
+{
+  GtCondenseqSeedextendExtractInfo *info = data;
+
+  while (true) {
+    GtRange range;
+    GtUword idx;
+    gt_mutex_lock(info->mutex);
+    idx = info->nextrange;
+    if (idx < info->ranges->nextfreeGtCondenseqSeedextendRange)
+      info->nextrange++;
+    gt_mutex_unlock(info->mutex);
+    if (idx == info->ranges->nextfreeGtCondenseqSeedextendRange)
+      break;
+    range = info->ranges->spaceGtCondenseqSeedextendRange[idx].range;
+    gt_condenseq_extract_encoded_range_to_buffer(info->ces, range,
+                                                 info->buffer +
+                                                 info->offsets[idx]);
+  }
+  return NULL;
+}
+
+/* the ranges to be searched in the fine search as in memory encoded
+   sequences, sequence number <i> corresponding to range <i> */
+static GtEncseq *gt_condenseq_seedextend_extract_ranges(
+                             const GtCondenseq *ces,
+                             const GtArrayGtCondenseqSeedextendRange *ranges,
+                             GtError *err)
+{
+  GtAlphabet *alphabet = gt_condenseq_alphabet(ces);
+  GtEncseqBuilder *eb = gt_encseq_builder_new(alphabet);
+  GtEncseq *fineencseq = NULL;
+  GtCondenseqSeedextendExtractInfo info;
+  const GtUword numofranges = ranges->nextfreeGtCondenseqSeedextendRange;
+  GtUword idx, totallength = 0;
+  int had_err = 0;
+
+  info.offsets = gt_malloc(sizeof (*info.offsets) * numofranges);
+  for (idx = 0; idx < numofranges; idx++) {
+    info.offsets[idx] = totallength;
+    totallength +=
+      gt_range_length(&ranges->spaceGtCondenseqSeedextendRange[idx].range);
+  }
+  info.buffer = gt_malloc(sizeof (*info.buffer) * totallength);
+  info.ces = ces;
+  info.ranges = ranges;
+  info.mutex = gt_mutex_new();
+  info.nextrange = 0;
+  if (gt_jobs > 1U && numofranges > 1UL)
+    had_err = gt_multithread(gt_condenseq_seedextend_extract_thread, &info,
+                             err);
+  else
+    (void) gt_condenseq_seedextend_extract_thread(&info);
+
+  if (!had_err) {
+    gt_encseq_builder_enable_multiseq_support(eb);
+    for (idx = 0; idx < numofranges; idx++) {
+      const GtRange range = ranges->spaceGtCondenseqSeedextendRange[idx].range;
+      gt_encseq_builder_add_encoded_own(eb, info.buffer + info.offsets[idx],
+                                        gt_range_length(&range), NULL);
+    }
+    fineencseq = gt_encseq_builder_build(eb, err);
+  }
+  gt_mutex_delete(info.mutex);
+  gt_free(info.buffer);
+  gt_free(info.offsets);
+  gt_encseq_builder_delete(eb);
+  gt_alphabet_delete(alphabet);
+  return fineencseq;
+}
+
+static void gt_condenseq_seedextend_show_hits(
+                             const GtCondenseqSeedextendArguments *arguments,
+                             const GtCondenseq *ces,
+                             const GtStrArray *queryids,
+                             const GtArrayGtCondenseqSeedextendRange *ranges,
+                             const GtArrayGtCondenseqSeedextendHit *hits)
+{
+  GtUword idx;
+
+  for (idx = 0; idx < hits->nextfreeGtCondenseqSeedextendHit; idx++) {
+    const GtCondenseqSeedextendHit *hit
+      = hits->spaceGtCondenseqSeedextendHit + idx;
+    const GtCondenseqSeedextendRange *range
+      = ranges->spaceGtCondenseqSeedextendRange + hit->dbseqnum;
+    const GtUword querystart = gt_condenseq_seedextend_querystart_fwd(hit),
+                  sstart = range->range.start + hit->dbstart -
+                           gt_condenseq_seqstartpos(ces, range->seqnum),
+                  send = sstart + hit->dblen - 1;
+    GtUword db_name_len;
+    const char *db_name = gt_condenseq_description(ces, &db_name_len,
+                                                   range->seqnum);
+
+    /* output like
+       blast -outfmt 6 'qseqid sseqid pident length qstart qend sstart send
+       evalue bitscore', positions are 1-based, matches on the reverse strand
+       have sstart > send */
+    gt_file_xprintf(arguments->outfp,
+                    "%s\t%.*s\t%.2f\t" GT_WU "\t" GT_WU "\t" GT_WU "\t"
+                    GT_WU "\t" GT_WU "\t%g\t%.3f\n",
+                    gt_str_array_get(queryids, hit->queryseqnum),
+                    (int) db_name_len, db_name,
+                    hit->identity,
+                    hit->alignment_length,
+                    querystart + 1,
+                    querystart + hit->querylen,
+                    (hit->reverse ? send : sstart) + 1,
+                    (hit->reverse ? sstart : send) + 1,
+                    hit->evalue,
+                    hit->bit_score);
+  }
+}
+
+static int gt_condenseq_seedextend_runner(GT_UNUSED int argc,
+                                          GT_UNUSED const char **argv,
+                                          GT_UNUSED int parsed_args,
+                                          void *tool_arguments,
+                                          GtError *err)
+{
+  GtCondenseqSeedextendArguments *arguments = tool_arguments;
+  GtCondenseq *ces = NULL;
+  GtEncseq *queryencseq = NULL,
+           *fineencseq = NULL;
+  GtLogger *logger;
+  GtStrArray *queryids = gt_str_array_new();
+  GtTimer *timer = NULL;
+  GtCondenseqSeedextendHits hits;
+  GtArrayGtCondenseqSeedextendRange ranges;
+  unsigned int seedlength = 0;
+  int had_err = 0;
+
+  gt_error_check(err);
+  gt_assert(arguments != NULL);
+
+  GT_INITARRAY(&hits.hits, GtCondenseqSeedextendHit);
+  hits.mutex = gt_mutex_new();
+  GT_INITARRAY(&ranges, GtCondenseqSeedextendRange);
+  logger = gt_logger_new(gt_condenseq_search_arguments_verbose(arguments->csa),
+                         GT_LOGGER_DEFLT_PREFIX, stderr);
+
+  if (gt_showtime_enabled()) {
+    timer = gt_timer_new_with_progress_description("initialization");
+    gt_timer_start(timer);
+  }
+
+  ces = gt_condenseq_search_arguments_read_condenseq(arguments->csa, logger,
+                                                     err);
+  if (ces == NULL)
+    had_err = -1;
+
+  if (!had_err) {
+    GtAlphabet *alphabet = gt_condenseq_alphabet(ces);
+    queryencseq =
+      gt_condenseq_seedextend_read_queries(queryids,
+                                           gt_str_get(arguments->querypath),
+                                           alphabet, err);
+    gt_alphabet_delete(alphabet);
+    if (queryencseq == NULL)
+      had_err = -1;
+  }
+
+  /* coarse search on the unique sequences */
+  if (!had_err) {
+    const GtEncseq *unique_es = gt_condenseq_unique_encseq(ces);
+    if (timer != NULL)
+      gt_timer_show_progress(timer, "coarse seed extend run", stderr);
+    seedlength = gt_condenseq_seedextend_seedlength(arguments->seedlength,
+                                                    unique_es, queryencseq);
+    gt_logger_log(logger, "seedlength set to %u", seedlength);
+    had_err = gt_condenseq_seedextend_run(unique_es, queryencseq, arguments,
+                                          seedlength, arguments->ceval,
+                                          &hits, err);
+  }
+  if (!had_err) {
+    gt_logger_log(logger, "coarse hits: " GT_WU,
+                  hits.hits.nextfreeGtCondenseqSeedextendHit);
+    if (hits.hits.nextfreeGtCondenseqSeedextendHit == 0) {
+      gt_error_set(err, "No hits found in coarse search");
+      had_err = -1;
+    }
+  }
+
+  /* identify the ranges of the original sequences */
+  if (!had_err) {
+    const GtUword numofqueries = gt_encseq_num_of_sequences(queryencseq),
+                  avg_querylen = (gt_encseq_total_length(queryencseq) -
+                                  (numofqueries - 1)) / numofqueries;
+    if (timer != NULL)
+      gt_timer_show_progress(timer, "identify ranges", stderr);
+    had_err = gt_condenseq_seedextend_expand_hits(&ranges, ces, &hits.hits,
+                                                  avg_querylen, err);
+  }
+  if (!had_err) {
+    gt_logger_log(logger, "ranges to extract: " GT_WU,
+                  ranges.nextfreeGtCondenseqSeedextendRange);
+    if (timer != NULL)
+      gt_timer_show_progress(timer, "extract ranges", stderr);
+    gt_condenseq_set_link_cache_size(ces, arguments->cachesize << 20);
+    fineencseq = gt_condenseq_seedextend_extract_ranges(ces, &ranges, err);
+    if (fineencseq == NULL)
+      had_err = -1;
+  }
+
+  /* fine search on the extracted ranges */
+  if (!had_err) {
+    if (timer != NULL)
+      gt_timer_show_progress(timer, "fine seed extend run", stderr);
+    hits.hits.nextfreeGtCondenseqSeedextendHit = 0;
+    had_err = gt_condenseq_seedextend_run(fineencseq, queryencseq, arguments,
+                                          gt_condenseq_seedextend_seedlength(
+                                                                 seedlength,
+                                                                 fineencseq,
+                                                                 queryencseq),
+                                          arguments->feval, &hits, err);
+  }
+  if (!had_err) {
+    gt_log_log(GT_WU " hits found",
+               hits.hits.nextfreeGtCondenseqSeedextendHit);
+    /* the order in which the threads report the hits is arbitrary */
+    if (hits.hits.nextfreeGtCondenseqSeedextendHit > 0) {
+      gt_qsort_r(hits.hits.spaceGtCondenseqSeedextendHit,
+                 (size_t) hits.hits.nextfreeGtCondenseqSeedextendHit,
+                 sizeof *hits.hits.spaceGtCondenseqSeedextendHit, NULL,
+                 gt_condenseq_seedextend_hit_compare);
+    }
+    gt_condenseq_seedextend_show_hits(arguments, ces, queryids, &ranges,
+                                      &hits.hits);
+  }
+
+  if (!had_err && timer != NULL)
+    gt_timer_show_progress_final(timer, stderr);
+  gt_timer_delete(timer);
+
+  gt_encseq_delete(fineencseq);
+  gt_encseq_delete(queryencseq);
+  gt_condenseq_delete(ces);
+  GT_FREEARRAY(&ranges, GtCondenseqSeedextendRange);
+  GT_FREEARRAY(&hits.hits, GtCondenseqSeedextendHit);
+  gt_mutex_delete(hits.mutex);
+  gt_str_array_delete(queryids);
+  gt_logger_delete(logger);
+  return had_err;
+}
+
+GtTool* gt_condenseq_seedextend(void)
+{
+  return gt_tool_new(gt_condenseq_seedextend_arguments_new,
+                     gt_condenseq_seedextend_arguments_delete,
+                     gt_condenseq_seedextend_option_parser_new,
+                     NULL,
+                     gt_condenseq_seedextend_runner);
+}
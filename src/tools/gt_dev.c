@@ -24,6 +24,7 @@
 #include "tools/gt_consensus_sa.h"
 #include "tools/gt_extracttarget.h"
 #include "tools/gt_gdiffcalc.h"
+#include "tools/gt_gff3bench.h"
 #include "tools/gt_guessprot.h"
 #include "tools/gt_idxlocali.h"
 #include "tools/gt_kmer_database.h"
@@ -62,6 +63,7 @@ static void* gt_dev_arguments_new(void)
   gt_toolbox_add_tool(dev_toolbox, "consensus_sa", gt_consensus_sa_tool());
   gt_toolbox_add_tool(dev_toolbox, "extracttarget", gt_extracttarget());
   gt_toolbox_add_tool(dev_toolbox, "gdiffcalc", gt_gdiffcalc());
+  gt_toolbox_add_tool(dev_toolbox, "gff3bench", gt_gff3bench());
   gt_toolbox_add_tool(dev_toolbox, "idxlocali", gt_idxlocali());
   gt_toolbox_add_tool(dev_toolbox, "kmer_database", gt_kmer_database());
   gt_toolbox_add_tool(dev_toolbox, "linspace_align", gt_linspace_align());
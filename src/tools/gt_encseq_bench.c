@@ -27,7 +27,7 @@
 
 typedef struct
 {
-  GtUword ccext;
+  GtUword ccext, rangeext, rangelen, seqnumext;
   bool sortlenprepare, verbose;
 } GtEncseqBenchArguments;
 
@@ -64,6 +64,26 @@ static GtOptionParser* gt_encseq_bench_option_parser_new(void *tool_arguments)
                                &arguments->ccext, 0UL);
   gt_option_parser_add_option(op, option);
 
+  option = gt_option_new_uword("rangeext", "specify number of random range "
+                                           "extractions, each performed "
+                                           "character by character and in "
+                                           "bulk",
+                               &arguments->rangeext, 0UL);
+  gt_option_parser_add_option(op, option);
+
+  option = gt_option_new_uword_min("rangelen", "specify length of ranges "
+                                               "extracted with option "
+                                               "-rangeext",
+                                   &arguments->rangelen, 1000UL, 1UL);
+  gt_option_parser_add_option(op, option);
+
+  option = gt_option_new_uword("seqnumext", "specify number of random "
+                                            "sequence number and sequence "
+                                            "start lookups, each performed "
+                                            "with and without a seqnum index",
+                               &arguments->seqnumext, 0UL);
+  gt_option_parser_add_option(op, option);
+
   option = gt_option_new_bool("solepr", "prepare data structure for sequences "
                                          "ordered by their length",
                                &arguments->sortlenprepare, false);
@@ -102,6 +122,137 @@ static void gt_bench_character_extractions(const GtEncseq *encseq,
   }
 }
 
+static void gt_bench_range_extractions(const GtEncseq *encseq,
+                                       GtUword rangeext,
+                                       GtUword rangelen)
+{
+  GtUword idx, *startpos, ccsum = 0, bulksum = 0,
+          totallength = gt_encseq_total_length(encseq);
+  GtUchar *buffer;
+  GtEncseqReader *esr;
+  GtTimer *timer = NULL;
+
+  if (rangelen > totallength)
+    rangelen = totallength;
+  startpos = gt_malloc(sizeof (*startpos) * rangeext);
+  for (idx = 0; idx < rangeext; idx++)
+    startpos[idx] = gt_rand_max(totallength - rangelen);
+  buffer = gt_malloc(sizeof (*buffer) * rangelen);
+  esr = gt_encseq_create_reader_with_readmode(encseq, GT_READMODE_FORWARD, 0);
+  if (gt_showtime_enabled()) {
+    timer = gt_timer_new_with_progress_description("run per-character range "
+                                                   "extractions");
+    gt_timer_start(timer);
+  }
+  for (idx = 0; idx < rangeext; idx++) {
+    GtUword pos;
+
+    gt_encseq_reader_reinit_with_readmode(esr, encseq, GT_READMODE_FORWARD,
+                                          startpos[idx]);
+    for (pos = 0; pos < rangelen; pos++)
+      ccsum += (GtUword) gt_encseq_reader_next_encoded_char(esr);
+  }
+  if (timer != NULL)
+    gt_timer_show_progress(timer, "run bulk range extractions", stdout);
+  for (idx = 0; idx < rangeext; idx++) {
+    GtUword pos;
+
+    gt_encseq_extract_encoded_with_reader(esr, encseq, buffer, startpos[idx],
+                                          startpos[idx] + rangelen - 1);
+    for (pos = 0; pos < rangelen; pos++)
+      bulksum += (GtUword) buffer[pos];
+  }
+  printf("charsum="GT_WU"\n",ccsum);
+  printf("rangesum="GT_WU"\n",bulksum);
+  if (timer != NULL) {
+    gt_timer_show_progress_final(timer, stdout);
+    gt_timer_delete(timer);
+  }
+  /* check the bulk extraction against the per-character extraction */
+  for (idx = 0; idx < rangeext; idx++) {
+    GtUword pos;
+
+    gt_encseq_extract_encoded_with_reader(esr, encseq, buffer, startpos[idx],
+                                          startpos[idx] + rangelen - 1);
+    gt_encseq_reader_reinit_with_readmode(esr, encseq, GT_READMODE_FORWARD,
+                                          startpos[idx]);
+    for (pos = 0; pos < rangelen; pos++) {
+      GtUchar cc = gt_encseq_reader_next_encoded_char(esr);
+      if (cc != buffer[pos]) {
+        fprintf(stderr,"position "GT_WU": bulk extraction delivers %u, "
+                       "character extraction delivers %u\n",
+                startpos[idx] + pos,(unsigned int) buffer[pos],
+                (unsigned int) cc);
+        exit(GT_EXIT_PROGRAMMING_ERROR);
+      }
+    }
+  }
+  gt_encseq_reader_delete(esr);
+  gt_free(buffer);
+  gt_free(startpos);
+}
+
+static GtUword gt_bench_seqnum_run(const GtEncseq *encseq,
+                                   const GtUword *positions,
+                                   GtUword seqnumext,
+                                   GtUword *seqnums)
+{
+  GtUword idx, seqnumsum = 0,
+          numofsequences = gt_encseq_num_of_sequences(encseq);
+
+  for (idx = 0; idx < seqnumext; idx++) {
+    seqnums[idx] = gt_encseq_seqnum(encseq, positions[idx]);
+    seqnumsum += seqnums[idx];
+    seqnumsum += gt_encseq_seqstartpos(encseq, positions[idx] % numofsequences);
+  }
+  return seqnumsum;
+}
+
+static void gt_bench_seqnum_lookups(const GtEncseq *encseq,
+                                    const GtEncseq *indexed_encseq,
+                                    GtUword seqnumext)
+{
+  GtUword idx, *positions, *seqnums, *indexed_seqnums, seqnumsum, indexedsum,
+          totallength = gt_encseq_total_length(encseq);
+  GtTimer *timer = NULL;
+
+  positions = gt_malloc(sizeof (*positions) * seqnumext);
+  seqnums = gt_malloc(sizeof (*seqnums) * seqnumext);
+  indexed_seqnums = gt_malloc(sizeof (*indexed_seqnums) * seqnumext);
+  for (idx = 0; idx < seqnumext; idx++)
+    positions[idx] = gt_rand_max(totallength - 1);
+  if (gt_showtime_enabled()) {
+    timer = gt_timer_new_with_progress_description("run seqnum lookups");
+    gt_timer_start(timer);
+  }
+  seqnumsum = gt_bench_seqnum_run(encseq, positions, seqnumext, seqnums);
+  if (timer != NULL)
+    gt_timer_show_progress(timer, "run seqnum lookups with index", stdout);
+  indexedsum = gt_bench_seqnum_run(indexed_encseq, positions, seqnumext,
+                                   indexed_seqnums);
+  printf("seqnumsum="GT_WU"\n",seqnumsum);
+  printf("indexedsum="GT_WU"\n",indexedsum);
+  if (timer != NULL) {
+    gt_timer_show_progress_final(timer, stdout);
+    gt_timer_delete(timer);
+  }
+  for (idx = 0; idx < seqnumext; idx++) {
+    if (seqnums[idx] != indexed_seqnums[idx]) {
+      fprintf(stderr,"position "GT_WU": seqnum index delivers "GT_WU", "
+                     "ssptab delivers "GT_WU"\n",
+              positions[idx],indexed_seqnums[idx],seqnums[idx]);
+      exit(GT_EXIT_PROGRAMMING_ERROR);
+    }
+  }
+  if (seqnumsum != indexedsum) {
+    fprintf(stderr,"sequence start positions differ with seqnum index\n");
+    exit(GT_EXIT_PROGRAMMING_ERROR);
+  }
+  gt_free(positions);
+  gt_free(seqnums);
+  gt_free(indexed_seqnums);
+}
+
 typedef struct
 {
   GtUword minlength, maxlength, numofdifferentseqlen, *seqlenseppos,
@@ -327,6 +478,26 @@ static int gt_encseq_bench_runner(GT_UNUSED int argc, const char **argv,
       gt_logger_log(logger,"perform character extractions");
       gt_bench_character_extractions(encseq,arguments->ccext);
     }
+    if (!had_err && arguments->rangeext > 0) {
+      gt_logger_log(logger,"perform range extractions");
+      gt_bench_range_extractions(encseq,arguments->rangeext,
+                                 arguments->rangelen);
+    }
+    if (!had_err && arguments->seqnumext > 0) {
+      GtEncseqLoader *indexed_loader = gt_encseq_loader_new();
+      GtEncseq *indexed_encseq;
+
+      gt_logger_log(logger,"perform seqnum lookups");
+      gt_encseq_loader_enable_seqnum_index(indexed_loader);
+      indexed_encseq = gt_encseq_loader_load(indexed_loader, indexname, err);
+      if (indexed_encseq == NULL)
+        had_err = -1;
+      else {
+        gt_bench_seqnum_lookups(encseq,indexed_encseq,arguments->seqnumext);
+        gt_encseq_delete(indexed_encseq);
+      }
+      gt_encseq_loader_delete(indexed_loader);
+    }
   }
   gt_encseq_delete(encseq);
   gt_encseq_loader_delete(encseq_loader);
@@ -21,13 +21,16 @@
 #include "core/chardef_api.h"
 #include "core/encseq_api.h"
 #include "core/encseq_options.h"
+#include "core/encseq_parallel.h"
 #include "core/fasta_separator.h"
 #include "core/log_api.h"
 #include "core/readmode.h"
+#include "core/str_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "core/warning_api.h"
 #include "core/xansi_api.h"
+#include "extended/qualtab.h"
 #include "tools/gt_encseq_decode.h"
 
 typedef struct {
@@ -74,7 +77,7 @@ static GtOptionParser* gt_encseq_decode_option_parser_new(void *tool_arguments)
            *optionmode;
   GtEncseqDecodeArguments *arguments =
                                       (GtEncseqDecodeArguments*) tool_arguments;
-  static const char *modes[] = {"fasta", "concat", NULL};
+  static const char *modes[] = {"fasta", "fastq", "concat", NULL};
 
   /* init */
   op = gt_option_parser_new("(sequence_file|indexname)",
@@ -111,7 +114,9 @@ static GtOptionParser* gt_encseq_decode_option_parser_new(void *tool_arguments)
   /* -output */
   optionmode = gt_option_new_choice("output",
                                     "specify output format "
-                                    "(choose from fasta|concat)",
+                                    "(choose from fasta|fastq|concat), "
+                                    "fastq requires qualities stored with "
+                                    "'gt encseq encode -qualities'",
                                     arguments->mode,
                                     modes[0],
                                     modes);
@@ -160,9 +165,15 @@ int gt_encseq_decode_arguments_check(GT_UNUSED int rest_argc,
   }
   if (!had_err && (args->seqrng.start != GT_UNDEF_UWORD ||
         args->seqrng.end != GT_UNDEF_UWORD || args->seq != GT_UNDEF_UWORD)
-        && strcmp(gt_str_get(args->mode), "fasta") != 0) {
+        && strcmp(gt_str_get(args->mode), "concat") == 0) {
     gt_error_set(err, "'-seq' and '-seqrange' can only be used with the "
-                      "'-output fasta' option");
+                      "'-output fasta' or '-output fastq' option");
+    had_err = -1;
+  }
+  if (!had_err && strcmp(gt_str_get(args->mode), "fastq") == 0
+        && args->rm != GT_READMODE_FORWARD) {
+    gt_error_set(err, "'-output fastq' can only be used with the forward "
+                      "read mode");
     had_err = -1;
   }
   if (!had_err && (args->rng.start != GT_UNDEF_UWORD ||
@@ -175,19 +186,129 @@ int gt_encseq_decode_arguments_check(GT_UNUSED int rest_argc,
   return had_err;
 }
 
+typedef struct {
+  const GtEncseq *encseq;
+  const GtQualTab *qualtab;
+  GtReadmode readmode;
+  bool has_desc;
+} GtEncseqDecodeInfo;
+
+typedef struct {
+  GtStr *buffer;
+  GtQualTabReader *qualtab_reader;
+  GtUchar *qualities;
+  GtUword allocatedqualities;
+} GtEncseqDecodeChunk;
+
+static void* decode_chunk_new(void *data)
+{
+  GtEncseqDecodeInfo *info = data;
+  GtEncseqDecodeChunk *chunk = gt_calloc((size_t) 1, sizeof (*chunk));
+  chunk->buffer = gt_str_new();
+  if (info->qualtab != NULL)
+    chunk->qualtab_reader = gt_qualtab_reader_new(info->qualtab);
+  return chunk;
+}
+
+/* appends the qualities of sequence <seqnum> as the last two lines of a FASTQ
+   entry to the buffer of <chunk> */
+static int decode_qualities(GtEncseqDecodeChunk *chunk,
+                            const GtQualTab *qualtab, GtUword seqnum,
+                            GtUword seqlength, GtError *err)
+{
+  if (gt_qualtab_seqlength(qualtab, seqnum) != seqlength) {
+    gt_error_set(err, "sequence "GT_WU" has "GT_WU" quality values but length "
+                 GT_WU, seqnum, gt_qualtab_seqlength(qualtab, seqnum),
+                 seqlength);
+    return -1;
+  }
+  if (seqlength > chunk->allocatedqualities) {
+    chunk->allocatedqualities = seqlength;
+    chunk->qualities = gt_realloc(chunk->qualities,
+                                  sizeof (*chunk->qualities) * seqlength);
+  }
+  if (gt_qualtab_reader_extract(chunk->qualtab_reader, chunk->qualities,
+                                seqnum, err) != 0)
+    return -1;
+  gt_str_append_cstr(chunk->buffer, "+\n");
+  gt_str_append_cstr_nt(chunk->buffer, (const char*) chunk->qualities,
+                        seqlength);
+  gt_str_append_char(chunk->buffer, '\n');
+  return 0;
+}
+
+/* appends sequence <seqnum> in FASTA format, or in FASTQ format if qualities
+   are given, to the buffer of <chunk> */
+static int decode_seq(GtEncseqReader *esr, GtUword seqnum,
+                      GT_UNUSED GtUword seqstartpos, GtUword seqlength,
+                      void *chunkptr, void *data, GtError *err)
+{
+  GtEncseqDecodeInfo *info = data;
+  GtEncseqDecodeChunk *chunk = chunkptr;
+  GtStr *buffer = chunk->buffer;
+  GtUword desclen, j;
+  char buf[BUFSIZ];
+  const char *desc;
+
+  if (info->has_desc) {
+    GtUword descseqnum = seqnum;
+    if (GT_ISDIRREVERSE(info->readmode))
+      descseqnum = gt_encseq_num_of_sequences(info->encseq) - 1 - seqnum;
+    desc = gt_encseq_description(info->encseq, &desclen, descseqnum);
+  } else {
+    (void) snprintf(buf, BUFSIZ, "sequence "GT_WU"", seqnum);
+    desclen = strlen(buf);
+    desc = buf;
+  }
+  gt_str_append_char(buffer, info->qualtab != NULL ? '@'
+                                                   : GT_FASTA_SEPARATOR);
+  gt_str_append_cstr_nt(buffer, desc, desclen);
+  gt_str_append_char(buffer, '\n');
+  for (j = 0; j < seqlength; j += BUFSIZ) {
+    GtUword k, len = seqlength - j < (GtUword) BUFSIZ ? seqlength - j
+                                                      : (GtUword) BUFSIZ;
+    for (k = 0; k < len; k++)
+      buf[k] = gt_encseq_reader_next_decoded_char(esr);
+    gt_str_append_cstr_nt(buffer, buf, len);
+  }
+  gt_str_append_char(buffer, '\n');
+  if (info->qualtab != NULL)
+    return decode_qualities(chunk, info->qualtab, seqnum, seqlength, err);
+  return 0;
+}
+
+static int decode_chunk_collect(void *chunkptr, GT_UNUSED void *data,
+                                GT_UNUSED GtError *err)
+{
+  GtEncseqDecodeChunk *chunk = chunkptr;
+  gt_xfwrite(gt_str_get(chunk->buffer), 1, gt_str_length(chunk->buffer),
+             stdout);
+  return 0;
+}
+
+static void decode_chunk_delete(void *chunkptr)
+{
+  GtEncseqDecodeChunk *chunk = chunkptr;
+  gt_str_delete(chunk->buffer);
+  gt_qualtab_reader_delete(chunk->qualtab_reader);
+  gt_free(chunk->qualities);
+  gt_free(chunk);
+}
+
 static int output_sequence(GtEncseq *encseq, GtEncseqDecodeArguments *args,
                            const char *filename, GtError *err)
 {
   GtUword i, j, sfrom, sto;
   int had_err = 0;
-  bool has_desc;
+  bool has_desc, fastq;
   GtEncseqReader *esr;
   gt_assert(encseq);
 
   if (!(has_desc = gt_encseq_has_description_support(encseq)))
     gt_warning("Missing description support for file %s", filename);
 
-  if (strcmp(gt_str_get(args->mode), "fasta") == 0) {
+  fastq = strcmp(gt_str_get(args->mode), "fastq") == 0;
+  if (fastq || strcmp(gt_str_get(args->mode), "fasta") == 0) {
     /* specify a single sequence to extract */
     if (args->seq != GT_UNDEF_UWORD) {
       if (args->seq >= gt_encseq_num_of_sequences(encseq)) {
@@ -219,6 +340,36 @@ static int output_sequence(GtEncseq *encseq, GtEncseqDecodeArguments *args,
       sfrom = 0;
       sto = gt_encseq_num_of_sequences(encseq);
     }
+    if (fastq || !args->singlechars) {
+      /* decode chunks of sequences in parallel, output them in order */
+      GtEncseqDecodeInfo info;
+      GtQualTab *qualtab = NULL;
+      if (fastq) {
+        if (!(qualtab = gt_qualtab_new(filename, err)))
+          return -1;
+        if (gt_qualtab_num_of_sequences(qualtab)
+              != gt_encseq_num_of_sequences(encseq)) {
+          gt_error_set(err, "quality table of %s contains "GT_WU" instead of "
+                       GT_WU" sequences", filename,
+                       gt_qualtab_num_of_sequences(qualtab),
+                       gt_encseq_num_of_sequences(encseq));
+          gt_qualtab_delete(qualtab);
+          return -1;
+        }
+      }
+      info.encseq = encseq;
+      info.qualtab = qualtab;
+      info.readmode = args->rm;
+      info.has_desc = has_desc;
+      had_err = gt_encseq_parallel_foreach_seq(encseq, args->rm, sfrom,
+                                               sto - 1, decode_chunk_new,
+                                               decode_seq,
+                                               decode_chunk_collect,
+                                               decode_chunk_delete, &info,
+                                               err);
+      gt_qualtab_delete(qualtab);
+      return had_err;
+    }
     for (i = sfrom; i < sto; i++) {
       GtUword desclen, startpos, len;
       char buf[BUFSIZ];
@@ -257,21 +408,11 @@ static int output_sequence(GtEncseq *encseq, GtEncseqDecodeArguments *args,
       gt_xfputc(GT_FASTA_SEPARATOR, stdout);
       gt_xfwrite(desc, 1, desclen, stdout);
       gt_xfputc('\n', stdout);
-      /* XXX: make this more efficient by writing in a buffer first and then
-         showing the result */
-      if (args->singlechars) {
-        for (j = 0; j < len; j++) {
-           gt_xfputc(gt_encseq_get_decoded_char(encseq,
-                                                startpos + j,
-                                                args->rm),
-                     stdout);
-        }
-      } else {
-        esr = gt_encseq_create_reader_with_readmode(encseq, args->rm, startpos);
-        for (j = 0; j < len; j++) {
-           gt_xfputc(gt_encseq_reader_next_decoded_char(esr), stdout);
-        }
-        gt_encseq_reader_delete(esr);
+      for (j = 0; j < len; j++) {
+         gt_xfputc(gt_encseq_get_decoded_char(encseq,
+                                              startpos + j,
+                                              args->rm),
+                   stdout);
       }
       gt_xfputc('\n', stdout);
     }
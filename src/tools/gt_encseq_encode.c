@@ -25,12 +25,14 @@
 #include "core/logger_api.h"
 #include "core/str_array_api.h"
 #include "core/unused_api.h"
+#include "extended/qualtab.h"
 #include "tools/gt_encseq_encode.h"
 
 typedef struct {
   GtEncseqOptions *eopts;
   bool showstats,
        no_esq_header,
+       qualities,
        verbose;
   GtStr *indexname;
 } GtEncseqEncodeArguments;
@@ -79,6 +81,14 @@ static GtOptionParser* gt_encseq_encode_option_parser_new(void *tool_arguments)
   gt_option_is_development_option(option);
   gt_option_parser_add_option(op, option);
 
+  /* -qualities */
+  option = gt_option_new_bool("qualities",
+                              "store the qualities of FASTQ input in a "
+                              "compressed table (" GT_QUALTABFILESUFFIX ")",
+                              &arguments->qualities,
+                              false);
+  gt_option_parser_add_option(op, option);
+
   /* encoded sequence options */
   arguments->eopts = gt_encseq_options_register_encoding(op,
                                                          arguments->indexname,
@@ -93,12 +103,21 @@ static GtOptionParser* gt_encseq_encode_option_parser_new(void *tool_arguments)
   return op;
 }
 
+static int encode_sequence_files_add_qualities(const GtUchar *qualities,
+                                              GtUword length, void *data,
+                                              GtError *err)
+{
+  return gt_qualtab_writer_add((GtQualTabWriter*) data, qualities, length,
+                               err);
+}
+
 static int encode_sequence_files(GtStrArray *infiles, GtEncseqOptions *opts,
                                  const char *indexname, bool verbose,
-                                 bool esq_no_header,
+                                 bool esq_no_header, bool qualities,
                                  GtError *err)
 {
   GtEncseqEncoder *encseq_encoder;
+  GtQualTabWriter *qualtab_writer = NULL;
   GtLogger *logger;
   int had_err = 0;
   gt_error_check(err);
@@ -113,8 +132,21 @@ static int encode_sequence_files(GtStrArray *infiles, GtEncseqOptions *opts,
     {
       gt_encseq_encoder_disable_esq_header(encseq_encoder);
     }
-    had_err = gt_encseq_encoder_encode(encseq_encoder, infiles, indexname, err);
+    if (qualities) {
+      qualtab_writer = gt_qualtab_writer_new(indexname, err);
+      if (qualtab_writer == NULL)
+        had_err = -1;
+      else
+        gt_encseq_encoder_set_quality_func(encseq_encoder,
+                                          encode_sequence_files_add_qualities,
+                                          qualtab_writer);
+    }
   }
+  if (!had_err)
+    had_err = gt_encseq_encoder_encode(encseq_encoder, infiles, indexname, err);
+  if (!had_err && qualtab_writer != NULL)
+    had_err = gt_qualtab_writer_finish(qualtab_writer, err);
+  gt_qualtab_writer_delete(qualtab_writer);
   gt_encseq_encoder_delete(encseq_encoder);
   gt_logger_delete(logger);
   return had_err;
@@ -148,6 +180,7 @@ static void show_encoded_statistics(GtStrArray *infiles, const char *indexname)
   enc_size += index_size(indexname, GT_DESTABFILESUFFIX);
   enc_size += index_size(indexname, GT_SDSTABFILESUFFIX);
   enc_size += index_size(indexname, GT_OISTABFILESUFFIX);
+  enc_size += index_size(indexname, GT_QUALTABFILESUFFIX);
   printf("encoded sequence file(s) are %.1f%% of original file size\n",
          ((double) enc_size / orig_size) * 100.0);
 }
@@ -188,6 +221,7 @@ static int gt_encseq_encode_runner(GT_UNUSED int argc, const char **argv,
                                     gt_str_get(arguments->indexname),
                                     arguments->verbose,
                                     arguments->no_esq_header,
+                                    arguments->qualities,
                                     err);
   }
 
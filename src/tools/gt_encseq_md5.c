@@ -15,7 +15,9 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <stdio.h>
 #include "core/encseq.h"
+#include "core/encseq_parallel.h"
 #include "core/ma_api.h"
 #include "core/md5_fingerprint_api.h"
 #include "core/output_file_api.h"
@@ -67,6 +69,70 @@ static GtOptionParser* gt_encseq_md5_option_parser_new(void *tool_arguments)
   return op;
 }
 
+typedef struct {
+  const GtEncseq *encseq;
+  GtFile *outfp;
+} GtEncseqMD5Info;
+
+typedef struct {
+  GtStr *buffer;
+  char *seq;
+  GtUword seqalloc;
+} GtEncseqMD5Chunk;
+
+static void* md5_chunk_new(GT_UNUSED void *data)
+{
+  GtEncseqMD5Chunk *chunk = gt_calloc(1, sizeof (*chunk));
+  chunk->buffer = gt_str_new();
+  return chunk;
+}
+
+/* appends the MD5 fingerprint of sequence <seqnum> to the buffer of
+   <chunk> */
+static int md5_seq(GtEncseqReader *esr, GtUword seqnum, GtUword seqstartpos,
+                   GtUword seqlength, void *chunk, void *data,
+                   GT_UNUSED GtError *err)
+{
+  GtEncseqMD5Info *info = data;
+  GtEncseqMD5Chunk *md5chunk = chunk;
+  char *md5str, line[64];
+
+  if (seqlength > md5chunk->seqalloc) {
+    md5chunk->seqalloc = seqlength;
+    md5chunk->seq = gt_realloc(md5chunk->seq, sizeof (char) * seqlength);
+  }
+  if (seqlength > 0) {
+    gt_encseq_extract_decoded_with_reader(esr, info->encseq, md5chunk->seq,
+                                          seqstartpos,
+                                          seqstartpos + seqlength - 1);
+  }
+  md5str = gt_md5_fingerprint(md5chunk->seq, seqlength);
+  (void) snprintf(line, sizeof (line), ""GT_WU": ", seqnum);
+  gt_str_append_cstr(md5chunk->buffer, line);
+  gt_str_append_cstr(md5chunk->buffer, md5str);
+  gt_str_append_char(md5chunk->buffer, '\n');
+  gt_free(md5str);
+  return 0;
+}
+
+static int md5_chunk_collect(void *chunk, void *data, GT_UNUSED GtError *err)
+{
+  GtEncseqMD5Info *info = data;
+  GtEncseqMD5Chunk *md5chunk = chunk;
+  gt_file_xwrite(info->outfp, gt_str_get(md5chunk->buffer),
+                 gt_str_length(md5chunk->buffer));
+  return 0;
+}
+
+static void md5_chunk_delete(void *chunk)
+{
+  GtEncseqMD5Chunk *md5chunk = chunk;
+  if (!md5chunk) return;
+  gt_str_delete(md5chunk->buffer);
+  gt_free(md5chunk->seq);
+  gt_free(md5chunk);
+}
+
 static int gt_encseq_md5_runner(GT_UNUSED int argc, const char **argv,
                            int parsed_args, void *tool_arguments,
                            GtError *err)
@@ -105,20 +171,17 @@ static int gt_encseq_md5_runner(GT_UNUSED int argc, const char **argv,
         } else had_err = -1;
       }
     } else {
-      char *seq,
-           *md5str;
-      for (i = 0; i < gt_encseq_num_of_sequences(encseq); i++) {
-        GtUword len, start, end;
-        len = gt_encseq_seqlength(encseq, i);
-        start = gt_encseq_seqstartpos(encseq, i);
-        end = len + start -1;
-        seq = gt_malloc(len * sizeof (char));
-        gt_encseq_extract_decoded(encseq, seq, start, end);
-        md5str = gt_md5_fingerprint(seq, len);
-        gt_file_xprintf(arguments->outfp, ""GT_WU": %s\n", i, md5str);
-        gt_free(seq);
-        gt_free(md5str);
-      }
+      /* compute the fingerprints with <gt_jobs> many threads */
+      GtEncseqMD5Info info;
+      GtUword numofseqs = gt_encseq_num_of_sequences(encseq);
+      info.encseq = encseq;
+      info.outfp = arguments->outfp;
+      had_err = gt_encseq_parallel_foreach_seq(encseq, GT_READMODE_FORWARD,
+                                               0, numofseqs - 1,
+                                               md5_chunk_new, md5_seq,
+                                               md5_chunk_collect,
+                                               md5_chunk_delete,
+                                               &info, err);
     }
   }
   gt_encseq_delete(encseq);
@@ -22,12 +22,15 @@
 #include "core/fa_api.h"
 #include "core/fasta_api.h"
 #include "core/ma_api.h"
+#include "core/multithread_api.h"
 #include "core/option_api.h"
 #include "core/output_file_api.h"
 #include "core/seq_info_cache.h"
 #include "core/string_distri.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
+#include "core/xxhash.h"
 #include "extended/gtdatahelp.h"
 #include "tools/gt_fingerprint.h"
 
@@ -35,7 +38,8 @@ typedef struct {
   bool show_duplicates,
        detect_collisions;
   GtStr *checklist,
-        *extract;
+        *extract,
+        *digest;
   GtUword width;
   GtOutputFileInfo *ofi;
   GtFile *outfp;
@@ -46,6 +50,7 @@ static void* gt_fingerprint_arguments_new(void)
   FingerprintArguments *arguments = gt_calloc(1, sizeof *arguments);
   arguments->checklist = gt_str_new();
   arguments->extract = gt_str_new();
+  arguments->digest = gt_str_new();
   arguments->ofi = gt_output_file_info_new();
   return arguments;
 }
@@ -56,6 +61,7 @@ static void gt_fingerprint_arguments_delete(void *tool_arguments)
   if (!arguments) return;
   gt_file_delete(arguments->outfp);
   gt_output_file_info_delete(arguments->ofi);
+  gt_str_delete(arguments->digest);
   gt_str_delete(arguments->extract);
   gt_str_delete(arguments->checklist);
   gt_free(arguments);
@@ -67,7 +73,12 @@ static GtOptionParser* gt_fingerprint_option_parser_new(GT_UNUSED
   FingerprintArguments *arguments = tool_arguments;
   GtOptionParser *op;
   GtOption *check_option, *collisions_option, *duplicates_option,
-           *extract_option, *width_option;
+           *extract_option, *width_option, *digest_option;
+  static const char *digests[] = {
+    "md5",
+    "xxh64",
+    NULL
+  };
   gt_assert(arguments);
   op = gt_option_parser_new("[option ...] sequence_file [...] ",
                             "Compute MD5 fingerprints for each sequence given "
@@ -106,6 +117,15 @@ static GtOptionParser* gt_fingerprint_option_parser_new(GT_UNUSED
                                         "stdout.", arguments->extract, NULL);
   gt_option_parser_add_option(op, extract_option);
 
+  /* -digest */
+  digest_option = gt_option_new_choice("digest", "use the given digest for "
+                                       "the fingerprints (choose from "
+                                       "md5|xxh64). xxh64 is a much faster "
+                                       "non-cryptographic 64-bit hash, "
+                                       "suitable for duplicate detection",
+                                       arguments->digest, digests[0], digests);
+  gt_option_parser_add_option(op, digest_option);
+
   /* -width */
   width_option = gt_option_new_width(&arguments->width);
   gt_option_parser_add_option(op, width_option);
@@ -128,6 +148,89 @@ static GtOptionParser* gt_fingerprint_option_parser_new(GT_UNUSED
   return op;
 }
 
+static int gt_fingerprint_arguments_check(GT_UNUSED int rest_argc,
+                                          void *tool_arguments, GtError *err)
+{
+  FingerprintArguments *arguments = tool_arguments;
+  gt_error_check(err);
+  gt_assert(arguments);
+  if (arguments->detect_collisions &&
+      strcmp(gt_str_get(arguments->digest), "md5") != 0) {
+    gt_error_set(err, "option '-collisions' requires '-digest md5'");
+    return -1;
+  }
+  return 0;
+}
+
+/* number of sequences a thread fingerprints at a time */
+#define FINGERPRINT_SEQS_PER_JOB  256UL
+
+typedef struct {
+  const GtBioseq *bs;
+  char *fingerprints;
+  GtUword numofseqs,
+          nextseq;
+  GtMutex *mutex;
+} FingerprintXXHashInfo;
+
+static void* compute_xxhash_fingerprints_thread(void *data)
+{
+  FingerprintXXHashInfo *info = data;
+  GtUword from, to, seqnum;
+
+  for (;;) {
+    gt_mutex_lock(info->mutex);
+    from = info->nextseq;
+    to = from + FINGERPRINT_SEQS_PER_JOB;
+    if (to > info->numofseqs)
+      to = info->numofseqs;
+    info->nextseq = to;
+    gt_mutex_unlock(info->mutex);
+    if (from == to)
+      break;
+    for (seqnum = from; seqnum < to; seqnum++) {
+      char *fingerprint = info->fingerprints
+                          + seqnum * GT_XXHASH64_FINGERPRINT_LENGTH;
+      if (gt_bioseq_get_sequence_length(info->bs, seqnum) == 0)
+        gt_xxhash64_fingerprint(fingerprint, "", 0);
+      else {
+        char *seq = gt_bioseq_get_sequence(info->bs, seqnum);
+        gt_xxhash64_fingerprint(fingerprint, seq,
+                                gt_bioseq_get_sequence_length(info->bs,
+                                                              seqnum));
+        gt_free(seq);
+      }
+    }
+  }
+  return NULL;
+}
+
+/* computes the xxHash fingerprints of all sequences in <bs> with <gt_jobs>
+   many threads, stored consecutively in the returned array */
+static char* compute_xxhash_fingerprints(GtBioseq *bs, GtError *err)
+{
+  FingerprintXXHashInfo info;
+  int had_err = 0;
+
+  gt_error_check(err);
+  info.bs = bs;
+  info.numofseqs = gt_bioseq_number_of_sequences(bs);
+  info.nextseq = 0;
+  info.fingerprints = gt_malloc(sizeof (char) * (info.numofseqs + 1)
+                                * GT_XXHASH64_FINGERPRINT_LENGTH);
+  info.mutex = gt_mutex_new();
+  if (gt_jobs > 1U && info.numofseqs > FINGERPRINT_SEQS_PER_JOB)
+    had_err = gt_multithread(compute_xxhash_fingerprints_thread, &info, err);
+  else
+    (void) compute_xxhash_fingerprints_thread(&info);
+  gt_mutex_delete(info.mutex);
+  if (had_err) {
+    gt_free(info.fingerprints);
+    return NULL;
+  }
+  return info.fingerprints;
+}
+
 static void proc_superfluous_sequence(const char *string,
                                       GT_UNUSED GtUword occurrences,
                                       GT_UNUSED double probability, void *data)
@@ -219,9 +322,11 @@ static int compare_md5s(GtBioseqCol *bsc, const GtSeqInfo *si,
                                              si->seqnum);
   seq_b_len = gt_seq_col_get_sequence_length((GtSeqCol*) bsc, filenum, seqnum);
   seq_a = gt_seq_col_get_sequence((GtSeqCol*) bsc, si->filenum, si->seqnum, 0,
-                                  seq_a_len - 1);
+                                  seq_a_len - 1, err);
   seq_b = gt_seq_col_get_sequence((GtSeqCol*) bsc, filenum, seqnum, 0,
-                                  seq_b_len - 1);
+                                  seq_b_len - 1, err);
+  /* a <GtBioseqCol> holds all sequences in memory */
+  gt_assert(seq_a && seq_b);
   seq_a_upper = gt_malloc((seq_a_len + 1) * sizeof (char));
   seq_b_upper = gt_malloc((seq_b_len + 1) * sizeof (char));
   for (i = 0; i < seq_a_len; i++)
@@ -257,7 +362,8 @@ static int detect_collisions_on_bsc(GtBioseqCol *bsc, GtError *err)
          seqnum++) {
       const GtSeqInfo *si_ptr;
       const char *md5;
-      md5 = gt_seq_col_get_md5_fingerprint((GtSeqCol*) bsc, filenum, seqnum);
+      md5 = gt_seq_col_get_md5_fingerprint((GtSeqCol*) bsc, filenum, seqnum,
+                                           err);
       if ((si_ptr = gt_seq_info_cache_get(sic, md5)))
         had_err = compare_md5s(bsc, si_ptr, filenum, seqnum, md5, err);
       else {
@@ -296,7 +402,7 @@ static int gt_fingerprint_runner(int argc, const char **argv, int parsed_args,
                                  void *tool_arguments, GtError *err)
 {
   FingerprintArguments *arguments = tool_arguments;
-  bool extract_found = true;
+  bool extract_found = true, use_xxhash;
   GtBioseq *bs;
   GtStringDistri *sd;
   GtUword i, j;
@@ -305,21 +411,30 @@ static int gt_fingerprint_runner(int argc, const char **argv, int parsed_args,
   gt_error_check(err);
   gt_assert(arguments);
   sd = gt_string_distri_new();
+  use_xxhash = strcmp(gt_str_get(arguments->digest), "xxh64") == 0;
 
   if (gt_str_length(arguments->extract))
     extract_found = false;
 
   /* process sequence files */
   for (i = parsed_args; !had_err && i < argc; i++) {
+    char *xxhash_fingerprints = NULL;
     if (!(bs = gt_bioseq_new(argv[i], err)))
       had_err = -1;
+    if (!had_err && use_xxhash &&
+        !(xxhash_fingerprints = compute_xxhash_fingerprints(bs, err))) {
+      had_err = -1;
+    }
     if (!had_err) {
       for (j = 0; j < gt_bioseq_number_of_sequences(bs); j++) {
+        const char *fingerprint
+          = use_xxhash
+            ? xxhash_fingerprints + j * GT_XXHASH64_FINGERPRINT_LENGTH
+            : gt_bioseq_get_md5_fingerprint(bs, j);
         if (gt_str_length(arguments->checklist) || arguments->show_duplicates)
-          gt_string_distri_add(sd, gt_bioseq_get_md5_fingerprint(bs, j));
+          gt_string_distri_add(sd, fingerprint);
         else if (gt_str_length(arguments->extract)) {
-          if (!strcmp(gt_bioseq_get_md5_fingerprint(bs, j),
-                      gt_str_get(arguments->extract))) {
+          if (!strcmp(fingerprint, gt_str_get(arguments->extract))) {
             char *seq = gt_bioseq_get_sequence(bs, j);
             gt_fasta_show_entry(gt_bioseq_get_description(bs, j),
                                 seq,
@@ -330,9 +445,10 @@ static int gt_fingerprint_runner(int argc, const char **argv, int parsed_args,
           }
         }
         else if (!arguments->detect_collisions)
-          gt_xputs(gt_bioseq_get_md5_fingerprint(bs, j));
+          gt_xputs(fingerprint);
       }
     }
+    gt_free(xxhash_fingerprints);
     gt_bioseq_delete(bs);
   }
 
@@ -361,6 +477,6 @@ GtTool* gt_fingerprint(void)
   return gt_tool_new(gt_fingerprint_arguments_new,
                      gt_fingerprint_arguments_delete,
                      gt_fingerprint_option_parser_new,
-                     NULL,
+                     gt_fingerprint_arguments_check,
                      gt_fingerprint_runner);
 }
@@ -53,7 +53,8 @@ typedef struct {
        strict,
        tidy,
        show,
-       fixboundaries;
+       fixboundaries,
+       twopass;
   GtWord offset;
   GtStr *offsetfile, *newsource;
   GtUword width;
@@ -174,6 +175,16 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
                               &arguments->fixboundaries, false);
   gt_option_parser_add_option(op, option);
 
+  /* -twopass */
+  option = gt_option_new_bool("twopass", "read each GFF3_file twice: the first "
+                              "pass determines where the feature trees end, "
+                              "so that complete trees can be output without "
+                              "waiting for the next '"GT_GFF_TERMINATOR"' "
+                              "line (reduces the memory consumption for "
+                              "unsorted files, not applicable to stdin)",
+                              &arguments->twopass, false);
+  gt_option_parser_add_option(op, option);
+
   /* -mergefeat */
   mergefeat_option = gt_option_new_bool("mergefeat",
                                         "merge adjacent features of the same "
@@ -309,6 +320,9 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
   if (!had_err && arguments->tidy)
     gt_gff3_in_stream_enable_tidy_mode((GtGFF3InStream*) gff3_in_stream);
 
+  if (!had_err && arguments->twopass)
+    gt_gff3_in_stream_enable_two_pass_mode((GtGFF3InStream*) gff3_in_stream);
+
   if (!had_err && arguments->fixboundaries)
     gt_gff3_in_stream_fix_region_boundaries((GtGFF3InStream*) gff3_in_stream);
 
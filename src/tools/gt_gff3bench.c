@@ -0,0 +1,198 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/array_api.h"
+#include "core/ma_api.h"
+#include "core/output_file_api.h"
+#include "core/str_api.h"
+#include "core/timer_api.h"
+#include "extended/array_out_stream_api.h"
+#include "extended/genome_node.h"
+#include "extended/gff3_in_stream.h"
+#include "extended/gff3_visitor.h"
+#include "tools/gt_gff3bench.h"
+
+typedef struct {
+  GtUword runs,
+          blocksize;
+  GtOutputFileInfo *ofi;
+  GtFile *outfp;
+} GFF3BenchArguments;
+
+static void* gt_gff3bench_arguments_new(void)
+{
+  GFF3BenchArguments *arguments = gt_calloc((size_t) 1, sizeof *arguments);
+  arguments->ofi = gt_output_file_info_new();
+  return arguments;
+}
+
+static void gt_gff3bench_arguments_delete(void *tool_arguments)
+{
+  GFF3BenchArguments *arguments = tool_arguments;
+  if (!arguments) return;
+  gt_file_delete(arguments->outfp);
+  gt_output_file_info_delete(arguments->ofi);
+  gt_free(arguments);
+}
+
+static GtOptionParser* gt_gff3bench_option_parser_new(void *tool_arguments)
+{
+  GFF3BenchArguments *arguments = tool_arguments;
+  GtOptionParser *op;
+  GtOption *option;
+  gt_assert(arguments);
+
+  op = gt_option_parser_new("[option ...] [GFF3_file ...]",
+                            "Benchmark the GFF3 output of the given "
+                            "annotations.\nThe timing results are appended to "
+                            "the output as comment lines.");
+
+  option = gt_option_new_uword("runs", "number of times the annotations are "
+                               "written", &arguments->runs, 1UL);
+  gt_option_parser_add_option(op, option);
+
+  option = gt_option_new_uword("blocksize", "size of the output buffer in "
+                               "bytes (0 writes out every node directly)",
+                               &arguments->blocksize,
+                               GT_GFF3_VISITOR_BLOCKSIZE);
+  gt_option_parser_add_option(op, option);
+
+  gt_output_file_info_register_options(arguments->ofi, op, &arguments->outfp);
+
+  return op;
+}
+
+/* load all annotations into memory, the parsing time is not measured */
+static int gt_gff3bench_load_nodes(GtArray *nodes, int numfiles,
+                                   const char **files, GtError *err)
+{
+  GtNodeStream *gff3_in_stream, *array_out_stream;
+  int had_err = 0;
+  gt_error_check(err);
+  gff3_in_stream = gt_gff3_in_stream_new_unsorted(numfiles, files);
+  array_out_stream = gt_array_out_stream_all_new(gff3_in_stream, nodes, err);
+  if (!array_out_stream)
+    had_err = -1;
+  if (!had_err)
+    had_err = gt_node_stream_pull(array_out_stream, err);
+  gt_node_stream_delete(array_out_stream);
+  gt_node_stream_delete(gff3_in_stream);
+  return had_err;
+}
+
+static void gt_gff3bench_delete_nodes(GtArray *nodes)
+{
+  GtUword i;
+  for (i = 0; i < gt_array_size(nodes); i++)
+    gt_genome_node_delete(*(GtGenomeNode**) gt_array_get(nodes, i));
+  gt_array_reset(nodes);
+}
+
+/* Writes all <nodes> with <nv> and adds the elapsed time in microseconds to
+   <usec>. The nodes are deleted afterwards, because feature node DAGs can only
+   be traversed once. */
+static int gt_gff3bench_write_nodes(GtArray *nodes, GtNodeVisitor *nv,
+                                    GtTimer *timer, GtWord *usec, GtError *err)
+{
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_timer_start(timer);
+  for (i = 0; !had_err && i < gt_array_size(nodes); i++) {
+    had_err = gt_genome_node_accept(*(GtGenomeNode**) gt_array_get(nodes, i),
+                                    nv, err);
+  }
+  if (!had_err)
+    gt_gff3_visitor_flush((GtGFF3Visitor*) nv);
+  *usec += gt_timer_elapsed_usec(timer);
+  gt_gff3bench_delete_nodes(nodes);
+  return had_err;
+}
+
+static void gt_gff3bench_show_rate(GtFile *outfp, const char *what,
+                                   GtUword bytes, GtWord usec)
+{
+  double seconds = (double) usec / 1000000.0;
+  gt_file_xprintf(outfp, "# %s: "GT_WU" bytes in %.3fs", what, bytes,
+                  seconds);
+  if (usec > 0) {
+    gt_file_xprintf(outfp, " (%.2f MB/s)",
+                    (double) bytes / (1024.0 * 1024.0) / seconds);
+  }
+  gt_file_xfputc('\n', outfp);
+}
+
+static int gt_gff3bench_runner(int argc, const char **argv, int parsed_args,
+                               void *tool_arguments, GtError *err)
+{
+  GFF3BenchArguments *arguments = tool_arguments;
+  GtNodeVisitor *nv;
+  GtArray *nodes;
+  GtTimer *timer;
+  GtStr *outstr;
+  GtUword i, bytes = 0;
+  GtWord format_usec = 0, write_usec = 0;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(arguments);
+
+  nodes = gt_array_new(sizeof (GtGenomeNode*));
+  timer = gt_timer_new();
+
+  /* determine the output size and the pure formatting time */
+  had_err = gt_gff3bench_load_nodes(nodes, argc - parsed_args,
+                                    argv + parsed_args, err);
+  if (!had_err) {
+    outstr = gt_str_new();
+    nv = gt_gff3_visitor_new_to_str(outstr);
+    had_err = gt_gff3bench_write_nodes(nodes, nv, timer, &format_usec, err);
+    bytes = gt_str_length(outstr);
+    gt_node_visitor_delete(nv);
+    gt_str_delete(outstr);
+  }
+
+  /* write the annotations to the output file */
+  for (i = 0; !had_err && i < arguments->runs; i++) {
+    had_err = gt_gff3bench_load_nodes(nodes, argc - parsed_args,
+                                      argv + parsed_args, err);
+    if (!had_err) {
+      nv = gt_gff3_visitor_new(arguments->outfp);
+      gt_gff3_visitor_set_blocksize((GtGFF3Visitor*) nv, arguments->blocksize);
+      had_err = gt_gff3bench_write_nodes(nodes, nv, timer, &write_usec, err);
+      gt_node_visitor_delete(nv);
+    }
+  }
+
+  if (!had_err) {
+    gt_gff3bench_show_rate(arguments->outfp, "formatting", bytes, format_usec);
+    gt_gff3bench_show_rate(arguments->outfp, "writing",
+                           bytes * arguments->runs, write_usec);
+  }
+
+  gt_gff3bench_delete_nodes(nodes);
+  gt_array_delete(nodes);
+  gt_timer_delete(timer);
+  return had_err;
+}
+
+GtTool* gt_gff3bench(void)
+{
+  return gt_tool_new(gt_gff3bench_arguments_new,
+                     gt_gff3bench_arguments_delete,
+                     gt_gff3bench_option_parser_new,
+                     NULL,
+                     gt_gff3bench_runner);
+}
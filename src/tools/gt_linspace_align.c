@@ -34,12 +34,14 @@
 #include "core/timer_api.h"
 #include "core/types_api.h"
 #include "core/unused_api.h"
+#include "extended/batchalign.h"
 #include "extended/diagonalbandalign.h"
 #include "extended/diagonalbandalign_affinegapcost.h"
 #include "extended/linearalign.h"
 #include "extended/linearalign_affinegapcost.h"
 #include "extended/linspace_management.h"
 #include "extended/scorehandler.h"
+#include "extended/stripedalign.h"
 #include "tools/gt_linspace_align.h"
 
 #define LEFT_DIAGONAL_SHIFT(similarity, ulen, vlen) \
@@ -51,7 +53,8 @@
                              GT_MAX(((GtWord)ulen-(GtWord)vlen),0))
 
 typedef struct{
-  GtStr      *outputfile; /*default stdout*/
+  GtStr      *outputfile, /*default stdout*/
+             *kernel; /* most powerful striped kernel to use */
   GtStrArray *strings,
              *files,
              *linearcosts,
@@ -69,7 +72,8 @@ typedef struct{
              showsequences,
              scoreonly, /* dev option generate alignment, but do not show it*/
              wildcardshow, /* show symbol wildcards in output*/
-             spacetime; /* write space peak and time overall on stdout*/
+             spacetime, /* write space peak and time overall on stdout*/
+             benchmark; /* dev option report cell updates per second */
   GtUword timesquarefactor; /*factor to specified termination of recursion
                               and call 2dim algorithm */
 } GtLinspaceArguments;
@@ -83,6 +87,7 @@ static void* gt_linspace_align_arguments_new(void)
 {
   GtLinspaceArguments *arguments = gt_calloc((size_t) 1, sizeof *arguments);
   arguments->outputfile = gt_str_new();
+  arguments->kernel = gt_str_new();
   arguments->strings = gt_str_array_new();
   arguments->files = gt_str_array_new();
   arguments->linearcosts = gt_str_array_new();
@@ -96,6 +101,7 @@ static void gt_linspace_align_arguments_delete(void *tool_arguments)
   GtLinspaceArguments *arguments = tool_arguments;
   if (arguments != NULL) {
     gt_str_delete(arguments->outputfile);
+    gt_str_delete(arguments->kernel);
     gt_str_array_delete(arguments->strings);
     gt_str_array_delete(arguments->files);
     gt_str_array_delete(arguments->linearcosts);
@@ -139,7 +145,9 @@ static GtOptionParser* gt_linspace_align_option_parser_new(void *tool_arguments)
            *optionaffinecosts, *optionoutputfile, *optionshowscore,
            *optionshowsequences, *optiondiagonal, *optiondiagonalbonds,
            *optionsimilarity, *optiontsfactor, *optionspacetime,
-           *optionscoreonly, *optionwildcardsymbol;
+           *optionscoreonly, *optionwildcardsymbol, *optionkernel,
+           *optionbenchmark;
+  static const char *kernels[] = {"avx2", "sse4.1", "scalar", NULL};
 
   gt_assert(arguments);
 
@@ -196,9 +204,10 @@ static GtOptionParser* gt_linspace_align_option_parser_new(void *tool_arguments)
                                        &arguments->showsequences, false);
   gt_option_parser_add_option(op, optionshowsequences);
 
-  optionscoreonly = gt_option_new_bool("showonlyscore", "show only score for "
-                                       "generated alignment to compare with "
-                                       "other algorithms",
+  optionscoreonly = gt_option_new_bool("showonlyscore", "show only score, "
+                                       "computed without generating the "
+                                       "alignment, to compare with other "
+                                       "algorithms",
                                        &arguments->scoreonly, false);
   gt_option_parser_add_option(op, optionscoreonly);
 
@@ -207,6 +216,13 @@ static GtOptionParser* gt_linspace_align_option_parser_new(void *tool_arguments)
                                        &arguments->spacetime, false);
   gt_option_parser_add_option(op, optionspacetime);
 
+  optionbenchmark = gt_option_new_bool("benchmark", "compute alignments "
+                                       "without showing them and write the "
+                                       "number of DP matrix cells evaluated "
+                                       "per second on stdout",
+                                       &arguments->benchmark, false);
+  gt_option_parser_add_option(op, optionbenchmark);
+
   /* -str */
   optionstrings = gt_option_new_string_array("ss", "input, use two strings",
                                              arguments->strings);
@@ -242,6 +258,14 @@ static GtOptionParser* gt_linspace_align_option_parser_new(void *tool_arguments)
                                           arguments->outputfile, "stdout");
   gt_option_parser_add_option(op, optionoutputfile);
 
+  optionkernel = gt_option_new_choice("kernel", "most powerful kernel used "
+                                      "for global alignments with constant "
+                                      "costs, choose avx2|sse4.1|scalar, the "
+                                      "kernels not supported by the "
+                                      "processor are skipped",
+                                      arguments->kernel, kernels[0], kernels);
+  gt_option_parser_add_option(op, optionkernel);
+
   /* -ulong */
   optiontsfactor = gt_option_new_ulong("t", "timesquarefactor to organize "
                                        "time and space",
@@ -263,6 +287,7 @@ static GtOptionParser* gt_linspace_align_option_parser_new(void *tool_arguments)
   gt_option_exclude(optionlinearcosts, optionaffinecosts);
   gt_option_exclude(optiondna, optionprotein);
   gt_option_exclude(optionshowsequences, optionscoreonly);
+  gt_option_exclude(optionshowsequences, optionbenchmark);
   gt_option_exclude(optionsimilarity, optiondiagonalbonds);
   gt_option_imply_either_2(optionfiles, optionglobal, optionlocal);
   gt_option_imply_either_2(optiondna, optionstrings, optionfiles);
@@ -287,6 +312,8 @@ static GtOptionParser* gt_linspace_align_option_parser_new(void *tool_arguments)
   /* development option(s) */
   gt_option_is_development_option(optionspacetime);
   gt_option_is_development_option(optionscoreonly);/*only useful to test*/
+  gt_option_is_development_option(optionkernel);
+  gt_option_is_development_option(optionbenchmark);
 
   return op;
 }
@@ -569,7 +596,7 @@ static int gt_all_against_all_alignment_check(bool affine,
                      useq, 0, ulen, vseq, 0, vlen);
       }
       /* show alignment*/
-      if (!had_err)
+      if (!had_err && !arguments->benchmark)
       {
         gt_assert(align != NULL);
         if (!strcmp(gt_str_get(arguments->outputfile),"stdout"))
@@ -613,6 +640,101 @@ static int gt_all_against_all_alignment_check(bool affine,
   return had_err;
 }
 
+/* with -showonlyscore, the alignments are not needed, such that the
+   distances or scores of all pairs with the same sequence u are computed at
+   once by the batch aligner */
+static int gt_all_against_all_scores(const GtLinspaceArguments *arguments,
+                                     const GtScoreHandler *scorehandler,
+                                     GtUchar wildcardshow,
+                                     const GtSequenceTable *sequence_table1,
+                                     const GtSequenceTable *sequence_table2,
+                                     GtTimer *linspacetimer,
+                                     GtError *err)
+{
+  const GtUword numofpairs = sequence_table2->size;
+  const GtUchar **useqs, **vseqs;
+  GtUword i, j, *ulens, *vlens, *distances = NULL;
+  GtWord *scores = NULL;
+  FILE *fp = stdout;
+
+  gt_error_check(err);
+  if (!arguments->benchmark &&
+      strcmp(gt_str_get(arguments->outputfile),"stdout") != 0)
+  {
+    fp = gt_fa_fopen_func(gt_str_get(arguments->outputfile),
+                          "a", __FILE__,__LINE__,err);
+    if (fp == NULL)
+    {
+      return -1;
+    }
+  }
+  if (linspacetimer != NULL)
+  {
+    gt_timer_start(linspacetimer);
+  }
+  useqs = gt_malloc(sizeof *useqs * 2 * numofpairs);
+  vseqs = useqs + numofpairs;
+  ulens = gt_malloc(sizeof *ulens * 2 * numofpairs);
+  vlens = ulens + numofpairs;
+  if (arguments->global)
+  {
+    distances = gt_malloc(sizeof *distances * numofpairs);
+  } else
+  {
+    scores = gt_malloc(sizeof *scores * numofpairs);
+  }
+  for (j = 0; j < numofpairs; j++)
+  {
+    vlens[j] = gt_str_length(sequence_table2->seqarray[j]);
+    vseqs[j] = (const GtUchar*) gt_str_get(sequence_table2->seqarray[j]);
+  }
+  for (i = 0; i < sequence_table1->size; i++)
+  {
+    for (j = 0; j < numofpairs; j++)
+    {
+      ulens[j] = gt_str_length(sequence_table1->seqarray[i]);
+      useqs[j] = (const GtUchar*) gt_str_get(sequence_table1->seqarray[i]);
+    }
+    if (arguments->global)
+    {
+      gt_batchalign_global(scorehandler, numofpairs, useqs, ulens,
+                           vseqs, vlens, distances);
+    } else
+    {
+      gt_batchalign_local(scorehandler, numofpairs, useqs, ulens,
+                          vseqs, vlens, scores);
+    }
+    for (j = 0; !arguments->benchmark && j < numofpairs; j++)
+    {
+      fprintf(fp, "######\n");
+      if (arguments->global)
+      {
+        fprintf(fp, "distance: "GT_WD"\n", (GtWord) distances[j]);
+      } else
+      {
+        fprintf(fp, "score: "GT_WD"\n", scores[j]);
+      }
+    }
+  }
+  if (linspacetimer != NULL)
+  {
+    gt_timer_stop(linspacetimer);
+  }
+  if (arguments->wildcardshow)
+  {
+    printf("# wildcards are represented by %c\n", wildcardshow);
+  }
+  gt_free(useqs);
+  gt_free(ulens);
+  gt_free(distances);
+  gt_free(scores);
+  if (fp != stdout)
+  {
+    gt_fa_fclose(fp);
+  }
+  return 0;
+}
+
 /* handle score and cost values */
 static GtScoreHandler *gt_arguments2scorehandler(
                              const GtLinspaceArguments *arguments,
@@ -747,6 +869,7 @@ static int gt_linspace_align_runner(GT_UNUSED int argc,
   GtScoreHandler *scorehandler = NULL;
   GtTimer *linspacetimer = NULL;
   GtAlphabet *alphabet = NULL;
+  GtStripedalignKernel kernel;
 
   gt_error_check(err);
   gt_assert(arguments);
@@ -816,10 +939,22 @@ static int gt_linspace_align_runner(GT_UNUSED int argc,
       }
     }
   }
-  if (!had_err && arguments->spacetime)
+  if (!had_err && (arguments->spacetime || arguments->benchmark))
   {
     linspacetimer = gt_timer_new();
   }
+  if (strcmp(gt_str_get(arguments->kernel), "scalar") == 0)
+  {
+    kernel = GT_STRIPEDALIGN_SCALAR;
+  }
+  else if (strcmp(gt_str_get(arguments->kernel), "sse4.1") == 0)
+  {
+    kernel = GT_STRIPEDALIGN_SSE41;
+  } else
+  {
+    kernel = GT_STRIPEDALIGN_AVX2;
+  }
+  gt_stripedalign_set_kernel(kernel);
 
   /* alignment functions with linear gap costs */
   if (!had_err)
@@ -834,7 +969,15 @@ static int gt_linspace_align_runner(GT_UNUSED int argc,
       gt_assert(gt_str_array_size(arguments->affinecosts) > 0);
       affine = true;
     }
-    had_err = gt_all_against_all_alignment_check (
+    if (arguments->scoreonly && !arguments->diagonal)
+    {
+      had_err = gt_all_against_all_scores(arguments, scorehandler,
+                                          gt_alphabet_wildcard_show(alphabet),
+                                          sequence_table1, sequence_table2,
+                                          linspacetimer, err);
+    } else
+    {
+      had_err = gt_all_against_all_alignment_check (
                             affine, align, arguments,
                             spacemanager,
                             scorehandler,
@@ -845,6 +988,7 @@ static int gt_linspace_align_runner(GT_UNUSED int argc,
                             left_dist,
                             right_dist,
                             linspacetimer,err);
+    }
   }
   /*spacetime option*/
   if (!had_err && arguments->spacetime)
@@ -854,6 +998,31 @@ static int gt_linspace_align_runner(GT_UNUSED int argc,
     gt_timer_show_formatted(linspacetimer,"# TIME overall " GT_WD ".%02ld\n",
                             stdout);
   }
+  /*benchmark option*/
+  if (!had_err && arguments->benchmark)
+  {
+    GtUword idx, ulensum = 0, vlensum = 0;
+    double cells, seconds;
+
+    for (idx = 0; idx < sequence_table1->size; idx++)
+    {
+      ulensum += gt_str_length(sequence_table1->seqarray[idx]);
+    }
+    for (idx = 0; idx < sequence_table2->size; idx++)
+    {
+      vlensum += gt_str_length(sequence_table2->seqarray[idx]);
+    }
+    cells = (double) ulensum * (double) vlensum;
+    seconds = (double) gt_timer_elapsed_usec(linspacetimer) / 1000000.0;
+    printf("# kernel: %s\n",
+           gt_stripedalign_kernel_name(gt_stripedalign_get_kernel()));
+    printf("# alignments: " GT_WU "\n",
+           sequence_table1->size * sequence_table2->size);
+    printf("# DP matrix cells: %.0f\n", cells);
+    printf("# time in seconds: %.3f\n", seconds);
+    printf("# cell updates per second: %.3e\n",
+           seconds > 0.0 ? cells / seconds : 0.0);
+  }
   gt_timer_delete(linspacetimer);
   gt_linspace_management_delete(spacemanager);
   gt_sequence_table_delete(sequence_table1);
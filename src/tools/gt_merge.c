@@ -22,7 +22,7 @@
 #include "extended/genome_node.h"
 #include "extended/gff3_in_stream.h"
 #include "extended/gff3_out_stream_api.h"
-#include "extended/merge_stream_api.h"
+#include "extended/merge_stream.h"
 #include "tools/gt_merge.h"
 
 typedef struct {
@@ -113,6 +113,9 @@ static int gt_merge_runner(int argc, const char **argv, int parsed_args,
   /* create a merge stream */
   merge_stream = gt_merge_stream_new(genome_streams);
   gt_assert(merge_stream);
+  /* the input files are parsed independently from each other */
+  if (parsed_args < argc)
+    gt_merge_stream_set_parallel((GtMergeStream*) merge_stream);
 
   /* create a gff3 output stream */
   gff3_out_stream = gt_gff3_out_stream_new(merge_stream, arguments->outfp);
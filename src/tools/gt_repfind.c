@@ -570,6 +570,7 @@ static int gt_callenumquerymatches(bool selfmatch,
                                    void *eqmf_data,
                                    const GtSeedExtendDisplayFlag
                                       *out_display_flag,
+                                   bool background_output,
                                    GtLogger *logger,
                                    GtError *err)
 {
@@ -651,6 +652,10 @@ static int gt_callenumquerymatches(bool selfmatch,
       gt_querymatch_outoptions_set(exactseed,querymatchoutoptions);
     }
     gt_querymatch_query_readmode_set(exactseed,query_readmode);
+    if (background_output)
+    {
+      gt_querymatch_background_output_set(exactseed);
+    }
     while (!haserr &&
            (retval = gt_querysubstringmatchiterator_next(qsmi, err)) == 0)
     {
@@ -958,6 +963,11 @@ static int gt_repfind_runner(int argc,const char **argv, int parsed_args,
       {
         gt_querymatch_verify_alignment_set(info_querymatch.querymatchspaceptr);
       }
+      if (!arguments->beverbose)
+      {
+        gt_querymatch_background_output_set(
+                                         info_querymatch.querymatchspaceptr);
+      }
       if (gt_option_is_set(arguments->refextendxdropoption))
       {
         eqmf = gt_rf_xdrop_extend_querymatch_with_output;
@@ -1044,6 +1054,8 @@ static int gt_repfind_runner(int argc,const char **argv, int parsed_args,
           {
             haserr = true;
           }
+          /* the following matches may be output by another querymatch */
+          gt_querymatch_output_flush(info_querymatch.querymatchspaceptr);
         }
         if (!haserr)
         {
@@ -1066,6 +1078,7 @@ static int gt_repfind_runner(int argc,const char **argv, int parsed_args,
                                           eqmf,
                                           eqmf_data,
                                           out_display_flag,
+                                          !arguments->beverbose,
                                           logger,
                                           err) != 0)
               {
@@ -1093,6 +1106,7 @@ static int gt_repfind_runner(int argc,const char **argv, int parsed_args,
                                   eqmf,
                                   eqmf_data,
                                   out_display_flag,
+                                  !arguments->beverbose,
                                   logger,
                                   err) != 0)
           {
@@ -809,6 +809,37 @@ static int gt_seed_extend_runner(int argc,
       had_err = -1;
     }
   }
+  /* binary records cannot be mixed with any other output on stdout */
+  if (!had_err && gt_querymatch_binary_display(out_display_flag))
+  {
+    const char *other_output = NULL;
+
+    if (arguments->verbose)
+    {
+      other_output = "-v";
+    } else if (arguments->benchmark)
+    {
+      other_output = "-benchmark";
+    } else if (arguments->onlyseeds)
+    {
+      other_output = "-only-seeds";
+    } else if (arguments->trimstat_on)
+    {
+      other_output = "-trimstat";
+    } else if (arguments->maxmat > 0)
+    {
+      other_output = "-maxmat";
+    } else if (gt_str_length(arguments->diagband_statistics_arg) > 0)
+    {
+      other_output = "-diagband-stat";
+    }
+    if (other_output != NULL)
+    {
+      gt_error_set(err,"argument \"binary\" of option -outfmt cannot be "
+                       "combined with option %s",other_output);
+      had_err = -1;
+    }
+  }
 
   if (!had_err)
   {
@@ -818,10 +849,15 @@ static int gt_seed_extend_runner(int argc,
         = (arguments->maxmat != 1 &&
            gt_str_length(arguments->diagband_statistics_arg) == 0)
           ? true : false;
-      gt_querymatch_Options_output(stdout,argc,argv,idhistout,
-                                   arguments->se_minidentity,
-                                   arguments->se_historysize);
-      if (!arguments->compute_ani  && !arguments->onlyseeds)
+      const size_t options_line_length
+        = gt_querymatch_Options_output(stdout,argc,argv,idhistout,
+                                       arguments->se_minidentity,
+                                       arguments->se_historysize);
+      if (gt_querymatch_binary_display(out_display_flag))
+      {
+        gt_querymatch_Binary_output(stdout,options_line_length,
+                                    out_display_flag);
+      } else if (!arguments->compute_ani  && !arguments->onlyseeds)
       {
         gt_querymatch_Fields_output(stdout,out_display_flag);
       }
@@ -870,6 +906,9 @@ static int gt_seed_extend_runner(int argc,
     GtEncseqLoader *encseq_loader = gt_encseq_loader_new();
     gt_encseq_loader_require_multiseq_support(encseq_loader);
     gt_encseq_loader_require_ssp_tab(encseq_loader);
+    /* the description tables are only needed once matches are output */
+    gt_encseq_loader_enable_lazy_loading(encseq_loader);
+    gt_encseq_loader_enable_seqnum_index(encseq_loader);
     if (out_display_flag != NULL &&
         gt_querymatch_subjectid_display(out_display_flag))
     {
@@ -896,6 +935,8 @@ static int gt_seed_extend_runner(int argc,
       GtEncseqLoader *encseq_loader = gt_encseq_loader_new();
       gt_encseq_loader_require_multiseq_support(encseq_loader);
       gt_encseq_loader_require_ssp_tab(encseq_loader);
+      gt_encseq_loader_enable_lazy_loading(encseq_loader);
+      gt_encseq_loader_enable_seqnum_index(encseq_loader);
       if (out_display_flag != NULL &&
           gt_querymatch_queryid_display(out_display_flag))
       {
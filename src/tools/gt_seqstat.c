@@ -21,6 +21,7 @@
 #include <string.h>
 #include <sys/types.h>
 
+#include "core/array_api.h"
 #include "core/compat_api.h"
 #include "core/fileutils_api.h"
 #include "core/xposix_api.h"
@@ -40,6 +41,8 @@
 #include "core/unused_api.h"
 #include "core/types_api.h"
 #include "core/disc_distri_api.h"
+#include "core/encseq_api.h"
+#include "core/encseq_parallel.h"
 #include "core/option_api.h"
 #include "core/error_api.h"
 #include "core/logger.h"
@@ -55,7 +58,8 @@ typedef struct
        binarydistlen,
        doastretch,
        docstats,
-       showestimsize;
+       showestimsize,
+       encseq;
   unsigned int bucketsize;
   GtUword genome_length;
   GtStrArray *nstats;
@@ -83,7 +87,7 @@ static GtOptionParser* gt_seqstat_option_parser_new(void *tool_arguments)
   GtOptionParser *op;
   GtOption *optionverbose, *optiondistlen, *optionbucketsize,
            *optioncontigs, *optionastretch, *optionestimsize,
-           *optionbinarydistlen, *optiongenome, *optionnstats;
+           *optionbinarydistlen, *optiongenome, *optionnstats, *optionencseq;
 
   gt_assert(arguments);
 
@@ -140,6 +144,14 @@ static GtOptionParser* gt_seqstat_option_parser_new(void *tool_arguments)
   gt_option_parser_add_option(op, optionestimsize);
   gt_option_is_development_option(optionestimsize);
 
+  optionencseq = gt_option_new_bool("encseq",
+                                  "input files are encoded sequences, whose "
+                                  "sequences are processed with -j many "
+                                  "threads",
+                                  &arguments->encseq,false);
+  gt_option_exclude(optionencseq, optionestimsize);
+  gt_option_parser_add_option(op, optionencseq);
+
   optiongenome = gt_option_new_uword_min("genome",
                                 "set genome length for NG50/NG80 calculation",
                                 &arguments->genome_length, 0, 1UL);
@@ -267,6 +279,166 @@ static void processastretches(const GtDiscDistri *distastretch,
   gt_free(astretchinfo.mmercount);
 }
 
+typedef struct
+{
+  SeqstatArguments *arguments;
+  GtDiscDistri *distseqlen,
+               *distastretch;
+  GtAssemblyStatsCalculator *asc;
+  uint64_t numofseq,
+           sumlength;
+  GtUword minlength,
+          maxlength;
+  GtUint64 countA;
+  bool minlengthdefined;
+} SeqstatState;
+
+static void seqstat_add_length(SeqstatState *state, GtUword len)
+{
+  if (state->arguments->dodistlen || state->arguments->docstats)
+  {
+    if (!state->minlengthdefined || state->minlength > len)
+    {
+      state->minlength = len;
+      state->minlengthdefined = true;
+    }
+    if (state->maxlength < len)
+    {
+      state->maxlength = len;
+    }
+    state->sumlength += (uint64_t) len;
+    state->numofseq++;
+    if (state->arguments->dodistlen)
+    {
+      gt_disc_distri_add(state->distseqlen,
+                         len/state->arguments->bucketsize);
+    }
+    if (state->arguments->docstats)
+    {
+      gt_assembly_stats_calculator_add(state->asc, len);
+    }
+  }
+}
+
+/* sequences of an encoded sequence are processed in chunks in parallel, the
+   lengths are added to the statistics in the order of the sequences */
+typedef struct
+{
+  GtArray *lengths;
+  GtDiscDistri *distastretch;
+  GtUint64 countA;
+  GtUchar *sequence;
+  GtUword allocated;
+} SeqstatChunk;
+
+static void* seqstat_chunk_new(void *data)
+{
+  SeqstatState *state = data;
+  SeqstatChunk *chunk = gt_calloc((size_t) 1, sizeof (*chunk));
+  chunk->lengths = gt_array_new(sizeof (GtUword));
+  if (state->arguments->doastretch)
+  {
+    chunk->distastretch = gt_disc_distri_new();
+  }
+  return chunk;
+}
+
+static int seqstat_encseq_seq(GtEncseqReader *esr,
+                              GT_UNUSED GtUword seqnum,
+                              GT_UNUSED GtUword seqstartpos,
+                              GtUword seqlength, void *chunkdata, void *data,
+                              GT_UNUSED GtError *err)
+{
+  SeqstatState *state = data;
+  SeqstatChunk *chunk = chunkdata;
+
+  gt_array_add(chunk->lengths, seqlength);
+  if (state->arguments->doastretch)
+  {
+    GtUword idx;
+    if (seqlength > chunk->allocated)
+    {
+      chunk->allocated = seqlength;
+      chunk->sequence = gt_realloc(chunk->sequence,
+                                   sizeof (*chunk->sequence) * seqlength);
+    }
+    for (idx = 0; idx < seqlength; idx++)
+    {
+      chunk->sequence[idx]
+        = (GtUchar) gt_encseq_reader_next_decoded_char(esr);
+    }
+    chunk->countA += accumulateastretch(chunk->distastretch,chunk->sequence,
+                                        seqlength);
+  }
+  return 0;
+}
+
+static void seqstat_add_astretches(GtUword key, GtUint64 value, void *data)
+{
+  gt_disc_distri_add_multi((GtDiscDistri *) data, key, value);
+}
+
+static int seqstat_chunk_collect(void *chunkdata, void *data,
+                                 GT_UNUSED GtError *err)
+{
+  SeqstatState *state = data;
+  SeqstatChunk *chunk = chunkdata;
+  GtUword idx;
+
+  for (idx = 0; idx < gt_array_size(chunk->lengths); idx++)
+  {
+    seqstat_add_length(state,*(GtUword *) gt_array_get(chunk->lengths,idx));
+  }
+  if (state->arguments->doastretch)
+  {
+    gt_disc_distri_foreach(chunk->distastretch,seqstat_add_astretches,
+                           state->distastretch);
+    state->countA += chunk->countA;
+  }
+  return 0;
+}
+
+static void seqstat_chunk_delete(void *chunkdata)
+{
+  SeqstatChunk *chunk = chunkdata;
+  gt_array_delete(chunk->lengths);
+  gt_disc_distri_delete(chunk->distastretch);
+  gt_free(chunk->sequence);
+  gt_free(chunk);
+}
+
+static int seqstat_process_encseqs(SeqstatState *state,
+                                   const GtStrArray *files, GtError *err)
+{
+  GtEncseqLoader *encseq_loader = gt_encseq_loader_new();
+  GtUword i;
+  int had_err = 0;
+
+  gt_encseq_loader_require_multiseq_support(encseq_loader);
+  gt_encseq_loader_drop_description_support(encseq_loader);
+  for (i = 0; !had_err && i < gt_str_array_size(files); i++)
+  {
+    GtEncseq *encseq = gt_encseq_loader_load(encseq_loader,
+                                             gt_str_array_get(files,i),err);
+    if (encseq == NULL)
+    {
+      had_err = -1;
+    } else
+    {
+      had_err = gt_encseq_parallel_foreach_seq(encseq,GT_READMODE_FORWARD,0,
+                                           gt_encseq_num_of_sequences(encseq)-1,
+                                           seqstat_chunk_new,
+                                           seqstat_encseq_seq,
+                                           seqstat_chunk_collect,
+                                           seqstat_chunk_delete,
+                                           state,err);
+      gt_encseq_delete(encseq);
+    }
+  }
+  gt_encseq_loader_delete(encseq_loader);
+  return had_err;
+}
+
 static int gt_seqstat_runner(int argc, const char **argv, int parsed_args,
                              void *tool_arguments, GtError *err)
 {
@@ -277,15 +449,12 @@ static int gt_seqstat_runner(int argc, const char **argv, int parsed_args,
   char *desc;
   GtUword len;
   int i, had_err = 0;
-  off_t totalsize;
+  off_t totalsize = 0;
   GtDiscDistri *distseqlen = NULL;
   GtAssemblyStatsCalculator *asc = NULL;
   GtLogger *asc_logger = NULL;
   GtDiscDistri *distastretch = NULL;
-  uint64_t numofseq = 0, sumlength = 0;
-  GtUword minlength = 0, maxlength = 0;
-  GtUint64 countA = 0;
-  bool minlengthdefined = false;
+  SeqstatState state;
 
   gt_error_check(err);
   gt_assert(arguments);
@@ -295,35 +464,48 @@ static int gt_seqstat_runner(int argc, const char **argv, int parsed_args,
   {
     gt_str_array_add_cstr(files, argv[i]);
   }
-  totalsize = gt_files_estimate_total_size(files);
+  if (!arguments->encseq)
+  {
+    totalsize = gt_files_estimate_total_size(files);
+  }
   if (arguments->showestimsize)
   {
     printf("# estimated total size is " Formatuint64_t "\n",
               PRINTuint64_tcast(totalsize));
   }
-  if (!had_err) {
+  if (arguments->dodistlen)
+  {
+    distseqlen = gt_disc_distri_new();
+    if (arguments->binarydistlen)
+      arguments->bucketsize = 1U;
+  }
+  if (arguments->docstats)
+  {
+    asc = gt_assembly_stats_calculator_new();
+    gt_assembly_stats_calculator_set_genome_length(asc,
+        arguments->genome_length);
+  }
+  if (arguments->doastretch)
+  {
+    distastretch = gt_disc_distri_new();
+  }
+  state.arguments = arguments;
+  state.distseqlen = distseqlen;
+  state.distastretch = distastretch;
+  state.asc = asc;
+  state.numofseq = state.sumlength = 0;
+  state.minlength = state.maxlength = 0;
+  state.countA = 0;
+  state.minlengthdefined = false;
+  if (arguments->encseq) {
+    had_err = seqstat_process_encseqs(&state, files, err);
+  } else {
     /* read input using seqiterator */
     seqit = gt_seq_iterator_sequence_buffer_new(files, err);
     if (!seqit)
       had_err = -1;
     if (!had_err)
     {
-      if (arguments->dodistlen)
-      {
-        distseqlen = gt_disc_distri_new();
-        if (arguments->binarydistlen)
-          arguments->bucketsize = 1U;
-      }
-      if (arguments->docstats)
-      {
-        asc = gt_assembly_stats_calculator_new();
-        gt_assembly_stats_calculator_set_genome_length(asc,
-            arguments->genome_length);
-      }
-      if (arguments->doastretch)
-      {
-        distastretch = gt_disc_distri_new();
-      }
       if (arguments->verbose)
       {
         gt_progressbar_start(gt_seq_iterator_getcurrentcounter(seqit,
@@ -336,31 +518,10 @@ static int gt_seqstat_runner(int argc, const char **argv, int parsed_args,
         desc = NULL;
         had_err = gt_seq_iterator_next(seqit, &sequence, &len, &desc, err);
         if (had_err != 1) break; /* 0: finished; 1: error */
-        if (arguments->dodistlen || arguments->docstats)
-        {
-          if (!minlengthdefined || minlength > len)
-          {
-            minlength = len;
-            minlengthdefined = true;
-          }
-          if (maxlength < len)
-          {
-            maxlength = len;
-          }
-          sumlength += (uint64_t) len;
-          numofseq++;
-          if (arguments->dodistlen)
-          {
-            gt_disc_distri_add(distseqlen,len/arguments->bucketsize);
-          }
-          if (arguments->docstats)
-          {
-            gt_assembly_stats_calculator_add(asc, len);
-          }
-        }
+        seqstat_add_length(&state, len);
         if (arguments->doastretch)
         {
-          countA += accumulateastretch(distastretch,sequence,len);
+          state.countA += accumulateastretch(distastretch,sequence,len);
         }
       }
       if (arguments->verbose)
@@ -374,11 +535,12 @@ static int gt_seqstat_runner(int argc, const char **argv, int parsed_args,
   if (!had_err && arguments->dodistlen)
   {
     printf("# " Formatuint64_t " sequences of average length %.2f\n",
-             PRINTuint64_tcast(numofseq),(double) sumlength/numofseq);
+             PRINTuint64_tcast(state.numofseq),
+             (double) state.sumlength/state.numofseq);
     printf("# total length " Formatuint64_t "\n",
-             PRINTuint64_tcast(sumlength));
-    printf("# minimum length "GT_WU"\n",minlength);
-    printf("# maximum length "GT_WU"\n",maxlength);
+             PRINTuint64_tcast(state.sumlength));
+    printf("# minimum length "GT_WU"\n",state.minlength);
+    printf("# maximum length "GT_WU"\n",state.maxlength);
     if (arguments->binarydistlen)
     {
       FILE *distlenoutfile;
@@ -406,8 +568,8 @@ static int gt_seqstat_runner(int argc, const char **argv, int parsed_args,
       gt_disc_distri_foreach(distseqlen, showdistseqlen,
           &(arguments->bucketsize));
     }
-    gt_disc_distri_delete(distseqlen);
   }
+  gt_disc_distri_delete(distseqlen);
   if (!had_err && arguments->docstats)
   {
     GtUword i;
@@ -438,9 +600,9 @@ static int gt_seqstat_runner(int argc, const char **argv, int parsed_args,
     gt_assembly_stats_calculator_delete(asc);
   if (!had_err && arguments->doastretch)
   {
-    processastretches(distastretch,countA);
-    gt_disc_distri_delete(distastretch);
+    processastretches(distastretch,state.countA);
   }
+  gt_disc_distri_delete(distastretch);
   return had_err;
 }
 
@@ -22,12 +22,14 @@
 #include <float.h>
 #include "core/ma_api.h"
 #include "core/minmax_api.h"
+#include "core/range_api.h"
 #include "core/str_api.h"
 #include "core/types_api.h"
 #include "core/unused_api.h"
 #include "core/encseq.h"
 #include "core/showtime.h"
 #include "core/timer_api.h"
+#include "match/chain2dim.h"
 #include "match/ft-polish.h"
 #include "match/seed-extend.h"
 #include "match/seq_or_encseq.h"
@@ -40,15 +42,20 @@ typedef struct
   bool relax_polish,
        sortmatches,
        verify_alignment,
-       optimal_alignment;
-  GtStr *matchfilename;
+       optimal_alignment,
+       binary_index;
+  GtStr *matchfilename, *chainarguments;
   GtStrArray *display_args;
+  GtRange records;
+  GtOption *ref_op_chain, *ref_op_records;
+  GtChain2Dimmode *chainmode;
 } GtShowSeedextArguments;
 
 static void* gt_show_seedext_arguments_new(void)
 {
   GtShowSeedextArguments *arguments = gt_calloc((size_t) 1, sizeof *arguments);
   arguments->matchfilename = gt_str_new();
+  arguments->chainarguments = gt_str_new();
   arguments->display_args = gt_str_array_new();
   return arguments;
 }
@@ -59,6 +66,10 @@ static void gt_show_seedext_arguments_delete(void *tool_arguments)
   if (arguments != NULL) {
     gt_str_array_delete(arguments->display_args);
     gt_str_delete(arguments->matchfilename);
+    gt_str_delete(arguments->chainarguments);
+    gt_option_delete(arguments->ref_op_chain);
+    gt_option_delete(arguments->ref_op_records);
+    gt_chain_chainmode_delete(arguments->chainmode);
     gt_free(arguments);
   }
 }
@@ -68,7 +79,8 @@ static GtOptionParser* gt_show_seedext_option_parser_new(void *tool_arguments)
   GtShowSeedextArguments *arguments = tool_arguments;
   GtOptionParser *op;
   GtOption *option_filename, *op_relax_polish, *op_sortmatches, *op_display,
-           *op_verify_alignment, *op_optimal_alignment;
+           *op_verify_alignment, *op_optimal_alignment, *op_chain, *op_index,
+           *op_records;
 
   gt_assert(arguments);
   /* init */
@@ -112,6 +124,46 @@ static GtOptionParser* gt_show_seedext_option_parser_new(void *tool_arguments)
   gt_option_parser_add_option(op, op_optimal_alignment);
   gt_option_is_development_option(op_optimal_alignment);
 
+  /* -chain */
+  op_chain = gt_option_new_string("chain",
+                                  "apply local chaining to the matches of "
+                                  "each pair of sequences and strand and "
+                                  "show the chains; the optional argument "
+                                  "selects the chains as for option -local "
+                                  "of gt chain2dim",
+                                  arguments->chainarguments,"");
+  gt_option_argument_is_optional(op_chain);
+  gt_option_parser_add_option(op, op_chain);
+  arguments->ref_op_chain = gt_option_ref(op_chain);
+  gt_option_exclude(op_chain, op_sortmatches);
+  gt_option_exclude(op_chain, op_optimal_alignment);
+
+  /* -index */
+  op_index = gt_option_new_bool("index",
+                                "write the index of a binary match file, "
+                                "which gives the offset of each record, to "
+                                "the file with the same name and suffix "
+                                GT_SEEDEXTEND_BINARY_INDEX_SUFFIX,
+                                &arguments->binary_index,false);
+  gt_option_parser_add_option(op, op_index);
+  gt_option_exclude(op_index, op_display);
+  gt_option_exclude(op_index, op_sortmatches);
+  gt_option_exclude(op_index, op_chain);
+  gt_option_exclude(op_index, op_optimal_alignment);
+
+  /* -records */
+  op_records = gt_option_new_range("records",
+                                   "show the matches in the given range of "
+                                   "record numbers of an indexed binary match "
+                                   "file, which are read from the mapped "
+                                   "file; numbering starts with 0",
+                                   &arguments->records,NULL);
+  gt_option_parser_add_option(op, op_records);
+  arguments->ref_op_records = gt_option_ref(op_records);
+  gt_option_exclude(op_records, op_sortmatches);
+  gt_option_exclude(op_records, op_chain);
+  gt_option_exclude(op_records, op_index);
+
   /* -f */
   option_filename = gt_option_new_filename("f",
                                           "path to file with match coordinates",
@@ -137,6 +189,19 @@ static int gt_show_seedext_arguments_check(GT_UNUSED int rest_argc,
     gt_error_set(err,"option -f requires a file name");
     had_err = -1;
   }
+  if (!had_err && gt_option_is_set(arguments->ref_op_chain))
+  {
+    const char *localargs = gt_str_length(arguments->chainarguments) > 0
+                              ? gt_str_get(arguments->chainarguments)
+                              : NULL;
+
+    arguments->chainmode = gt_chain_chainmode_new(GT_UWORD_MAX,false,NULL,
+                                                  true,localargs,err);
+    if (arguments->chainmode == NULL)
+    {
+      had_err = -1;
+    }
+  }
   return had_err;
 }
 
@@ -187,6 +252,198 @@ void gt_querymatch_optimal_alignment(const GtQuerymatch *querymatchptr,
   }
 }
 
+typedef struct
+{
+  GtUword dbseqnum, queryseqnum, querystart, matchnum;
+  GtReadmode query_readmode;
+} GtShowSeedextChainkey;
+
+/* order the matches by sequence pair and strand, which are chained
+   independently, and then by their start on the query, which is the order
+   in which the matches are chained */
+static int gt_show_seedext_chainkey_compare(const void *va,const void *vb)
+{
+  const GtShowSeedextChainkey *a = (const GtShowSeedextChainkey *) va;
+  const GtShowSeedextChainkey *b = (const GtShowSeedextChainkey *) vb;
+
+  if (a->dbseqnum != b->dbseqnum)
+  {
+    return a->dbseqnum < b->dbseqnum ? -1 : 1;
+  }
+  if (a->queryseqnum != b->queryseqnum)
+  {
+    return a->queryseqnum < b->queryseqnum ? -1 : 1;
+  }
+  if (a->query_readmode != b->query_readmode)
+  {
+    return a->query_readmode < b->query_readmode ? -1 : 1;
+  }
+  if (a->querystart != b->querystart)
+  {
+    return a->querystart < b->querystart ? -1 : 1;
+  }
+  return a->matchnum < b->matchnum ? -1 : 1;
+}
+
+typedef struct
+{
+  const GtSeedextendMatchIterator *semi;
+  const GtShowSeedextChainkey *chainkeys; /* of the chained matches */
+  const GtSeedExtendDisplayFlag *out_display_flag;
+  const GtKarlinAltschulStat *karlin_altschul_stat;
+  bool match_has_seed;
+} GtShowSeedextChaininfo;
+
+static void gt_show_seedext_chain_out(void *data,
+                                      GT_UNUSED const GtChain2Dimmatchtable
+                                        *matchtable,
+                                      const GtChain2Dim *chain)
+{
+  const GtShowSeedextChaininfo *chaininfo
+    = (const GtShowSeedextChaininfo *) data;
+  const GtUword chainlength = gt_chain_chainlength(chain);
+  GtUword idx;
+
+  printf("# chain of length " GT_WU " with score " GT_WD "\n",
+         chainlength,gt_chain_chainscore(chain));
+  gt_assert(!gt_chain_storedinreverseorder(chain));
+  for (idx = 0; idx < chainlength; idx++)
+  {
+    const GtUword matchnum
+      = chaininfo->chainkeys[gt_chain_chainelem_index(chain,idx)].matchnum;
+    GtQuerymatch *querymatchptr
+      = gt_seedextend_match_iterator_get(chaininfo->semi,matchnum);
+
+    /* the edit operations of the stored matches are not available, so the
+       alignments are recomputed */
+    gt_querymatch_recompute_alignment(querymatchptr,
+                                      chaininfo->out_display_flag,
+                                      false,
+                                      false,
+                                      0,
+                                      chaininfo->match_has_seed,
+                                      gt_seedextend_match_iterator_aencseq(
+                                        chaininfo->semi),
+                                      gt_seedextend_match_iterator_bencseq(
+                                        chaininfo->semi),
+                                      chaininfo->karlin_altschul_stat,
+                                      DBL_MAX,
+                                      DBL_MAX);
+  }
+}
+
+/* chains the matches of each pair of sequences and strand and shows the
+   chained matches according to <out_display_flag> */
+static int gt_show_seedext_chain(GtSeedextendMatchIterator *semi,
+                                 const GtChain2Dimmode *chainmode,
+                                 const GtSeedExtendDisplayFlag
+                                   *out_display_flag,
+                                 const GtKarlinAltschulStat
+                                   *karlin_altschul_stat,
+                                 GtError *err)
+{
+  const unsigned int presortdim = 1U;
+  GtUword nummatches, numgroups = 0, idx, groupstart, groupend;
+  GtShowSeedextChainkey *chainkeys;
+  GtChain2Dimmatchtable **matchtables;
+  GtShowSeedextChaininfo *chaininfos;
+  void **cpinfos;
+  GtChain2Dim *chain;
+  int had_err;
+
+  nummatches = gt_seedextend_match_iterator_all_sorted(semi,true,err);
+  if (gt_error_is_set(err))
+  {
+    return -1;
+  }
+  chainkeys = gt_malloc(sizeof *chainkeys * (nummatches + 1));
+  for (idx = 0; idx < nummatches; idx++)
+  {
+    const GtQuerymatch *querymatchptr
+      = gt_seedextend_match_iterator_get(semi,idx);
+    GtUword seqstart, seqlen;
+
+    gt_querymatch_db_coordinates(&chainkeys[idx].dbseqnum,&seqstart,&seqlen,
+                                 querymatchptr);
+    gt_querymatch_query_coordinates(&chainkeys[idx].queryseqnum,&seqstart,
+                                    &seqlen,querymatchptr);
+    chainkeys[idx].query_readmode = gt_querymatch_query_readmode(querymatchptr);
+    chainkeys[idx].querystart = gt_querymatch_querystart(querymatchptr);
+    chainkeys[idx].matchnum = idx;
+  }
+  qsort(chainkeys,(size_t) nummatches,sizeof *chainkeys,
+        gt_show_seedext_chainkey_compare);
+  matchtables = gt_malloc(sizeof *matchtables * (nummatches + 1));
+  chaininfos = gt_malloc(sizeof *chaininfos * (nummatches + 1));
+  cpinfos = gt_malloc(sizeof *cpinfos * (nummatches + 1));
+  for (groupstart = 0; groupstart < nummatches; groupstart = groupend)
+  {
+    GtChain2Dimmatchtable *matchtable;
+
+    for (groupend = groupstart + 1;
+         groupend < nummatches &&
+         chainkeys[groupend].dbseqnum == chainkeys[groupstart].dbseqnum &&
+         chainkeys[groupend].queryseqnum == chainkeys[groupstart].queryseqnum &&
+         chainkeys[groupend].query_readmode
+           == chainkeys[groupstart].query_readmode;
+         groupend++)
+    {
+      /* Nothing */ ;
+    }
+    /* the matches are added in the order of their start on the query, so
+       the table is not sorted again and the indices of the chain elements
+       refer to the matches of the group */
+    matchtable = gt_chain_matchtable_new(groupend - groupstart);
+    for (idx = groupstart; idx < groupend; idx++)
+    {
+      const GtQuerymatch *querymatchptr
+        = gt_seedextend_match_iterator_get(semi,chainkeys[idx].matchnum);
+      GtChain2Dimmatchvalues inmatch;
+
+      inmatch.startpos[0] = gt_querymatch_dbstart_relative(querymatchptr);
+      inmatch.endpos[0] = inmatch.startpos[0] +
+                          gt_querymatch_dblen(querymatchptr) - 1;
+      inmatch.startpos[1] = chainkeys[idx].querystart;
+      inmatch.endpos[1] = inmatch.startpos[1] +
+                          gt_querymatch_querylen(querymatchptr) - 1;
+      inmatch.weight = gt_querymatch_score(querymatchptr);
+      gt_chain_matchtable_add(matchtable,&inmatch);
+    }
+    gt_chain_fillthegapvalues(matchtable);
+    matchtables[numgroups] = matchtable;
+    chaininfos[numgroups].semi = semi;
+    chaininfos[numgroups].chainkeys = chainkeys + groupstart;
+    chaininfos[numgroups].out_display_flag = out_display_flag;
+    chaininfos[numgroups].karlin_altschul_stat = karlin_altschul_stat;
+    chaininfos[numgroups].match_has_seed
+      = gt_seedextend_match_iterator_has_seed(semi);
+    cpinfos[numgroups] = chaininfos + numgroups;
+    numgroups++;
+  }
+  chain = gt_chain_chain_new();
+  had_err = gt_chain_fastchaining_multi(chainmode,
+                                        chain,
+                                        matchtables,
+                                        numgroups,
+                                        true,
+                                        presortdim,
+                                        true,
+                                        gt_show_seedext_chain_out,
+                                        cpinfos,
+                                        NULL,
+                                        err);
+  gt_chain_chain_delete(chain);
+  for (idx = 0; idx < numgroups; idx++)
+  {
+    gt_chain_matchtable_delete(matchtables[idx]);
+  }
+  gt_free(matchtables);
+  gt_free(chaininfos);
+  gt_free(cpinfos);
+  gt_free(chainkeys);
+  return had_err;
+}
+
 static int gt_show_seedext_runner(GT_UNUSED int argc,
                                   GT_UNUSED const char **argv,
                                   GT_UNUSED int parsed_args,
@@ -227,6 +484,12 @@ static int gt_show_seedext_runner(GT_UNUSED int argc,
   {
     had_err = true;
   }
+  if (!had_err && gt_querymatch_binary_display(out_display_flag))
+  {
+    gt_error_set(err,"argument \"binary\" of option -outfmt is only "
+                     "supported by gt seed_extend");
+    had_err = -1;
+  }
   if (!had_err)
   {
     if (arguments->optimal_alignment)
@@ -247,8 +510,12 @@ static int gt_show_seedext_runner(GT_UNUSED int argc,
       had_err = -1;
     }
   }
+  if (!had_err && arguments->binary_index)
+  {
+    had_err = gt_seedextend_match_iterator_binary_index_write(semi,err);
+  }
   /* Parse seed extensions. */
-  if (!had_err)
+  if (!had_err && !arguments->binary_index)
   {
     printf("%s\n",gt_seedextend_match_iterator_Options_line(semi));
     aencseq = gt_seedextend_match_iterator_aencseq(semi);
@@ -295,9 +562,11 @@ static int gt_show_seedext_runner(GT_UNUSED int argc,
       }
     }
   }
-  if (!had_err)
+  if (!had_err && !arguments->binary_index)
   {
     GtKarlinAltschulStat *karlin_altschul_stat = NULL;
+    const bool show_records = gt_option_is_set(arguments->ref_op_records);
+    GtUword recordnum = arguments->records.start;
     const bool match_has_cigar = gt_seedextend_match_iterator_has_cigar(semi),
                match_has_seed = gt_seedextend_match_iterator_has_seed(semi),
                dtrace = gt_seedextend_match_iterator_dtrace(semi);
@@ -311,18 +580,53 @@ static int gt_show_seedext_runner(GT_UNUSED int argc,
                                        gt_encseq_num_of_sequences(aencseq),
                                        bencseq);
     }
-    if (arguments->sortmatches)
+    if (arguments->chainmode != NULL)
+    {
+      had_err = gt_show_seedext_chain(semi,arguments->chainmode,
+                                      out_display_flag,karlin_altschul_stat,
+                                      err);
+    }
+    if (!had_err && show_records)
     {
-      (void) gt_seedextend_match_iterator_all_sorted(semi,true);
+      GtUword numofrecords = 0;
+
+      had_err = gt_seedextend_match_iterator_binary_index_map(semi,
+                                                              &numofrecords,
+                                                              err);
+      if (!had_err && arguments->records.end >= numofrecords)
+      {
+        gt_error_set(err,"range of option -records exceeds the number of "
+                         "records, which is " GT_WU,numofrecords);
+        had_err = -1;
+      }
+    }
+    if (!had_err && arguments->sortmatches)
+    {
+      (void) gt_seedextend_match_iterator_all_sorted(semi,true,err);
+      if (gt_error_is_set(err))
+      {
+        had_err = -1;
+      }
     }
-    while (true)
+    /* with option -chain, the matches are shown as part of the chains */
+    while (!had_err && arguments->chainmode == NULL)
     {
-      GtQuerymatch *querymatchptr = gt_seedextend_match_iterator_next(semi);
+      GtQuerymatch *querymatchptr
+        = !show_records
+            ? gt_seedextend_match_iterator_next(semi,err)
+            : (recordnum <= arguments->records.end
+                 ? gt_seedextend_match_iterator_binary_at(semi,recordnum++,
+                                                          err)
+                 : NULL);
       const double evalue = gt_seedextend_match_iterator_evalue(semi),
                    bitscore = gt_seedextend_match_iterator_bitscore(semi);
 
       if (querymatchptr == NULL)
       {
+        if (gt_error_is_set(err))
+        {
+          had_err = -1;
+        }
         break;
       }
       gt_querymatch_recompute_alignment(querymatchptr,
@@ -38,6 +38,23 @@ Test do
   end
 end
 
+Name "gt chain2dim multiple matchfiles"
+Keywords "gt_chain2dim multi"
+Test do
+  matchfiles = ["#{$testdata}ecolicmp250.of",
+                "#{$testdata}chaindata/matches-nd.txt"]
+  ["-global", "-global gc", "-global ov", "-local 2b"].each do |args|
+    run "rm -f expected"
+    matchfiles.each do |matchfile|
+      run "echo '# matchfile #{matchfile}' >> expected"
+      run_test "#{$bin}gt chain2dim -m #{matchfile} " + args
+      run "cat #{last_stdout} >> expected"
+    end
+    run_test "#{$bin}gt -j 2 chain2dim -m #{matchfiles.join(" ")} " + args
+    run "cmp #{last_stdout} expected"
+  end
+end
+
 runchain2dimfailure("-maxgap 0")
 runchain2dimfailure("-maxgap -1")
 runchain2dimfailure("-wf 0.0")
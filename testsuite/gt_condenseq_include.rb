@@ -91,6 +91,35 @@ opt_arr.each do |opt|
   end
 end
 
+Name "gt condenseq compress + extract batch"
+Keywords "gt_condenseq compress extract batch"
+Test do
+  ["-diagonals yes", "-diagonals no", "-full_diags yes"].each do |opt|
+    files.each_pair do |file, info|
+      basename = File.basename(file)
+      run_test "#{$bin}gt encseq encode -clipdesc -indexname #{basename} " \
+        "-md5 no #{file}"
+      run_test "#{$bin}gt encseq decode -output fasta " \
+        "#{basename} > #{basename}.fas"
+      ["1", "4"].each do |jobs|
+        run_test "#{$bin}gt -j #{jobs} condenseq compress #{opt} -batch 8 " \
+          "-indexname #{basename}_nr_j#{jobs} " \
+          "-cutoff 0 " \
+          "-alignlength #{info[0]} " \
+          "#{info[3] > 0 ? "-windowsize #{info[3]}" : ""} " \
+          "#{info[4] > 0 ? "-kmersize #{info[4]}" : ""} " \
+          "#{basename} ",
+          :maxtime => 600
+        run_test "#{$bin}gt condenseq extract " \
+          "#{basename}_nr_j#{jobs} > #{basename}_ext_j#{jobs}.fas"
+        run "diff #{basename}.fas #{basename}_ext_j#{jobs}.fas"
+      end
+      run "cmp #{basename}_nr_j1.cse #{basename}_nr_j4.cse"
+      run "cmp #{basename}_nr_j1.fas #{basename}_nr_j4.fas"
+    end
+  end
+end
+
 makeblastdb = system("which makeblastdb")
 if makeblastdb
   makeblastdb = $?
@@ -154,6 +183,67 @@ opt_arr.each do |opt|
   end
 end
 
+Name "gt condenseq compress + search seedextend"
+Keywords "gt_condenseq compress search seedextend"
+Test do
+  searchfiles.each_pair do |file, info|
+    basename = File.basename(file)
+    queries = "#{File.join(File.dirname(file), File.basename(file,'.fas'))}" \
+              "_queries_300_2x"
+    run_test "#{$bin}gt encseq encode -clipdesc -indexname #{basename} " \
+      "-md5 no " \
+      "#{file}"
+    run_test "#{$bin}gt condenseq compress " \
+      "-indexname #{basename}_nr " \
+      "-cutoff 0 " \
+      "-alignlength #{info[0]} " \
+      "#{info[4] > 0 ? "-kmersize #{info[4]}" : ""} " \
+      "#{basename}",
+      :maxtime => 600
+    run_test "#{$bin}gt condenseq search seedextend " \
+      "-query #{queries}.fas -db #{basename}_nr", :maxtime => 600
+    hits = last_stdout
+    run_ruby "#$scriptsdir/condenseq_blastsearch_stats.rb " \
+      "#{queries}_blastn_result #{hits}"
+    grep(last_stdout, /^## TP: [1-9]+[0-9]*$/)
+    grep(last_stdout, /^## FP: 0$/)
+    run_test "#{$bin}gt -j 2 condenseq search seedextend " \
+      "-query #{queries}.fas -db #{basename}_nr", :maxtime => 600
+    run "diff #{last_stdout} #{hits}"
+    run_test "#{$bin}gt -j 2 condenseq search seedextend -cachesize 0 " \
+      "-query #{queries}.fas -db #{basename}_nr", :maxtime => 600
+    run "diff #{last_stdout} #{hits}"
+  end
+end
+
+Name "gt condenseq extract parallel"
+Keywords "gt_condenseq extract"
+Test do
+  files.each_pair do |file, info|
+    basename = File.basename(file)
+    run_test "#{$bin}gt encseq encode -clipdesc -indexname #{basename} " \
+      "-md5 no #{file}"
+    run_test "#{$bin}gt encseq decode -output fasta " \
+      "#{basename} > #{basename}.fas"
+    run_test "#{$bin}gt condenseq compress " \
+      "-indexname #{basename}_nr " \
+      "-cutoff 0 " \
+      "-alignlength #{info[0]} " \
+      "#{info[3] > 0 ? "-windowsize #{info[3]}" : ""} " \
+      "#{info[4] > 0 ? "-kmersize #{info[4]}" : ""} " \
+      "#{basename}",
+      :maxtime => 600
+    run_test "#{$bin}gt -j 4 condenseq extract #{basename}_nr " \
+      "> #{basename}_ext.fas"
+    run "diff #{basename}.fas #{basename}_ext.fas"
+    run_test "#{$bin}gt -j 3 condenseq extract -seqrange 1 3 -width 20 " \
+      "#{basename}_nr > #{basename}_ext_j3.fas"
+    run_test "#{$bin}gt condenseq extract -seqrange 1 3 -width 20 " \
+      "#{basename}_nr > #{basename}_ext_j1.fas"
+    run "diff #{basename}_ext_j1.fas #{basename}_ext_j3.fas"
+  end
+end
+
 opt_arr.each do |opt|
   range_ext = Proc.new do |file, info|
     basename = File.basename(file)
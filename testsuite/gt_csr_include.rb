@@ -86,6 +86,26 @@ Test do
   end
 end
 
+Name "gt hcr sampling parallel"
+Keywords "gt_csr hcr sampling"
+Test do
+  hcr_testcases.each do |testcase|
+    run_test "#$bin/gt -j 1 compreads compress -descs #{testcase} " \
+             "-files #$testdata/#{hcr_testfiles[0]} -name test_j1"
+    run_test "#$bin/gt -j 4 compreads compress -descs #{testcase} " \
+             "-files #$testdata/#{hcr_testfiles[0]} -name test_j4"
+    run_test "cmp test_j1.hcr test_j4.hcr"
+    run_test "cmp test_j1.ede test_j4.ede"
+    run_test "#$bin/gt -j 4 compreads decompress -descs -file test_j4"
+    run_test "diff test_j4.fastq #$testdata/#{hcr_testfiles[0]}"
+    # reads 10 to 57 are the lines 41 to 232
+    run_test "#$bin/gt -j 4 compreads decompress -descs -file test_j4 " \
+             "-range 10 57 -name range"
+    `sed -n '41,232p' #$testdata/#{hcr_testfiles[0]} > original`
+    run_test "diff range.fastq original"
+  end
+end
+
 
 rcr_testfiles = {
   "rcr_testreads_on_seq.bam" => "rcr_testseq.fa",
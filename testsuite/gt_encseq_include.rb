@@ -86,6 +86,41 @@ Test do
   run "diff #{last_stdout} #{$testdata}dust.window32.out"
 end
 
+# writes the ranges masked by dust, i.e. the wildcards in <masked> which are
+# not wildcards in <plain>, to <file>
+def dust_masked_ranges(plain, masked, file)
+  start = nil
+  masked.length.times do |i|
+    if masked[i] == "n" && plain[i] != "n"
+      start = i if start.nil?
+    elsif !start.nil?
+      file.puts "#{start} #{i - 1}"
+      start = nil
+    end
+  end
+  file.puts "#{start} #{masked.length - 1}" unless start.nil?
+end
+
+Name "gt encseq encode with dust masking (several settings)"
+Keywords "encseq gt_encseq_encode dust"
+Test do
+  run "#{$bin}gt encseq encode -indexname plain #{$testdata}at100K1"
+  run "#{$bin}gt encseq decode -output concat plain"
+  plain = File.read(last_stdout)
+  File.open("dust.ranges", "w") do |file|
+    ["", "-dustwindow 16", "-dustwindow 128", "-dustthreshold 1",
+     "-dustthreshold 3", "-dustlink 0", "-dustlink 10",
+     "-dustwindow 32 -dustthreshold 1.5 -dustlink 3"].each do |opts|
+      run "#{$bin}gt encseq encode -dust #{opts} -indexname masked " +
+          "#{$testdata}at100K1"
+      run "#{$bin}gt encseq decode -output concat masked"
+      file.puts "# -dust #{opts}".strip
+      dust_masked_ranges(plain, File.read(last_stdout), file)
+    end
+  end
+  run "diff dust.ranges #{$testdata}dust.at100K1.out"
+end
+
 STDREADMODES  = ["fwd", "rev"]
 DNAREADMODES  = STDREADMODES + ["cpl", "rcl"]
 DNATESTSEQS   = ["#{$testdata}foobar.fas",
@@ -445,6 +480,19 @@ end
   end
 end
 
+Name "gt encseq MD5 multithreaded"
+Keywords "gt_encseq encseq md5 threads"
+Test do
+  fastafiles.each do |fn|
+    run "#{$bin}gt -j 4 encseq encode -indexname idx #{$testdata}/#{fn}"
+    run "#{$bin}gt encseq encode -indexname idx1 #{$testdata}/#{fn}"
+    run "cmp idx.md5 idx1.md5"
+    run_test "#{$bin}gt encseq md5 -force -o out1 idx"
+    run_test "#{$bin}gt -j 4 encseq md5 -force -fromindex no -o out2 idx"
+    run "diff out1 out2"
+  end
+end
+
 Name "gt encseq MD5 index w/o MD5 support"
 Keywords "encseq gt_encseq md5"
 Test do
@@ -474,3 +522,91 @@ Test do
     end
   end
 end
+
+Name "gt encseq bench range extraction"
+Keywords "encseq gt_encseq_bench"
+Test do
+  ["direct", "bit", "uchar", "ushort", "uint32"].each do |sat|
+    run_test "#{$bin}gt encseq encode -sat #{sat} -indexname at1MB.#{sat} " +
+             "#{$testdata}at1MB"
+    [1, 31, 1000].each do |rangelen|
+      run_test "#{$bin}gt encseq bench -rangeext 500 -rangelen #{rangelen} " +
+               "at1MB.#{sat}"
+    end
+  end
+end
+
+Name "gt encseq bench seqnum index"
+Keywords "encseq gt_encseq_bench seqnumindex"
+Test do
+  ["at1MB", "U89959_ests.fas", "Atinsert.fna"].each do |file|
+    run_test "#{$bin}gt encseq encode -indexname #{file} #{$testdata}#{file}"
+    run_test "#{$bin}gt encseq bench -seqnumext 10000 #{file}"
+  end
+end
+
+Name "gt encseq decode multithreaded"
+Keywords "encseq gt_encseq_decode threads"
+Test do
+  run_test "#{$bin}gt encseq encode -indexname at1MB #{$testdata}at1MB"
+  ["fwd", "rev", "cpl", "rcl"].each do |dir|
+    run_test "#{$bin}gt encseq decode -singlechars -dir #{dir} at1MB"
+    run "mv #{last_stdout} singlechars.fas"
+    [1, 4].each do |jobs|
+      run_test "#{$bin}gt -j #{jobs} encseq decode -dir #{dir} at1MB"
+      run "diff #{last_stdout} singlechars.fas"
+    end
+  end
+  run_test "#{$bin}gt -j 4 encseq decode -seqrange 100 1500 at1MB"
+  run "mv #{last_stdout} seqrange.fas"
+  run_test "#{$bin}gt encseq decode -singlechars -seqrange 100 1500 at1MB"
+  run "diff #{last_stdout} seqrange.fas"
+end
+
+Name "gt encseq encode|decode qualities"
+Keywords "encseq gt_encseq_encode gt_encseq_decode qualities fastq"
+Test do
+  ["test1.fastq", "fastq_long.fastq", "test10_multiline.fastq",
+   "csr_testcase.fastq"].each do |file|
+    run_test "#{$bin}gt encseq encode -qualities -indexname #{file} " + \
+             "#{$testdata}#{file}"
+    [1, 4].each do |jobs|
+      run_test "#{$bin}gt -j #{jobs} encseq decode -output fastq #{file}"
+      run "mv #{last_stdout} #{file}.#{jobs}.out"
+    end
+    run "diff #{file}.1.out #{file}.4.out"
+  end
+end
+
+Name "gt encseq encode|decode qualities (compare with input)"
+Keywords "encseq gt_encseq_encode gt_encseq_decode qualities fastq"
+Test do
+  run_test "#{$bin}gt encseq encode -qualities -lossless " + \
+           "-indexname fastq_long #{$testdata}fastq_long.fastq"
+  run "awk 'NR%4!=3' #{$testdata}fastq_long.fastq > fastq_long.ref"
+  run_test "#{$bin}gt -j 2 encseq decode -lossless -output fastq fastq_long"
+  run "awk 'NR%4!=3' #{last_stdout} | diff - fastq_long.ref"
+  run_test "#{$bin}gt encseq decode -lossless -output fastq " + \
+           "-seqrange 3 5 fastq_long"
+  run "awk 'NR%4!=3' #{last_stdout} > seqrange.out"
+  run "sed -n '10,18p' fastq_long.ref | diff - seqrange.out"
+end
+
+Name "gt encseq encode qualities (FASTA input)"
+Keywords "encseq gt_encseq_encode qualities fastq"
+Test do
+  run_test "#{$bin}gt encseq encode -qualities -indexname foo " + \
+           "#{$testdata}Atinsert.fna", :retval => 1
+  grep last_stderr, /qualities can only be read from FASTQ files/
+  run "test ! -e foo.qlt"
+end
+
+Name "gt encseq decode qualities (missing table)"
+Keywords "encseq gt_encseq_decode qualities fastq"
+Test do
+  run_test "#{$bin}gt encseq encode -indexname foo #{$testdata}test1.fastq"
+  run_test "#{$bin}gt encseq decode -output fastq foo", :retval => 1
+  grep last_stderr, /foo.qlt/
+  run_test "#{$bin}gt encseq decode -output fastq -dir rev foo", :retval => 1
+  grep last_stderr, /forward read mode/
+end
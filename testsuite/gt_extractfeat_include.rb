@@ -1,4 +1,21 @@
 require "fileutils"
+require "zlib"
+
+# writes <data> to <filename> as BGZF, i.e. as a sequence of gzip blocks with
+# the block size in the extra field, followed by an empty end-of-file block
+def write_bgzf(filename, data)
+  File.open(filename, "wb") do |f|
+    (data.scan(/.{1,65280}/m) + [""]).each do |chunk|
+      deflate = Zlib::Deflate.new(Zlib::DEFAULT_COMPRESSION, -Zlib::MAX_WBITS)
+      cdata = deflate.deflate(chunk, Zlib::FINISH)
+      deflate.close
+      f.write([31, 139, 8, 4, 0, 0, 255, 6, "BC", 2, cdata.length + 25].
+              pack("C4VCCva2vv"))
+      f.write(cdata)
+      f.write([Zlib.crc32(chunk), chunk.length].pack("VV"))
+    end
+  end
+end
 
 Name "gt extractfeat -seqfile test 1"
 Keywords "gt_extractfeat"
@@ -165,6 +182,43 @@ Test do
   run "diff #{last_stdout} #{$testdata}U89959_cds.fas"
 end
 
+Name "gt extractfeat -translate (BGZF compressed)"
+Keywords "gt_extractfeat bgzf"
+Test do
+  FileUtils.copy "#{$testdata}U89959_genomic.fas", "."
+  run "#{$bin}gt extractseq -width 50 -gzip -bgzf -o U89959_genomic.fas.gz " \
+      "U89959_genomic.fas"
+  # the first run creates the index files, the second one uses them
+  2.times do
+    run "#{$bin}gt extractfeat -seqfile U89959_genomic.fas.gz " \
+        "-matchdesc -type CDS -join -translate #{$testdata}U89959_cds.gff3"
+    run "diff #{last_stdout} #{$testdata}U89959_cds.fas"
+    run "test -f U89959_genomic.fas.gz.fai"
+    run "test -f U89959_genomic.fas.gz.gzi"
+    run "test ! -f U89959_genomic.fas.gz.esq"
+  end
+end
+
+Name "gt extractfeat -translate (BGZF compressed, uneven lines)"
+Keywords "gt_extractfeat bgzf"
+Test do
+  # lines of different length cannot be indexed, the file is read completely
+  lines = File.readlines("#{$testdata}U89959_genomic.fas")
+  seq = lines[1..-1].join.delete("\n")
+  seqlines = []
+  pos = 0
+  while pos < seq.length
+    width = seqlines.length.even? ? 60 : 70
+    seqlines.push(seq[pos, width])
+    pos += width
+  end
+  write_bgzf("U89959_uneven.fas.gz", lines[0] + seqlines.join("\n") + "\n")
+  run "#{$bin}gt extractfeat -seqfile U89959_uneven.fas.gz " \
+      "-matchdesc -type CDS -join -translate #{$testdata}U89959_cds.gff3"
+  run "diff #{last_stdout} #{$testdata}U89959_cds.fas"
+  run "test ! -f U89959_uneven.fas.gz.fai"
+end
+
 Name "gt extractfeat -translate -gcode"
 Keywords "gt_extractfeat gcode"
 Test do
@@ -98,3 +98,68 @@ Test do
            "U89959_ests.fas", :retval => 1
   grep last_stderr, /could not find sequence with fingerprint/
 end
+
+Name "fingerprint -digest xxh64 (same classes as md5)"
+Keywords "gt_fingerprint"
+Test do
+  FileUtils.copy "#{$testdata}U89959_ests.fas", "."
+  run_test "#{$bin}gt -j 4 fingerprint -digest xxh64 U89959_ests.fas"
+  run "mv #{last_stdout} xxh64.out"
+  run "#{$bin}gt fingerprint U89959_ests.fas > md5.out"
+  # both digests partition the sequences into the same classes
+  run "paste md5.out xxh64.out | sort -u | wc -l > pairs.count"
+  run "sort -u md5.out | wc -l > md5.count"
+  run "sort -u xxh64.out | wc -l > xxh64.count"
+  run "diff pairs.count md5.count"
+  run "diff pairs.count xxh64.count"
+end
+
+Name "fingerprint -digest xxh64 (case insensitive)"
+Keywords "gt_fingerprint"
+Test do
+  FileUtils.copy "#{$testdata}U89959_ests_gi_8690080_soft_masked.fas", "."
+  run_test("#{$bin}gt fingerprint -digest xxh64 " +
+           "U89959_ests_gi_8690080_soft_masked.fas")
+  grep last_stdout, /^5bdd59842c445220$/
+end
+
+Name "fingerprint -digest xxh64 -check"
+Keywords "gt_fingerprint"
+Test do
+  FileUtils.copy "#{$testdata}U89959_ests.fas", "."
+  run "#{$bin}gt fingerprint -digest xxh64 U89959_ests.fas > checklist"
+  run_test "#{$bin}gt fingerprint -digest xxh64 -check checklist " +
+           "U89959_ests.fas"
+  run_test("#{$bin}gt fingerprint -check checklist U89959_ests.fas",
+           :retval => 1)
+  grep last_stderr, /fingerprint comparison failed/
+end
+
+Name "fingerprint -digest xxh64 -duplicates"
+Keywords "gt_fingerprint"
+Test do
+  FileUtils.copy "#{$testdata}U89959_ests.fas", "."
+  run_test("#{$bin}gt fingerprint -digest xxh64 -duplicates U89959_ests.fas",
+           :retval => 1)
+  grep last_stderr, /duplicates found/
+  FileUtils.copy "#{$testdata}U89959_genomic.fas", "."
+  run_test "#{$bin}gt fingerprint -digest xxh64 -duplicates U89959_genomic.fas"
+end
+
+Name "fingerprint -digest xxh64 -extract"
+Keywords "gt_fingerprint"
+Test do
+  FileUtils.copy "#{$testdata}U89959_ests.fas", "."
+  run_test "#{$bin}gt fingerprint -digest xxh64 -extract ee9560f9db3c3f7f " +
+           "U89959_ests.fas"
+  run "diff #{last_stdout} #{$testdata}gt_fingerprint_extract.out"
+end
+
+Name "fingerprint -digest xxh64 -collisions"
+Keywords "gt_fingerprint"
+Test do
+  FileUtils.copy "#{$testdata}U89959_ests.fas", "."
+  run_test("#{$bin}gt fingerprint -digest xxh64 -collisions U89959_ests.fas",
+           :retval => 1)
+  grep last_stderr, /requires '-digest md5'/
+end
@@ -1049,6 +1049,37 @@ Test do
   run_test "#{$bin}gt gff3 out.gff3.bz2 | diff #{$testdata}dynbuf.gff3 -"
 end
 
+Name "gt gff3 compressed input read ahead (-j 4)"
+Keywords "gt_gff3 gzip bzip2"
+Test do
+  run_test "#{$bin}gt gff3 #{$testdata}encode_known_genes_Mar07.gff3"
+  run "mv #{last_stdout} expected.gff3"
+  run "gzip -c #{$testdata}encode_known_genes_Mar07.gff3 > in.gff3.gz"
+  run "bzip2 -c #{$testdata}encode_known_genes_Mar07.gff3 > in.gff3.bz2"
+  ["gz", "bz2"].each do |suffix|
+    run_test "#{$bin}gt -j 4 gff3 in.gff3.#{suffix}"
+    run "diff #{last_stdout} expected.gff3"
+  end
+end
+
+Name "gt gff3 compressed output (-gzip, -bgzf)"
+Keywords "gt_gff3 gzip bgzf"
+Test do
+  run_test "#{$bin}gt gff3 #{$testdata}encode_known_genes_Mar07.gff3"
+  run "mv #{last_stdout} expected.gff3"
+  run_test "#{$bin}gt -j 4 gff3 -gzip -o out.gff3.gz " +
+           "#{$testdata}encode_known_genes_Mar07.gff3"
+  run "gzip -dc out.gff3.gz | diff - expected.gff3"
+  run_test "#{$bin}gt -j 4 gff3 -gzip -bgzf -o out_bgzf.gff3.gz " +
+           "#{$testdata}encode_known_genes_Mar07.gff3"
+  run "gzip -dc out_bgzf.gff3.gz | diff - expected.gff3"
+  run_test "#{$bin}gt -j 4 gff3 out_bgzf.gff3.gz"
+  run "diff #{last_stdout} expected.gff3"
+  run_test "#{$bin}gt gff3 -bgzf -o out.gff3.gz " +
+           "#{$testdata}encode_known_genes_Mar07.gff3", :retval => 1
+  grep last_stderr, /requires option "-gzip"/
+end
+
 Name "custom_stream (C)"
 Keywords "gt_gff3 examples"
 Test do
@@ -1623,3 +1654,38 @@ if $gttestdata then
     run      "diff #{last_stdout} #{$gttestdata}gff3testruns/ensembl.gff3"
   end
 end
+
+Name "gt dev gff3bench"
+Keywords "gt_gff3 gt_gff3bench"
+Test do
+  run_test "#{$bin}gt gff3 #{$testdata}standard_gene_as_dag.gff3"
+  run "mv #{last_stdout} reference.gff3"
+  [0, 64, 262144].each do |blocksize|
+    run_test "#{$bin}gt dev gff3bench -blocksize #{blocksize} " +
+             "#{$testdata}standard_gene_as_dag.gff3"
+    grep last_stdout, /^# writing: /
+    run "grep -v '^# [a-z]*: ' #{last_stdout} | diff - reference.gff3"
+  end
+end
+
+Name "gt gff3 -twopass"
+Keywords "gt_gff3 twopass"
+Test do
+  ["standard_gene_as_dag.gff3", "encode_known_genes_Mar07.gff3",
+   "multi_feature_simple_reverted.gff3", "multi_feature_orphan_succ.gff3",
+   "gt_gff3_prob_7.unsorted", "unsorted_gff3_file.txt"].each do |file|
+    ["", "-checkids", "-tidy"].each do |opt|
+      run_test "#{$bin}gt gff3 #{opt} #{$testdata}#{file}"
+      run "mv #{last_stdout} onepass.gff3"
+      run_test "#{$bin}gt gff3 -twopass #{opt} #{$testdata}#{file}"
+      run "diff #{last_stdout} onepass.gff3"
+    end
+  end
+end
+
+Name "gt gff3 -twopass (fail)"
+Keywords "gt_gff3 twopass"
+Test do
+  run_test("#{$bin}gt gff3 -twopass #{$testdata}multi_feature_orphan_fail.gff3",
+           :retval => 1)
+end
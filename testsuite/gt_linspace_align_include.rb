@@ -159,6 +159,49 @@ Test do
   run "diff -i #{last_stdout} #{$testdata}gt_linspace_align_global_affine_special_cases.out"
 end
 
+Name "gt linspace_align striped kernels"
+Keywords "gt_linspace_align striped"
+Test do
+  ["-l 0 1 1", "-l 0 3 2", "-a 0 2 3 1", "-a 1 3 4 1"].each do |costs|
+    run_test "#{$bin}gt dev linspace_align -ff #{$testdata}Atinsert.fna "\
+             "#{$testdata}Atinsert.fna -dna -global #{costs} -showscore "\
+             "-kernel scalar", :maxtime => 120
+    temp = last_stdout
+    ["sse4.1", "avx2"].each do |kernel|
+      run_test "#{$bin}gt dev linspace_align -ff #{$testdata}Atinsert.fna "\
+               "#{$testdata}Atinsert.fna -dna -global #{costs} -showscore "\
+               "-kernel #{kernel}", :maxtime => 120
+      run "diff #{last_stdout} #{temp}"
+    end
+  end
+end
+
+Name "gt linspace_align batch scores"
+Keywords "gt_linspace_align batch"
+Test do
+  ["-global -l 0 1 1", "-global -a 0 2 3 1", "-local -l 2 \" -2\" \" -1\"",
+   "-local -a 6 \" -2\" \" -5\" \" -1\""].each do |costs|
+    run_test "#{$bin}gt dev linspace_align -ff #{$testdata}Reads1.fna "\
+             "#{$testdata}Reads2.fna -dna #{costs} -showscore", :maxtime => 120
+    run "grep -E '^(distance|score):' #{last_stdout} > scores_ref"
+    ["scalar", "sse4.1", "avx2"].each do |kernel|
+      run_test "#{$bin}gt dev linspace_align -ff #{$testdata}Reads1.fna "\
+               "#{$testdata}Reads2.fna -dna #{costs} -showonlyscore "\
+               "-kernel #{kernel}", :maxtime => 120
+      run "grep -E '^(distance|score):' #{last_stdout} > scores_batch"
+      run "diff scores_batch scores_ref"
+    end
+  end
+end
+
+Name "gt linspace_align benchmark"
+Keywords "gt_linspace_align striped"
+Test do
+  run_test "#{$bin}gt dev linspace_align -ff #{$testdata}Ecoli-section1.fna "\
+           "#{$testdata}Ecoli-section2.fna -dna -global -a 0 2 3 1 -benchmark"
+  grep last_stdout, "cell updates per second"
+end
+
 Name "gt linspace_align all checkfun with gt_paircmp (dna)"
 Keywords "gt_linspace_align"
 Test do
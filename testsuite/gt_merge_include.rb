@@ -24,6 +24,26 @@ Test do
   run "diff #{last_stdout} #{$testdata}gt_merge_prob_2.out"
 end
 
+Name "gt merge test 4 (multiple threads)"
+Keywords "gt_merge"
+Test do
+  run_test "#{$bin}gt -j 4 merge #{$testdata}gt_merge_prob_2.in1 #{$testdata}gt_merge_prob_2.in2"
+  run "diff #{last_stdout} #{$testdata}gt_merge_prob_2.out"
+  run_test "#{$bin}gt -j 4 merge -retainids #{$testdata}encode_known_genes_Mar07.gff3 " \
+           "#{$testdata}standard_gene_as_tree.gff3 #{$testdata}U89959_csas.gff3"
+  run "mv #{last_stdout} merged_j4.gff3"
+  run_test "#{$bin}gt merge -retainids #{$testdata}encode_known_genes_Mar07.gff3 " \
+           "#{$testdata}standard_gene_as_tree.gff3 #{$testdata}U89959_csas.gff3"
+  run "diff #{last_stdout} merged_j4.gff3"
+end
+
+Name "gt merge many unsorted files (multiple threads)"
+Keywords "gt_merge"
+Test do
+  run_test("#{$bin}gt -j 4 merge #{$testdata}/standard_gene_as_tree.gff3 #{$testdata}unsorted_gff3_file.txt #{$testdata}unsorted_gff3_file.txt", :retval => 1)
+  grep(last_stderr, "is not sorted")
+end
+
 Name "gt merge unsorted file"
 Keywords "gt_merge"
 Test do
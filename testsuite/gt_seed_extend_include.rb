@@ -374,6 +374,25 @@ Test do
   end
 end
 
+Name "gt seed_extend: threaded extension, same order of matches"
+Keywords "gt_seed_extend thread gt_seed_extend_thread"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  run_test build_encseq("U89959_genomic", "#{$testdata}U89959_genomic.fas")
+  for extend in ["-extendgreedy", "-extendxdrop"] do
+    for args in ["", " -qii U89959_genomic", " -outfmt alignment",
+                 " -use-apos -outfmt evalue bitscore"] do
+      run_test "#{$bin}gt seed_extend -ii at1MB #{extend}#{args} -kmerfile no"
+      run "mv #{last_stdout} sequential.out"
+      for jobs in [2, 5] do
+        run_test "#{$bin}gt -j #{jobs} seed_extend -ii at1MB " +
+                 "#{extend}#{args} -kmerfile no"
+        run "diff -I '^#' sequential.out #{last_stdout}"
+      end
+    end
+  end
+end
+
 # KmerPos and SeedPair verification
 Name "gt seed_extend: small_poly, no extension, verify lists"
 Keywords "gt_seed_extend only-seeds verify debug-kmer debug-seedpair small_poly"
@@ -575,3 +594,136 @@ Test do
     grep last_stdout, /23 418 127 P 24 2 68 35 4 82.98/
   end
 end
+
+Name "gt seed_extend: sequence ids from lazily loaded tables"
+Keywords "gt_seed_extend lazy"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  run_test "#{$bin}gt seed_extend -ii at1MB -l 80 " +
+           "-outfmt 'subject id' 'query id'"
+  grep last_stdout, /^239 1 378 F 228 2 0 395 24 89.72 .*C99932 .*C99931$/
+  run_test "#{$bin}gt -j 4 seed_extend -ii at1MB -l 80 -parts 4 " +
+           "-outfmt 'subject id' 'query id'"
+  grep last_stdout, /^239 1 378 F 228 2 0 395 24 89.72 .*C99932 .*C99931$/
+end
+
+Name "gt seed_extend: background output"
+Keywords "gt_seed_extend background"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  ["cigar", "trace", "dtrace evalue bitscore", "blast",
+   "failed_seed s.seqlen q.seqlen"].each do |outfmt|
+    # with -v the matches are written synchronously between other output
+    run_test "#{$bin}gt seed_extend -ii at1MB -l 20 -v -outfmt #{outfmt}"
+    run "grep -v '^#' #{last_stdout}"
+    run "mv #{last_stdout} sync.out"
+    ["", "-j 4 "].each do |jobs|
+      run_test "#{$bin}gt #{jobs}seed_extend -ii at1MB -l 20 " +
+               "-outfmt #{outfmt}"
+      run "grep -v '^#' #{last_stdout}"
+      run "cmp #{last_stdout} sync.out"
+    end
+  end
+end
+
+Name "gt seed_extend: binary output"
+Keywords "gt_seed_extend binary"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  [["cigar", "cigarX"], ["trace", "dtrace"],
+   ["cigarX evalue bitscore", "blast"], ["", "seed s.seqlen q.seqlen"]].each do |binfmt, outfmt|
+    run_test "#{$bin}gt seed_extend -ii at1MB -l 20 -outfmt #{outfmt}"
+    run "grep -v '^#' #{last_stdout}"
+    run "mv #{last_stdout} text.out"
+    run_test "#{$bin}gt seed_extend -ii at1MB -l 20 -outfmt binary #{binfmt}"
+    run "mv #{last_stdout} matches.bin"
+    run_test "#{$bin}gt -j 4 seed_extend -ii at1MB -l 20 " +
+             "-outfmt binary #{binfmt}"
+    run "cmp #{last_stdout} matches.bin"
+    run_test "#{$bin}gt dev show_seedext -f matches.bin -outfmt #{outfmt}"
+    run "grep -v '^#' #{last_stdout}"
+    run "cmp #{last_stdout} text.out"
+  end
+  run_test "#{$bin}gt seed_extend -ii at1MB -l 40 -minidentity 75"
+  run "mv #{last_stdout} text.out"
+  run_test "#{$bin}gt dev show_seedext -f text.out -chain"
+  run "grep -v '^# Options' #{last_stdout}"
+  run "mv #{last_stdout} chains.out"
+  run_test "#{$bin}gt seed_extend -ii at1MB -l 40 -minidentity 75 " +
+           "-outfmt binary"
+  run "mv #{last_stdout} matches.bin"
+  run_test "#{$bin}gt dev show_seedext -f matches.bin -chain"
+  run "grep -v '^# Options' #{last_stdout}"
+  run "cmp #{last_stdout} chains.out"
+  grep "chains.out", /^# chain of length 2 with score/
+  run_test "#{$bin}gt seed_extend -ii at1MB -outfmt binary -v", :retval => 1
+  grep last_stderr, /argument "binary" of option -outfmt cannot be combined /
+                    /with option -v/
+  run_test "#{$bin}gt seed_extend -ii at1MB -outfmt binary alignment",
+           :retval => 1
+  run_test "#{$bin}gt dev show_seedext -f matches.bin -chain xx", :retval => 1
+  run_test "#{$bin}gt seed_extend -ii at1MB -l 20 -outfmt binary cigar"
+  run "mv #{last_stdout} matches.bin"
+  [8, 100].each do |cut|
+    run "head -c -#{cut} matches.bin > truncated.bin"
+    ["", "-sort", "-chain"].each do |opt|
+      run_test "#{$bin}gt dev show_seedext -f truncated.bin #{opt}",
+               :retval => 1
+      grep last_stderr, /file truncated.bin: incomplete binary match record/
+    end
+  end
+end
+
+Name "gt seed_extend: binary output with index"
+Keywords "gt_seed_extend binary"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  [["cigar", "cigar"], ["", "seed"]].each do |binfmt, outfmt|
+    run_test "#{$bin}gt seed_extend -ii at1MB -l 20 -outfmt #{outfmt}"
+    run "grep -v '^#' #{last_stdout}"
+    run "mv #{last_stdout} text.out"
+    numofmatches = File.readlines("text.out").length
+    run_test "#{$bin}gt seed_extend -ii at1MB -l 20 -outfmt binary #{binfmt}"
+    run "mv #{last_stdout} matches.bin"
+    run_test "#{$bin}gt dev show_seedext -f matches.bin -index"
+    [[0, 0], [3, 7], [0, numofmatches - 1],
+     [numofmatches - 1, numofmatches - 1]].each do |first, last|
+      run_test "#{$bin}gt dev show_seedext -f matches.bin " +
+               "-records #{first} #{last} -outfmt #{outfmt}"
+      run "grep -v '^#' #{last_stdout}"
+      run "mv #{last_stdout} records.out"
+      run "sed -n #{first + 1},#{last + 1}p text.out"
+      run "cmp #{last_stdout} records.out"
+    end
+    run_test "#{$bin}gt dev show_seedext -f matches.bin " +
+             "-records 0 #{numofmatches}", :retval => 1
+    grep last_stderr, /range of option -records exceeds the number of records/
+  end
+  run_test "#{$bin}gt seed_extend -ii at1MB -l 20"
+  run "mv #{last_stdout} matches.txt"
+  run_test "#{$bin}gt dev show_seedext -f matches.txt -index", :retval => 1
+  grep last_stderr, /file matches.txt does not contain binary match records/
+  run "cp matches.bin other.bin"
+  run_test "#{$bin}gt dev show_seedext -f other.bin -records 0 0",
+           :retval => 1
+  grep last_stderr, /other.bin.sxi/
+  run "cp matches.bin.sxi other.bin.sxi"
+  run "head -c -8 matches.bin > other.bin"
+  run_test "#{$bin}gt dev show_seedext -f other.bin -records 0 0",
+           :retval => 1
+  grep last_stderr, /index other.bin.sxi does not belong to file other.bin/
+  run "head -c 16 matches.bin.sxi > other.bin.sxi"
+  run_test "#{$bin}gt dev show_seedext -f other.bin -records 0 0",
+           :retval => 1
+  grep last_stderr, /file other.bin.sxi is not a valid index/
+end
+
+Name "gt seed_extend: lazily loaded table with invalid size"
+Keywords "gt_seed_extend lazy"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  File.truncate("at1MB.sds", 16)
+  run_test "#{$bin}gt seed_extend -ii at1MB -l 80 " +
+           "-outfmt 'subject id' 'query id'", :retval => 1
+  grep last_stderr, /file "at1MB.sds" has an invalid size of 16 bytes/
+end
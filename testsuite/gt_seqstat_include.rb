@@ -91,3 +91,17 @@ Test do
            :retval => 1
   grep(last_stderr, /cannot guess file type/)
 end
+
+Name "gt seqstat encseq"
+Keywords "gt_seqstat encseq threads"
+Test do
+  run_test "#{$bin}gt encseq encode -indexname at1MB #{$testdata}at1MB"
+  ["-distlen", "-astretch", "-contigs -nstats 10 90 --"].each do |opts|
+    run_test "#{$bin}gt seqstat #{opts} #{$testdata}at1MB"
+    run "mv #{last_stdout} fasta.out"
+    [1, 4].each do |jobs|
+      run_test "#{$bin}gt -j #{jobs} seqstat -encseq #{opts} at1MB"
+      run "diff #{last_stdout} fasta.out"
+    end
+  end
+end